@@ -0,0 +1,142 @@
+/***********************************************************************
+    filename:   AsyncLogger.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIAsyncLogger_h_
+#define _CEGUIAsyncLogger_h_
+
+#include "CEGUI/Logger.h"
+#include "CEGUI/ThreadPool.h"
+#include <ctime>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4275)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Logger implementation that writes the log file on a background thread.
+
+    logEvent checks the logging level before doing anything else, then copies
+    the message into a record of a fixed size ring buffer and returns; no
+    formatting or file I/O is done on the calling thread.  Records are claimed
+    with a single atomic add, so any number of threads may log at once without
+    taking a lock.  A writer task on a ThreadPool thread adds the timestamp,
+    formatted at most once per second, and writes the records in the order
+    they were claimed.  If the ring buffer is full, logEvent waits for the
+    writer to make room rather than dropping the message.
+
+    Log entries made before setLogFilename is called are cached, as by
+    DefaultLogger.  Unlike DefaultLogger, entries are filtered by the logging
+    level in effect when they are logged.
+
+    To use it, create an AsyncLogger before creating the CEGUI::System
+    singleton.
+*/
+class CEGUIEXPORT AsyncLogger : public Logger
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param capacity
+        Number of records in the ring buffer.  This is rounded up to a power
+        of two.
+    */
+    AsyncLogger(size_t capacity = 4096);
+
+    //! Destructor.  All logged entries are written before it returns.
+    ~AsyncLogger(void);
+
+    // overridden from Logger
+    void logEvent(const String& message, LoggingLevel level = Standard);
+    void setLogFilename(const String& filename, bool append = false);
+
+    /*!
+    \brief
+        Wait until every entry logged before this call has been written to the
+        log file (or cached, if there is no log file yet).
+    */
+    void flush();
+
+    //! Return the number of records in the ring buffer.
+    size_t getCapacity() const;
+
+protected:
+    struct Record;
+    class WriterTask;
+
+    //! write all published records; called on the writer thread.
+    void writeRecords();
+    //! format \a record and write it to the log file, or cache it.
+    void writeRecord(const Record& record);
+    //! make sure a WriterTask will write the records published so far.
+    void scheduleWriter();
+
+    //! the ring buffer.
+    Record* d_records;
+    //! number of records in the ring buffer, a power of two.
+    uint32 d_capacity;
+    //! sequence number of the next record to be claimed by logEvent.
+    volatile uint32 d_claimSequence;
+    //! sequence number of the next record to be written by the writer.
+    volatile uint32 d_writeSequence;
+    //! non-zero while a WriterTask is queued or running.
+    volatile uint32 d_writerScheduled;
+
+    //! pool providing the writer thread.
+    ThreadPool* d_writerPool;
+    //! held by the writer while it writes, and while the log file changes.
+    Mutex d_streamMutex;
+    //! Stream used to implement the logger
+    std::ofstream d_ostream;
+
+    typedef std::vector<std::string
+        CEGUI_VECTOR_ALLOC(std::string)> Cache;
+    //! Used to cache log entries before log file is created.
+    Cache d_cache;
+
+    //! time that d_timestamp was formatted for.
+    std::time_t d_timestampTime;
+    //! formatted date and time of d_timestampTime.
+    char d_timestamp[32];
+    //! Used to build log entry strings on the writer thread.
+    std::string d_line;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIAsyncLogger_h_
@@ -0,0 +1,310 @@
+/***********************************************************************
+    filename:   AsyncResourceLoader.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIAsyncResourceLoader_h_
+#define _CEGUIAsyncResourceLoader_h_
+
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+#include "CEGUI/RefCounted.h"
+#include "CEGUI/ThreadPool.h"
+#include "CEGUI/Texture.h"
+
+#include <deque>
+#include <map>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Tracks a resource load started by the AsyncResourceLoader.
+*/
+class CEGUIEXPORT AsyncLoad :
+    public AllocatedObject<AsyncLoad>
+{
+public:
+    //! Types of resource that may be loaded.
+    enum ResourceType
+    {
+        RT_SCHEME,
+        RT_IMAGESET,
+        RT_FONT,
+        RT_LOOKNFEEL,
+
+        RT_COUNT
+    };
+
+    //! States of a load.
+    enum Status
+    {
+        //! Files are being read and decoded on the worker threads.
+        S_PREPARING,
+        //! Waiting for AsyncResourceLoader::update to create the resource.
+        S_READY,
+        //! The resource was created.
+        S_COMPLETE,
+        //! Creating the resource failed; see getError.
+        S_FAILED
+    };
+
+    //! Return the type of resource being loaded.
+    ResourceType getType() const;
+    //! Return the name of the file being loaded.
+    const String& getFilename() const;
+    //! Return the resource group given for the file being loaded.
+    const String& getResourceGroup() const;
+    //! Return the current state of the load.
+    Status getStatus() const;
+    //! Return whether the load has completed, successfully or not.
+    bool isComplete() const;
+    //! Return the error message for a failed load.
+    const String& getError() const;
+
+    /*!
+    \brief
+        Return the number of files that were read and decoded on worker
+        threads.  This is final once the load has completed.
+    */
+    size_t getPreparedFileCount() const;
+
+    /*!
+    \brief
+        Return the number of prepared files that were used to create the
+        resources, rather than being read again.  This is final once the load
+        has completed.
+    */
+    size_t getUsedFileCount() const;
+
+private:
+    friend class AsyncResourceLoader;
+
+    typedef std::vector<String CEGUI_VECTOR_ALLOC(String)> ErrorList;
+
+    AsyncLoad(ResourceType type, const String& filename,
+              const String& resource_group);
+
+    // not copyable
+    AsyncLoad(const AsyncLoad&);
+    AsyncLoad& operator=(const AsyncLoad&);
+
+    const ResourceType d_type;
+    const String d_filename;
+    const String d_resourceGroup;
+    //! default resource group of each resource type when the load started.
+    String d_defaultGroups[RT_COUNT];
+
+    //! guards the status and counters shared with the worker threads.
+    mutable Mutex d_mutex;
+    Status d_status;
+    String d_error;
+    //! worker tasks yet to finish.
+    size_t d_pendingTasks;
+    size_t d_preparedFiles;
+    size_t d_usedFiles;
+    //! why files could not be prepared, to be logged on the main thread.
+    ErrorList d_prepareErrors;
+};
+
+//! Handle to an AsyncLoad.  Handles may only be copied on the main thread.
+typedef RefCounted<AsyncLoad> AsyncLoadHandle;
+
+/*!
+\brief
+    Loads schemes, imagesets, fonts and looknfeels with the reading, parsing
+    and image decoding done on a pool of worker threads.
+
+    Each load first reads the XML file and every file it refers to - the
+    files of the imagesets, fonts and looknfeels of a scheme, the texture
+    images of the imagesets - on the worker threads, parses the XML and decodes
+    the images.  The resources are then created on the thread that owns the
+    renderer, by calling update, using the usual loading functions;
+    XMLParser::parseXMLFile and ImageManager take the prepared data from here
+    rather than reading and decoding the files again.  Any file that could not
+    be prepared is loaded as usual at that point, so errors are reported in
+    the same way as for a synchronous load.  The reason a file could not be
+    prepared is logged as a warning by update, on the calling thread.
+
+\note
+    The ResourceProvider, XMLParser and ImageCodec in use are called from
+    several threads at once and must support that.  Exceptions they throw on
+    the worker threads are not logged there, but anything they log directly
+    needs a thread safe Logger, such as AsyncLogger.
+*/
+class CEGUIEXPORT AsyncResourceLoader :
+    public Singleton<AsyncResourceLoader>,
+    public AllocatedObject<AsyncResourceLoader>
+{
+public:
+    /*!
+    \brief
+        Constructor.  This must be called on the thread that owns the
+        renderer, once System has been created.
+
+    \param thread_count
+        Number of worker threads, or 0 for one per processor.
+    */
+    AsyncResourceLoader(size_t thread_count = 0);
+
+    /*!
+    \brief
+        Destructor.  Work already queued is finished, but loads that have not
+        completed are marked as failed.
+    */
+    ~AsyncResourceLoader();
+
+    //! Start loading the scheme file \a filename.
+    AsyncLoadHandle loadScheme(const String& filename,
+                               const String& resource_group = "");
+    //! Start loading the imageset file \a filename.
+    AsyncLoadHandle loadImageset(const String& filename,
+                                 const String& resource_group = "");
+    //! Start loading the font file \a filename.
+    AsyncLoadHandle loadFont(const String& filename,
+                             const String& resource_group = "");
+    //! Start loading the looknfeel file \a filename.
+    AsyncLoadHandle loadLookNFeel(const String& filename,
+                                  const String& resource_group = "");
+
+    /*!
+    \brief
+        Create the resources of the prepared loads.  Loads complete in the
+        order they were started, so this stops at the first load that is
+        still being prepared.  This must be called regularly on the thread
+        that owns the renderer, such as once per frame.
+
+    \return
+        The number of loads that completed.
+    */
+    size_t update();
+
+    //! Block until \a load has completed.
+    void wait(const AsyncLoadHandle& load);
+    //! Block until every load has completed.
+    void waitAll();
+
+    //! Return the number of loads that have not completed.
+    size_t getPendingLoadCount() const;
+
+    //! Return the ThreadPool used for the worker threads.
+    ThreadPool& getThreadPool();
+
+    /*!
+    \brief
+        Take the parsed XML events prepared for \a filename in
+        \a resource_group, if there are any.  Used by XMLParser::parseXMLFile.
+
+    \return
+        The recorded events, which the caller must delete with
+        CEGUI_DELETE_AO, or 0.
+    */
+    XMLEventRecorder* takePreparedXML(const String& filename,
+                                      const String& resource_group);
+
+    /*!
+    \brief
+        Create the texture \a name from the image decoded for \a filename in
+        \a resource_group, if there is one.  Used by ImageManager.
+
+    \return
+        The new texture, or 0 if the image was not prepared.
+    */
+    Texture* createPreparedTexture(const String& name, const String& filename,
+                                   const String& resource_group);
+
+private:
+    friend class AsyncPrepareTask;
+    friend class AsyncPrepareXMLTask;
+    friend class AsyncPrepareImageTask;
+    friend class AsyncReferenceCollector;
+
+    struct PreparedXML;
+    struct PreparedImage;
+
+    typedef std::pair<String, String> FileKey;
+    typedef std::map<FileKey, PreparedXML*, std::less<FileKey>
+        CEGUI_MAP_ALLOC(FileKey, PreparedXML*)> PreparedXMLMap;
+    typedef std::map<FileKey, PreparedImage*, std::less<FileKey>
+        CEGUI_MAP_ALLOC(FileKey, PreparedImage*)> PreparedImageMap;
+    typedef std::deque<AsyncLoadHandle> LoadQueue;
+
+    // not copyable
+    AsyncResourceLoader(const AsyncResourceLoader&);
+    AsyncResourceLoader& operator=(const AsyncResourceLoader&);
+
+    AsyncLoadHandle startLoad(AsyncLoad::ResourceType type,
+                              const String& filename,
+                              const String& resource_group);
+    //! create the resource of \a load with the usual loading functions.
+    void createResource(const AsyncLoad& load) const;
+
+    // functions used by the worker tasks
+    void submitXML(AsyncLoad& load, AsyncLoad::ResourceType type,
+                   const String& filename, const String& resource_group);
+    void submitImage(AsyncLoad& load, const String& filename,
+                     const String& resource_group);
+    void taskFinished(AsyncLoad& load);
+    void prepareFailed(AsyncLoad& load, const String& filename,
+                       const String& resource_group, const String& error);
+    void storeXML(AsyncLoad& load, const String& filename,
+                  const String& resource_group, XMLEventRecorder* recorder);
+    void storeImage(AsyncLoad& load, const String& filename,
+                    const String& resource_group, PreparedImage* image);
+
+    //! log the reasons files of \a load could not be prepared.
+    void logPrepareErrors(AsyncLoad& load) const;
+    //! delete the prepared data of \a owner that was not used.
+    void releasePrepared(const AsyncLoad* owner);
+
+    //! guards the prepared data.
+    Mutex d_mutex;
+    PreparedXMLMap d_preparedXML;
+    PreparedImageMap d_preparedImages;
+    //! loads that have not completed, in the order they were started.
+    LoadQueue d_loads;
+    //! schema name of each resource type.
+    String d_schemaNames[AsyncLoad::RT_COUNT];
+    //! whether the renderer supports each texture pixel format.
+    bool d_pixelFormatSupported[Texture::PF_RGBA_DXT5 + 1];
+    //! the worker threads; destroyed first so no task outlives the loader.
+    ThreadPool* d_threadPool;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIAsyncResourceLoader_h_
@@ -56,6 +56,9 @@ public:
     void setAutoScaled(const AutoScaledMode autoscaled);
     void setNativeResolution(const Sizef& native_res);
 
+    //! Return the Texture used by this image.
+    Texture* getTexture() const;
+
     // Implement CEGUI::Image interface
     const String& getName() const;
     const Sizef& getRenderedSize() const;
@@ -64,9 +67,24 @@ public:
                 const Rectf& dest_area,
                 const Rectf* clip_area,
                 const ColourRect& colours) const;
+    bool getPackedGeometry(PackedVertex* vbuff, uint& vertex_count,
+                           Texture*& texture, const Rectf& dest_area,
+                           const Rectf* clip_area,
+                           const ColourRect& colours) const;
     void notifyDisplaySizeChanged(const Sizef& size);
 
 protected:
+    /*!
+    \brief
+        Calculate the clipped area to draw to, aligned to pixels, and the
+        matching texture co-ordinates for rendering into \a dest_area.
+
+    \return
+        false if the image is entirely clipped.
+    */
+    bool getRenderAreas(const Rectf& dest_area, const Rectf* clip_area,
+                        Rectf& final_rect, Rectf& tex_rect) const;
+
     //! name used when the BasicImage was created.
     String d_name;
     //! Texture used by this image.
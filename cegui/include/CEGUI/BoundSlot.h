@@ -131,6 +131,7 @@ private:
     Group d_group;                  //! The group the slot subscription used.
     SubscriberSlot* d_subscriber;   //! The actual slot object.
     Event* d_event;                 //! The event to which the slot was attached
+    uint d_sequence;                //! Order of the subscription in its event
 };
 
 } // End of  CEGUI namespace section
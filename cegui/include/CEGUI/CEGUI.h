@@ -46,6 +46,7 @@
 #include "CEGUI/CoordConverter.h"
 #include "CEGUI/DataContainer.h"
 #include "CEGUI/DefaultLogger.h"
+#include "CEGUI/AsyncLogger.h"
 #include "CEGUI/DefaultRenderedStringParser.h"
 #include "CEGUI/DefaultResourceProvider.h"
 #include "CEGUI/DynamicModule.h"
@@ -75,6 +76,7 @@
 #include "CEGUI/Logger.h"
 #include "CEGUI/MouseCursor.h"
 #include "CEGUI/NamedElement.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/Property.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/PropertySet.h"
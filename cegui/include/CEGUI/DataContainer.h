@@ -53,7 +53,8 @@ public:
 	*/
     RawDataContainer()
       : mData(0),
-        mSize(0)
+        mSize(0),
+        mMapped(false)
     {
     }
 
@@ -76,7 +77,27 @@ public:
 	\param data
         Pointer to the uint8 data buffer.
 	*/
-    void setData(uint8* data) { mData = data; }
+    void setData(uint8* data) { mData = data; mMapped = false; }
+
+	/*!
+	\brief
+		Set the data to a view of a memory mapped file, which is unmapped
+		rather than deleted when the data is released.
+
+	\param data
+		Start of the view, as returned by mmap or MapViewOfFile.
+
+	\param size
+		Size of the view in bytes.
+	*/
+    void setMappedData(uint8* data, size_t size)
+        { mData = data; mSize = size; mMapped = true; }
+
+	/*!
+	\brief
+		Return whether the data is a view of a memory mapped file.
+	*/
+    bool isMapped(void) const { return mMapped; }
 
 	/*!
 	\brief
@@ -118,6 +139,8 @@ private:
 	*************************************************************************/
     uint8* mData;
     size_t mSize;
+    //! whether mData is a mapped view of a file rather than a heap buffer.
+    bool mMapped;
 };
 
 } // End of  CEGUI namespace section
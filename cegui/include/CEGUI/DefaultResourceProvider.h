@@ -49,9 +49,12 @@ public:
 	/*************************************************************************
 		Construction and Destruction
 	*************************************************************************/
-	DefaultResourceProvider() {}
+	DefaultResourceProvider();
 	~DefaultResourceProvider(void) {}
 
+    //! Default value for the minimum size of files that are memory mapped.
+    static const size_t DefaultFileMappingMinimumSize;
+
     /*!
     \brief
         Set the directory associated with a given resource group identifier.
@@ -99,8 +102,44 @@ public:
     */
     void clearResourceGroupDirectory(const String& resourceGroup);
 
+    /*!
+    \brief
+        Set whether files are memory mapped rather than read into a buffer.
+
+        Files are mapped copy-on-write, so pages that are only read - such as
+        those of FreeType fonts, whose data is kept for the lifetime of the
+        font - are shared with every other user of the file, including other
+        processes, rather than each holding a private copy.  Mapping is
+        disabled by default.
+
+    \note
+        A file must not be truncated while it is mapped.
+
+    \param enabled
+        - true to map files of at least the size set with
+          setFileMappingMinimumSize.
+        - false to always read files into a buffer.
+    */
+    void setFileMappingEnabled(bool enabled);
+
+    //! Return whether files are memory mapped.
+    bool isFileMappingEnabled() const;
+
+    /*!
+    \brief
+        Set the size, in bytes, below which files are read into a buffer even
+        when file mapping is enabled, because mapping small files costs more
+        than reading them.
+    */
+    void setFileMappingMinimumSize(size_t size);
+
+    //! Return the size below which files are not memory mapped.
+    size_t getFileMappingMinimumSize() const;
+
     void loadRawDataContainer(const String& filename, RawDataContainer& output, const String& resourceGroup);
     void unloadRawDataContainer(RawDataContainer& data);
+    bool getFileStatus(const String& filename, const String& resourceGroup,
+                       uint64& size, uint64& modifiedTime);
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group);
@@ -116,6 +155,10 @@ protected:
 
     typedef std::map<String, String, StringFastLessCompare> ResourceGroupMap;
     ResourceGroupMap    d_resourceGroups;
+    //! whether large enough files are memory mapped.
+    bool d_fileMappingEnabled;
+    //! size below which files are not memory mapped.
+    size_t d_fileMappingMinimumSize;
 };
 
 } // End of  CEGUI namespace section
@@ -84,6 +84,13 @@ public:
     */
     typedef unsigned int Group;
 
+    /*!
+    \brief
+        Integer that event names are interned as.  All Event objects with the
+        same name have the same ID.
+    */
+    typedef uint32 ID;
+
     /*!
     \brief
         Event::Connection wrapper that automatically disconnects the connection
@@ -148,6 +155,56 @@ public:
         return d_name;
     }
 
+    /*!
+    \brief
+        Return the ID the name of this Event is interned as.
+    */
+    ID getID() const
+    {
+        return d_id;
+    }
+
+    /*!
+    \brief
+        Return whether anything is subscribed to the Event.
+    */
+    bool hasSubscribers() const
+    {
+        return !d_slots.empty();
+    }
+
+    /*!
+    \brief
+        Return the ID that \a name is interned as, interning it first if that
+        was not done before.
+    */
+    static ID internName(const String& name);
+
+    /*!
+    \brief
+        Find the ID that \a name was interned as, without interning it.  This
+        neither builds strings nor searches trees, so it is cheap enough to do
+        each time an event is fired.
+
+    \return
+        - true if \a name was interned, and \a id was set to its ID.
+        - false if \a name was never interned, in which case no Event named
+          \a name was ever created.
+    */
+    static bool findInternedName(const String& name, ID& id);
+
+    /*!
+    \brief
+        Find the ID of the name made by joining \a prefix and \a name with a
+        '/' - as the GlobalEventSet names events - without building that name.
+
+    \return
+        - true if the joined name was interned, and \a id was set to its ID.
+        - false if the joined name was never interned.
+    */
+    static bool findInternedName(const String& prefix, const String& name,
+                                 ID& id);
+
     /*!
     \brief
         Subscribes some function or object to the Event
@@ -203,6 +260,8 @@ public:
 
 protected:
     friend void CEGUI::BoundSlot::disconnect();
+    // friend is so that EventSet can set itself as d_owner.
+    friend class EventSet;
     /*!
     \brief
         Disconnects and removes the given BoundSlot from the collection of bound
@@ -216,16 +275,21 @@ protected:
     void unsubscribe(const BoundSlot& slot);
 
     // Copy constructor and assignment are not allowed for events
-    Event(const Event&) {}
+    Event(const Event&) : d_id(0), d_owner(0), d_nextSequence(0) {}
     Event& operator=(const Event&)
     {
         return *this;
     }
 
-    typedef std::multimap<Group, Connection, std::less<Group>
-        CEGUI_MULTIMAP_ALLOC(Group, Connection)> SlotContainer;
+    //! slots are ordered by group, then in the order they subscribed.
+    typedef std::pair<Group, uint> SlotKey;
+    typedef std::map<SlotKey, Connection, std::less<SlotKey>
+        CEGUI_MAP_ALLOC(SlotKey, Connection)> SlotContainer;
     SlotContainer d_slots;  //!< Collection holding ref-counted bound slots
     const String d_name;    //!< Name of this event
+    const ID d_id;          //!< ID the name of this event is interned as
+    EventSet* d_owner;      //!< EventSet holding this event, or 0
+    uint d_nextSequence;    //!< Sequence number of the next subscription
 };
 
 } // End of  CEGUI namespace section
@@ -320,8 +320,27 @@ public:
     Event* getEventObject(const String& name, bool autoAdd = false);
 
 protected:
+    // friend is so that Event can update d_subscribedMask.
+    friend class Event;
+
     //! Implementation event firing member
     void fireEvent_impl(const String& name, EventArgs& args);
+    /*!
+    \brief
+        Return whether an Event with ID \a id may have subscribers.  When
+        this returns false, firing the event would do nothing.
+    */
+    bool mayHaveSubscribers(Event::ID id) const
+    {
+        return (d_subscribedMask & getSubscribedMaskBit(id)) != 0;
+    }
+    //! Return the bit of d_subscribedMask used for Events with ID \a id.
+    static uint64 getSubscribedMaskBit(Event::ID id)
+    {
+        return static_cast<uint64>(1) << (id & 63);
+    }
+    //! Recalculate d_subscribedMask from the Events in the set.
+    void updateSubscribedMask();
     //! Helper to return the script module pointer or throw.
     ScriptModule* getScriptModule() const;
 
@@ -337,6 +356,11 @@ protected:
     EventMap    d_events;
 
     bool    d_muted;    //!< true if events for this EventSet have been muted.
+    /*!
+        Bit for each Event in the set with subscribers, by the ID of its name
+        modulo 64.  Names sharing a bit only cost a needless lookup.
+    */
+    uint64  d_subscribedMask;
 
 public:
     /*************************************************************************
@@ -137,7 +137,9 @@ protected:
     \brief
         Protected constructor that prevents instantiations (users should employ
         derived exception classes instead) and that is responsible for logging
-        the exception.
+        the exception.  Exceptions constructed on ThreadPool worker threads are
+        not logged, since the Logger need not be thread safe; the code catching
+        them is responsible for reporting them.
 
     \param message
         String object describing the reason for the exception being thrown.
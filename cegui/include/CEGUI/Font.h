@@ -34,6 +34,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/XMLSerializer.h"
 #include "CEGUI/FontGlyph.h"
+#include "CEGUI/FontGlyphTable.h"
 
 #include <map>
 
@@ -98,7 +99,7 @@ public:
         false if it does not contain a mapping for \a cp.
     */
     bool isCodepointAvailable(utf32 cp) const
-    { return (d_cp_map.find(cp) != d_cp_map.end()); }
+    { return d_glyphTable.find(cp) != 0; }
 
     /*!
     \brief
@@ -270,6 +271,16 @@ public:
     */
     float getTextExtent(const String& text, float x_scale = 1.0f) const;
 
+    /*!
+    \brief
+        Return the rendered pixel width of \a char_count characters of \a text,
+        starting at index \a start_char, without copying them out of \a text.
+
+    \see getTextExtent(const String&, float) const
+    */
+    float getTextExtent(const String& text, size_t start_char,
+                        size_t char_count, float x_scale = 1.0f) const;
+
     /*!
     \brief
         Return pixel advance of the specified text when rendered with this Font.
@@ -300,6 +311,16 @@ public:
     */
     float getTextAdvance(const String& text, float x_scale = 1.0f) const;
 
+    /*!
+    \brief
+        Return pixel advance of \a char_count characters of \a text, starting
+        at index \a start_char, without copying them out of \a text.
+
+    \see getTextAdvance(const String&, float) const
+    */
+    float getTextAdvance(const String& text, size_t start_char,
+                         size_t char_count, float x_scale = 1.0f) const;
+
     /*!
     \brief
         Return the index of the closest text character in String \a text
@@ -382,6 +403,15 @@ public:
     static const String& getDefaultResourceGroup()
     { return d_defaultResourceGroup; }
 
+    /*!
+    \brief
+        Return a number that changes whenever the render size of any Font
+        changes.  Cached text layouts can compare this value to find out
+        whether the glyph metrics they were built with are still valid.
+    */
+    static uint getRenderSizeGeneration()
+    { return d_renderSizeGeneration; }
+
     /*!
     \brief
         Writes an xml representation of this Font to \a out_stream.
@@ -452,6 +482,20 @@ protected:
     //! finds FontGlyph in map and returns it, or 0 if none.
     virtual const FontGlyph* findFontGlyph(const utf32 codepoint) const;
 
+    /*!
+    \brief
+        Add, or replace, the FontGlyph for \a codepoint.  This updates both
+        the ordered codepoint map and the glyph lookup table, and so should
+        be used rather than writing to d_cp_map directly.
+
+    \return
+        Reference to the FontGlyph as stored for \a codepoint.
+    */
+    FontGlyph& defineGlyph(const utf32 codepoint, const FontGlyph& glyph);
+
+    //! Remove all glyphs from the codepoint map and the glyph lookup table.
+    void clearGlyphs();
+
     //! Name of this font.
     String d_name;
     //! Type name string for this font (not used internally)
@@ -462,6 +506,8 @@ protected:
     String d_resourceGroup;
     //! Holds default resource group for font loading.
     static String d_defaultResourceGroup;
+    //! Incremented whenever the render size of any Font changes.
+    static uint d_renderSizeGeneration;
 
     //! maximal font ascender (pixels above the baseline)
     float d_ascender;
@@ -502,6 +548,8 @@ protected:
         CEGUI_MAP_ALLOC(utf32, FontGlyph)> CodepointMap;
     //! Contains mappings from code points to Image objects
     mutable CodepointMap d_cp_map;
+    //! Fast lookup of the glyphs held in d_cp_map, used when drawing/measuring.
+    FontGlyphTable d_glyphTable;
 };
 
 
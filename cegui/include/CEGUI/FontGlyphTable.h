@@ -0,0 +1,147 @@
+/***********************************************************************
+    filename:   FontGlyphTable.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIFontGlyphTable_h_
+#define _CEGUIFontGlyphTable_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class FontGlyph;
+
+/*!
+\brief
+    Lookup table mapping codepoints to FontGlyph objects.
+
+    Codepoints in the Basic Multilingual Plane are held in direct-indexed
+    pages of 256 entries, where a page is only allocated once a glyph within
+    it is added.  Codepoints above the BMP are held in an open-addressing
+    hash table using linear probing.  Either way a lookup costs an index or
+    two and no pointer chasing, rather than the tree walk of a std::map.
+
+    The table does not own the FontGlyph objects; it stores pointers to
+    glyphs held elsewhere (the Font's ordered codepoint map), which must
+    remain valid until the glyph is removed via clear().
+*/
+class CEGUIEXPORT FontGlyphTable
+{
+public:
+    //! Constructor.
+    FontGlyphTable();
+    //! Destructor.
+    ~FontGlyphTable();
+
+    /*!
+    \brief
+        Add, or replace, the glyph used for \a codepoint.
+
+    \param codepoint
+        utf32 codepoint that \a glyph is to be returned for.
+
+    \param glyph
+        Pointer to the FontGlyph for \a codepoint.  The table does not take
+        ownership of the glyph.
+    */
+    void insert(utf32 codepoint, FontGlyph* glyph);
+
+    /*!
+    \brief
+        Return the glyph for \a codepoint, or 0 if no glyph has been added
+        for that codepoint.
+    */
+    FontGlyph* find(utf32 codepoint) const
+    {
+        if (codepoint < BMP_CODEPOINT_COUNT)
+        {
+            FontGlyph* const* const page = d_pages[codepoint >> PAGE_SHIFT];
+            return page ? page[codepoint & PAGE_MASK] : 0;
+        }
+
+        return findInHash(codepoint);
+    }
+
+    //! Remove all glyphs from the table and release the storage used.
+    void clear();
+
+    //! Return the number of glyphs held in the table.
+    size_t size() const
+    { return d_count; }
+
+private:
+    static const uint PAGE_SHIFT = 8;
+    static const uint PAGE_SIZE = 1 << PAGE_SHIFT;
+    static const uint PAGE_MASK = PAGE_SIZE - 1;
+    static const uint BMP_CODEPOINT_COUNT = 0x10000;
+    static const uint BMP_PAGE_COUNT = BMP_CODEPOINT_COUNT >> PAGE_SHIFT;
+    //! key used to mark unused slots in the hash (not a valid codepoint).
+    static const utf32 EMPTY_KEY = 0xFFFFFFFF;
+
+    //! hash lookup used for codepoints outside the BMP.
+    FontGlyph* findInHash(utf32 codepoint) const;
+    //! return the hash slot for \a codepoint, either its own or an empty one.
+    size_t findSlot(utf32 codepoint) const;
+    //! grow the hash to \a capacity slots (a power of two) and rehash.
+    void rehash(size_t capacity);
+
+    //! no copying allowed: we own the page storage.
+    FontGlyphTable(const FontGlyphTable&);
+    FontGlyphTable& operator=(const FontGlyphTable&);
+
+    //! direct-indexed pages for the BMP; unused pages are 0.
+    FontGlyph** d_pages[BMP_PAGE_COUNT];
+    typedef std::vector<utf32
+        CEGUI_VECTOR_ALLOC(utf32)> KeyList;
+    typedef std::vector<FontGlyph*
+        CEGUI_VECTOR_ALLOC(FontGlyph*)> GlyphList;
+
+    //! hash keys for codepoints beyond the BMP.
+    KeyList d_hashKeys;
+    //! hash values, parallel to d_hashKeys.
+    GlyphList d_hashGlyphs;
+    //! number of occupied hash slots.
+    size_t d_hashCount;
+    //! total number of glyphs in the table.
+    size_t d_count;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIFontGlyphTable_h_
@@ -40,6 +40,8 @@ class Affector;
 class Animation;
 class AnimationInstance;
 class AnimationManager;
+class AsyncLoad;
+class AsyncResourceLoader;
 class BasicRenderedStringParser;
 class BidiVisualMapping;
 class CentredRenderedString;
@@ -65,7 +67,9 @@ class FontManager;
 class FormattedRenderedString;
 class GeometryBuffer;
 class GlobalEventSet;
+class GlyphAtlas;
 class GUIContext;
+class HitTestIndex;
 class Image;
 class ImageCodec;
 class ImageManager;
@@ -78,9 +82,11 @@ class LinkedEvent;
 class LinkedEventArgs;
 class Logger;
 class MouseCursor;
+class Mutex;
 class NamedElement;
 class NamedElementEventArgs;
 class NativeClipboardProvider;
+struct PackedVertex;
 class Property;
 template<typename T> class PropertyHelper;
 class PropertyReceiver;
@@ -118,6 +124,7 @@ class SystemKeys;
 class Texture;
 class TextureTarget;
 class TextUtils;
+class ThreadPool;
 class UBox;
 class UDim;
 template<typename T> class Vector2;
@@ -132,6 +139,8 @@ class WindowRenderer;
 class WindowRendererModule;
 class WRFactoryRegisterer;
 class XMLAttributes;
+class XMLBinaryCache;
+class XMLEventRecorder;
 class XMLHandler;
 class XMLParser;
 class XMLSerializer;
@@ -49,7 +49,9 @@ namespace CEGUI
     like TTF and PS as well as on bitmap font formats like PCF and FON.
 
     Glyphs are rendered dynamically on demand, so a large font with lots
-    of glyphs won't slow application startup time.
+    of glyphs won't slow application startup time.  The glyph imagery of all
+    FreeType fonts is packed into a shared GlyphAtlas, each glyph being
+    uploaded into its own area of an atlas page as it is rendered.
 */
 class FreeTypeFont : public Font
 {
@@ -115,6 +117,13 @@ public:
     //! return whether the freetype font is rendered anti-aliased.
     void setAntiAliased(const bool anti_alaised);
 
+    /*!
+    \brief
+        Return the GlyphAtlas that holds the glyph imagery of all FreeType
+        fonts, or 0 if no FreeTypeFont currently exists.
+    */
+    static GlyphAtlas* getGlyphAtlas();
+
 protected:
     /*!
     \brief
@@ -133,25 +142,13 @@ protected:
     */
     void drawGlyphToBuffer(argb_t* buffer, uint buf_width) const;
 
-    /*!
-    \brief
-        Return the required texture size required to store imagery for the
-        glyphs from s to e
-    \param s
-        The first glyph in set
-    \param e
-        The last glyph in set
-    */
-    uint getTextureSize(CodepointMap::const_iterator s,
-                        CodepointMap::const_iterator e) const;
-
     //! Register all properties of this class.
     void addFreeTypeFontProperties();
     //! Free all allocated font data.
     void free();
 
     //! initialise FontGlyph for given codepoint.
-    void initialiseFontGlyph(CodepointMap::iterator cp) const;
+    void initialiseFontGlyph(const utf32 codepoint, FontGlyph& glyph) const;
 
     void initialiseGlyphMap();
 
@@ -171,11 +168,6 @@ protected:
     FT_Face d_fontFace;
     //! Font file data
     RawDataContainer d_fontData;
-    //! Type definition for TextureVector.
-    typedef std::vector<Texture*
-        CEGUI_VECTOR_ALLOC(Texture*)> TextureVector;
-    //! Textures that hold the glyph imagery for this font.
-    mutable TextureVector d_glyphTextures;
     typedef std::vector<BasicImage*
         CEGUI_VECTOR_ALLOC(BasicImage*)> ImageVector;
     //! collection of images defined for this font.
@@ -184,6 +184,36 @@ public:
     //! returns whether the window containing the mouse had changed.
     bool updateWindowContainingMouse();
 
+    /*!
+    \brief
+        Set whether a spatial index of window hit-test areas is maintained for
+        this GUIContext.
+
+        When enabled, finding the window at a given point (as is done for
+        every injected mouse input) examines only the windows whose hit-test
+        areas cover that point, rather than walking the whole window
+        hierarchy.  This is worthwhile for hierarchies with a large number of
+        windows, at the cost of some extra work whenever window areas change.
+
+    \param enabled
+        - true to maintain and use the index.
+        - false to use the recursive window walk (the default).
+    */
+    void setHitTestIndexEnabled(const bool enabled);
+
+    //! Return whether the hit-test spatial index is enabled.
+    bool isHitTestIndexEnabled() const;
+
+    /*!
+    \brief
+        Return the hit-test spatial index for this GUIContext, or 0 if it is
+        not enabled.
+
+    \note
+        This is mainly intended for internal use by Window.
+    */
+    HitTestIndex* getHitTestIndex() const;
+
     Window* getInputCaptureWindow() const;
     void setInputCaptureWindow(Window* window);
 
@@ -338,6 +368,9 @@ protected:
 
     Event::ScopedConnection d_areaChangedEventConnection;
     Event::ScopedConnection d_windowDestroyedEventConnection;
+
+    //! spatial index of window hit-test areas, or 0 when not enabled.
+    HitTestIndex* d_hitTestIndex;
 };
 
 }
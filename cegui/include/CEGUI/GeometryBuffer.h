@@ -53,6 +53,38 @@ public:
     */
     virtual void draw() const = 0;
 
+    /*!
+    \brief
+        Return whether \a buffer may be drawn together with this
+        GeometryBuffer by a single call to drawBatched.
+
+        Implementations that support merged drawing will typically require
+        that both buffers are of the same type, share a blend mode, have no
+        RenderEffect and apply no rotation.  The default implementation
+        returns false.
+    */
+    virtual bool isBatchCompatible(const GeometryBuffer& buffer) const;
+
+    /*!
+    \brief
+        Draw a run of GeometryBuffer objects, merging consecutive geometry
+        that shares the same render state into as few draw calls as possible.
+        The result must be the same as calling draw on each buffer in turn.
+
+    \param buffers
+        Pointer to an array of GeometryBuffer pointers.  The first element
+        should be this GeometryBuffer, and every other element must be batch
+        compatible with it (see isBatchCompatible).
+
+    \param buffer_count
+        Number of GeometryBuffer pointers in the array \a buffers.
+
+    \note
+        The default implementation simply draws each buffer in turn.
+    */
+    virtual void drawBatched(const GeometryBuffer* const* buffers,
+                             uint buffer_count) const;
+
     /*!
     \brief
         Set the translation to be applied to the geometry in the buffer when it
@@ -112,6 +144,55 @@ public:
     */
     virtual void appendGeometry(const Vertex* const vbuff, uint vertex_count)=0;
 
+    /*!
+    \brief
+        Append a number of vertices in the compact PackedVertex format to the
+        GeometryBuffer.
+
+        The vertices are treated exactly as if the equivalent Vertex objects,
+        with a z co-ordinate of 0, had been passed to appendGeometry.  The
+        default implementation does that conversion in small blocks;
+        implementations that can draw the packed data directly override this
+        along with isPackedGeometryNative.
+
+    \param vbuff
+        Pointer to an array of PackedVertex objects that describe the vertices
+        that are to be added to the GeometryBuffer.
+
+    \param vertex_count
+        The number of PackedVertex objects from the array \a vbuff that are to
+        be added to the GeometryBuffer.
+    */
+    virtual void appendPackedGeometry(const PackedVertex* const vbuff,
+                                      uint vertex_count);
+
+    /*!
+    \brief
+        Return whether appendPackedGeometry keeps PackedVertex data as it is,
+        rather than expanding it to Vertex objects.
+
+        Code generating 2D geometry checks this to decide which format to
+        produce, since packing vertices only pays off when the GeometryBuffer
+        does not expand them again.  The default implementation returns false.
+    */
+    virtual bool isPackedGeometryNative() const;
+
+    /*!
+    \brief
+        Ensure the GeometryBuffer can hold at least \a vertex_count further
+        vertices without having to grow its internal storage.
+
+        This is a hint only; calling it before appending a known amount of
+        geometry allows implementations to allocate storage once up front
+        rather than repeatedly while the geometry is appended.  The default
+        implementation does nothing.
+
+    \param vertex_count
+        The number of vertices that are expected to be appended in addition
+        to those already held by the GeometryBuffer.
+    */
+    virtual void reserveVertices(uint vertex_count);
+
     /*!
     \brief
         Set the active texture to be used with all subsequently added vertices.
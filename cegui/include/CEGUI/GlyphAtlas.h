@@ -0,0 +1,190 @@
+/***********************************************************************
+    filename:   GlyphAtlas.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIGlyphAtlas_h_
+#define _CEGUIGlyphAtlas_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+#include "CEGUI/Rect.h"
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Packs glyph (or other small image) rectangles into a set of shared
+    texture pages using skyline bin packing.
+
+    Areas are allocated on demand; when no existing page has room a new page
+    is added, each new page being twice the size of the newest existing page
+    up to the renderer's maximum texture size.  Pages are reference counted by the
+    number of areas allocated on them and are destroyed once every area has
+    been released.  Individual areas can not be freed for reuse, so space on a
+    page is only reclaimed when the whole page is released.
+
+    The atlas does not upload any imagery itself; callers write their pixels
+    into the returned area with Texture::blitFromMemory, so adding glyphs to
+    an existing page never re-creates or re-uploads the whole texture.
+*/
+class CEGUIEXPORT GlyphAtlas :
+    public AllocatedObject<GlyphAtlas>
+{
+public:
+    /*!
+    \brief
+        Constructor.
+
+    \param name_prefix
+        Prefix used for the names of the textures created for atlas pages.
+
+    \param initial_page_size
+        Width and height, in pixels, of the first page created.
+
+    \param padding
+        Number of empty pixels kept between, and around, allocated areas.
+    */
+    GlyphAtlas(const String& name_prefix, uint initial_page_size = 256,
+               uint padding = 2);
+
+    //! Destructor.  Destroys all page textures.
+    ~GlyphAtlas();
+
+    /*!
+    \brief
+        Allocate an area of the given size on one of the atlas pages.
+
+    \param width
+        Width of the area required, in pixels.  May be zero.
+
+    \param height
+        Height of the area required, in pixels.  May be zero.
+
+    \param area
+        Rect that receives the pixel area allocated on the returned texture.
+
+    \return
+        Reference to the Texture of the page that the area was allocated on.
+
+    \exception InvalidRequestException
+        thrown if the area can not fit on a texture of the renderer's
+        maximum texture size.
+    */
+    Texture& allocate(uint width, uint height, Rectf& area);
+
+    /*!
+    \brief
+        Release one area previously allocated on the page using \a texture.
+        When the last area of a page is released the page and its texture
+        are destroyed.
+    */
+    void release(const Texture& texture);
+
+    //! Return the number of pages currently in the atlas.
+    size_t getPageCount() const;
+
+    //! Return the texture used for the page at \a index.
+    Texture& getPageTexture(size_t index) const;
+
+    //! Return the number of areas currently allocated on page \a index.
+    uint getPageAllocationCount(size_t index) const;
+
+    /*!
+    \brief
+        Return the fraction (0 to 1) of the page at \a index that is covered
+        by allocated areas, including their padding.
+    */
+    float getPageOccupancy(size_t index) const;
+
+protected:
+    //! One horizontal segment of the skyline.
+    struct SkylineNode
+    {
+        uint x;
+        uint y;
+        uint width;
+    };
+
+    typedef std::vector<SkylineNode
+        CEGUI_VECTOR_ALLOC(SkylineNode)> Skyline;
+
+    //! A single texture page of the atlas.
+    struct Page
+    {
+        Texture* texture;
+        uint size;
+        uint allocationCount;
+        uint usedArea;
+        Skyline skyline;
+    };
+
+    /*!
+    \brief
+        Find the skyline position giving the lowest top edge for an area of
+        \a width x \a height on \a page.
+
+    \return
+        Index of the skyline node the area starts at, or -1 if it does not fit.
+    */
+    int findPosition(const Page& page, uint width, uint height,
+                     uint& x, uint& y) const;
+    //! Insert an area of \a width x \a height at node \a index of the skyline.
+    void addSkylineLevel(Page& page, size_t index, uint x, uint y,
+                         uint width, uint height) const;
+    //! Create a new page of at least \a min_size pixels square.
+    Page* createPage(uint min_size);
+    //! Destroy a page and its texture.
+    void destroyPage(Page* page);
+
+    typedef std::vector<Page*
+        CEGUI_VECTOR_ALLOC(Page*)> PageList;
+
+    //! Prefix used when naming page textures.
+    String d_namePrefix;
+    //! Size of the first page created.
+    uint d_initialPageSize;
+    //! Pixels kept between allocated areas.
+    uint d_padding;
+    //! Counter used to give each page texture a unique name.
+    uint d_pageCounter;
+    //! The pages currently in the atlas.
+    PageList d_pages;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIGlyphAtlas_h_
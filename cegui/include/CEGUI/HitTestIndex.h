@@ -0,0 +1,221 @@
+/***********************************************************************
+    filename:   HitTestIndex.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIHitTestIndex_h_
+#define _CEGUIHitTestIndex_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Vector.h"
+#include "CEGUI/Size.h"
+
+#include <map>
+#include <vector>
+
+#if defined (_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Spatial index over the hit-test areas of the windows attached to a
+    GUIContext, used to answer 'which window is under this point' queries
+    without visiting every window in the hierarchy.
+
+    The index is a uniform grid laid over the GUIContext surface.  Each window
+    is registered in the cells covered by its Window::getHitTestRect, and is
+    kept up to date from Window::notifyScreenAreaChanged and
+    Window::notifyClippingChanged.  A query only examines the windows
+    registered in the cell containing the point, and resolves the result the
+    same way the recursive Window::getTargetChildAtPosition walk does:
+    visibility, disabled state and mouse pass-through are tested at query
+    time, and between candidates the one drawn in front (which honours the
+    'always on top' setting) wins.  Since those states are checked when
+    querying, changing them requires no index maintenance.
+
+    Windows beneath a RenderingWindow that has a rotation applied can not be
+    placed in the grid, since their hit-test areas are not in screen space;
+    such windows are tested on every query, with the point unprojected through
+    each RenderingWindow exactly as the recursive walk would do.
+
+\note
+    The index assumes that Window::isHit can only succeed for points within
+    the window's hit-test rect, which is true for all of the bundled widgets.
+*/
+class CEGUIEXPORT HitTestIndex :
+    public AllocatedObject<HitTestIndex>
+{
+public:
+    //! Default size of the (square) grid cells, in pixels.
+    static const float DefaultCellSize;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param context
+        GUIContext whose window hierarchy is to be indexed.
+
+    \param cell_size
+        Size of the square grid cells, in pixels.
+    */
+    HitTestIndex(const GUIContext& context,
+                 float cell_size = DefaultCellSize);
+
+    //! Destructor.
+    ~HitTestIndex();
+
+    /*!
+    \brief
+        Set the size of the area covered by the grid.  This will cause the
+        index to be rebuilt when it is next queried.
+    */
+    void setSurfaceSize(const Sizef& size);
+
+    //! Set the size of the grid cells, in pixels.  Causes a rebuild.
+    void setCellSize(float cell_size);
+
+    //! Return the size of the grid cells, in pixels.
+    float getCellSize() const;
+
+    /*!
+    \brief
+        Discard the index content, so that it is rebuilt from the root window
+        of the GUIContext when it is next queried.
+    */
+    void invalidate();
+
+    /*!
+    \brief
+        Add or update the entry for \a wnd following a change to its hit-test
+        area.  Windows not attached to the GUIContext root are ignored.
+    */
+    void updateWindow(const Window& wnd);
+
+    //! Remove the entries for \a wnd and all of its descendants.
+    void removeWindow(const Window& wnd);
+
+    /*!
+    \brief
+        Return whether queries starting at \a wnd can be answered by this
+        index; i.e. whether \a wnd is part of the indexed hierarchy.
+    */
+    bool isIndexing(const Window& wnd) const;
+
+    /*!
+    \brief
+        Return the descendant of \a start that would be hit at \a position,
+        giving the same result as Window::getTargetChildAtPosition or
+        Window::getChildAtPosition.
+
+    \param start
+        Window whose descendants are to be considered.
+
+    \param position
+        Screen position to test.
+
+    \param allow_disabled
+        Whether disabled windows may be hit.
+
+    \param honour_pass_through
+        - true to skip windows with mouse pass-through enabled
+          (as Window::getTargetChildAtPosition does).
+        - false to consider all windows (as Window::getChildAtPosition does).
+
+    \return
+        Pointer to the window hit, or 0 if no descendant of \a start is hit.
+    */
+    Window* getChildAtPosition(const Window& start, const Vector2f& position,
+                               const bool allow_disabled,
+                               const bool honour_pass_through) const;
+
+    //! Return the number of windows currently held in the index.
+    size_t getWindowCount() const;
+
+protected:
+    //! details of where a window is held in the index.
+    struct Entry
+    {
+        //! whether the window is in the grid (false => in d_unindexed).
+        bool inGrid;
+        //! first and last (inclusive) columns and rows covered.
+        int x0, y0, x1, y1;
+    };
+
+    typedef std::vector<Window*> WindowList;
+    typedef std::map<const Window*, Entry> EntryMap;
+
+    //! rebuild everything from the root window, if the index is not valid.
+    void rebuildIfRequired() const;
+    //! add entries for \a wnd and all of its descendants.
+    void addWindowRecursive(Window& wnd) const;
+    //! add an entry for \a wnd, which must not already be present.
+    void addWindow(Window& wnd) const;
+    //! remove the content of the given entry from the grid / unindexed list.
+    void eraseEntry(const Window& wnd, const Entry& entry) const;
+    //! return whether \a wnd is beneath a RenderingWindow with rotation.
+    static bool isBeneathRotatedSurface(const Window& wnd);
+    //! unproject \a position from \a start's space to that of \a wnd.
+    static Vector2f localisePoint(const Window& start, const Window& wnd,
+                                  const Vector2f& position);
+    //! test \a wnd as a candidate for a query, updating \a best if needed.
+    static void testCandidate(Window* wnd, const Window& start,
+                              const Vector2f& position,
+                              const bool allow_disabled,
+                              const bool honour_pass_through,
+                              Window*& best);
+
+    //! the GUIContext whose hierarchy we index.
+    const GUIContext& d_context;
+    //! size of the grid cells.
+    float d_cellSize;
+    //! size of the area covered by the grid.
+    Sizef d_surfaceSize;
+    //! number of columns in the grid.
+    mutable int d_columns;
+    //! number of rows in the grid.
+    mutable int d_rows;
+    //! grid cells, in row major order.
+    mutable std::vector<WindowList> d_cells;
+    //! windows that can not be placed in the grid.
+    mutable WindowList d_unindexed;
+    //! where each indexed window is held.
+    mutable EntryMap d_entries;
+    //! false when the index content must be rebuilt before use.
+    mutable bool d_valid;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIHitTestIndex_h_
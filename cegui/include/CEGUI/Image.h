@@ -173,6 +173,33 @@ public:
                         const Rectf* clip_area,
                         const ColourRect& colours) const = 0;
 
+    /*!
+    \brief
+        Write the geometry for rendering the image into \a dest_area to
+        \a vbuff as PackedVertex data rather than appending it to a
+        GeometryBuffer, so that callers drawing many images can append it all
+        at once via GeometryBuffer::appendPackedGeometry.
+
+    \param vbuff
+        Array of at least 6 PackedVertex objects to receive the vertices.
+
+    \param vertex_count
+        Receives the number of vertices written to \a vbuff; 0 if the image
+        is entirely clipped.
+
+    \param texture
+        Receives the Texture the vertices are to be drawn with.
+
+    \return
+        true if the geometry was written.  false if the image can not be
+        expressed this way, in which case render must be used instead; this
+        is what the default implementation returns.
+    */
+    virtual bool getPackedGeometry(PackedVertex* vbuff, uint& vertex_count,
+                                   Texture*& texture, const Rectf& dest_area,
+                                   const Rectf* clip_area,
+                                   const ColourRect& colours) const;
+
     virtual void notifyDisplaySizeChanged(const Sizef& size) = 0;
 
     // Standard Image::render overloads
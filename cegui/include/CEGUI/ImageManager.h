@@ -219,6 +219,9 @@ private:
     void elementImageStart(const XMLAttributes& attributes);
     //! throw exception if file version is not supported.
     void validateImagesetFileVersion(const XMLAttributes& attrs);
+    //! create a texture from an image file, or the prepared pixels of one.
+    Texture* createTextureFromImage(const String& name, const String& filename,
+                                    const String& resource_group);
 
     //! Default resource group specifically for Imagesets.
     static String d_imagesetDefaultResourceGroup;
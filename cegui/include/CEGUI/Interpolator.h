@@ -32,6 +32,7 @@
 
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
+#include "CEGUI/Affector.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -87,6 +88,50 @@ public:
             const String& value1,
             const String& value2,
             float position) = 0;
+
+    /*!
+    \brief
+        Interpolate between the values of key frames \a left and \a right and
+        set the result on \a property of the instance's target, working in the
+        property's native type rather than going through Strings.
+
+        This is tried by Affector::apply before the String based functions
+        above.  The default implementation does nothing and returns false, so
+        interpolators that only implement the String functions keep working.
+
+    \param property
+        The target property, as resolved on AnimationInstance::getTarget.
+
+    \param instance
+        The AnimationInstance being stepped, used to reach the target and any
+        saved property values.
+
+    \param method
+        Application method of the Affector.
+
+    \param left
+        Key frame before (or at) the current animation position.
+
+    \param right
+        Key frame after (or at) the current animation position.
+
+    \param position
+        Interpolation position between \a left and \a right, from 0 to 1.
+
+    \return
+        - true if the interpolated value was set on \a property.
+        - false if \a property is not of a type this interpolator can set
+          natively, in which case the String based functions should be used.
+    */
+    virtual bool interpolateNative(Property& /*property*/,
+                                   AnimationInstance* /*instance*/,
+                                   Affector::ApplicationMethod /*method*/,
+                                   const KeyFrame& /*left*/,
+                                   const KeyFrame& /*right*/,
+                                   float /*position*/)
+    {
+        return false;
+    }
 };
 
 } // End of  CEGUI namespace section
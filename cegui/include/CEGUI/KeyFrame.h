@@ -69,6 +69,24 @@ public:
         P_Discrete
     };
 
+    /*!
+    \brief
+        Base class for a parsed, natively typed copy of a key frame's value.
+
+        Typed interpolators create these the first time a key frame's value
+        String is used and keep them on the KeyFrame, so later animation steps
+        do not need to parse the String again.
+
+    \see
+        KeyFrame::setNativeValue
+    */
+    class CEGUIEXPORT NativeValue :
+        public AllocatedObject<NativeValue>
+    {
+    public:
+        virtual ~NativeValue() {}
+    };
+
     //! internal constructor, please use Affector::createKeyFrame
     KeyFrame(Affector* parent, float position);
 
@@ -208,6 +226,25 @@ public:
 	*/
 	void writeXMLToStream(XMLSerializer& xml_stream) const;
 
+    /*!
+    \brief
+        Internal method, returns the natively typed copy of this key frame's
+        value previously set via setNativeValue, or 0 if there is none.
+
+    \par
+        The cached value is discarded whenever the value or source property
+        of the key frame is changed.
+    */
+    NativeValue* getNativeValue() const;
+
+    /*!
+    \brief
+        Internal method, sets the natively typed copy of this key frame's
+        value. The KeyFrame takes ownership of \a value and any previously
+        set native value is destroyed.
+    */
+    void setNativeValue(NativeValue* value) const;
+
 private:
     //! parent affector
     Affector* d_parent;
@@ -220,6 +257,8 @@ private:
     String d_sourceProperty;
     //! progression method used towards this key frame
     Progression d_progression;
+    //! natively typed copy of d_value, owned by the key frame (may be 0).
+    mutable NativeValue* d_nativeValue;
 };
 
 } // End of  CEGUI namespace section
@@ -67,9 +67,50 @@ public:
     void setArchive(const String& archive);
     void setLoadLocal(bool load = true);
 
+    /*!
+    \brief
+        Set the maximum number of bytes of decompressed archive files kept
+        for reuse.  When the cache is full, the least recently used files are
+        discarded.  The default of 0 disables the cache.
+    */
+    void setCacheSize(size_t bytes);
+
+    //! Return the maximum number of bytes held by the cache.
+    size_t getCacheSize() const;
+
+    //! Return the number of bytes currently held by the cache.
+    size_t getCachedBytes() const;
+
+    //! Discard every file held by the cache.
+    void clearCache();
+
+    /*!
+    \brief
+        Decompress the given archive files on worker threads and add them to
+        the cache, so that loading them later only copies the data.  This
+        does nothing unless the cache has been enabled with setCacheSize.
+
+    \param filenames
+        Names of the files, relative to the directory of \a resource_group.
+
+    \param resource_group
+        Resource group of the files.
+
+    \param thread_count
+        Number of worker threads to use, or 0 for one per processor.
+
+    \return
+        The number of files that were added to the cache.
+    */
+    size_t preloadFiles(const std::vector<String>& filenames,
+                        const String& resource_group = "",
+                        size_t thread_count = 0);
+
     void loadRawDataContainer(const String& filename,
                               RawDataContainer& output,
                               const String& resourceGroup);
+    bool getFileStatus(const String& filename, const String& resourceGroup,
+                       uint64& size, uint64& modifiedTime);
     size_t getResourceGroupFileNames(std::vector<String>& out_vec,
                                      const String& file_pattern,
                                      const String& resource_group);
@@ -0,0 +1,292 @@
+/***********************************************************************
+    filename:   Profiler.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIProfiler_h_
+#define _CEGUIProfiler_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/Singleton.h"
+#include "CEGUI/String.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Records timed zones and per frame counters, so that the time taken by a
+    frame can be attributed to the windows drawn and the input handled.
+
+    When CEGUI is built with CEGUI_HAS_PROFILER, GUIContext drawing and
+    input injection, RenderingSurface drawing and Window geometry generation
+    are recorded as zones, and the counters are updated, via the
+    CEGUI_PROFILE_* macros.  Without it the macros expand to nothing and only
+    zones recorded by the application are seen.
+
+    Nothing is recorded until the Profiler is enabled.  Records are kept in a
+    fixed size ring buffer, overwriting the oldest once it is full.  Zones
+    and counters may be recorded from any thread without taking a lock.
+
+    The records can be written out in the Chrome trace event format, which
+    chrome://tracing and other trace viewers load.
+*/
+class CEGUIEXPORT Profiler :
+    public Singleton<Profiler>,
+    public AllocatedObject<Profiler>
+{
+public:
+    //! Things counted in each frame.
+    enum Counter
+    {
+        //! windows whose geometry was regenerated.
+        C_WINDOWS_REDRAWN,
+        //! vertices generated by those windows.
+        C_VERTICES,
+        //! batches of geometry drawn.
+        C_BATCHES,
+        //! changes of texture from one batch drawn to the next.
+        C_TEXTURE_SWITCHES,
+        //! RenderingSurfaces invalidated.
+        C_SURFACES_INVALIDATED,
+        //! events fired.
+        C_EVENTS_FIRED,
+
+        C_COUNT
+    };
+
+    //! Longest detail kept for a zone, in bytes.
+    static const size_t MAX_DETAIL_LENGTH = 95;
+    //! Number of records kept by default.
+    static const size_t DEFAULT_CAPACITY = 65536;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param capacity
+        Number of records kept.  This is rounded up to a power of two.
+    */
+    Profiler(size_t capacity = DEFAULT_CAPACITY);
+
+    //! Destructor.
+    ~Profiler();
+
+    /*!
+    \brief
+        Start or stop recording.  The records are allocated when recording
+        is first started.  This should be called when no other thread is
+        recording.
+    */
+    void setEnabled(bool enabled);
+
+    //! Return whether recording.
+    bool isEnabled() const
+        { return d_enabled; }
+
+    /*!
+    \brief
+        Discard all records, and reset the counters and the frame number.
+        This should be called when no other thread is recording.
+    */
+    void clear();
+
+    //! Return the time since the Profiler was created, in microseconds.
+    uint64 getTime() const;
+
+    /*!
+    \brief
+        Record a zone.
+
+    \param name
+        Name of the zone.  This is not copied, so must stay valid for the
+        lifetime of the Profiler; normally it is a string literal.
+
+    \param detail
+        Detail about this instance of the zone, such as the window it is
+        for, or 0.  Only the first MAX_DETAIL_LENGTH bytes are kept.
+
+    \param start, end
+        Times the zone started and ended, as returned by getTime.
+    */
+    void recordZone(const char* name, const char* detail,
+                    uint64 start, uint64 end);
+
+    //! Add \a amount to \a counter for the current frame.
+    void count(Counter counter, uint32 amount = 1);
+
+    //! Return the value of \a counter for the current frame so far.
+    uint32 getCount(Counter counter) const;
+
+    //! Return the value of \a counter for the last frame ended.
+    uint32 getLastFrameCount(Counter counter) const;
+
+    /*!
+    \brief
+        End the current frame.  This records a "Frame" zone, from the end of
+        the previous frame, holding the counters, and resets them.
+
+        System::renderAllGUIContexts calls this once it has drawn everything.
+    */
+    void endFrame();
+
+    //! Return the number of frames ended.
+    uint32 getFrameNumber() const;
+
+    //! Return the number of records currently kept.
+    size_t getRecordCount() const;
+
+    //! Return the name \a counter is written out with.
+    static const char* getCounterName(Counter counter);
+
+    //! Write the records to \a out in the Chrome trace event format.
+    void writeChromeTrace(OutStream& out) const;
+
+    //! Write the records to the file \a filename in the Chrome trace format.
+    void writeChromeTrace(const String& filename) const;
+
+private:
+    struct Record;
+
+    //! Return the next record to write to, marked as being written.
+    Record* claimRecord(uint32& index);
+    //! Mark the record \a index as written.
+    void publishRecord(Record& record, uint32 index);
+
+    //! whether recording.
+    bool d_enabled;
+    //! number of records kept.
+    uint32 d_capacity;
+    //! ring buffer of records.
+    std::vector<Record> d_records;
+    //! number of records ever claimed.
+    volatile uint32 d_writeIndex;
+    //! counters for the current frame.
+    volatile uint32 d_counters[C_COUNT];
+    //! counters for the last frame ended.
+    uint32 d_lastFrameCounters[C_COUNT];
+    //! number of frames ended.
+    uint32 d_frameNumber;
+    //! time the current frame started.
+    uint64 d_frameStart;
+    //! platform time the Profiler was created at.
+    uint64 d_baseTime;
+};
+
+/*!
+\brief
+    Records a zone with the Profiler from its construction to its
+    destruction, if the Profiler exists and is enabled when it is
+    constructed.
+*/
+class CEGUIEXPORT ProfileZone
+{
+public:
+    //! Constructor.  \a name must be a string literal.
+    ProfileZone(const char* name) :
+        d_profiler(Profiler::getSingletonPtr()),
+        d_name(name),
+        d_start(0)
+    {
+        if (d_profiler && !d_profiler->isEnabled())
+            d_profiler = 0;
+
+        if (d_profiler)
+        {
+            d_detail[0] = 0;
+            d_start = d_profiler->getTime();
+        }
+    }
+
+    ~ProfileZone()
+    {
+        if (d_profiler)
+            d_profiler->recordZone(d_name, d_detail, d_start,
+                                   d_profiler->getTime());
+    }
+
+    //! Return whether the zone will be recorded.
+    bool isRecording() const
+        { return d_profiler != 0; }
+
+    //! Set the detail recorded with the zone.
+    void setDetail(const String& detail);
+
+private:
+    // not copyable
+    ProfileZone(const ProfileZone&);
+    ProfileZone& operator=(const ProfileZone&);
+
+    Profiler* d_profiler;
+    const char* const d_name;
+    uint64 d_start;
+    char d_detail[Profiler::MAX_DETAIL_LENGTH + 1];
+};
+
+} // End of  CEGUI namespace section
+
+#ifdef CEGUI_HAS_PROFILER
+/*!
+    Record the rest of the enclosing scope as a zone named \a name.
+*/
+#   define CEGUI_PROFILE_ZONE(name) \
+        CEGUI::ProfileZone cegui_profile_zone(name)
+/*!
+    Record the rest of the enclosing scope as a zone named \a name, with the
+    String \a detail.  \a detail is only evaluated when recording.
+*/
+#   define CEGUI_PROFILE_ZONE_DETAIL(name, detail) \
+        CEGUI::ProfileZone cegui_profile_zone(name); \
+        if (cegui_profile_zone.isRecording()) \
+            cegui_profile_zone.setDetail(detail)
+/*!
+    Add \a amount to the Profiler::Counter \a counter.  \a amount is only
+    evaluated when recording.
+*/
+#   define CEGUI_PROFILE_COUNT(counter, amount) \
+        do { \
+            CEGUI::Profiler* const cegui_profiler = \
+                CEGUI::Profiler::getSingletonPtr(); \
+            if (cegui_profiler && cegui_profiler->isEnabled()) \
+                cegui_profiler->count(CEGUI::Profiler::counter, (amount)); \
+        } while (false)
+#else
+#   define CEGUI_PROFILE_ZONE(name)
+#   define CEGUI_PROFILE_ZONE_DETAIL(name, detail)
+#   define CEGUI_PROFILE_COUNT(counter, amount) do {} while (false)
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIProfiler_h_
@@ -41,6 +41,7 @@
 #include "CEGUI/TplWindowProperty.h"
 #include "CEGUI/Exceptions.h"
 #include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -245,6 +246,65 @@ public:
         }
     }
 
+    //! Type of the IDs returned by PropertySet::internPropertyName.
+    typedef uint PropertyID;
+
+    /*!
+    \brief
+        Returns the ID for the property name \a name, interning the name if
+        it has not been seen before.
+
+        IDs are global and remain valid for the lifetime of the application.
+        Code that repeatedly reads the same properties - such as the Falagard
+        rendering components - can intern the names once and use the ID based
+        overloads of getPropertyInstance and getProperty, which avoid looking
+        the name up in the property registry each time.
+
+    \param name
+        String holding the name of the property.
+
+    \return
+        The PropertyID that represents \a name.
+    */
+    static PropertyID internPropertyName(const String& name);
+
+    /*!
+    \brief
+        Returns the property name that was interned as \a id.
+
+    \exception UnknownObjectException  Thrown if \a id was not returned by internPropertyName.
+    */
+    static const String& getInternedPropertyName(PropertyID id);
+
+    /*!
+    \copydoc PropertySet::getPropertyInstance(const String&) const
+
+    The instance found for an ID is cached on the PropertySet, so repeated
+    calls for the same ID do not need to search the property registry.
+    */
+    Property* getPropertyInstance(PropertyID id) const;
+
+    //! \copydoc PropertySet::getProperty(const String&) const
+    String getProperty(PropertyID id) const;
+
+    /*!
+    \copydoc PropertySet::getProperty(const String&) const
+
+    This method tries to do a native type get without string conversion if possible,
+    if that is not possible, it gracefully falls back to string conversion
+    */
+    template<typename T>
+    typename PropertyHelper<T>::safe_method_return_type getProperty(PropertyID id) const
+    {
+        const Property* baseProperty = getPropertyInstance(id);
+        const TypedProperty<T>* typedProperty = dynamic_cast<const TypedProperty<T>* >(baseProperty);
+
+        if (typedProperty)
+            return typedProperty->getNative(this);
+
+        return PropertyHelper<T>::fromString(baseProperty->get(this));
+    }
+
 	/*!
 	\brief
 		Returns whether a Property is at it's default value.
@@ -276,6 +336,23 @@ private:
         CEGUI_MAP_ALLOC(String, Property*)> PropertyRegistry;
 	PropertyRegistry	d_properties;
 
+    //! entry in the cache used by getPropertyInstance(PropertyID)
+    struct PropertyCacheEntry
+    {
+        PropertyCacheEntry() : d_id(0), d_property(0) {}
+
+        PropertyID d_id;
+        Property* d_property;
+    };
+
+    typedef std::vector<PropertyCacheEntry
+        CEGUI_VECTOR_ALLOC(PropertyCacheEntry)> PropertyCache;
+
+    //! number of entries in d_propertyCache, must be a power of two.
+    static const uint PropertyCacheSize = 32;
+    //! direct-mapped ID to Property cache; empty until first used.
+    mutable PropertyCache d_propertyCache;
+
 
 public:
 	/*************************************************************************
@@ -297,6 +297,14 @@ public:
                                                const String& value1,
                                                const String& value2,
                                                float position);
+
+    //! \copydoc Interpolator::interpolateNative
+    virtual bool interpolateNative(Property& property,
+                                   AnimationInstance* instance,
+                                   Affector::ApplicationMethod method,
+                                   const KeyFrame& left,
+                                   const KeyFrame& right,
+                                   float position);
 };
 
 } // End of  CEGUI namespace section
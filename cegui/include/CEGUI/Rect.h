@@ -211,6 +211,32 @@ public:
 	    }
     }
 
+	/*!
+	\brief
+		return the smallest Rect that contains both 'this' Rect and the Rect 'rect'.
+
+	\note
+		A Rect with no width or no height is considered empty, and does not
+		contribute to the result.
+	*/
+	inline Rect getUnion(const Rect& rect) const
+    {
+        if (rect.getWidth() <= 0 || rect.getHeight() <= 0)
+            return *this;
+
+        if (getWidth() <= 0 || getHeight() <= 0)
+            return rect;
+
+        Rect ret;
+
+        ret.d_min.d_x = (d_min.d_x < rect.d_min.d_x) ? d_min.d_x : rect.d_min.d_x;
+        ret.d_max.d_x = (d_max.d_x > rect.d_max.d_x) ? d_max.d_x : rect.d_max.d_x;
+        ret.d_min.d_y = (d_min.d_y < rect.d_min.d_y) ? d_min.d_y : rect.d_min.d_y;
+        ret.d_max.d_y = (d_max.d_y > rect.d_max.d_y) ? d_max.d_y : rect.d_max.d_y;
+
+        return ret;
+    }
+
 	/*!
 	\brief
 		Applies an offset the Rect object
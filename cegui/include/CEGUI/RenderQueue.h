@@ -54,14 +54,32 @@ class CEGUIEXPORT RenderQueue :
     public AllocatedObject<RenderQueue> 
 {
 public:
+    //! Constructor.
+    RenderQueue();
+
     /*!
     \brief
         Draw all GeometryBuffer objects currently listed in the RenderQueue.
         The GeometryBuffer objects remain in the queue after drawing has taken
         place.
+
+        When batching is enabled, each run of consecutive batch compatible
+        GeometryBuffers is drawn with a single call to
+        GeometryBuffer::drawBatched, allowing the renderer to merge their
+        geometry into fewer draw calls.
     */
     void draw() const;
 
+    /*!
+    \brief
+        Set whether consecutive compatible GeometryBuffers are drawn together
+        as merged batches.  Batching is disabled by default.
+    */
+    void setBatchingEnabled(const bool enabled);
+
+    //! Return whether batched drawing is enabled for this RenderQueue.
+    bool isBatchingEnabled() const;
+
     /*!
     \brief
         Add a GeometryBuffer to the RenderQueue.  Ownership of the
@@ -97,6 +115,8 @@ private:
         CEGUI_VECTOR_ALLOC(const GeometryBuffer)> BufferList;
     //! Collection of GeometryBuffer objects that comprise this RenderQueue.
     BufferList d_buffers;
+    //! whether runs of compatible GeometryBuffers are drawn as merged batches.
+    bool d_batchingEnabled;
 };
 
 } // End of  CEGUI namespace section
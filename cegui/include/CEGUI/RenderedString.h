@@ -168,12 +168,24 @@ public:
     //! set selection highlight
     void setSelection(const Window* ref_wnd, float start, float end);
 
+    /*!
+    \brief
+        Return a number identifying the current content of this
+        RenderedString.  The value changes whenever the string is modified and
+        is never shared by two RenderedString objects, so it can be used to
+        validate layouts cached for the string.
+    */
+    uint getRevision() const;
+
     //! Copy constructor.
     RenderedString(const RenderedString& other);
     //! Assignment.
     RenderedString& operator=(const RenderedString& rhs);
 
 protected:
+    // the word wrapper builds its wrapped lines directly over our components.
+    template <typename T> friend class RenderedStringWordWrapper;
+
     //! Collection type used to hold the string components.
     typedef std::vector<RenderedStringComponent*
         CEGUI_VECTOR_ALLOC(RenderedStringComponent*)> ComponentList;
@@ -186,6 +198,13 @@ protected:
         CEGUI_VECTOR_ALLOC(LineInfo)> LineList;
     //! lines that make up this string.
     LineList d_lines;
+    //! number identifying the current content of the string.
+    uint d_revision;
+    //! Last revision number handed out to any RenderedString.
+    static uint d_lastRevision;
+
+    //! Give the string a new revision number after it has been modified.
+    void updateRevision();
     //! Make this object's component list a clone of \a list.
     void cloneComponentList(const ComponentList& list);
     //! Free components in the given ComponentList and clear the list.
@@ -30,6 +30,10 @@
 
 #include "CEGUI/FormattedRenderedString.h"
 #include "CEGUI/JustifiedRenderedString.h"
+#include "CEGUI/RenderedStringComponent.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
 #include "CEGUI/Vector.h"
 #include <vector>
 
@@ -40,6 +44,13 @@ namespace CEGUI
 \brief
     Class that handles wrapping of a rendered string into sub-strings.  Each
     sub-string is rendered using the FormattedRenderedString based class 'T'.
+
+    Wrapping is done in a single pass over the source string.  Components that
+    fit on a line are referenced rather than copied; only components that have
+    to be split across lines are cloned.  The result is kept until the source
+    string, the font and display metrics, the reference window or the width
+    change.  A string that needed no wrapping stays valid for any width that
+    still fits its widest line.
 */
 template <typename T>
 class RenderedStringWordWrapper : public FormattedRenderedString
@@ -60,25 +71,104 @@ public:
     float getVerticalExtent(const Window* ref_wnd) const;
 
 protected:
-    //! Delete the current formatters and associated RenderedStrings
+    //! Delete the current formatters and the wrapped lines
     void deleteFormatters();
+    //! Return whether the current wrapped lines are valid for the given input.
+    bool isWrapValid(const Window* ref_wnd, const float width) const;
+    //! Return whether the source string is the one the lines were built from.
+    bool isSourceUnchanged() const;
+    //! Break the lines of the source string so they fit within \a width.
+    void wrapLines(const Window* ref_wnd, const float width);
+    //! Add a component to the last wrapped line.
+    void appendToLine(RenderedStringComponent* comp);
+    //! End the last wrapped line at a wrap point and start a new one.
+    void breakLine();
+    //! Create the formatters for the wrapped lines.
+    void createFormatters();
+    //! Create a RenderedString referencing wrapped lines [first, end).
+    RenderedString& createLineRun(const size_t first, const size_t end);
+
+    //! details of one line produced by wrapping.
+    struct WrappedLine
+    {
+        //! index of the first component of the line in d_wrappedComponents.
+        size_t first;
+        //! number of components on the line.
+        size_t count;
+        //! true if the line ends at a wrap point rather than a line break.
+        bool wrapped;
+    };
+
     //! type of collection used to track the formatted lines.
     typedef std::vector<FormattedRenderedString*
         CEGUI_VECTOR_ALLOC(FormattedRenderedString*)> LineList;
-    //! collection of lines.
+    //! type of collection used to hold the RenderedStrings given to formatters
+    typedef std::vector<RenderedString*
+        CEGUI_VECTOR_ALLOC(RenderedString*)> RunList;
+    //! type of collection used to hold components.
+    typedef std::vector<RenderedStringComponent*
+        CEGUI_VECTOR_ALLOC(RenderedStringComponent*)> ComponentList;
+    //! type of collection used to hold the wrapped lines.
+    typedef std::vector<WrappedLine
+        CEGUI_VECTOR_ALLOC(WrappedLine)> WrappedLineList;
+
+    //! collection of formatters, one per run of similarly formatted lines.
     LineList d_lines;
+    //! RenderedStrings holding the runs of lines drawn by d_lines.
+    RunList d_runs;
+    //! components of all wrapped lines, in order.
+    ComponentList d_wrappedComponents;
+    //! components created by splitting, which we own.
+    ComponentList d_ownedComponents;
+    //! the wrapped lines.
+    WrappedLineList d_wrappedLines;
+
+    //! whether the wrapped lines are valid for the values below.
+    bool d_wrapValid;
+    //! source string the wrapped lines were built from.
+    const RenderedString* d_wrappedString;
+    //! revision of d_wrappedString the wrapped lines were built from.
+    uint d_wrappedRevision;
+    //! reference window the wrapped lines were built for.
+    const Window* d_wrappedWindow;
+    //! Font render size generation the wrapped lines were built with.
+    uint d_fontGeneration;
+    //! display size the wrapped lines were built with.
+    Sizef d_displaySize;
+    //! width the wrapped lines were built for.
+    float d_wrappedWidth;
+    //! area size the formatters were last formatted for.
+    Sizef d_formattedSize;
+    //! width of the widest line of the source string.
+    float d_widestLine;
+    //! true if any line of the source string did not fit the width.
+    bool d_linesWrapped;
+    //! extents cached at format time.
+    float d_horzExtent;
+    float d_vertExtent;
 };
 
-//! specialised version of format used with Justified text
+//! specialised version of createFormatters used with Justified text
 template <> CEGUIEXPORT
-void RenderedStringWordWrapper<JustifiedRenderedString>::format(const Window* ref_wnd,
-                                                                const Sizef& area_size);
+void RenderedStringWordWrapper<JustifiedRenderedString>::createFormatters();
 
 //----------------------------------------------------------------------------//
 template <typename T>
 RenderedStringWordWrapper<T>::RenderedStringWordWrapper(
         const RenderedString& string) :
-    FormattedRenderedString(string)
+    FormattedRenderedString(string),
+    d_wrapValid(false),
+    d_wrappedString(0),
+    d_wrappedRevision(0),
+    d_wrappedWindow(0),
+    d_fontGeneration(0),
+    d_displaySize(0, 0),
+    d_wrappedWidth(0),
+    d_formattedSize(0, 0),
+    d_widestLine(0),
+    d_linesWrapped(false),
+    d_horzExtent(0),
+    d_vertExtent(0)
 {
 }
 
@@ -94,37 +184,218 @@ template <typename T>
 void RenderedStringWordWrapper<T>::format(const Window* ref_wnd,
                                           const Sizef& area_size)
 {
-    deleteFormatters();
+    if (isWrapValid(ref_wnd, area_size.d_width))
+    {
+        // nothing at all to do when formatting again at the same size
+        if (area_size == d_formattedSize)
+            return;
+    }
+    else
+    {
+        deleteFormatters();
+        wrapLines(ref_wnd, area_size.d_width);
+        createFormatters();
+
+        d_wrapValid = true;
+        d_wrappedString = d_renderedString;
+        d_wrappedRevision = d_renderedString->getRevision();
+        d_wrappedWindow = ref_wnd;
+        d_fontGeneration = Font::getRenderSizeGeneration();
+        d_displaySize = System::getSingleton().getRenderer()->getDisplaySize();
+        d_wrappedWidth = area_size.d_width;
+    }
 
-    RenderedString rstring, lstring;
-    rstring = *d_renderedString;
-    float rs_width;
+    // the formatters themselves may depend on the exact width
+    d_formattedSize = area_size;
+    d_horzExtent = d_vertExtent = 0;
+    typename LineList::const_iterator i = d_lines.begin();
+    for (; i != d_lines.end(); ++i)
+    {
+        (*i)->format(ref_wnd, area_size);
+        d_horzExtent = ceguimax(d_horzExtent, (*i)->getHorizontalExtent(ref_wnd));
+        d_vertExtent += (*i)->getVerticalExtent(ref_wnd);
+    }
+}
+
+//----------------------------------------------------------------------------//
+template <typename T>
+bool RenderedStringWordWrapper<T>::isWrapValid(const Window* ref_wnd,
+                                               const float width) const
+{
+    if (!d_wrapValid || !isSourceUnchanged() ||
+        d_wrappedWindow != ref_wnd ||
+        d_fontGeneration != Font::getRenderSizeGeneration() ||
+        d_displaySize != System::getSingleton().getRenderer()->getDisplaySize())
+        return false;
 
-    T* frs;
+    // Where lines were wrapped, the break positions depend on the exact width
+    // (RenderedStringComponent::split measures word by word), so only text
+    // that needed no wrapping can be reused at a different width.
+    return width == d_wrappedWidth ||
+           (!d_linesWrapped && width >= d_widestLine);
+}
 
-    for (size_t line = 0; line < rstring.getLineCount(); ++line)
+//----------------------------------------------------------------------------//
+template <typename T>
+bool RenderedStringWordWrapper<T>::isSourceUnchanged() const
+{
+    return d_wrappedString == d_renderedString &&
+           d_wrappedRevision == d_renderedString->getRevision();
+}
+
+//----------------------------------------------------------------------------//
+template <typename T>
+void RenderedStringWordWrapper<T>::wrapLines(const Window* ref_wnd,
+                                             const float width)
+{
+    const RenderedString& src = *d_renderedString;
+
+    d_widestLine = 0;
+    d_linesWrapped = false;
+
+    for (size_t line = 0; line < src.d_lines.size(); ++line)
     {
-        while ((rs_width = rstring.getPixelSize(ref_wnd, line).d_width) > 0)
+        const WrappedLine first_line = { d_wrappedComponents.size(), 0, false };
+        d_wrappedLines.push_back(first_line);
+
+        float line_width = 0;
+
+        const size_t end = src.d_lines[line].first + src.d_lines[line].second;
+        for (size_t c = src.d_lines[line].first; c < end; ++c)
         {
-            // skip line if no wrapping occurs
-            if (rs_width <= area_size.d_width)
-                break;
-
-            // split rstring at width into lstring and remaining rstring
-            rstring.split(ref_wnd, line, area_size.d_width, lstring);
-            frs = CEGUI_NEW_AO T(*new RenderedString(lstring));
-            frs->format(ref_wnd, area_size);
-            d_lines.push_back(frs);
-            line = 0;
+            RenderedStringComponent* const comp = src.d_components[c];
+            const float comp_width = comp->getPixelSize(ref_wnd).d_width;
+
+            // whole component fits, reference it as it is.
+            if (line_width + comp_width <= width)
+            {
+                appendToLine(comp);
+                line_width += comp_width;
+                continue;
+            }
+
+            d_linesWrapped = true;
+
+            if (!comp->canSplit())
+            {
+                // move the component to the next line
+                if (d_wrappedLines.back().count)
+                    breakLine();
+
+                appendToLine(comp);
+                line_width = comp_width;
+
+                // and give it a line of its own if it fills the width anyway.
+                if (comp_width >= width)
+                {
+                    breakLine();
+                    line_width = 0;
+                }
+
+                continue;
+            }
+
+            // split a copy of the component over as many lines as needed
+            RenderedStringComponent* piece = comp->clone();
+            d_ownedComponents.push_back(piece);
+            float piece_width = comp_width;
+
+            while (line_width + piece_width > width)
+            {
+                const bool first_on_line = !d_wrappedLines.back().count;
+
+                RenderedStringComponent* const left =
+                    piece->split(ref_wnd, width - line_width, first_on_line);
+                const float left_width =
+                    left ? left->getPixelSize(ref_wnd).d_width : 0.0f;
+
+                if (left_width > 0)
+                {
+                    d_ownedComponents.push_back(left);
+                    appendToLine(left);
+                }
+                else if (left)
+                    CEGUI_DELETE_AO left;
+
+                piece_width = piece->getPixelSize(ref_wnd).d_width;
+
+                // nothing could be split off, let the remainder overflow.
+                if (first_on_line && left_width <= 0)
+                    break;
+
+                breakLine();
+                line_width = 0;
+            }
+
+            appendToLine(piece);
+            line_width += piece_width;
         }
+
+        d_widestLine = ceguimax(d_widestLine, line_width);
+    }
+
+    // a component given a line of its own may leave an empty one behind.
+    if (d_wrappedLines.size() > 1 && !d_wrappedLines.back().count &&
+        d_wrappedLines[d_wrappedLines.size() - 2].wrapped)
+    {
+        d_wrappedLines.pop_back();
+        d_wrappedLines.back().wrapped = false;
     }
+}
 
-    // last line.
-    frs = CEGUI_NEW_AO T(*new RenderedString(rstring));
-    frs->format(ref_wnd, area_size);
+//----------------------------------------------------------------------------//
+template <typename T>
+void RenderedStringWordWrapper<T>::appendToLine(RenderedStringComponent* comp)
+{
+    d_wrappedComponents.push_back(comp);
+    ++d_wrappedLines.back().count;
+}
+
+//----------------------------------------------------------------------------//
+template <typename T>
+void RenderedStringWordWrapper<T>::breakLine()
+{
+    d_wrappedLines.back().wrapped = true;
+
+    const WrappedLine next_line = { d_wrappedComponents.size(), 0, false };
+    d_wrappedLines.push_back(next_line);
+}
+
+//----------------------------------------------------------------------------//
+template <typename T>
+void RenderedStringWordWrapper<T>::createFormatters()
+{
+    T* frs = CEGUI_NEW_AO T(createLineRun(0, d_wrappedLines.size()));
     d_lines.push_back(frs);
 }
 
+//----------------------------------------------------------------------------//
+template <typename T>
+RenderedString& RenderedStringWordWrapper<T>::createLineRun(const size_t first,
+                                                            const size_t end)
+{
+    RenderedString* rs = CEGUI_NEW_AO RenderedString();
+    rs->d_lines.clear();
+    d_runs.push_back(rs);
+
+    if (first == end)
+        return *rs;
+
+    const size_t comp_first = d_wrappedLines[first].first;
+    const size_t comp_end = d_wrappedLines[end - 1].first +
+                            d_wrappedLines[end - 1].count;
+
+    // the run only references the components, see deleteFormatters.
+    rs->d_components.assign(d_wrappedComponents.begin() + comp_first,
+                            d_wrappedComponents.begin() + comp_end);
+
+    for (size_t i = first; i < end; ++i)
+        rs->d_lines.push_back(RenderedString::LineInfo(
+            d_wrappedLines[i].first - comp_first, d_wrappedLines[i].count));
+
+    return *rs;
+}
+
 //----------------------------------------------------------------------------//
 template <typename T>
 void RenderedStringWordWrapper<T>::draw(const Window* ref_wnd,
@@ -133,6 +404,12 @@ void RenderedStringWordWrapper<T>::draw(const Window* ref_wnd,
                                         const ColourRect* mod_colours,
                                         const Rectf* clip_rect) const
 {
+    // lines may reference components of a source string that has since
+    // changed, so wrap it again at the size last formatted for.
+    if (d_wrapValid && !isSourceUnchanged())
+        const_cast<RenderedStringWordWrapper<T>*>(this)->format(
+            ref_wnd, d_formattedSize);
+
     Vector2f line_pos(position);
     typename LineList::const_iterator i = d_lines.begin();
     for (; i != d_lines.end(); ++i)
@@ -146,39 +423,21 @@ void RenderedStringWordWrapper<T>::draw(const Window* ref_wnd,
 template <typename T>
 size_t RenderedStringWordWrapper<T>::getFormattedLineCount() const
 {
-    return d_lines.size();
+    return d_wrappedLines.size();
 }
 
 //----------------------------------------------------------------------------//
 template <typename T>
-float RenderedStringWordWrapper<T>::getHorizontalExtent(const Window* ref_wnd) const
+float RenderedStringWordWrapper<T>::getHorizontalExtent(const Window* /*ref_wnd*/) const
 {
-    // TODO: Cache at format time.
-
-    float w = 0;
-    typename LineList::const_iterator i = d_lines.begin();
-    for (; i != d_lines.end(); ++i)
-    {
-        const float cur_width = (*i)->getHorizontalExtent(ref_wnd);
-        if (cur_width > w)
-            w = cur_width;
-    }
-    
-    return w;
+    return d_horzExtent;
 }
 
 //----------------------------------------------------------------------------//
 template <typename T>
-float RenderedStringWordWrapper<T>::getVerticalExtent(const Window* ref_wnd) const
+float RenderedStringWordWrapper<T>::getVerticalExtent(const Window* /*ref_wnd*/) const
 {
-    // TODO: Cache at format time.
-
-    float h = 0;
-    typename LineList::const_iterator i = d_lines.begin();
-    for (; i != d_lines.end(); ++i)
-        h += (*i)->getVerticalExtent(ref_wnd);
-
-    return h;
+    return d_vertExtent;
 }
 
 //----------------------------------------------------------------------------//
@@ -186,16 +445,26 @@ template <typename T>
 void RenderedStringWordWrapper<T>::deleteFormatters()
 {
     for (size_t i = 0; i < d_lines.size(); ++i)
-    {
-        // get the rendered string back from rthe formatter
-        const RenderedString* rs = &d_lines[i]->getRenderedString();
-        // delete the formatter
         CEGUI_DELETE_AO d_lines[i];
-        // delete the rendered string.
-        CEGUI_DELETE_AO rs;
+    d_lines.clear();
+
+    for (size_t i = 0; i < d_runs.size(); ++i)
+    {
+        // the runs do not own their components; release them before the
+        // RenderedString destructor gets to delete them.
+        d_runs[i]->d_components.clear();
+        CEGUI_DELETE_AO d_runs[i];
     }
+    d_runs.clear();
 
-    d_lines.clear();
+    for (size_t i = 0; i < d_ownedComponents.size(); ++i)
+        CEGUI_DELETE_AO d_ownedComponents[i];
+    d_ownedComponents.clear();
+
+    d_wrappedComponents.clear();
+    d_wrappedLines.clear();
+    d_wrapValid = false;
+    d_horzExtent = d_vertExtent = 0;
 }
 
 //----------------------------------------------------------------------------//
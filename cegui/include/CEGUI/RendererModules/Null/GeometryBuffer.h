@@ -51,18 +51,22 @@ class NULL_GUIRENDERER_API NullGeometryBuffer : public GeometryBuffer
 {
 public:
     //! Constructor
-    NullGeometryBuffer();
+    NullGeometryBuffer(NullRenderer& owner);
     //! Destructor
     virtual ~NullGeometryBuffer();
 
     // implement CEGUI::GeometryBuffer interface.
     void draw() const;
+    bool isBatchCompatible(const GeometryBuffer& buffer) const;
+    void drawBatched(const GeometryBuffer* const* buffers,
+                     uint buffer_count) const;
     void setTranslation(const Vector3f& v);
     void setRotation(const Quaternion& r);
     void setPivot(const Vector3f& p);
     void setClippingRegion(const Rectf& region);
     void appendVertex(const Vertex& vertex);
     void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void reserveVertices(uint vertex_count);
     void setActiveTexture(Texture* texture);
     void reset();
     Texture* getActiveTexture() const;
@@ -74,6 +78,25 @@ public:
     bool isClippingActive() const;
 
 protected:
+    //! type to track info for per-texture sub batches of geometry
+    struct BatchInfo
+    {
+        const NullTexture* texture;
+        uint vertexCount;
+        bool clip;
+        //! extent of the batch's vertices, before translation.
+        Rectf bounds;
+    };
+
+    //! perform batch management operations prior to adding new geometry.
+    void performBatchManagement();
+    //! return whether the buffer applies no rotation to its geometry.
+    bool isTranslationOnly() const;
+    //! return whether \a batch has geometry outside the clip region.
+    bool isBatchClipped(const BatchInfo& batch) const;
+
+    //! NullRenderer that owns the GeometryBuffer.
+    NullRenderer* d_owner;
     //! Texture that is set as active
     NullTexture* d_activeTexture;
     //! rectangular clip region
@@ -92,6 +115,10 @@ protected:
     typedef std::vector<Vertex> VertexList;
     //! container where added geometry is stored.
     VertexList d_vertices;
+    //! type of container that tracks BatchInfos.
+    typedef std::vector<BatchInfo> BatchList;
+    //! list of batches added to the geometry buffer
+    BatchList d_batches;
 };
 
 
@@ -132,6 +132,24 @@ public:
     uint getMaxTextureSize() const;
     const String& getIdentifierString() const;
 
+    /*!
+    \brief
+        Return the number of draw calls that would have been issued since the
+        draw statistics were last reset.  One draw call is counted for each
+        batch of geometry drawn; geometry merged by batched rendering queues
+        (see RenderQueue::setBatchingEnabled) is counted once.
+    */
+    uint getDrawCallCount() const;
+
+    //! Return the number of vertices drawn since the statistics were reset.
+    uint getDrawnVertexCount() const;
+
+    //! Reset the draw call and vertex counters to zero.
+    void resetDrawStatistics();
+
+    //! Record a draw call of \a vertex_count vertices (used by NullGeometryBuffer).
+    void recordDrawCall(uint vertex_count);
+
 protected:
     //! default constructor.
     NullRenderer();
@@ -170,6 +188,10 @@ protected:
     TextureMap d_textures;
     //! What the renderer thinks the max texture size is.
     uint d_maxTextureSize;
+    //! Number of draw calls recorded since the statistics were reset.
+    uint d_drawCallCount;
+    //! Number of vertices drawn since the statistics were reset.
+    uint d_drawnVertexCount;
 };
 
 
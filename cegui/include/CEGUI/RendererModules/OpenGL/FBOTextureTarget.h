@@ -55,6 +55,9 @@ public:
     // implementation of TextureTarget interface
     void clear();
     void declareRenderSize(const Sizef& sz);
+    bool isPartialRedrawSupported() const;
+    void beginPartialRedraw(const Rectf& area);
+    void endPartialRedraw();
     // specialise functions from OpenGLTextureTarget
     void grabTexture();
     void restoreTexture();
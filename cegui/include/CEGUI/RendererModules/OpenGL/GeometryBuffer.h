@@ -58,12 +58,16 @@ public:
 
     // implementation of abstract members from GeometryBuffer
     void draw() const;
+    bool isBatchCompatible(const GeometryBuffer& buffer) const;
+    void drawBatched(const GeometryBuffer* const* buffers,
+                     uint buffer_count) const;
     void setTranslation(const Vector3f& t);
     void setRotation(const Quaternion& r);
     void setPivot(const Vector3f& p);
     void setClippingRegion(const Rectf& region);
     void appendVertex(const Vertex& vertex);
     void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void reserveVertices(uint vertex_count);
     void setActiveTexture(Texture* texture);
     void reset();
     Texture* getActiveTexture() const;
@@ -83,13 +87,15 @@ protected:
 
     //! update cached matrix
     void updateMatrix() const;
+    //! return whether the buffer applies no rotation to its geometry.
+    bool isTranslationOnly() const;
 
     //! internal Vertex structure used for GL based geometry.
     struct GLVertex
     {
+        float position[3];
         float tex[2];
         float colour[4];
-        float position[3];
     };
 
     //! type to track info for per-texture sub batches of geometry
@@ -98,8 +104,20 @@ protected:
         uint texture;
         uint vertexCount;
         bool clip;
+        //! extent of the batch's vertices, before transformation.
+        Rectf bounds;
     };
 
+    //! return whether \a batch has geometry outside the clip region.
+    bool isBatchClipped(const BatchInfo& batch) const;
+    //! draw \a count vertices from \a vertices with the given state.
+    void drawMergedBatch(const GLVertex* vertices, uint count, uint texture,
+                         bool clip, const Rectf& clip_rect,
+                         const int* viewport) const;
+    //! set up the scissor from the clip region and the owner's redraw area.
+    void setupScissor(bool clip, const Rectf& clip_rect,
+                      const int* viewport) const;
+
     //! OpenGLRenderer object that owns the GeometryBuffer.
     OpenGLRenderer* d_owner;
     //! last texture that was set as active
@@ -112,6 +130,8 @@ protected:
     typedef std::vector<GLVertex> VertexList;
     //! container where added geometry is stored.
     VertexList d_vertices;
+    //! translated geometry from a run of buffers merged by drawBatched.
+    mutable VertexList d_mergedVertices;
     //! rectangular clip region
     Rectf d_clipRect;
     //! whether clipping will be active for the current batch
@@ -32,6 +32,7 @@
 #include "../../Renderer.h"
 #include "../../Size.h"
 #include "../../Vector.h"
+#include "../../Rect.h"
 #include "CEGUI/RendererModules/OpenGL/GL.h"
 #include <vector>
 #include <map>
@@ -296,6 +297,24 @@ public:
     //! set the render states for the specified BlendMode.
     void setupRenderingBlendMode(const BlendMode mode, const bool force = false);
 
+    /*!
+    \brief
+        Restrict the geometry drawn to the active target to an area, as a
+        scissor would.  Used by TextureTargets doing a partial redraw.
+
+    \param area
+        Pointer to a Rect describing the area, in pixels relative to the
+        target, or 0 to remove the restriction.
+    */
+    void setRedrawArea(const Rectf* area);
+
+    /*!
+    \brief
+        Return a pointer to the area set with setRedrawArea, or 0 if the
+        geometry drawn is not restricted.
+    */
+    const Rectf* getRedrawArea() const;
+
 protected:
     /*!
     \brief
@@ -369,6 +388,10 @@ protected:
     OGLTextureTargetFactory* d_textureTargetFactory;
     //! What blend mode we think is active.
     BlendMode d_activeBlendMode;
+    //! Area drawing is restricted to while d_redrawAreaActive is true.
+    Rectf d_redrawArea;
+    //! whether drawing is restricted to d_redrawArea.
+    bool d_redrawAreaActive;
 };
 
 } // End of  CEGUI namespace section
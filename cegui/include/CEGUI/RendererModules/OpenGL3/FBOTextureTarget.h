@@ -56,6 +56,9 @@ public:
     // implementation of TextureTarget interface
     void clear();
     void declareRenderSize(const Sizef& sz);
+    bool isPartialRedrawSupported() const;
+    void beginPartialRedraw(const Rectf& area);
+    void endPartialRedraw();
     // specialise functions from OpenGL3TextureTarget
     void grabTexture();
     void restoreTexture();
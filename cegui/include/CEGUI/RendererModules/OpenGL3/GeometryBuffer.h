@@ -32,6 +32,7 @@
 #include "CEGUI/RendererModules/OpenGL3/Renderer.h"
 #include "../../Rect.h"
 #include "../../Quaternion.h"
+#include "../../Vertex.h"
 
 #include <utility>
 #include <vector>
@@ -70,6 +71,10 @@ public:
     void setClippingRegion(const Rectf& region);
     void appendVertex(const Vertex& vertex);
     void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void appendPackedGeometry(const PackedVertex* const vbuff,
+                              uint vertex_count);
+    bool isPackedGeometryNative() const;
+    void reserveVertices(uint vertex_count);
     void setActiveTexture(Texture* texture);
     void reset();
     Texture* getActiveTexture() const;
@@ -83,21 +88,33 @@ public:
     //! return the GL modelview matrix used for this buffer.
     const mat4Pimpl* getMatrix() const;
 
-    void updateOpenGLBuffers();
+    /*!
+    \brief
+        Upload the buffered vertices to the VBO.  This normally happens lazily
+        on the first draw after the geometry has changed.
+    */
+    void updateOpenGLBuffers() const;
 
 protected:
-    //! perform batch management operations prior to adding new geometry.
-    void performBatchManagement();
+    /*!
+    \brief
+        perform batch management operations prior to adding new geometry in
+        the PackedVertex format if \a packed is true, or as Vertex otherwise.
+    */
+    void performBatchManagement(bool packed);
 
     //! update cached matrix
     void updateMatrix() const;
 
+    //! set up the scissor from the clip region and the owner's redraw area.
+    void setupScissor(bool clip, float viewport_height) const;
+
     //! internal Vertex structure used for GL based geometry.
     struct GLVertex
     {
+        float position[3];
         float tex[2];
         float colour[4];
-        float position[3];
     };
 
     //! type to track info for per-texture sub batches of geometry
@@ -106,6 +123,8 @@ protected:
         uint texture;
         uint vertexCount;
         bool clip;
+        //! true if the vertices are in d_packedVertices, not d_vertices.
+        bool packed;
     };
 
     //! OpenGL3Renderer object that owns the GeometryBuffer.
@@ -120,6 +139,10 @@ protected:
     typedef std::vector<GLVertex> VertexList;
     //! container where added geometry is stored.
     VertexList d_vertices;
+    //! type of container used to queue geometry in the PackedVertex format
+    typedef std::vector<PackedVertex> PackedVertexList;
+    //! container where geometry added in the PackedVertex format is stored.
+    PackedVertexList d_packedVertices;
     //! rectangular clip region
     Rectf d_clipRect;
     //! whether clipping will be active for the current batch
@@ -140,6 +163,10 @@ protected:
     GLuint                          d_verticesVAO;
     //! OpenGL vbo containing all vertex data
     GLuint                          d_verticesVBO;
+    //! OpenGL vao used for the vertices in the PackedVertex format
+    GLuint                          d_packedVerticesVAO;
+    //! OpenGL vbo containing all vertex data in the PackedVertex format
+    GLuint                          d_packedVerticesVBO;
     //! Reference to the OpenGL shader inside the Renderer, that is used to render all geometry
     CEGUI::OpenGL3Shader*&          d_shader;
     //! Position variable location inside the shader, for OpenGL
@@ -150,10 +177,24 @@ protected:
     const GLint                     d_shaderColourLoc;
     //! Matrix uniform location inside the shader, for OpenGL
     const GLint                     d_shaderStandardMatrixLoc;
+    //! Reference to the OpenGL shader inside the Renderer used for packed vertices
+    CEGUI::OpenGL3Shader*&          d_shaderPacked;
+    //! Position variable location inside the packed vertex shader
+    const GLint                     d_shaderPackedPosLoc;
+    //! TexCoord variable location inside the packed vertex shader
+    const GLint                     d_shaderPackedTexCoordLoc;
+    //! Color variable location inside the packed vertex shader
+    const GLint                     d_shaderPackedColourLoc;
+    //! Matrix uniform location inside the packed vertex shader
+    const GLint                     d_shaderPackedMatrixLoc;
     //! Pointer to the OpenGL state changer wrapper that was created inside the Renderer
     OpenGL3StateChangeWrapper*      d_glStateChanger;
     //! Size of the buffer that is currently in use
-    GLuint                          d_bufferSize;
+    mutable GLuint                  d_bufferSize;
+    //! Size, in vertices, of the packed vertex buffer that is currently in use
+    mutable GLuint                  d_packedBufferSize;
+    //! true when d_vertices holds data not yet uploaded to d_verticesVBO
+    mutable bool                    d_bufferDirty;
 };
 
 
@@ -325,6 +325,28 @@ public:
     */
     GLint getShaderStandardMatrixUniformLoc();
 
+    /*!
+    \brief
+    Helper to return the reference to the pointer to the shader used for
+    geometry in the PackedVertex format
+
+    \return
+    Reference to the pointer to the packed vertex shader of the Renderer
+    */
+    OpenGL3Shader*& getShaderPacked();
+
+    //! Return the attribute location of the position variable in the packed vertex shader
+    GLint getShaderPackedPositionLoc();
+
+    //! Return the attribute location of the texture coordinate variable in the packed vertex shader
+    GLint getShaderPackedTexCoordLoc();
+
+    //! Return the attribute location of the colour variable in the packed vertex shader
+    GLint getShaderPackedColourLoc();
+
+    //! Return the uniform location of the matrix variable in the packed vertex shader
+    GLint getShaderPackedMatrixUniformLoc();
+
 
     /*!
     \brief
@@ -374,6 +396,26 @@ public:
     */
     RenderTarget* getActiveRenderTarget();
 
+    /*!
+    \brief
+    Helper to restrict the geometry drawn to the active render target to an
+    area, as a scissor would.  Used by TextureTargets doing a partial redraw.
+
+    \param area
+    Pointer to a Rect describing the area, in pixels relative to the target,
+    or 0 to remove the restriction.
+    */
+    void setRedrawArea(const Rectf* area);
+
+    /*!
+    \brief
+    Helper to get the area set with setRedrawArea.
+
+    \return
+    Pointer to the area geometry is restricted to, or 0 if there is none.
+    */
+    const Rectf* getRedrawArea() const;
+
     /*!
     \brief
     Helper to get the wrapper used to check for redundant OpenGL state changes.
@@ -472,10 +514,24 @@ private:
     GLint           d_shaderStandardColourLoc;
     //! Matrix uniform location inside the shader, for OpenGL
     GLint           d_shaderStandardMatrixLoc;
+    //! The OpenGL shader used for geometry in the PackedVertex format
+    OpenGL3Shader*         d_shaderPacked;
+    //! Position variable location inside the packed vertex shader
+    GLint           d_shaderPackedPosLoc;
+    //! TexCoord variable location inside the packed vertex shader
+    GLint           d_shaderPackedTexCoordLoc;
+    //! Color variable location inside the packed vertex shader
+    GLint           d_shaderPackedColourLoc;
+    //! Matrix uniform location inside the packed vertex shader
+    GLint           d_shaderPackedMatrixLoc;
     //! View projection matrix
     mat4Pimpl*      d_viewProjectionMatrix;
     //! The active RenderTarget
     RenderTarget*        d_activeRenderTarget;
+    //! Area drawing is restricted to while d_redrawAreaActive is true.
+    Rectf d_redrawArea;
+    //! whether drawing is restricted to d_redrawArea.
+    bool d_redrawAreaActive;
     //! The wrapper we use for OpenGL calls, to detect redundant state changes and prevent them
     OpenGL3StateChangeWrapper*  d_openGLStateChanger;
     OpenGL3ShaderManager*       d_shaderManager;
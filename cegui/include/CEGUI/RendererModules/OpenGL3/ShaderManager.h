@@ -46,6 +46,7 @@ namespace CEGUI
     enum OpenGL3ShaderID
     {
         SHADER_ID_STANDARDSHADER,
+        SHADER_ID_PACKEDSHADER,
 
         SHADER_ID_COUNT
     };
@@ -0,0 +1,139 @@
+/***********************************************************************
+    filename:   GeometryBuffer.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareGeometryBuffer_h_
+#define _CEGUISoftwareGeometryBuffer_h_
+
+#include "../../GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+#include "../../Vertex.h"
+#include "../../Quaternion.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//! Implementation of CEGUI::GeometryBuffer for the software renderer.
+class SOFTWARE_GUIRENDERER_API SoftwareGeometryBuffer : public GeometryBuffer
+{
+public:
+    //! Constructor
+    SoftwareGeometryBuffer(SoftwareRenderer& owner);
+    //! Destructor
+    virtual ~SoftwareGeometryBuffer();
+
+    /*!
+    \brief
+        Transform a point from the surface of the active render target into
+        the co-ordinates of the geometry in this buffer.  This undoes the
+        translation, rotation and perspective applied by draw.
+
+    \param area
+        Area of the render target the point is on.
+    */
+    void unprojectPoint(const Rectf& area, const Vector2f& p_in,
+                        Vector2f& p_out) const;
+
+    // implement CEGUI::GeometryBuffer interface.
+    void draw() const;
+    void setTranslation(const Vector3f& v);
+    void setRotation(const Quaternion& r);
+    void setPivot(const Vector3f& p);
+    void setClippingRegion(const Rectf& region);
+    void appendVertex(const Vertex& vertex);
+    void appendGeometry(const Vertex* const vbuff, uint vertex_count);
+    void reserveVertices(uint vertex_count);
+    void setActiveTexture(Texture* texture);
+    void reset();
+    Texture* getActiveTexture() const;
+    uint getVertexCount() const;
+    uint getBatchCount() const;
+    void setRenderEffect(RenderEffect* effect);
+    RenderEffect* getRenderEffect();
+    void setClippingActive(const bool active);
+    bool isClippingActive() const;
+
+protected:
+    //! type to track info for per-texture sub batches of geometry
+    struct BatchInfo
+    {
+        const SoftwareTexture* texture;
+        uint vertexCount;
+        bool clip;
+    };
+
+    //! perform batch management operations prior to adding new geometry.
+    void performBatchManagement();
+    /*!
+    \brief
+        apply translation, rotation and perspective to \a pos.  Returns false
+        if the point is behind the eye.
+    */
+    bool transformPoint(const Vector3f& pos, const Rectf& area,
+                        Vector2f& p_out) const;
+
+    //! SoftwareRenderer that owns the GeometryBuffer.
+    SoftwareRenderer* d_owner;
+    //! Texture that is set as active
+    SoftwareTexture* d_activeTexture;
+    //! rectangular clip region
+    Rectf d_clipRect;
+    //! whether clipping will be active for the current batch
+    bool d_clippingActive;
+    //! translation vector
+    Vector3f d_translation;
+    //! rotation quaternion
+    Quaternion d_rotation;
+    //! pivot point for rotation
+    Vector3f d_pivot;
+    //! RenderEffect that will be used by the GeometryBuffer
+    RenderEffect* d_effect;
+    //! type of container used to queue the geometry
+    typedef std::vector<Vertex> VertexList;
+    //! container where added geometry is stored.
+    VertexList d_vertices;
+    //! type of container that tracks BatchInfos.
+    typedef std::vector<BatchInfo> BatchList;
+    //! list of batches added to the geometry buffer
+    BatchList d_batches;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareGeometryBuffer_h_
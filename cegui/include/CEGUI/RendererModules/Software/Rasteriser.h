@@ -0,0 +1,225 @@
+/***********************************************************************
+    filename:   Rasteriser.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRasteriser_h_
+#define _CEGUISoftwareRasteriser_h_
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Queues triangles drawn to a SoftwareTexture and rasterises them.
+
+    Triangles are rasterised with the top-left fill rule, so triangles
+    sharing an edge never both cover a pixel on it.  Texture co-ordinates
+    and colours are interpolated linearly in screen space, textures are
+    sampled bilinearly with their edges clamped, and the result is blended
+    with the surface as the OpenGL renderer does for each BlendMode.
+
+    flush sorts the queued triangles into square tiles of the surface.  The
+    tiles are independent of each other, so they are rasterised in parallel
+    when a ThreadPool is given, and the triangles of each tile are
+    rasterised in the order they were added.  The output does not depend
+    on the number of threads, nor on whether SIMD instructions are used.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRasteriser
+{
+public:
+    //! A vertex of a triangle, in pixels of the surface.
+    struct RasterVertex
+    {
+        float x, y;
+        //! texture co-ordinates, 0 to 1 over the texture.
+        float u, v;
+        //! colour components, 0 to 1.
+        float r, g, b, a;
+    };
+
+    //! Width and height of the tiles triangles are sorted into.
+    static const int TileSize = 64;
+
+    SoftwareRasteriser();
+    ~SoftwareRasteriser();
+
+    /*!
+    \brief
+        Set the texture triangles are rasterised into.  Triangles queued for
+        the previous surface are discarded.
+    */
+    void setSurface(SoftwareTexture* surface);
+
+    //! Return the texture triangles are rasterised into.
+    SoftwareTexture* getSurface() const;
+
+    /*!
+    \brief
+        Set the area of the surface covered by the render target using this
+        rasteriser.  SoftwareGeometryBuffer positions its geometry relative
+        to the top left of this area.
+    */
+    void setArea(const Rectf& area);
+
+    //! Return the area of the surface covered by the render target.
+    const Rectf& getArea() const;
+
+    /*!
+    \brief
+        Set the area of the surface that queued triangles are restricted to
+        while the scissor is active, in addition to their own clip area.
+    */
+    void setScissorArea(const Rectf& area);
+
+    //! Return the area set with setScissorArea.
+    const Rectf& getScissorArea() const;
+
+    //! Set whether the scissor area is applied to the triangles queued.
+    void setScissorActive(bool active);
+
+    //! Return whether the scissor area is applied to the triangles queued.
+    bool isScissorActive() const;
+
+    /*!
+    \brief
+        Queue a triangle.
+
+    \param vertices
+        The three vertices of the triangle, in either winding order.
+
+    \param texture
+        Texture sampled by the triangle, or 0 to use the vertex colours only.
+
+    \param blend_mode
+        How the triangle is blended with the surface.
+
+    \param clip
+        Pixels of the surface outside of this area are not touched.
+    */
+    void addTriangle(const RasterVertex* vertices,
+                     const SoftwareTexture* texture,
+                     BlendMode blend_mode,
+                     const Rectf& clip);
+
+    //! Return whether there are queued triangles.
+    bool isFlushNeeded() const;
+
+    /*!
+    \brief
+        Rasterise the queued triangles into the surface.
+
+    \param pool
+        ThreadPool used to rasterise tiles in parallel, or 0 to rasterise
+        them all on the calling thread.
+    */
+    void flush(ThreadPool* pool);
+
+    //! Discard the queued triangles without rasterising them.
+    void discard();
+
+    //! Return the name of the span filling implementation in use.
+    static const char* getImplementationName();
+
+    //! Sampling done for a queued triangle.
+    enum Sampling
+    {
+        //! vertex colours only.
+        S_NONE,
+        //! one texel per pixel, which needs no filtering.
+        S_NEAREST,
+        //! bilinear filtering.
+        S_BILINEAR,
+
+        S_COUNT
+    };
+
+    //! A queued triangle, prepared for rasterisation.
+    struct Triangle
+    {
+        //! edge functions: a * x + b * y + c, in 1/256 pixels.
+        int64 d_edgeA[3];
+        int64 d_edgeB[3];
+        int64 d_edgeC[3];
+        //! area the triangle may cover, with the clip area applied.
+        int d_left, d_top, d_right, d_bottom;
+        //! attribute planes: value at the origin and change per pixel.
+        float d_base[6];
+        float d_dx[6];
+        float d_dy[6];
+        const SoftwareTexture* d_texture;
+        Sampling d_sampling;
+        BlendMode d_blendMode;
+    };
+
+protected:
+    struct TileTask;
+
+    //! rasterise the queued triangles that cover tile \a tile.
+    void rasteriseTile(size_t tile) const;
+    //! rasterise one row of \a triangle within the columns given.
+    void rasteriseRow(const Triangle& triangle, int y,
+                      int left, int right) const;
+    //! make the tiles list fit the surface.
+    void updateTiles();
+
+    //! texture triangles are rasterised into.
+    SoftwareTexture* d_surface;
+    //! area of the surface covered by the render target.
+    Rectf d_area;
+    //! area triangles are restricted to while d_scissorActive is true.
+    Rectf d_scissorArea;
+    //! whether d_scissorArea is applied to the triangles queued.
+    bool d_scissorActive;
+    //! number of tiles across and down the surface.
+    int d_tilesAcross;
+    int d_tilesDown;
+    //! queued triangles.
+    std::vector<Triangle> d_triangles;
+    //! type holding the indices of the triangles covering one tile.
+    typedef std::vector<uint> TriangleIndexList;
+    //! indices of the triangles covering each tile.
+    std::vector<TriangleIndexList> d_tiles;
+    //! indices of the tiles covered by at least one triangle.
+    std::vector<size_t> d_coveredTiles;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRasteriser_h_
@@ -0,0 +1,256 @@
+/***********************************************************************
+    filename:   Renderer.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareRenderer_h_
+#define _CEGUISoftwareRenderer_h_
+
+#include "../../Renderer.h"
+#include "../../Size.h"
+#include "../../Vector.h"
+#include "../../Colour.h"
+
+#include <vector>
+#include <map>
+
+#if (defined( __WIN32__ ) || defined( _WIN32 )) && !defined(CEGUI_STATIC)
+#   ifdef CEGUISOFTWARERENDERER_EXPORTS
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllexport)
+#   else
+#       define SOFTWARE_GUIRENDERER_API __declspec(dllimport)
+#   endif
+#else
+#   define SOFTWARE_GUIRENDERER_API
+#endif
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+class SoftwareGeometryBuffer;
+class SoftwareTexture;
+class SoftwareRasteriser;
+
+/*!
+\brief
+    CEGUI::Renderer implementation that rasterises on the CPU.
+
+    The display is an RGBA image in memory (see getDisplaySurface), so the
+    complete rendering pipeline can run without a GPU or a window, for
+    example to compare rendered output against reference images or to
+    profile CEGUI on build machines.
+
+    Triangles drawn to a RenderTarget are queued until the target is
+    deactivated.  They are then sorted into square tiles of the target,
+    and the tiles are rasterised in parallel on a ThreadPool.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareRenderer : public Renderer
+{
+public:
+    /*!
+    \brief
+        Convenience function that creates all the necessary objects
+        then initialises the CEGUI system with them.
+
+        This will create and initialise the following objects for you:
+        - CEGUI::SoftwareRenderer
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::System
+
+    \param display_size
+        Size of the display image, in pixels.
+
+    \param thread_count
+        Number of threads rasterising the tiles, or 0 to use one per
+        processor.
+
+    \param abi
+        This must be set to CEGUI_VERSION_ABI
+
+    \return
+        Reference to the CEGUI::SoftwareRenderer object that was created.
+    */
+    static SoftwareRenderer& bootstrapSystem(const Sizef& display_size,
+                                             uint thread_count = 0,
+                                             const int abi = CEGUI_VERSION_ABI);
+
+    /*!
+    \brief
+        Convenience function to cleanup the CEGUI system and related objects
+        that were created by calling the bootstrapSystem function.
+
+        This function will destroy the following objects for you:
+        - CEGUI::System
+        - CEGUI::DefaultResourceProvider
+        - CEGUI::SoftwareRenderer
+
+    \note
+        If you did not initialise CEGUI by calling the bootstrapSystem function,
+        you should \e not call this, but rather delete any objects you created
+        manually.
+    */
+    static void destroySystem();
+
+    /*!
+    \brief
+        Create a SoftwareRenderer object.
+
+    \param display_size
+        Size of the display image, in pixels.
+
+    \param thread_count
+        Number of threads rasterising the tiles, or 0 to use one per
+        processor.  With 1, everything is rasterised on the calling thread.
+    */
+    static SoftwareRenderer& create(const Sizef& display_size,
+                                    uint thread_count = 0,
+                                    const int abi = CEGUI_VERSION_ABI);
+
+    //! destroy a SoftwareRenderer object.
+    static void destroy(SoftwareRenderer& renderer);
+
+    /*!
+    \brief
+        Return the texture holding the display image.  Its pixels are only
+        complete once endRendering has been called.
+    */
+    SoftwareTexture& getDisplaySurface() const;
+
+    /*!
+    \brief
+        Set the colour the display image is cleared to by beginRendering.
+        The default is transparent black.
+    */
+    void setClearColour(const Colour& colour);
+
+    //! Return the colour the display image is cleared to by beginRendering.
+    const Colour& getClearColour() const;
+
+    //! Return the number of threads rasterising the tiles.
+    uint getThreadCount() const;
+
+    /*!
+    \brief
+        Make \a rasteriser the destination of the triangles drawn by
+        SoftwareGeometryBuffer objects, until the matching
+        popActiveRasteriser call.  This is done by the render targets when
+        they are activated.
+    */
+    void pushActiveRasteriser(SoftwareRasteriser& rasteriser);
+
+    /*!
+    \brief
+        Rasterise the triangles queued on the active rasteriser and restore
+        the previously active one.
+    */
+    void popActiveRasteriser();
+
+    //! Return the active rasteriser, or 0 if no render target is active.
+    SoftwareRasteriser* getActiveRasteriser() const;
+
+    // implement CEGUI::Renderer interface
+    RenderTarget& getDefaultRenderTarget();
+    GeometryBuffer& createGeometryBuffer();
+    void destroyGeometryBuffer(const GeometryBuffer& buffer);
+    void destroyAllGeometryBuffers();
+    TextureTarget* createTextureTarget();
+    void destroyTextureTarget(TextureTarget* target);
+    void destroyAllTextureTargets();
+    Texture& createTexture(const String& name);
+    Texture& createTexture(const String& name,
+                           const String& filename,
+                           const String& resourceGroup);
+    Texture& createTexture(const String& name, const Sizef& size);
+    void destroyTexture(Texture& texture);
+    void destroyTexture(const String& name);
+    void destroyAllTextures();
+    Texture& getTexture(const String& name) const;
+    bool isTextureDefined(const String& name) const;
+    void beginRendering();
+    void endRendering();
+    void setDisplaySize(const Sizef& sz);
+    const Sizef& getDisplaySize() const;
+    const Vector2f& getDisplayDPI() const;
+    uint getMaxTextureSize() const;
+    const String& getIdentifierString() const;
+
+protected:
+    //! constructor.
+    SoftwareRenderer(const Sizef& display_size, uint thread_count);
+    //! destructor.
+    virtual ~SoftwareRenderer();
+
+    //! helper to throw exception if name is already used.
+    void throwIfNameExists(const String& name) const;
+    //! helper to safely log the creation of a named texture
+    static void logTextureCreation(const String& name);
+    //! helper to safely log the destruction of a named texture
+    static void logTextureDestruction(const String& name);
+
+    //! String holding the renderer identification text.
+    static String d_rendererID;
+    //! What the renderer considers to be the current display size.
+    Sizef d_displaySize;
+    //! What the renderer considers to be the current display DPI resolution.
+    Vector2f d_displayDPI;
+    //! texture holding the display image.
+    SoftwareTexture* d_displaySurface;
+    //! colour the display image is cleared to.
+    Colour d_clearColour;
+    //! The default RenderTarget
+    RenderTarget* d_defaultTarget;
+    //! container type used to hold TextureTargets we create.
+    typedef std::vector<TextureTarget*> TextureTargetList;
+    //! Container used to track texture targets.
+    TextureTargetList d_textureTargets;
+    //! container type used to hold GeometryBuffers we create.
+    typedef std::vector<SoftwareGeometryBuffer*> GeometryBufferList;
+    //! Container used to track geometry buffers.
+    GeometryBufferList d_geometryBuffers;
+    //! container type used to hold Textures we create.
+    typedef std::map<String, SoftwareTexture*, StringFastLessCompare
+                     CEGUI_MAP_ALLOC(String, SoftwareTexture*)> TextureMap;
+    //! Container used to track textures.
+    TextureMap d_textures;
+    //! stack of active rasterisers, innermost last.
+    std::vector<SoftwareRasteriser*> d_activeRasterisers;
+    //! threads rasterising tiles; 0 when rasterising on the calling thread.
+    ThreadPool* d_threadPool;
+};
+
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareRenderer_h_
@@ -0,0 +1,132 @@
+/***********************************************************************
+    filename:   Texture.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUISoftwareTexture_h_
+#define _CEGUISoftwareTexture_h_
+
+#include "../../Texture.h"
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "../../Rect.h"
+
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Implementation of the CEGUI::Texture class for the software renderer.
+
+    The pixels are kept in memory as four bytes per pixel, in RGBA order,
+    row by row from the top.
+*/
+class SOFTWARE_GUIRENDERER_API SoftwareTexture : public Texture
+{
+public:
+    //! Return the width of the pixel data.
+    uint getPixelWidth() const;
+    //! Return the height of the pixel data.
+    uint getPixelHeight() const;
+    //! Return the pixel data, or 0 if the texture is empty.
+    const uint8* getPixels() const;
+    //! Return the pixel data, or 0 if the texture is empty.
+    uint8* getPixels();
+
+    /*!
+    \brief
+        Resize the pixel data to \a width by \a height pixels.  All pixels
+        are set to transparent black.
+    */
+    void setPixelSize(uint width, uint height);
+
+    //! Set every pixel to \a colour.
+    void fill(const Colour& colour);
+
+    /*!
+    \brief
+        Set the pixels within \a area to \a colour.  The edges of \a area
+        are rounded outwards to whole pixels.
+    */
+    void fill(const Colour& colour, const Rectf& area);
+
+    // implement CEGUI::Texture interface
+    const String& getName() const;
+    const Sizef& getSize() const;
+    const Sizef& getOriginalDataSize() const;
+    const Vector2f& getTexelScaling() const;
+    void loadFromFile(const String& filename, const String& resourceGroup);
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format);
+    void blitFromMemory(void* sourceData, const Rectf& area);
+    void blitToMemory(void* targetData);
+    bool isPixelFormatSupported(const PixelFormat fmt) const;
+
+protected:
+    // we all need a little help from out friends ;)
+    friend class SoftwareRenderer;
+
+    //! standard constructor
+    SoftwareTexture(const String& name);
+    //! construct texture via an image file.
+    SoftwareTexture(const String& name, const String& filename,
+                    const String& resourceGroup);
+    //! construct texture with a specified initial size.
+    SoftwareTexture(const String& name, const Sizef& sz);
+    //! destructor.
+    virtual ~SoftwareTexture();
+
+    //! updates cached scale value used to map pixels to texture co-ords.
+    void updateCachedScaleValues();
+
+    //! Size of the texture.
+    Sizef d_size;
+    //! original pixel of size data loaded into texture
+    Sizef d_dataSize;
+    //! cached pixel to texel mapping scale values.
+    Vector2f d_texelScaling;
+    //! Name this texture was created with.
+    const String d_name;
+    //! width of the pixel data.
+    uint d_pixelWidth;
+    //! height of the pixel data.
+    uint d_pixelHeight;
+    //! the pixel data, RGBA.
+    std::vector<uint8> d_pixels;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUISoftwareTexture_h_
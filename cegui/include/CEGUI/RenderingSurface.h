@@ -31,6 +31,7 @@
 #include "CEGUI/EventSet.h"
 #include "CEGUI/EventArgs.h"
 #include "CEGUI/RenderQueue.h"
+#include "CEGUI/Rect.h"
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -238,6 +239,22 @@ public:
     */
     virtual void invalidate();
 
+    /*!
+    \brief
+        Marks an area of the RenderingSurface as invalid, causing the geometry
+        covering that area to be rerendered to the RenderTarget next time draw
+        is called.
+
+        Surfaces that cache their rendered output may then clear and redraw
+        only the invalidated areas.  The default implementation invalidates
+        the whole surface.
+
+    \param area
+        Rect describing the invalidated area, in pixels relative to the
+        top-left of the surface.
+    */
+    virtual void invalidateArea(const Rectf& area);
+
     /*!
     \brief
         Return whether this RenderingSurface is invalidated.
@@ -330,6 +347,24 @@ public:
     const RenderTarget& getRenderTarget() const;
     RenderTarget& getRenderTarget();
 
+    /*!
+    \brief
+        Set whether the rendering queues of this RenderingSurface draw runs of
+        compatible GeometryBuffers as merged batches (see
+        RenderQueue::setBatchingEnabled).
+
+        The setting is also applied to the RenderingWindow objects attached to
+        this RenderingSurface, including any that are attached later.
+
+    \param enabled
+        - true to enable batched drawing of the rendering queues.
+        - false to draw each GeometryBuffer individually (the default).
+    */
+    void setBatchingEnabled(const bool enabled);
+
+    //! Return whether batched drawing is enabled for this RenderingSurface.
+    bool isBatchingEnabled() const;
+
 protected:
     /** draw the surface content. Default impl draws the render queues.
      * NB: Called between RenderTarget activate and deactivate calls.
@@ -359,6 +394,8 @@ protected:
     RenderTarget* d_target;
     //! holds invalidated state of target (as far as we are concerned)
     bool d_invalidated;
+    //! whether the rendering queues use batched drawing.
+    bool d_batchingEnabled;
 };
 
 } // End of  CEGUI namespace section
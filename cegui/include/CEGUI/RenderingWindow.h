@@ -279,9 +279,24 @@ public:
     */
     void unprojectPoint(const Vector2f& p_in, Vector2f& p_out);
 
+    /*!
+    \brief
+        Return whether the RenderingWindow is invalidated, but only the area
+        returned by getInvalidatedArea needs to be cleared and redrawn.
+    */
+    bool isPartiallyInvalidated() const;
+
+    /*!
+    \brief
+        Return the area that will be cleared and redrawn, in whole pixels, when
+        isPartiallyInvalidated returns true.
+    */
+    const Rectf& getInvalidatedArea() const;
+
     // overrides from base
     void draw();
     void invalidate();
+    void invalidateArea(const Rectf& area);
     bool isRenderingWindow() const;
 
 protected:
@@ -311,6 +326,10 @@ protected:
     Quaternion d_rotation;
     //! Pivot point used for the rotation.
     Vector3f d_pivot;
+    //! true when only d_invalidatedArea needs to be redrawn.
+    bool d_partiallyInvalidated;
+    //! area to be redrawn when d_partiallyInvalidated is true.
+    Rectf d_invalidatedArea;
 };
 
 } // End of  CEGUI namespace section
@@ -108,6 +108,36 @@ public:
     */
     virtual void unloadRawDataContainer(RawDataContainer&)  { }
 
+    /*!
+    \brief
+        Get the size and modification time of a file without loading it.  This
+        lets data derived from the file, such as a cached parse, be checked
+        for being current cheaply.
+
+    \param filename
+        String containing a filename of the resource.
+
+    \param resourceGroup
+        Optional String that may be used by implementations to identify the group from
+        which the resource would be loaded.
+
+    \param size
+        Receives the size of the file in bytes.
+
+    \param modifiedTime
+        Receives the time the file was last modified, in units chosen by the
+        implementation.
+
+    \return
+        - true if \a size and \a modifiedTime were set.
+        - false if the implementation cannot tell, in which case the file has
+          to be loaded to check it.  The default implementation returns false.
+    */
+    virtual bool getFileStatus(const String& /*filename*/,
+                               const String& /*resourceGroup*/,
+                               uint64& /*size*/, uint64& /*modifiedTime*/)
+    { return false; }
+
     /*!
     \brief
         Return the current default resource group identifier.
@@ -91,6 +91,37 @@ public:
         textures.
     */
     virtual bool isRenderingInverted() const = 0;
+
+    /*!
+    \brief
+        Return whether the TextureTarget can clear and redraw an area of the
+        underlying texture, leaving the rest of it untouched.
+
+        When this returns false, RenderingWindow always clears and redraws the
+        whole texture.  The default implementation returns false.
+    */
+    virtual bool isPartialRedrawSupported() const;
+
+    /*!
+    \brief
+        Clear an area of the underlying texture, and restrict the rendering
+        done to the target to that area - as a scissor would - until
+        endPartialRedraw is called.
+
+        The default implementation clears the whole texture.
+
+    \param area
+        Rect describing the area, in whole pixels relative to the top-left of
+        the target.
+    */
+    virtual void beginPartialRedraw(const Rectf& area);
+
+    /*!
+    \brief
+        Remove the restriction to the area given to beginPartialRedraw.  The
+        default implementation does nothing.
+    */
+    virtual void endPartialRedraw();
 };
 
 } // End of  CEGUI namespace section
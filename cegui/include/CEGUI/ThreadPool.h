@@ -0,0 +1,176 @@
+/***********************************************************************
+    filename:   ThreadPool.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIThreadPool_h_
+#define _CEGUIThreadPool_h_
+
+#include "CEGUI/Base.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Simple mutual exclusion lock, using the threading API of the platform.
+*/
+class CEGUIEXPORT Mutex
+{
+public:
+    Mutex();
+    ~Mutex();
+
+    //! Lock the mutex, waiting for other threads to unlock it as needed.
+    void lock();
+    //! Unlock the mutex.
+    void unlock();
+
+private:
+    friend class ThreadPool;
+
+    // not copyable
+    Mutex(const Mutex&);
+    Mutex& operator=(const Mutex&);
+
+    //! platform specific mutex object.
+    void* d_impl;
+};
+
+/*!
+\brief
+    Locks a Mutex for the lifetime of the MutexLock object.
+*/
+class MutexLock
+{
+public:
+    MutexLock(Mutex& mutex) :
+        d_mutex(mutex)
+    {
+        d_mutex.lock();
+    }
+
+    ~MutexLock()
+    {
+        d_mutex.unlock();
+    }
+
+private:
+    // not copyable
+    MutexLock(const MutexLock&);
+    MutexLock& operator=(const MutexLock&);
+
+    Mutex& d_mutex;
+};
+
+/*!
+\brief
+    Atomic operations on 32 bit values shared between threads, using the
+    primitives of the compiler or platform.  Each operation is also a full
+    memory barrier.
+*/
+class CEGUIEXPORT Atomic
+{
+public:
+    //! Add \a value to \a target and return the result.
+    static uint32 add(volatile uint32& target, uint32 value);
+    //! Return the value of \a source.
+    static uint32 load(const volatile uint32& source);
+    //! Set \a target to \a value.
+    static void store(volatile uint32& target, uint32 value);
+};
+
+/*!
+\brief
+    Fixed set of worker threads executing queued tasks in submission order.
+*/
+class CEGUIEXPORT ThreadPool :
+    public AllocatedObject<ThreadPool>
+{
+public:
+    //! Interface for a unit of work executed by a ThreadPool.
+    class CEGUIEXPORT Task :
+        public AllocatedObject<Task>
+    {
+    public:
+        virtual ~Task();
+
+        /*!
+        \brief
+            Perform the work.  This is called on one of the worker threads;
+            exceptions escaping from it are discarded.
+        */
+        virtual void execute() = 0;
+    };
+
+    /*!
+    \brief
+        Constructor.
+
+    \param thread_count
+        Number of worker threads to start, or 0 to start one per processor.
+    */
+    ThreadPool(size_t thread_count = 0);
+
+    //! Destructor.  Queued tasks are completed before the threads are joined.
+    ~ThreadPool();
+
+    /*!
+    \brief
+        Queue \a task for execution.  The ThreadPool takes ownership of
+        \a task and deletes it once it has been executed.  This may be called
+        from any thread, including from within a task.
+    */
+    void submit(Task* task);
+
+    //! Wait until no task is queued or being executed.
+    void waitUntilIdle();
+
+    //! Return the number of worker threads.
+    size_t getThreadCount() const;
+
+    //! Return the number of processors available to the process.
+    static size_t getProcessorCount();
+
+    //! Return a number identifying the calling thread.
+    static uint32 getCurrentThreadID();
+
+    //! Return whether the calling thread is a worker thread of a ThreadPool.
+    static bool isWorkerThread();
+
+private:
+    struct Impl;
+
+    // not copyable
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    //! platform specific state.
+    Impl* d_impl;
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIThreadPool_h_
@@ -33,6 +33,10 @@
 #include "CEGUI/Base.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/TypedProperty.h"
+#include "CEGUI/KeyFrame.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/PropertySet.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -58,6 +62,62 @@ private:
     const String d_type;
 };
 
+/*!
+ \brief KeyFrame::NativeValue holding a key frame value parsed as type T
+ */
+template<typename T>
+class TplKeyFrameNativeValue : public KeyFrame::NativeValue
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    TplKeyFrameNativeValue(typename Helper::pass_type value):
+        d_value(value)
+    {}
+
+    //! the parsed value
+    const T d_value;
+};
+
+/*!
+ \brief Helpers shared by the native paths of the template interpolators
+ */
+template<typename T>
+class TplInterpolatorNativeHelper
+{
+public:
+    typedef PropertyHelper<T> Helper;
+
+    /*!
+     \brief returns the value of \a key_frame as a T
+
+     Key frames holding their own value have it parsed once and cached on the
+     key frame, those using a source property parse the saved value.
+     */
+    static T getKeyFrameValue(const KeyFrame& key_frame, AnimationInstance* instance)
+    {
+        if (!key_frame.getSourceProperty().empty())
+            return Helper::fromString(key_frame.getValueForAnimation(instance));
+
+        const TplKeyFrameNativeValue<T>* cached =
+            dynamic_cast<const TplKeyFrameNativeValue<T>*>(key_frame.getNativeValue());
+
+        if (!cached)
+        {
+            cached = CEGUI_NEW_AO TplKeyFrameNativeValue<T>(Helper::fromString(key_frame.getValue()));
+            key_frame.setNativeValue(const_cast<TplKeyFrameNativeValue<T>*>(cached));
+        }
+
+        return cached->d_value;
+    }
+
+    //! returns the value of \a property saved by \a instance when it started
+    static T getBaseValue(const Property& property, AnimationInstance* instance)
+    {
+        return Helper::fromString(instance->getSavedPropertyValue(property.getName()));
+    }
+};
+
 /*!
  \brief Generic linear interpolator class
  
@@ -121,6 +181,51 @@ public:
 
         return Helper::toString(result);
     }
+
+    //! \copydoc Interpolator::interpolateNative
+    virtual bool interpolateNative(Property& property,
+                                   AnimationInstance* instance,
+                                   Affector::ApplicationMethod method,
+                                   const KeyFrame& left,
+                                   const KeyFrame& right,
+                                   float position)
+    {
+        TypedProperty<T>* const typedProperty = dynamic_cast<TypedProperty<T>*>(&property);
+
+        if (!typedProperty)
+            return false;
+
+        typedef TplInterpolatorNativeHelper<T> Native;
+
+        if (method == Affector::AM_RelativeMultiply)
+        {
+            const T bas = Native::getBaseValue(property, instance);
+            const float val1 = TplInterpolatorNativeHelper<float>::getKeyFrameValue(left, instance);
+            const float val2 = TplInterpolatorNativeHelper<float>::getKeyFrameValue(right, instance);
+
+            const float mul = val1 * (1.0f - position) + val2 * (position);
+
+            typedProperty->setNative(instance->getTarget(), static_cast<const T>(bas * mul));
+            return true;
+        }
+
+        const T val1 = Native::getKeyFrameValue(left, instance);
+        const T val2 = Native::getKeyFrameValue(right, instance);
+
+        if (method == Affector::AM_Relative)
+        {
+            const T bas = Native::getBaseValue(property, instance);
+            typedProperty->setNative(instance->getTarget(),
+                static_cast<const T>(bas + (val1 * (1.0f - position) + val2 * (position))));
+        }
+        else
+        {
+            typedProperty->setNative(instance->getTarget(),
+                static_cast<const T>(val1 * (1.0f - position) + val2 * (position)));
+        }
+
+        return true;
+    }
 };
 
 /*!
@@ -186,6 +291,42 @@ public:
         // there is nothing we can do, we have no idea what operators T has overloaded
         return Helper::toString(bas);
     }
+
+    //! \copydoc Interpolator::interpolateNative
+    virtual bool interpolateNative(Property& property,
+                                   AnimationInstance* instance,
+                                   Affector::ApplicationMethod method,
+                                   const KeyFrame& left,
+                                   const KeyFrame& right,
+                                   float position)
+    {
+        TypedProperty<T>* const typedProperty = dynamic_cast<TypedProperty<T>*>(&property);
+
+        if (!typedProperty)
+            return false;
+
+        typedef TplInterpolatorNativeHelper<T> Native;
+
+        if (method == Affector::AM_RelativeMultiply)
+            // see interpolateRelativeMultiply, we can only re-apply the base
+            typedProperty->setNative(instance->getTarget(), Native::getBaseValue(property, instance));
+        else if (method == Affector::AM_Relative)
+            typedProperty->setNative(instance->getTarget(),
+                                     relativeResult(Native::getBaseValue(property, instance),
+                                                    Native::getKeyFrameValue(position < 0.5 ? left : right, instance)));
+        else
+            typedProperty->setNative(instance->getTarget(),
+                                     Native::getKeyFrameValue(position < 0.5 ? left : right, instance));
+
+        return true;
+    }
+
+protected:
+    //! returns the result of the native path for AM_Relative, given the base and the picked value
+    virtual T relativeResult(typename Helper::pass_type /*base*/, typename Helper::pass_type value) const
+    {
+        return value;
+    }
 };
 
 /*!
@@ -223,6 +364,13 @@ public:
         
         return Helper::toString(result);
     }
+
+protected:
+    //! \copydoc TplDiscreteInterpolator::relativeResult
+    virtual T relativeResult(typename Helper::pass_type base, typename Helper::pass_type value) const
+    {
+        return base + value;
+    }
 };
 
 } // End of  CEGUI namespace section
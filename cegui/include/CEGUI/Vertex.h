@@ -49,6 +49,30 @@ struct Vertex :
     Colour  colour_val;
 };
 
+/*!
+\brief
+    Compact vertex format for geometry that lies entirely in the 2D plane.
+
+    A PackedVertex is 20 bytes, against the 40 or more used by Vertex: the z
+    co-ordinate is dropped (it is taken to be 0) and the colour is held as a
+    single 32 bit ARGB value rather than four floats.  Geometry in this format
+    is appended via GeometryBuffer::appendPackedGeometry; renderers that report
+    GeometryBuffer::isPackedGeometryNative keep and upload it as it is.
+*/
+struct PackedVertex
+{
+    //! x co-ordinate of the vertex position.
+    float x;
+    //! y co-ordinate of the vertex position.
+    float y;
+    //! u texture co-ordinate.
+    float u;
+    //! v texture co-ordinate.
+    float v;
+    //! colour to be applied to the vertex, in 32 bit ARGB format.
+    argb_t colour;
+};
+
 } // End of  CEGUI namespace section
 
 #endif  // end of guard _CEGUIVertex_h_
@@ -0,0 +1,117 @@
+/***********************************************************************
+    filename:   VertexConverter.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIVertexConverter_h_
+#define _CEGUIVertexConverter_h_
+
+#include "CEGUI/Base.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+struct Vertex;
+struct PackedVertex;
+
+/*!
+\brief
+    Utility class that converts spans of CEGUI::Vertex objects into the
+    interleaved float layouts consumed by the renderer modules, and between
+    CEGUI::Vertex and CEGUI::PackedVertex.
+
+    The conversions work on a whole span at once, writing into storage that
+    the caller has already sized, so GeometryBuffer implementations can grow
+    their vertex store once per append rather than once per vertex.  Where
+    available, SSE2 or NEON is used to move the data; otherwise a scalar
+    fallback is used.
+*/
+class CEGUIEXPORT VertexConverter
+{
+public:
+    //! Number of floats written per vertex by toPositionTexColourFloats.
+    static const uint PositionTexColourFloatCount = 9;
+
+    /*!
+    \brief
+        Convert \a vertex_count vertices to the interleaved layout:
+        position[3], tex[2], colour[4] - with colour in RGBA order.
+
+    \param vbuff
+        Pointer to the first Vertex of the span to convert.
+
+    \param vertex_count
+        Number of Vertex objects to convert.
+
+    \param dest
+        Pointer to storage for at least
+        vertex_count * PositionTexColourFloatCount floats.
+    */
+    static void toPositionTexColourFloats(const Vertex* vbuff,
+                                          uint vertex_count,
+                                          float* dest);
+
+    /*!
+    \brief
+        Convert \a vertex_count vertices to the PackedVertex format.  The z
+        co-ordinate of each Vertex is discarded.
+
+    \param vbuff
+        Pointer to the first Vertex of the span to convert.
+
+    \param vertex_count
+        Number of Vertex objects to convert.
+
+    \param dest
+        Pointer to storage for at least \a vertex_count PackedVertex objects.
+    */
+    static void toPackedVertices(const Vertex* vbuff, uint vertex_count,
+                                 PackedVertex* dest);
+
+    /*!
+    \brief
+        Convert \a vertex_count packed vertices to Vertex objects, with the z
+        co-ordinate set to 0.
+
+    \param vbuff
+        Pointer to the first PackedVertex of the span to convert.
+
+    \param vertex_count
+        Number of PackedVertex objects to convert.
+
+    \param dest
+        Pointer to storage for at least \a vertex_count Vertex objects.
+    */
+    static void fromPackedVertices(const PackedVertex* vbuff,
+                                   uint vertex_count,
+                                   Vertex* dest);
+
+    //! Return a string naming the conversion path compiled in.
+    static const char* getImplementationName();
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIVertexConverter_h_
@@ -2053,6 +2053,39 @@ public:
     */
     virtual void destroy(void);
 
+    /*!
+    \brief
+        Prepare a destroyed window for being reused by WindowManager rather
+        than deleted.
+
+        Event subscriptions, user data and user strings are removed and every
+        member of Window is set back to the value the constructor gives it.
+        The WindowRenderer, look'n'feel and child windows were already
+        removed by destroy, and are assigned again when the window is reused.
+
+        Subclasses that return true from isReusable must override this to
+        restore their own members and constructor subscriptions, and MUST
+        call the base class version first.
+
+    \note
+        You never have to call this method yourself; WindowManager calls it
+        for windows of types that are pooled (see
+        WindowManager::setWindowPoolSize).
+    */
+    virtual void resetForReuse();
+
+    /*!
+    \brief
+        Return whether resetForReuse puts a window of this class back into
+        the state of a newly constructed one, so WindowManager may pool it.
+
+        Window returns false.  A class that overrides this to return true
+        declares that it resets all of its state; classes deriving from it
+        that add state of their own must return false again or reset that
+        state too.
+    */
+    virtual bool isReusable() const;
+
     /*!
     \brief
         Set the custom Tooltip object for this Window.  This value may be 0 to
@@ -3325,6 +3358,23 @@ protected:
     //! Helper to intialise the needed clipping for geometry and render surface.
     void initialiseClippers(const RenderingContext& ctx);
 
+    /*!
+    \brief
+        Return the area of a RenderingSurface the window draws to when
+        rendered, in pixels relative to \a offset - the position of that
+        surface.  For a window having a RenderingWindow, this is the area its
+        RenderingWindow may draw to.
+    */
+    Rectf getRenderedArea(const Vector2f& offset) const;
+
+    /*!
+    \brief
+        Add to \a area the areas of the RenderingSurface at \a offset that
+        this window and the descendants drawing to the same surface covered
+        when last rendered, and will cover when next rendered.
+    */
+    void addRedrawArea(Rectf& area, const Vector2f& offset) const;
+
     //! \copydoc Element::setArea_impl
     virtual void setArea_impl(const UVector2& pos, const USize& size, bool topLeftSizing = false, bool fireEvents = true);
     
@@ -3420,6 +3470,9 @@ protected:
     */
     void updateGeometryRenderSettings();
 
+    //! update our entry in the GUIContext hit-test index, if there is one.
+    void updateHitTestIndex() const;
+
     //! transfer RenderingSurfaces to be owned by our target RenderingSurface.
     void transferChildSurfaces();
 
@@ -3551,6 +3604,8 @@ protected:
     RenderingSurface* d_surface;
     //! true if window geometry cache needs to be regenerated.
     mutable bool d_needsRedraw;
+    //! area of the target surface drawn to when last rendered.
+    Rectf d_drawnArea;
     //! holds setting for automatic creation of of surface (RenderingWindow)
     bool d_autoRenderingWindow;
 
@@ -259,6 +259,42 @@ public:
     */
     bool isDeadPoolEmpty(void) const;
 
+    /*!
+    \brief
+        Set how many destroyed windows of type \a type are kept for reuse.
+
+        When windows of a pooled type are cleaned from the dead pool they are
+        reset with Window::resetForReuse and kept, up to \a size windows,
+        rather than deleted.  createWindow then takes a window from the pool
+        for that type and assigns its WindowRenderer and look'n'feel again.
+        This avoids constructing the window and its property set.  Pooling
+        is disabled for all types by default.
+
+    \note
+        Only windows whose class returns true from Window::isReusable are
+        kept; windows of other classes are deleted as usual, so setting a
+        pool size for their type has no effect.  A reused window has the
+        same address as the destroyed one, so stale pointers to destroyed
+        windows of pooled types must not be kept.
+
+    \param type
+        The type of window, as passed to createWindow.
+
+    \param size
+        Maximum number of windows kept; 0 disables pooling for \a type and
+        deletes the windows it holds.
+    */
+    void setWindowPoolSize(const String& type, size_t size);
+
+    //! Return the maximum number of windows of type \a type kept for reuse.
+    size_t getWindowPoolSize(const String& type) const;
+
+    //! Return the number of windows of type \a type waiting to be reused.
+    size_t getPooledWindowCount(const String& type) const;
+
+    //! Delete every window kept for reuse, leaving pooling enabled.
+    void clearWindowPools();
+
     /*!
     \brief
         Permanently destroys any windows placed in the dead pool.
@@ -404,15 +440,37 @@ private:
     //! function to set up RenderEffect on a window
     void initialiseRenderEffect(Window* wnd, const String& effect) const;
 
+    //! delete a window in the dead pool or a window pool.
+    void deleteWindow(Window* window, String& last_type,
+                      WindowFactory*& last_factory) const;
+
     /*************************************************************************
 		Implementation Data
 	*************************************************************************/
     typedef std::vector<Window*
         CEGUI_VECTOR_ALLOC(Window*)> WindowVector; //!< Type to use for a collection of Window pointers.
 
+    //! windows kept for reuse, and the maximum number kept, for one type.
+    struct WindowPool
+    {
+        WindowPool() : d_size(0) {}
+
+        size_t d_size;
+        WindowVector d_windows;
+    };
+
+    typedef std::map<const Window*, size_t, std::less<const Window*>
+        CEGUI_MAP_ALLOC(const Window*, size_t)> RegistryIndex;
+    typedef std::map<String, WindowPool, StringFastLessCompare
+        CEGUI_MAP_ALLOC(String, WindowPool)> WindowPoolMap;
+
     //! collection of created windows.
 	WindowVector d_windowRegistry;
+    //! index of each window in d_windowRegistry.
+    RegistryIndex d_registryIndex;
     WindowVector d_deathrow; //!< Collection of 'destroyed' windows.
+    //! windows kept for reuse, by type.
+    WindowPoolMap d_windowPools;
 
     unsigned long   d_uid_counter;  //!< Counter used to generate unique window names.
     static String d_defaultResourceGroup;   //!< holds default resource group
@@ -30,7 +30,7 @@
 
 #include "CEGUI/Base.h"
 #include "CEGUI/String.h"
-#include <map>
+#include <vector>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -43,6 +43,12 @@ namespace CEGUI
     /*!
     \brief
         Class representing a block of attributes associated with an XML element.
+
+        Attributes are held in a small flat array as UTF-8 text.  Parser modules
+        add attributes with addView, which refers to the parser's own buffer
+        rather than copying it, and names and values are only converted to
+        String objects when they are asked for as such.  The typed getValueAs
+        functions and getValueAsUTF8 work on the UTF-8 text directly.
      */
     class CEGUIEXPORT XMLAttributes :
         public AllocatedObject<XMLAttributes>
@@ -60,6 +66,16 @@ namespace CEGUI
          */
         virtual ~XMLAttributes(void);
 
+        /*!
+        \brief
+            XMLAttributes copy constructor.  Attributes referring to a parser
+            buffer are copied into storage owned by the new block.
+         */
+        XMLAttributes(const XMLAttributes& other);
+
+        //! assignment operator, copying attributes as the copy constructor does.
+        XMLAttributes& operator=(const XMLAttributes& other);
+
         /*!
         \brief
             Adds an attribute to the attribute block.  If the attribute value already exists, it is replaced with
@@ -75,6 +91,34 @@ namespace CEGUI
             Nothing.
          */
         void add(const String& attrName, const String& attrValue);
+
+        /*!
+        \brief
+            Adds an attribute to the attribute block without copying its name
+            or value.  If the attribute already exists, it is replaced.
+
+            This is intended for use by XMLParser modules, which pass pointers
+            into their own buffers.
+
+        \param attrName
+            Pointer to the zero terminated, UTF-8 encoded attribute name.
+
+        \param attrValue
+            Pointer to the zero terminated, UTF-8 encoded attribute value.
+
+        \note
+            Both buffers must remain valid and unchanged for as long as the
+            attribute block is used, or until clear is called.  Copies of the
+            attribute block do not refer to them.
+         */
+        void addView(const char* attrName, const char* attrValue);
+
+        /*!
+        \brief
+            Removes all attributes from the attribute block, keeping the memory
+            allocated so the block can be reused for another element.
+         */
+        void clear(void);
         
         /*!
         \brief
@@ -177,6 +221,25 @@ namespace CEGUI
          */
         const String& getValueAsString(const String& attrName, const String& def = "") const;
 
+        /*!
+        \brief
+            Return the value of attribute \a attrName as UTF-8 text, without
+            creating a String for it.
+
+        \param attrName
+            String object holding the name of the attribute whos value is to be returned.
+
+        \param def
+            Pointer to the zero terminated default value to be returned if
+            \a attrName does not exist in the attribute block.
+
+        \return
+            Pointer to the zero terminated, UTF-8 encoded value of attribute
+            \a attrName if present, or \a def if not.  The pointer remains valid
+            until the attribute block is modified.
+         */
+        const char* getValueAsUTF8(const String& attrName, const char* def = "") const;
+
         /*!
         \brief
             Return the value of attribute \a attrName as a boolean value.
@@ -235,8 +298,56 @@ namespace CEGUI
         float getValueAsFloat(const String& attrName, float def = 0.0f) const;
 
     protected:
-        typedef std::map<String, String, StringFastLessCompare> AttributeMap;
-        AttributeMap    d_attrs;
+        //! UTF-8 text held either in an external buffer or in d_storage.
+        struct Text
+        {
+            //! external text, or 0 when the text is in d_storage.
+            const char* d_data;
+            //! offset of the text in d_storage when d_data is 0.
+            size_t d_offset;
+            //! length of the text in bytes, excluding the terminating zero.
+            size_t d_length;
+        };
+
+        //! a single attribute with lazily created String versions of its text.
+        struct Attribute
+        {
+            Text d_name;
+            Text d_value;
+            mutable String d_nameString;
+            mutable String d_valueString;
+            mutable bool d_nameConverted;
+            mutable bool d_valueConverted;
+        };
+
+        typedef std::vector<Attribute
+            CEGUI_VECTOR_ALLOC(Attribute)> AttributeList;
+        typedef std::vector<char
+            CEGUI_VECTOR_ALLOC(char)> Storage;
+
+        //! return the index of the attribute \a attrName or -1 if it does not exist.
+        int find(const String& attrName) const;
+        //! return the index of the attribute with UTF-8 name \a attrName or -1.
+        int find(const char* attrName, size_t length) const;
+        //! return a pointer to the zero terminated text \a text.
+        const char* getText(const Text& text) const;
+        //! return whether the text \a text is equal to \a str.
+        bool isEqual(const Text& text, const String& str) const;
+        //! copy \a length bytes of UTF-8 text into d_storage.
+        Text storeText(const char* data, size_t length);
+        //! return the String version of the name of attribute \a index.
+        const String& getNameString(size_t index) const;
+        //! return the String version of the value of attribute \a index.
+        const String& getValueString(size_t index) const;
+        //! set attribute \a index to \a attr, or append \a attr if \a index is -1.
+        void setAttribute(int index, const Attribute& attr);
+        //! throw an exception for a value that failed to convert to \a type.
+        void throwConversionError(const String& attrName, const char* type) const;
+
+        //! the attributes, in the order they were added.
+        AttributeList d_attrs;
+        //! storage for attribute text that does not refer to a parser buffer.
+        Storage d_storage;
     };
 
 } // End of  CEGUI namespace section
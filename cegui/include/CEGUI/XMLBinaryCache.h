@@ -0,0 +1,137 @@
+/***********************************************************************
+    filename:   XMLBinaryCache.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIXMLBinaryCache_h_
+#define _CEGUIXMLBinaryCache_h_
+
+#include "CEGUI/Base.h"
+#include "CEGUI/String.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    Binary cache of the XMLHandler events produced by parsing an XML file.
+
+    A cache file holds the element start, text and element end events of one
+    parsed document.  Every name, attribute value and text string is stored
+    once, as zero terminated UTF-8, in a string table at the end of the file,
+    and the events refer to them by offset.  Replaying memory maps the cache
+    file read only and passes the handler attribute blocks that refer straight
+    into the mapping, so none of the XML parsing or attribute copying is
+    repeated and the file is never copied.
+
+    Cache files are named after a key for the source.  When the
+    ResourceProvider reports the size and modification time of the source
+    file (see ResourceProvider::getFileStatus) the key is computed from those
+    and the file's name and resource group, so a cache hit needs neither the
+    source data nor a pass over it.  Otherwise the key is a hash of the
+    loaded source data.  Either way a modified source file misses the cache
+    and gets a new cache file.  The file header holds the format version, the
+    key and the size of the source, and files that do not match are ignored.
+
+    The cache is used by XMLParser::parseXMLFile once a directory has been set
+    with XMLParser::setBinaryCacheDirectory.  Old cache files are never
+    removed automatically.
+*/
+class CEGUIEXPORT XMLBinaryCache
+{
+public:
+    //! Version of the cache file format; files of other versions are ignored.
+    static const uint32 FormatVersion;
+
+    //! Return the 64 bit FNV-1a hash of the data in \a source.
+    static uint64 computeHash(const RawDataContainer& source);
+
+    /*!
+    \brief
+        Return the key for the cache file of \a filename from
+        \a resourceGroup, given the size and modification time of that file
+        as reported by ResourceProvider::getFileStatus.
+    */
+    static uint64 computeFileKey(const String& filename,
+                                 const String& resourceGroup,
+                                 uint64 size, uint64 modifiedTime);
+
+    //! Return the name of the cache file for \a source in \a directory.
+    static String getCacheFilename(const String& directory,
+                                   const RawDataContainer& source);
+
+    //! Return the name of the cache file with the given \a key in \a directory.
+    static String getCacheFilename(const String& directory, uint64 key);
+
+    /*!
+    \brief
+        Replay the cached events for \a source to \a handler.
+
+    \return
+        - true if a valid cache file was found and replayed.
+        - false if there is no valid cache file for \a source, in which case
+          \a handler has not been called.
+    */
+    static bool replay(XMLHandler& handler, const String& directory,
+                       const RawDataContainer& source);
+
+    /*!
+    \brief
+        Replay the events cached under \a key for a source of \a sourceSize
+        bytes to \a handler, without needing the source data.
+
+    \return
+        - true if a valid cache file was found and replayed.
+        - false if there is no valid cache file for \a key, in which case
+          \a handler has not been called.
+    */
+    static bool replay(XMLHandler& handler, const String& directory,
+                       uint64 key, uint64 sourceSize);
+
+    /*!
+    \brief
+        Parse \a source with \a parser for \a handler, recording the events
+        and writing them to a cache file in \a directory once parsing
+        succeeded.  Failure to write the cache file is logged, not thrown.
+    */
+    static void parseAndStore(XMLParser& parser, XMLHandler& handler,
+                              const String& directory,
+                              const RawDataContainer& source,
+                              const String& schemaName);
+
+    /*!
+    \brief
+        As above, but the cache file is stored under \a key, as returned by
+        computeFileKey, rather than under a hash of \a source.
+    */
+    static void parseAndStore(XMLParser& parser, XMLHandler& handler,
+                              const String& directory,
+                              const RawDataContainer& source,
+                              const String& schemaName, uint64 key);
+};
+
+} // End of  CEGUI namespace section
+
+#endif  // end of guard _CEGUIXMLBinaryCache_h_
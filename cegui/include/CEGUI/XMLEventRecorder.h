@@ -0,0 +1,139 @@
+/***********************************************************************
+    filename:   XMLEventRecorder.h
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#ifndef _CEGUIXMLEventRecorder_h_
+#define _CEGUIXMLEventRecorder_h_
+
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/String.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#   pragma warning(push)
+#   pragma warning(disable : 4251)
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+/*!
+\brief
+    XMLHandler that records the events of a parsed document so they can be
+    replayed to another handler later, possibly on another thread.
+
+    Events are held as 32 bit words and every name, attribute value and text
+    string is stored once, as zero terminated UTF-8, in a string table that
+    the events refer to by offset.  An element start is followed by the
+    offset of the element name, the number of attributes and the name and
+    value offsets of each attribute; an element end by the offset of the
+    element name and a text event by the offset of the text.
+*/
+class CEGUIEXPORT XMLEventRecorder :
+    public XMLHandler,
+    public AllocatedObject<XMLEventRecorder>
+{
+public:
+    //! Types of recorded event.
+    enum EventType
+    {
+        ET_ELEMENT_START = 1,
+        ET_ELEMENT_END,
+        ET_TEXT
+    };
+
+    typedef std::vector<uint32 CEGUI_VECTOR_ALLOC(uint32)> EventList;
+
+    /*!
+    \brief
+        Constructor.
+
+    \param target
+        Pointer to a handler that events are passed on to as they are
+        recorded, or 0 to only record them.
+    */
+    XMLEventRecorder(XMLHandler* target = 0);
+
+    // XMLHandler overrides
+    const String& getSchemaName() const;
+    const String& getDefaultResourceGroup() const;
+    void elementStart(const String& element, const XMLAttributes& attributes);
+    void elementEnd(const String& element);
+    void text(const String& text);
+
+    //! Replay the recorded events to \a handler.
+    void replay(XMLHandler& handler) const;
+
+    //! Return the recorded events.
+    const EventList& getEvents() const;
+    //! Return the string table the events refer to.
+    const std::string& getStrings() const;
+    //! Discard all recorded events.
+    void clear();
+
+    /*!
+    \brief
+        Replay events recorded by an XMLEventRecorder and held elsewhere, such
+        as in a cache file.  The events must have been validated with validate.
+    */
+    static void replay(XMLHandler& handler, const uint32* events,
+                       size_t event_words, const char* strings);
+
+    /*!
+    \brief
+        Return whether \a events form complete events that only refer to
+        strings within a zero terminated string table of \a string_bytes bytes.
+    */
+    static bool validate(const uint32* events, size_t event_words,
+                         size_t string_bytes);
+
+protected:
+    //! return the offset of \a str in the string table, adding it if needed.
+    uint32 addString(const String& str);
+
+    typedef std::map<std::string, uint32, std::less<std::string>
+        CEGUI_MAP_ALLOC(std::string, uint32)> StringOffsetMap;
+
+    //! handler events are passed on to, or 0.
+    XMLHandler* d_target;
+    //! the recorded events.
+    EventList d_events;
+    //! the string table.
+    std::string d_strings;
+    //! offset of every string already in the string table.
+    StringOffsetMap d_stringOffsets;
+};
+
+} // End of  CEGUI namespace section
+
+#if defined(_MSC_VER)
+#   pragma warning(pop)
+#endif
+
+#endif  // end of guard _CEGUIXMLEventRecorder_h_
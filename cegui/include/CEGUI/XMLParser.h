@@ -152,6 +152,29 @@ namespace CEGUI
         */
         const String& getIdentifierString() const;
 
+        /*!
+        \brief
+            Set the directory used to cache parsed XML files in binary form.
+
+            When set, parseXMLFile looks for a cache file for the XML file and,
+            if it is present and of the current format version, replays it to
+            the handler instead of parsing the XML.  Cache files are keyed by
+            the file's name, size and modification time where the
+            ResourceProvider reports them, in which case a cache hit does not
+            load the XML file at all, and by a hash of the loaded file's
+            content otherwise.  On a miss the XML is parsed as usual and a
+            cache file is written for the next time.  See XMLBinaryCache for
+            details.
+
+        \param directory
+            String object holding the path of an existing, writable directory,
+            or an empty string to disable the cache (the default).
+        */
+        void setBinaryCacheDirectory(const String& directory);
+
+        //! Return the directory used to cache parsed XML files, empty if disabled.
+        const String& getBinaryCacheDirectory() const;
+
     protected:
         /*!
         \brief
@@ -175,6 +198,7 @@ namespace CEGUI
 
         // data fields
         String d_identifierString;                 //!< String that holds some id information about the module.
+        String d_binaryCacheDirectory;             //!< directory holding binary caches of parsed files, empty if disabled.
 
     private:
         bool d_initialised;     //!< true if the parser module has been initialised,
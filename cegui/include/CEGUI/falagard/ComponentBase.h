@@ -172,6 +172,8 @@ protected:
     ColourRect d_colours;
     //! name of property to fetch colours from.
     String d_colourPropertyName;
+    //! interned ID of d_colourPropertyName.
+    PropertySet::PropertyID d_colourPropertyID;
 };
 
 }
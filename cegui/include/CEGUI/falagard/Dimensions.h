@@ -33,6 +33,7 @@
 #include "../UDim.h"
 #include "../Rect.h"
 #include "../XMLSerializer.h"
+#include "../PropertySet.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -309,6 +310,8 @@ protected:
 
     //! name of the property from which to fetch the image name.
     String d_propertyName;
+    //! interned ID of d_propertyName.
+    PropertySet::PropertyID d_propertyID;
 };
 
 /*!
@@ -677,6 +680,8 @@ protected:
 private:
     //! Propery that this object represents.
     String d_property;
+    //! interned ID of d_property.
+    PropertySet::PropertyID d_propertyID;
     //! String to hold the name of the child to access the property form.
     String d_childName;
     //! String to hold the type of dimension
@@ -889,6 +894,8 @@ public:
 private:
     //! name of property or named area: must access a URect style value.
     String d_namedSource;
+    //! interned ID of d_namedSource, when it names a property.
+    PropertySet::PropertyID d_namedSourcePropertyID;
     //! name of widget look holding the named area to fetch
     String d_namedAreaSourceLook;
 };
@@ -40,18 +40,21 @@ class FormattingSetting
 public:
     //------------------------------------------------------------------------//
     FormattingSetting() :
-        d_value(FalagardXMLHelper<T>::fromString(""))
+        d_value(FalagardXMLHelper<T>::fromString("")),
+        d_propertySourceID(0)
     {}
 
     //------------------------------------------------------------------------//
     FormattingSetting(const String& property_name) :
         d_value(FalagardXMLHelper<T>::fromString("")),
-        d_propertySource(property_name)
+        d_propertySource(property_name),
+        d_propertySourceID(PropertySet::internPropertyName(property_name))
     {}
 
     //------------------------------------------------------------------------//
     FormattingSetting(T val) :
-        d_value(val)
+        d_value(val),
+        d_propertySourceID(0)
     {}
 
     //------------------------------------------------------------------------//
@@ -60,8 +63,14 @@ public:
         if (d_propertySource.empty())
             return d_value;
 
-        return FalagardXMLHelper<T>::fromString(
-            wnd.getProperty(d_propertySource));
+        const Property* const property = wnd.getPropertyInstance(d_propertySourceID);
+        const TypedProperty<T>* const typedProperty =
+            dynamic_cast<const TypedProperty<T>*>(property);
+
+        if (typedProperty)
+            return typedProperty->getNative(&wnd);
+
+        return FalagardXMLHelper<T>::fromString(property->get(&wnd));
     }
 
     //------------------------------------------------------------------------//
@@ -75,6 +84,7 @@ public:
     void setPropertySource(const String& property_name)
     {
         d_propertySource = property_name;
+        d_propertySourceID = PropertySet::internPropertyName(property_name);
     }
 
     //------------------------------------------------------------------------//
@@ -119,6 +129,8 @@ public:
 protected:
     T d_value;
     String d_propertySource;
+    //! interned ID of d_propertySource.
+    PropertySet::PropertyID d_propertySourceID;
 };
 
 template<> void CEGUIEXPORT FormattingSetting<VerticalFormatting>::writeXMLTagToStream(
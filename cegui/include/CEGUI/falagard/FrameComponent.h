@@ -340,7 +340,8 @@ protected:
     {
         FrameImageSource() :
             d_specified(false),
-            d_image(0)
+            d_image(0),
+            d_propertyID(0)
         {}
 
         bool operator==(const FrameImageSource& rhs) const
@@ -358,6 +359,8 @@ protected:
         bool d_specified;
         const Image* d_image;
         String d_propertyName;
+        //! interned ID of d_propertyName.
+        PropertySet::PropertyID d_propertyID;
     };
 
     // implemets abstract from base
@@ -196,6 +196,7 @@ namespace CEGUI
         //! Horizontal formatting to be applied when rendering the image component.
         FormattingSetting<HorizontalFormatting> d_horzFormatting;
         String  d_imagePropertyName;            //!< Name of the property to access to obtain the image to be used.
+        PropertySet::PropertyID d_imagePropertyID; //!< interned ID of d_imagePropertyName.
     };
 
 } // End of  CEGUI namespace section
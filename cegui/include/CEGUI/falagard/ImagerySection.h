@@ -278,6 +278,7 @@ namespace CEGUI
         ImageryList         d_images;           //!< Collection of ImageryComponent objects to be drawn for this ImagerySection.
         TextList            d_texts;            //!< Collection of TextComponent objects to be drawn for this ImagerySection.
         String              d_colourPropertyName;   //!< name of property to fetch colours from.
+        PropertySet::PropertyID d_colourPropertyID; //!< interned ID of d_colourPropertyName.
 
     public:
         typedef ConstVectorIterator<ImageryList> ImageryComponentIterator;
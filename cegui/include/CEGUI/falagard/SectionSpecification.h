@@ -372,8 +372,11 @@ namespace CEGUI
         ColourRect      d_coloursOverride;      //!< Colours to use when override is enabled.
         bool            d_usingColourOverride;  //!< true if colour override is enabled.
         String          d_colourPropertyName;   //!< name of property to fetch colours from.
+        PropertySet::PropertyID d_colourPropertyID; //!< interned ID of d_colourPropertyName.
         //! Name of a property to control whether to draw this section.
         String d_renderControlProperty;
+        //! interned ID of d_renderControlProperty.
+        PropertySet::PropertyID d_renderControlPropertyID;
         //! Comparison value to test against d_renderControlProperty.
         String d_renderControlValue;
         //! Widget upon which d_renderControlProperty is to be accessed.
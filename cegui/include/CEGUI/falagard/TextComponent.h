@@ -325,6 +325,8 @@ namespace CEGUI
         FormattingSetting<HorizontalTextFormatting> d_horzFormatting;
         String  d_textPropertyName;             //!< Name of the property to access to obtain the text string to render.
         String  d_fontPropertyName;             //!< Name of the property to access to obtain the font to use for rendering.
+        PropertySet::PropertyID d_textPropertyID; //!< interned ID of d_textPropertyName.
+        PropertySet::PropertyID d_fontPropertyID; //!< interned ID of d_fontPropertyName.
     };
 
 } // End of  CEGUI namespace section
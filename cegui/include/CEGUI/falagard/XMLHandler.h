@@ -197,6 +197,8 @@ namespace CEGUI
             helper methods
         **************************************************************************/
         static argb_t hexStringToARGB(const String& str);
+        //! convert a zero terminated UTF-8 hex string "AARRGGBB" to argb_t.
+        static argb_t hexStringToARGB(const char* str);
 
         /*************************************************************************
             implementation methods
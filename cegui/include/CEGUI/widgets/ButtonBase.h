@@ -94,6 +94,9 @@ public:
 	*/
 	virtual ~ButtonBase(void);
 
+	// overridden from Window base class
+	virtual void	resetForReuse();
+
 
 protected:
 	/*************************************************************************
@@ -74,6 +74,10 @@ public:
     */
     virtual ~DefaultWindow(void) {}
 
+    // overridden from Window base class
+    void resetForReuse();
+    bool isReusable() const;
+
 
 protected:
     //! helper to update mouse input handled state
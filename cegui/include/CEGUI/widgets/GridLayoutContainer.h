@@ -32,6 +32,9 @@
 
 #include "./LayoutContainer.h"
 #include "../WindowFactory.h"
+#include <map>
+#include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -44,6 +47,10 @@ namespace CEGUI
 /*!
 \brief
     A Layout Container window layouting it's children into a grid
+
+\par
+    Only occupied cells are stored; empty cells have no window, take no memory
+    and are skipped by layouting, so large and mostly empty grids are cheap.
 */
 class CEGUIEXPORT GridLayoutContainer : public LayoutContainer
 {
@@ -77,12 +84,6 @@ public:
     //! The unique typename of this widget
     static const String WidgetTypeName;
 
-    /*************************************************************************
-        Child Widget name suffix constants
-    *************************************************************************/
-    //! Widget name for dummies.
-    static const String DummyName;
-
     /*************************************************************************
         Event name constants
     *************************************************************************/
@@ -110,6 +111,11 @@ public:
     /*!
     \brief
         Sets grid's dimensions.
+
+    \par
+        Children in cells that are still inside the grid keep their cells and
+        stay attached.  Children in cells outside the new grid are removed, and
+        destroyed if they are set to be destroyed by their parent.
     */
     void setGridDimensions(size_t width, size_t height);
     /*!
@@ -194,13 +200,15 @@ public:
 
     /*!
     \brief
-        Retrieves child window that is currently at given grid position
+        Retrieves child window that is currently at given grid position, or 0
+        if that cell is empty
     */
     Window* getChildAtPosition(size_t gridX, size_t gridY);
 
     /*!
     \brief
-        Removes the child window that is currently at given grid position
+        Removes the child window that is currently at given grid position, if
+        there is one
 
     \see
         Window::removeChild
@@ -209,7 +217,8 @@ public:
 
     /*!
     \brief
-        Swaps positions of 2 windows given by their index
+        Swaps the contents of 2 grid cells given by their index, where the
+        index of a cell is gridY * gridWidth + gridX.  Either cell may be empty.
 
     \par
         For advanced users only!
@@ -268,6 +277,28 @@ protected:
     */
     virtual void onChildOrderChanged(WindowEventArgs& e);
 
+    /*!
+    \brief
+        Key identifying a grid cell: (gridY, gridX), so that cells are ordered
+        row by row and a key remains valid when the grid is resized.
+    */
+    typedef std::pair<size_t, size_t> CellKey;
+    //! maps occupied cells to the child windows in them
+    typedef std::map<CellKey, Window*, std::less<CellKey>
+        CEGUI_MAP_ALLOC(CellKey, Window*)> CellMap;
+    //! maps child windows to the cells they occupy
+    typedef std::map<const Window*, CellKey, std::less<const Window*>
+        CEGUI_MAP_ALLOC(const Window*, CellKey)> ChildCellMap;
+
+    //! swaps the contents of two cells, either of which may be empty
+    void swapCells(const CellKey& cell1, const CellKey& cell2);
+
+    //! recalculates d_colSizes and d_rowSizes from all occupied cells
+    void updateCellSizes(const Sizef& contentSize);
+    //! widens column \a gridX and row \a gridY to fit \a size if necessary
+    void growCellSizes(size_t gridX, size_t gridY, const UVector2& size,
+                       const Sizef& contentSize);
+
     //! converts from grid cell position to idx
     size_t mapFromGridToIdx(size_t gridX, size_t gridY,
                             size_t gridWidth, size_t gridHeight) const;
@@ -309,21 +340,30 @@ protected:
      */
     size_t d_nextGridY;
 
-    /** stores next used dummy suffix index
-     * (used to generate unique dummy names)
-     */
-    size_t d_nextDummyIdx;
+    //! occupied cells of the grid
+    CellMap d_cells;
+    //! cell of each child window
+    ChildCellMap d_childCells;
 
-    //! creates a dummy window
-    Window* createDummy();
-    //! checks whether given window is a dummy
-    bool isDummy(Window* wnd) const;
+    //! cached width of each column
+    std::vector<UDim> d_colSizes;
+    //! cached height of each row
+    std::vector<UDim> d_rowSizes;
+    //! whether d_colSizes and d_rowSizes are up to date
+    bool d_cellSizesValid;
+    //! size of the child content area d_colSizes and d_rowSizes were made for
+    Sizef d_cellSizesContentSize;
 
     /// @copydoc Window::addChild_impl
     virtual void addChild_impl(Element* element);
     /// @copydoc Window::removeChild_impl
     virtual void removeChild_impl(Element* element);
 
+    /// @copydoc LayoutContainer::handleChildSized
+    virtual bool handleChildSized(const EventArgs& e);
+    /// @copydoc LayoutContainer::handleChildMarginChanged
+    virtual bool handleChildMarginChanged(const EventArgs& e);
+
 private:
     void addGridLayoutContainerProperties(void);
 };
@@ -66,6 +66,9 @@ public:
 
     /// @copydoc LayoutContainer::layout
     virtual void layout();
+
+    /// @copydoc Window::isReusable
+    virtual bool isReusable() const;
 };
 
 } // End of  CEGUI namespace section
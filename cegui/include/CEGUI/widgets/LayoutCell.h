@@ -89,6 +89,12 @@ public:
     virtual const CachedRectf& getClientChildContentArea() const;
 
     virtual void notifyScreenAreaChanged(bool recursive);
+
+    /// @copydoc Window::resetForReuse
+    virtual void resetForReuse();
+
+    /// @copydoc Window::isReusable
+    virtual bool isReusable() const;
     
 protected:
     /// @copydoc Window::getUnclippedInnerRect_impl
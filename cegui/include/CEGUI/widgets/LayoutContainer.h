@@ -110,6 +110,9 @@ public:
 
     virtual void notifyScreenAreaChanged(bool recursive);
 
+    /// @copydoc Window::resetForReuse
+    virtual void resetForReuse();
+
 protected:
     /// @copydoc Window::getUnclippedInnerRect_impl
     virtual Rectf getUnclippedInnerRect_impl(bool skipAllPixelAlignment) const;
@@ -505,6 +505,22 @@ public:
 	void	handleUpdatedItemData(void);
 
 
+    /*!
+    \brief
+        Causes the list box to update it's internal state after changes have
+        been made to the one attached ListboxItem at index \a item_index.
+
+        For large lists this is cheaper than handleUpdatedItemData(void), since
+        only the cached size of the given item is measured again (unless the
+        list is sorted, in which case the whole list is re-sorted).
+
+    \param item_index
+        The zero based index of the ListboxItem that was changed.  This must be
+        a valid index (0 <= index < getItemCount())
+    */
+    void    handleUpdatedItemData(size_t item_index);
+
+
 	/*!
 	\brief
 		Ensure the item at the specified index is visible within the list box.
@@ -600,6 +616,27 @@ public:
     ListboxItem* getItemAtPoint(const Vector2f& pt) const;
 
 
+    /*!
+    \brief
+        Return the vertical offset, in pixels, of the top of the item at index
+        \a item_index relative to the top of the first item.  Passing
+        getItemCount() returns the same value as getTotalItemsHeight.
+    */
+    float   getItemOffset(size_t item_index) const;
+
+
+    /*!
+    \brief
+        Return the index of the item covering the vertical pixel offset
+        \a offset, measured from the top of the first item.
+
+    \return
+        Index of the item at \a offset, or getItemCount() if \a offset is
+        beyond the last item.  Offsets above the first item return 0.
+    */
+    size_t  getItemIndexAtOffset(float offset) const;
+
+
 	/*************************************************************************
 		Construction and Destruction
 	*************************************************************************/
@@ -689,6 +726,23 @@ protected:
     */
     void resortList();
 
+    /*!
+    \brief
+        Bring the cached item sizes, item offsets and widest item width up to
+        date, measuring only the items whose cached size is no longer valid.
+    */
+    void updateItemMetrics() const;
+
+    //! Mark the cached metrics of every item as invalid.
+    void invalidateItemMetrics();
+
+    //! Mark the cached size of the item at \a item_index as invalid.
+    void invalidateItemMetrics(size_t item_index);
+
+    //! Insert and erase the cached metrics entry for a new / removed item.
+    void insertItemMetrics(size_t item_index);
+    void eraseItemMetrics(size_t item_index);
+
 	/*************************************************************************
 		New event handlers
 	*************************************************************************/
@@ -741,6 +795,8 @@ protected:
 	virtual void	onMouseButtonDown(MouseEventArgs& e);
 	virtual	void	onMouseWheel(MouseEventArgs& e);
 	virtual void	onMouseMove(MouseEventArgs& e);
+    virtual void    onFontChanged(WindowEventArgs& e);
+    virtual bool    handleFontRenderSizeChange(const EventArgs& args);
 
 
 	/*************************************************************************
@@ -756,6 +812,21 @@ protected:
 	LBItemList	d_listItems;		//!< list of items in the list box.
 	ListboxItem*	d_lastSelected;	//!< holds pointer to the last selected item (used in range selections)
 
+    typedef std::vector<Sizef
+        CEGUI_VECTOR_ALLOC(Sizef)> ItemSizeList;
+    typedef std::vector<float
+        CEGUI_VECTOR_ALLOC(float)> ItemOffsetList;
+    //! cached pixel size of each item, a negative width marks a stale entry.
+    mutable ItemSizeList d_itemSizes;
+    //! running total of item heights; entry i is the top of item i.
+    mutable ItemOffsetList d_itemOffsets;
+    //! number of leading entries of d_itemOffsets that are up to date.
+    mutable size_t d_validItemOffsets;
+    //! cached width of the widest item.
+    mutable float d_widestItemWidth;
+    //! whether d_widestItemWidth is up to date.
+    mutable bool d_widestItemWidthValid;
+
     friend class ListboxWindowRenderer;
 
 private:
@@ -33,6 +33,8 @@
 #include "../Base.h"
 #include "../Window.h"
 #include "./ListHeader.h"
+#include <map>
+#include <set>
 
 #if defined(_MSC_VER)
 #	pragma warning(push)
@@ -65,6 +67,57 @@ struct CEGUIEXPORT MCLGridRef
 	bool operator!=(const MCLGridRef& rhs) const;
 };
 
+/*!
+\brief
+    Interface for a model that supplies the rows of a MultiColumnList.
+
+    When a data source is attached to a MultiColumnList, the list no longer
+    holds a ListboxItem for every cell; instead it keeps only an index of
+    source rows in display order and asks the data source for the items of
+    the rows it actually needs - typically just those that are visible.
+
+    Items returned by the data source remain owned by the data source.  The
+    same item should be returned for a given cell each time it is requested,
+    since selection state is held in the items, and items must stay valid
+    until the row is removed or the data source is reset (and the list has
+    been told so via the MultiColumnList::notifyDataSource* functions).
+*/
+class CEGUIEXPORT MultiColumnListDataSource
+{
+public:
+    virtual ~MultiColumnListDataSource() {}
+
+    //! Return the number of rows held by the data source.
+    virtual uint getRowCount() const = 0;
+
+    /*!
+    \brief
+        Return the item to be shown for a cell.
+
+    \param source_row
+        Zero based index of the row within the data source.
+
+    \param col_id
+        ID of the column, as given when the column was added to the list.
+
+    \return
+        Pointer to the ListboxItem for the cell, or 0 if the cell is empty.
+    */
+    virtual ListboxItem* getItem(uint source_row, uint col_id) const = 0;
+
+    /*!
+    \brief
+        Return whether source row \a lhs sorts before source row \a rhs when
+        sorting on the column with ID \a col_id.
+
+        The default implementation compares the items returned by getItem,
+        with an empty cell ordering before any item.  Data sources that can
+        compare their raw data directly should override this so that sorting
+        does not require an item to exist for every row.
+    */
+    virtual bool isRowLess(uint lhs, uint rhs, uint col_id) const;
+};
+
 /*!
 \brief
     Base class for the multi column list window renderer.
@@ -1249,6 +1302,125 @@ public:
 	void	handleUpdatedItemData(void);
 
 
+    /*!
+    \brief
+        Inform the list box that the items in a single row have been
+        externally modified.  If the list is sorted, only that row is moved to
+        its new sorted position, rather than the entire list being re-sorted.
+
+    \param row_idx
+        Zero based index of the row that was modified.
+
+    \return
+        Zero based index of the row after it has been repositioned.
+
+    \exception InvalidRequestException	thrown if \a row_idx is out of range,
+        or if a data source is attached.
+    */
+    uint handleUpdatedRowData(uint row_idx);
+
+
+    /*!
+    \brief
+        Start a batch of updates to the list.
+
+        Until the matching call to endUpdate, rows added to a sorted list are
+        appended rather than inserted at their sorted position, and the work
+        normally done when the list contents change - scrollbar configuration,
+        redraw and firing EventListContentsChanged - is deferred.  Calls may be
+        nested; the deferred work happens once, when the outermost batch ends.
+
+    \note
+        While a batch is in progress row indices returned from functions such
+        as addRow may be invalidated by the sort performed in endUpdate.
+    */
+    void beginUpdate();
+
+    /*!
+    \brief
+        End a batch of updates started with beginUpdate.  When the outermost
+        batch ends the list is sorted once and, if the contents changed,
+        EventListContentsChanged is fired once.
+    */
+    void endUpdate();
+
+    //! Return whether a batch of updates started by beginUpdate is in progress.
+    bool isUpdating() const;
+
+
+    /*!
+    \brief
+        Attach a data source that supplies the rows of the list.
+
+        Any rows previously added to the list are removed (deleting items
+        as required) and the list is populated from \a source, which is sorted
+        according to the current sort column and direction.  While a data
+        source is attached functions that modify rows directly (addRow,
+        insertRow, removeRow, setItem and setRowID) throw an
+        InvalidRequestException; changes are instead made to the data source
+        and the list informed via the notifyDataSource* functions.
+
+        All rows shown from a data source are taken to be the height of the
+        first row.
+
+        Selection of rows shown from a data source is held by the list per
+        cell, keyed on data source row and column ID, so selecting, clearing
+        or counting selections never asks the source for items; an item's
+        selected state is updated as the list fetches it.  Items can only be
+        located (e.g. with getItemGridReference) once the list has fetched
+        them from the source.
+
+    \param source
+        Pointer to the MultiColumnListDataSource to use, or 0 to detach any
+        current data source.  The list does not take ownership of the source.
+    */
+    void setDataSource(MultiColumnListDataSource* source);
+
+    //! Return the attached MultiColumnListDataSource, or 0 if there is none.
+    MultiColumnListDataSource* getDataSource() const;
+
+    /*!
+    \brief
+        Return the index within the attached data source of the row shown at
+        list row \a row_idx.
+
+    \exception InvalidRequestException	thrown if \a row_idx is out of range,
+        or if no data source is attached.
+    */
+    uint getDataSourceRow(uint row_idx) const;
+
+    /*!
+    \brief
+        Inform the list that a row was inserted into the data source at index
+        \a source_row.  Source rows at or after that index are taken to have
+        moved down by one.
+    */
+    void notifyDataSourceRowInserted(uint source_row);
+
+    /*!
+    \brief
+        Inform the list that the row at index \a source_row was removed from
+        the data source.  Source rows after that index are taken to have moved
+        up by one.
+    */
+    void notifyDataSourceRowRemoved(uint source_row);
+
+    /*!
+    \brief
+        Inform the list that the data for the row at index \a source_row in
+        the data source has changed.  If the list is sorted, only that row is
+        moved to its new sorted position.
+    */
+    void notifyDataSourceRowChanged(uint source_row);
+
+    /*!
+    \brief
+        Inform the list that the content of the data source has changed
+        wholesale; the list is rebuilt and re-sorted from the data source.
+    */
+    void notifyDataSourceReset();
+
+
 	/*!
 	\brief
 		Set the width of the specified column header (and therefore the column itself).
@@ -1574,6 +1746,86 @@ protected:
     */
     void resortList();
 
+    /*!
+    \brief
+        Return the item at the given row and column, without range checks.
+        When a data source is attached the item is fetched from it.
+    */
+    ListboxItem* getGridItem(uint row_idx, uint col_idx) const;
+
+    /*!
+    \brief
+        Return the height used for every row when a data source is attached;
+        this is the height of the highest item in the first row.
+    */
+    float getDataSourceRowHeight() const;
+
+    /*!
+    \brief
+        Signal a change to the list contents, or record that the contents
+        changed if a batch of updates is in progress.
+    */
+    void notifyContentsChanged();
+
+    /*!
+    \brief
+        Insert \a source_row into d_sourceRows at its display position, and
+        return the list row index it was inserted at.
+    */
+    uint insertSourceRow(uint source_row);
+
+    /*!
+    \brief
+        Locate an item previously fetched from the data source, without
+        asking the source for any other items.
+
+    \return
+        true if \a item is still shown by the list, in which case \a grid_ref
+        is set to its position.  false if the item is not known.
+    */
+    bool findSourceItem(const ListboxItem* item, MCLGridRef& grid_ref) const;
+
+    //! Return the list row index showing data source row \a source_row.
+    uint getSourceRowIndex(uint source_row) const;
+
+    //! Return whether the data source cell at the given position is selected.
+    bool isSourceCellSelected(uint row_idx, uint col_idx) const;
+
+    /*!
+    \brief
+        Set the selection state of the data source cell at the given position.
+
+    \return
+        true if the selection state changed.
+    */
+    bool setSourceCellSelectState(uint row_idx, uint col_idx, bool state);
+
+    /*!
+    \brief
+        Update the data source row numbers held for selection and item lookup
+        after data source row \a source_row was inserted or removed.
+    */
+    void shiftSourceCells(uint source_row, bool inserted);
+
+    //! Add the items in row \a row_idx of d_grid to d_itemRows.
+    void addItemRows(uint row_idx);
+
+    //! Remove the items in row \a row_idx of d_grid from d_itemRows.
+    void removeItemRows(uint row_idx);
+
+    /*!
+    \brief
+        Move the d_itemRows entries of rows at or after \a first_row down one
+        row if \a inserted is true, or up one row otherwise.
+    */
+    void shiftItemRows(uint first_row, bool inserted);
+
+    //! Throw an InvalidRequestException if a data source is attached.
+    void checkNoDataSource() const;
+
+    //! Throw an InvalidRequestException if no data source is attached.
+    void checkDataSource() const;
+
 	/*************************************************************************
 		New event handlers for multi column list
 	*************************************************************************/
@@ -1731,6 +1983,36 @@ protected:
     //! whether header size will be considered when auto-sizing columns.
     bool d_autoSizeColumnUsesHeader;
 
+    //! data source supplying the rows, or 0 if the list holds its own items.
+    MultiColumnListDataSource* d_dataSource;
+    typedef std::vector<uint CEGUI_VECTOR_ALLOC(uint)> SourceRowList;
+    //! data source row shown at each list row, in display order.
+    SourceRowList d_sourceRows;
+
+    //! nesting depth of beginUpdate / endUpdate calls.
+    uint d_updateDepth;
+    //! true if the list contents changed during the current batch of updates.
+    bool d_updateContentsChanged;
+    //! true if rows were added or changed during the current batch of updates.
+    bool d_updateNeedsSort;
+
+    typedef std::map<const ListboxItem*, uint, std::less<const ListboxItem*>
+        CEGUI_MAP_ALLOC(const ListboxItem*, uint)> ItemRowMap;
+    //! row index of each item in d_grid, kept in step by the row mutators.
+    ItemRowMap d_itemRows;
+
+    //! a data source cell, as its data source row and column ID.
+    typedef std::pair<uint, uint> SourceCell;
+    typedef std::set<SourceCell, std::less<SourceCell>
+        CEGUI_SET_ALLOC(SourceCell)> SourceCellSet;
+    //! selected data source cells; the selection state when a source is set.
+    SourceCellSet d_selectedSourceCells;
+    typedef std::map<const ListboxItem*, SourceCell,
+        std::less<const ListboxItem*>
+        CEGUI_MAP_ALLOC(const ListboxItem*, SourceCell)> SourceItemMap;
+    //! cell each item was last fetched from the data source for.
+    mutable SourceItemMap d_sourceItemCells;
+
     friend class MultiColumnListWindowRenderer;
 
 
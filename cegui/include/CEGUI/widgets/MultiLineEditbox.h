@@ -519,6 +519,18 @@ protected:
 	*/
 	size_t	getNextTokenLength(const String& text, size_t start_idx) const;
 
+    /*!
+    \brief
+        Format the paragraphs of \a text in the range [\a start_idx, \a end_idx)
+        and append the resulting lines to \a lines.  The range must start and
+        end on paragraph boundaries.
+
+    \param wrap_width
+        Width to word-wrap the text to, or 0 for no word-wrapping.
+    */
+    void formatParagraphs(const String& text, size_t start_idx, size_t end_idx,
+                          float wrap_width, LineList& lines) const;
+
 
     /*!
 	\brief
@@ -764,6 +776,12 @@ protected:
 	bool		d_wordWrap;			//!< true when formatting uses word-wrapping.
 	LineList	d_lines;			//!< Holds the lines for the current formatting.
 	float		d_widestExtent;		//!< Holds the extent of the widest line as calculated in the last formatting pass.
+    //! Text as it was when d_lines was last updated, used to find what changed.
+    String      d_formattedText;
+    //! Font used for the lines in d_lines.
+    const Font* d_formattedFont;
+    //! Wrap width used for the lines in d_lines (0 when not wrapping).
+    float       d_formattedWrapWidth;
 
 	// component widget settings
 	bool	d_forceVertScroll;		//!< true if vertical scrollbar should always be displayed
@@ -77,6 +77,9 @@ public:
 	*/
 	virtual ~PushButton(void);
 
+	// overridden from Window base class
+	virtual bool	isReusable() const;
+
 
 protected:
 	/*************************************************************************
@@ -461,6 +461,8 @@ public:
 
     // overrides
     void initialiseComponents(void);
+    void resetForReuse();
+    bool isReusable() const;
 
 protected:
     /*!
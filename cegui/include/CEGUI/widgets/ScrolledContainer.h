@@ -31,6 +31,7 @@
 #include "../Window.h"
 #include "../WindowFactory.h"
 #include <map>
+#include <set>
 
 #if defined(_MSC_VER)
 #   pragma warning(push)
@@ -131,13 +132,33 @@ public:
         Rect object that describes the pixel extents of the attached
         child windows.  This is effectively the smallest bounding box
         that could contain all the attached windows.
+
+    \note
+        The extents are maintained incrementally as child windows are added,
+        removed, moved and sized, so this does not visit every child.
     */
     Rectf getChildExtentsArea(void) const;
+
+    /*!
+    \brief
+        Fire EventContentChanged now if changes to the child windows have
+        happened since it was last fired.
+
+        Changes to the child windows update the content area immediately, but
+        the notification is deferred until the next update, so that many
+        changes within one frame cause only one EventContentChanged (and so
+        one scrollbar update in ScrollablePane).  Call this to get the
+        notification without waiting for the next update.
+    */
+    void notifyContentChangedIfNecessary();
     
     virtual const CachedRectf& getClientChildContentArea() const;
     virtual const CachedRectf& getNonClientChildContentArea() const;
 
     virtual void notifyScreenAreaChanged(bool recursive);
+
+    // overridden from Window.
+    virtual void update(float elapsed);
     
 protected:
     // Overridden from Window.
@@ -170,6 +191,22 @@ protected:
     */
     virtual void onAutoSizeSettingChanged(WindowEventArgs& e);
 
+    /*!
+    \brief
+        Mark the content as changed: the content area is updated now and
+        EventContentChanged fired by the next notifyContentChangedIfNecessary.
+    */
+    void markContentChanged();
+
+    //! returns the pixel area of child window \a wnd within this container.
+    Rectf getChildArea(const Window* wnd) const;
+    //! adds the area of \a wnd to the child extents.
+    void addChildExtents(const Window* wnd) const;
+    //! removes the area of \a wnd from the child extents.
+    void removeChildExtents(const Window* wnd) const;
+    //! recalculates the child extents from all child windows.
+    void rebuildChildExtents() const;
+
     //! handles notifications about child windows being moved.
     bool handleChildSized(const EventArgs& e);
     //! handles notifications about child windows being sized.
@@ -194,6 +231,27 @@ protected:
     Rectf d_contentArea;
     //! true if the pane auto-sizes itself.
     bool d_autosizePane;
+    //! true if EventContentChanged is waiting to be fired.
+    bool d_contentChangePending;
+
+    //! type definition for collection holding the area of each child.
+    typedef std::map<const Window*, Rectf, std::less<const Window*>
+        CEGUI_MAP_ALLOC(const Window*, Rectf)> ChildAreaMap;
+    //! type definition for collection holding one edge of all child areas.
+    typedef std::multiset<float, std::less<float>
+        CEGUI_SET_ALLOC(float)> EdgeSet;
+    //! area of each child, as held in the edge sets below.
+    mutable ChildAreaMap d_childAreas;
+    //! left edges of all child areas.
+    mutable EdgeSet d_childLefts;
+    //! top edges of all child areas.
+    mutable EdgeSet d_childTops;
+    //! right edges of all child areas.
+    mutable EdgeSet d_childRights;
+    //! bottom edges of all child areas.
+    mutable EdgeSet d_childBottoms;
+    //! our pixel size when the child areas were calculated.
+    mutable Sizef d_childAreasPixelSize;
     
     CachedRectf d_clientChildContentArea;
 
@@ -261,6 +261,9 @@ public:
 	*/
 	virtual ~Thumb(void);
 
+	// overridden from Window base class
+	virtual void	resetForReuse();
+
 
 protected:
     // overridden from base class
@@ -33,6 +33,7 @@
 #include "CEGUI/AnimationManager.h"
 #include "CEGUI/Interpolator.h"
 #include "CEGUI/PropertySet.h"
+#include "CEGUI/Property.h"
 #include "CEGUI/AnimationInstance.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
@@ -348,6 +349,17 @@ void Affector::apply(AnimationInstance* instance)
         right->alterInterpolationPosition(
             leftDistance / (leftDistance + rightDistance));
 
+    // try the native path first, it avoids formatting and parsing Strings
+    Property* const property = target->getPropertyInstance(d_targetProperty);
+
+    if (d_interpolator->interpolateNative(*property, instance,
+                                          d_applicationMethod,
+                                          *left, *right,
+                                          interpolationPosition))
+    {
+        return;
+    }
+
     // absolute application method
     if (d_applicationMethod == AM_Absolute)
     {
@@ -0,0 +1,331 @@
+/***********************************************************************
+    filename:   AsyncLogger.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AsyncLogger.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include <cstdio>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <sched.h>
+#endif
+
+#ifdef _MSC_VER
+#define snprintf _snprintf
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+/*
+    A record holds one logged entry.  The sequence number tells producers and
+    the writer who owns the record: it is the claim sequence number of the
+    next entry to be stored in it while the record is free, one more than the
+    claim sequence number of the entry it holds once that entry is published,
+    and is advanced by the capacity when the writer has written it.
+*/
+struct AsyncLogger::Record
+{
+    volatile uint32 d_sequence;
+    std::time_t d_time;
+    LoggingLevel d_level;
+    //! kept between entries so that its capacity is reused.
+    std::string d_text;
+};
+
+//----------------------------------------------------------------------------//
+class AsyncLogger::WriterTask : public ThreadPool::Task
+{
+public:
+    WriterTask(AsyncLogger& logger) :
+        d_logger(logger)
+    {}
+
+    void execute()
+    {
+        d_logger.writeRecords();
+    }
+
+private:
+    AsyncLogger& d_logger;
+};
+
+//----------------------------------------------------------------------------//
+static void yieldThread()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+static const char* getLevelTag(LoggingLevel level)
+{
+    switch(level)
+    {
+    case Errors:
+        return "(Error)\t";
+
+    case Warnings:
+        return "(Warn)\t";
+
+    case Standard:
+        return "(Std) \t";
+
+    case Informative:
+        return "(Info) \t";
+
+    case Insane:
+        return "(Insan)\t";
+
+    default:
+        return "(Unkwn)\t";
+    }
+}
+
+//----------------------------------------------------------------------------//
+AsyncLogger::AsyncLogger(size_t capacity) :
+    d_records(0),
+    d_capacity(2),
+    d_claimSequence(0),
+    d_writeSequence(0),
+    d_writerScheduled(0),
+    d_writerPool(0),
+    d_timestampTime(0)
+{
+    while (d_capacity < capacity && d_capacity < 0x80000000u)
+        d_capacity <<= 1;
+
+    d_records = CEGUI_NEW_ARRAY_PT(Record, d_capacity, AsyncLogger);
+    for (uint32 i = 0; i < d_capacity; ++i)
+    {
+        d_records[i].d_sequence = i;
+        d_records[i].d_time = 0;
+        d_records[i].d_level = Standard;
+    }
+
+    d_timestamp[0] = 0;
+
+    d_writerPool = CEGUI_NEW_AO ThreadPool(1);
+
+    // create log header
+    logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+");
+    logEvent("+                     Crazy Eddie's GUI System - Event log                    +");
+    logEvent("+                          (http://www.cegui.org.uk/)                         +");
+    logEvent("+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+\n");
+    char addr_buff[32];
+    sprintf(addr_buff, "(%p)", static_cast<void*>(this));
+    logEvent("CEGUI::Logger singleton created. " + String(addr_buff));
+}
+
+//----------------------------------------------------------------------------//
+AsyncLogger::~AsyncLogger(void)
+{
+    if (d_ostream.is_open())
+    {
+        char addr_buff[32];
+        sprintf(addr_buff, "(%p)", static_cast<void*>(this));
+        logEvent("CEGUI::Logger singleton destroyed. " + String(addr_buff));
+    }
+
+    flush();
+    CEGUI_DELETE_AO d_writerPool;
+
+    if (d_ostream.is_open())
+        d_ostream.close();
+
+    CEGUI_DELETE_ARRAY_PT(d_records, Record, d_capacity, AsyncLogger);
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::logEvent(const String& message,
+                           LoggingLevel level /* = Standard */)
+{
+    if (level > d_level)
+        return;
+
+    const uint32 sequence = Atomic::add(d_claimSequence, 1) - 1;
+    Record& record = d_records[sequence & (d_capacity - 1)];
+
+    // wait for the writer to free the record if the ring buffer is full.
+    while (Atomic::load(record.d_sequence) != sequence)
+        yieldThread();
+
+    std::time(&record.d_time);
+    record.d_level = level;
+    record.d_text.assign(message.c_str());
+
+    Atomic::store(record.d_sequence, sequence + 1);
+
+    scheduleWriter();
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::setLogFilename(const String& filename, bool append)
+{
+    flush();
+
+    MutexLock lock(d_streamMutex);
+
+    // close current log file (if any)
+    if (d_ostream.is_open())
+        d_ostream.close();
+
+#if defined(_MSC_VER)
+    d_ostream.open(System::getStringTranscoder().stringToStdWString(filename).c_str(),
+                   std::ios_base::out |
+                   (append ? std::ios_base::app : std::ios_base::trunc));
+#else
+    d_ostream.open(filename.c_str(),
+                   std::ios_base::out |
+                   (append ? std::ios_base::app : std::ios_base::trunc));
+#endif
+
+    if (!d_ostream)
+        CEGUI_THROW(FileIOException(
+            "Failed to open file '" + filename + "' for writing"));
+
+    // write out cached log strings.
+    for (Cache::const_iterator iter = d_cache.begin();
+         iter != d_cache.end(); ++iter)
+    {
+        d_ostream << *iter;
+    }
+
+    d_ostream.flush();
+    d_cache.clear();
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::flush()
+{
+    const uint32 last_sequence = Atomic::load(d_claimSequence);
+
+    // entries claimed by other threads and not yet published hold up the
+    // writer, so wait until it has got past all entries claimed so far.
+    for (;;)
+    {
+        d_writerPool->waitUntilIdle();
+
+        if (Atomic::load(d_writeSequence) - last_sequence < 0x80000000u)
+            break;
+
+        yieldThread();
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t AsyncLogger::getCapacity() const
+{
+    return d_capacity;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::scheduleWriter()
+{
+    if (Atomic::load(d_writerScheduled) == 0 &&
+        Atomic::add(d_writerScheduled, 1) == 1)
+    {
+        d_writerPool->submit(CEGUI_NEW_AO WriterTask(*this));
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::writeRecords()
+{
+    MutexLock lock(d_streamMutex);
+
+    for (;;)
+    {
+        uint32 sequence = d_writeSequence;
+        Record* record = &d_records[sequence & (d_capacity - 1)];
+
+        while (Atomic::load(record->d_sequence) == sequence + 1)
+        {
+            writeRecord(*record);
+
+            Atomic::store(record->d_sequence, sequence + d_capacity);
+            Atomic::store(d_writeSequence, ++sequence);
+            record = &d_records[sequence & (d_capacity - 1)];
+        }
+
+        // ensure the written events reach the file, rather than just being
+        // buffered.
+        if (d_ostream.is_open())
+            d_ostream.flush();
+
+        Atomic::store(d_writerScheduled, 0);
+
+        // an entry published after the loop above stopped and before the
+        // flag was cleared did not schedule another task, so check again.
+        if (Atomic::load(record->d_sequence) != sequence + 1 ||
+            Atomic::add(d_writerScheduled, 1) != 1)
+        {
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncLogger::writeRecord(const Record& record)
+{
+    if (record.d_time != d_timestampTime || !d_timestamp[0])
+    {
+        const std::tm* etm = std::localtime(&record.d_time);
+
+        // the entry is still written, without a timestamp, if the time can
+        // not be converted.
+        if (etm)
+            snprintf(d_timestamp, sizeof(d_timestamp),
+                     "%02d/%02d/%04d %02d:%02d:%02d ",
+                     etm->tm_mday, 1 + etm->tm_mon, 1900 + etm->tm_year,
+                     etm->tm_hour, etm->tm_min, etm->tm_sec);
+        else
+            d_timestamp[0] = 0;
+
+        d_timestampTime = record.d_time;
+    }
+
+    d_line.assign(d_timestamp);
+    d_line.append(getLevelTag(record.d_level));
+    d_line.append(record.d_text);
+    d_line.push_back('\n');
+
+    if (d_ostream.is_open())
+        d_ostream << d_line;
+    else
+        d_cache.push_back(d_line);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,870 @@
+/***********************************************************************
+    filename:   AsyncResourceLoader.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AsyncResourceLoader.h"
+#include "CEGUI/XMLEventRecorder.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/Scheme.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/Font_xmlHandler.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+
+#include <vector>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// singleton instance pointer
+template<> AsyncResourceLoader* Singleton<AsyncResourceLoader>::ms_Singleton = 0;
+
+//----------------------------------------------------------------------------//
+// Elements and attributes that refer to other files.
+static const String SchemeSchemaName("GUIScheme.xsd");
+static const String LookNFeelSchemaName("Falagard.xsd");
+static const String SchemeImagesetElement("Imageset");
+static const String SchemeImagesetFromImageElement("ImagesetFromImage");
+static const String SchemeFontElement("Font");
+static const String SchemeLookNFeelElement("LookNFeel");
+static const String SchemeFilenameAttribute("filename");
+static const String SchemeResourceGroupAttribute("resourceGroup");
+static const String ImagesetElement("Imageset");
+static const String ImagesetImageFileAttribute("imagefile");
+static const String ImagesetResourceGroupAttribute("resourceGroup");
+
+//----------------------------------------------------------------------------//
+// Pixel data decoded by the image codec on a worker thread.
+struct AsyncResourceLoader::PreparedImage :
+    public AllocatedObject<AsyncResourceLoader::PreparedImage>
+{
+    //! load that prepared the image.
+    AsyncLoad* d_owner;
+    std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)> d_pixels;
+    Sizef d_size;
+    Texture::PixelFormat d_format;
+};
+
+//----------------------------------------------------------------------------//
+// XML parsed on a worker thread.
+struct AsyncResourceLoader::PreparedXML :
+    public AllocatedObject<AsyncResourceLoader::PreparedXML>
+{
+    //! load that prepared the XML.
+    AsyncLoad* d_owner;
+    XMLEventRecorder* d_recorder;
+};
+
+//----------------------------------------------------------------------------//
+// Texture handed to the image codec on a worker thread, which keeps a copy of
+// the decoded pixels rather than creating a renderer texture.
+class AsyncCaptureTexture : public Texture
+{
+public:
+    AsyncCaptureTexture(std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)>& pixels,
+                        const bool* pixel_format_supported) :
+        d_name("AsyncResourceLoader/capture"),
+        d_size(0, 0),
+        d_texelScaling(0, 0),
+        d_pixels(pixels),
+        d_pixelFormatSupported(pixel_format_supported),
+        d_format(PF_RGBA),
+        d_captured(false)
+    {}
+
+    //! return whether pixel data in a supported format was captured.
+    bool isCaptured() const { return d_captured; }
+    PixelFormat getFormat() const { return d_format; }
+
+    const String& getName() const { return d_name; }
+    const Sizef& getSize() const { return d_size; }
+    const Sizef& getOriginalDataSize() const { return d_size; }
+    const Vector2f& getTexelScaling() const { return d_texelScaling; }
+
+    void loadFromFile(const String&, const String&)
+    {
+        CEGUI_THROW(InvalidRequestException(
+            "AsyncCaptureTexture only captures pixel data from an image codec."));
+    }
+
+    void loadFromMemory(const void* buffer, const Sizef& buffer_size,
+                        PixelFormat pixel_format)
+    {
+        size_t bytes_per_pixel;
+        switch (pixel_format)
+        {
+        case PF_RGB:
+            bytes_per_pixel = 3;
+            break;
+        case PF_RGBA:
+            bytes_per_pixel = 4;
+            break;
+        case PF_RGBA_4444:
+        case PF_RGB_565:
+            bytes_per_pixel = 2;
+            break;
+        default:
+            // the data size of compressed formats is not known here, so leave
+            // those to be loaded on the main thread.
+            return;
+        }
+
+        const size_t size = static_cast<size_t>(buffer_size.d_width) *
+                            static_cast<size_t>(buffer_size.d_height) *
+                            bytes_per_pixel;
+        const uint8* const data = static_cast<const uint8*>(buffer);
+        d_pixels.assign(data, data + size);
+        d_size = buffer_size;
+        d_format = pixel_format;
+        d_captured = size != 0;
+    }
+
+    void blitFromMemory(void*, const Rectf&) {}
+    void blitToMemory(void*) {}
+
+    bool isPixelFormatSupported(const PixelFormat fmt) const
+    {
+        return d_pixelFormatSupported[fmt];
+    }
+
+private:
+    const String d_name;
+    Sizef d_size;
+    const Vector2f d_texelScaling;
+    std::vector<uint8 CEGUI_VECTOR_ALLOC(uint8)>& d_pixels;
+    const bool* const d_pixelFormatSupported;
+    PixelFormat d_format;
+    bool d_captured;
+};
+
+//----------------------------------------------------------------------------//
+// Base for the tasks that prepare the files of a load on a worker thread.
+class AsyncPrepareTask : public ThreadPool::Task
+{
+public:
+    AsyncPrepareTask(AsyncResourceLoader& loader, AsyncLoad& load,
+                     const String& filename, const String& resource_group) :
+        d_loader(loader),
+        d_load(load),
+        d_filename(filename),
+        d_resourceGroup(resource_group)
+    {}
+
+    void execute()
+    {
+        // nothing is stored if preparing fails, so the file is loaded again
+        // when the resource is created, which reports the error as usual.
+        // The exceptions are not logged here, so the reason is kept for
+        // update to log on the main thread.
+        CEGUI_TRY
+        {
+            prepare();
+        }
+        CEGUI_CATCH (const std::exception& e)
+        {
+            d_loader.prepareFailed(d_load, d_filename, d_resourceGroup,
+                                   e.what());
+        }
+        CEGUI_CATCH (...)
+        {
+            d_loader.prepareFailed(d_load, d_filename, d_resourceGroup,
+                                   "unknown exception");
+        }
+
+        d_loader.taskFinished(d_load);
+    }
+
+protected:
+    virtual void prepare() = 0;
+
+    AsyncResourceLoader& d_loader;
+    AsyncLoad& d_load;
+    const String d_filename;
+    const String d_resourceGroup;
+};
+
+//----------------------------------------------------------------------------//
+// Queues the preparation of the files referred to by a scheme or imageset.
+class AsyncReferenceCollector : public XMLHandler
+{
+public:
+    AsyncReferenceCollector(AsyncResourceLoader& loader, AsyncLoad& load,
+                            AsyncLoad::ResourceType type) :
+        d_loader(loader),
+        d_load(load),
+        d_type(type)
+    {}
+
+    const String& getDefaultResourceGroup() const
+    {
+        static const String no_group;
+        return no_group;
+    }
+
+    void elementStart(const String& element, const XMLAttributes& attributes)
+    {
+        if (d_type == AsyncLoad::RT_IMAGESET)
+        {
+            if (element == ImagesetElement)
+                d_loader.submitImage(d_load,
+                    attributes.getValueAsString(ImagesetImageFileAttribute),
+                    attributes.getValueAsString(ImagesetResourceGroupAttribute));
+
+            return;
+        }
+
+        const String filename(
+            attributes.getValueAsString(SchemeFilenameAttribute));
+        const String resource_group(
+            attributes.getValueAsString(SchemeResourceGroupAttribute));
+
+        if (element == SchemeImagesetElement)
+            d_loader.submitXML(d_load, AsyncLoad::RT_IMAGESET,
+                               filename, resource_group);
+        else if (element == SchemeFontElement)
+            d_loader.submitXML(d_load, AsyncLoad::RT_FONT,
+                               filename, resource_group);
+        else if (element == SchemeLookNFeelElement)
+            d_loader.submitXML(d_load, AsyncLoad::RT_LOOKNFEEL,
+                               filename, resource_group);
+        else if (element == SchemeImagesetFromImageElement)
+            d_loader.submitImage(d_load, filename, resource_group);
+    }
+
+private:
+    AsyncResourceLoader& d_loader;
+    AsyncLoad& d_load;
+    const AsyncLoad::ResourceType d_type;
+};
+
+//----------------------------------------------------------------------------//
+// Reads and parses an XML file, queueing the files it refers to.
+class AsyncPrepareXMLTask : public AsyncPrepareTask
+{
+public:
+    AsyncPrepareXMLTask(AsyncResourceLoader& loader, AsyncLoad& load,
+                        AsyncLoad::ResourceType type, const String& filename,
+                        const String& resource_group) :
+        AsyncPrepareTask(loader, load, filename, resource_group),
+        d_type(type)
+    {}
+
+protected:
+    void prepare()
+    {
+        ResourceProvider* const provider =
+            System::getSingleton().getResourceProvider();
+
+        RawDataContainer data;
+        provider->loadRawDataContainer(d_filename, data, d_resourceGroup);
+
+        XMLEventRecorder* const recorder = CEGUI_NEW_AO XMLEventRecorder;
+
+        CEGUI_TRY
+        {
+            System::getSingleton().getXMLParser()->parseXML(
+                *recorder, data, d_loader.d_schemaNames[d_type]);
+        }
+        CEGUI_CATCH (...)
+        {
+            CEGUI_DELETE_AO recorder;
+            provider->unloadRawDataContainer(data);
+            CEGUI_RETHROW;
+        }
+
+        provider->unloadRawDataContainer(data);
+
+        if (d_type == AsyncLoad::RT_SCHEME || d_type == AsyncLoad::RT_IMAGESET)
+        {
+            AsyncReferenceCollector collector(d_loader, d_load, d_type);
+            recorder->replay(collector);
+        }
+
+        d_loader.storeXML(d_load, d_filename, d_resourceGroup, recorder);
+    }
+
+    const AsyncLoad::ResourceType d_type;
+};
+
+//----------------------------------------------------------------------------//
+// Reads and decodes an image file.
+class AsyncPrepareImageTask : public AsyncPrepareTask
+{
+public:
+    AsyncPrepareImageTask(AsyncResourceLoader& loader, AsyncLoad& load,
+                          const String& filename,
+                          const String& resource_group) :
+        AsyncPrepareTask(loader, load, filename, resource_group)
+    {}
+
+protected:
+    void prepare()
+    {
+        ResourceProvider* const provider =
+            System::getSingleton().getResourceProvider();
+
+        RawDataContainer data;
+        provider->loadRawDataContainer(d_filename, data, d_resourceGroup);
+
+        AsyncResourceLoader::PreparedImage* const image =
+            CEGUI_NEW_AO AsyncResourceLoader::PreparedImage;
+        AsyncCaptureTexture capture(image->d_pixels,
+                                    d_loader.d_pixelFormatSupported);
+        Texture* result;
+
+        CEGUI_TRY
+        {
+            result = System::getSingleton().getImageCodec().load(data, &capture);
+        }
+        CEGUI_CATCH (...)
+        {
+            CEGUI_DELETE_AO image;
+            provider->unloadRawDataContainer(data);
+            CEGUI_RETHROW;
+        }
+
+        provider->unloadRawDataContainer(data);
+
+        if (!result || !capture.isCaptured())
+        {
+            CEGUI_DELETE_AO image;
+            return;
+        }
+
+        image->d_size = capture.getSize();
+        image->d_format = capture.getFormat();
+        d_loader.storeImage(d_load, d_filename, d_resourceGroup, image);
+    }
+};
+
+//----------------------------------------------------------------------------//
+AsyncLoad::AsyncLoad(ResourceType type, const String& filename,
+                     const String& resource_group) :
+    d_type(type),
+    d_filename(filename),
+    d_resourceGroup(resource_group),
+    d_status(S_PREPARING),
+    d_pendingTasks(0),
+    d_preparedFiles(0),
+    d_usedFiles(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoad::ResourceType AsyncLoad::getType() const
+{
+    return d_type;
+}
+
+//----------------------------------------------------------------------------//
+const String& AsyncLoad::getFilename() const
+{
+    return d_filename;
+}
+
+//----------------------------------------------------------------------------//
+const String& AsyncLoad::getResourceGroup() const
+{
+    return d_resourceGroup;
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoad::Status AsyncLoad::getStatus() const
+{
+    MutexLock lock(d_mutex);
+    return d_status;
+}
+
+//----------------------------------------------------------------------------//
+bool AsyncLoad::isComplete() const
+{
+    const Status status = getStatus();
+    return status == S_COMPLETE || status == S_FAILED;
+}
+
+//----------------------------------------------------------------------------//
+const String& AsyncLoad::getError() const
+{
+    return d_error;
+}
+
+//----------------------------------------------------------------------------//
+size_t AsyncLoad::getPreparedFileCount() const
+{
+    MutexLock lock(d_mutex);
+    return d_preparedFiles;
+}
+
+//----------------------------------------------------------------------------//
+size_t AsyncLoad::getUsedFileCount() const
+{
+    MutexLock lock(d_mutex);
+    return d_usedFiles;
+}
+
+//----------------------------------------------------------------------------//
+AsyncResourceLoader::AsyncResourceLoader(size_t thread_count) :
+    d_threadPool(0)
+{
+    // ask the renderer which formats it supports now, since textures can not
+    // be created on the worker threads.
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    Texture& probe = renderer->createTexture("AsyncResourceLoader/probe");
+    for (int fmt = 0; fmt <= Texture::PF_RGBA_DXT5; ++fmt)
+        d_pixelFormatSupported[fmt] = probe.isPixelFormatSupported(
+            static_cast<Texture::PixelFormat>(fmt));
+    renderer->destroyTexture(probe);
+
+    d_schemaNames[AsyncLoad::RT_SCHEME] = SchemeSchemaName;
+    d_schemaNames[AsyncLoad::RT_IMAGESET] =
+        ImageManager::getSingleton().getSchemaName();
+    d_schemaNames[AsyncLoad::RT_FONT] = Font_xmlHandler::FontSchemaName;
+    d_schemaNames[AsyncLoad::RT_LOOKNFEEL] = LookNFeelSchemaName;
+
+    d_threadPool = CEGUI_NEW_AO ThreadPool(thread_count);
+
+    Logger::getSingleton().logEvent(
+        "CEGUI::AsyncResourceLoader singleton created with " +
+        PropertyHelper<uint>::toString(
+            static_cast<uint>(d_threadPool->getThreadCount())) +
+        " worker threads.");
+}
+
+//----------------------------------------------------------------------------//
+AsyncResourceLoader::~AsyncResourceLoader()
+{
+    // finishes the queued tasks, so nothing refers to the loads after this.
+    CEGUI_DELETE_AO d_threadPool;
+
+    for (LoadQueue::iterator i = d_loads.begin(); i != d_loads.end(); ++i)
+    {
+        AsyncLoad& load = **i;
+        MutexLock lock(load.d_mutex);
+        load.d_status = AsyncLoad::S_FAILED;
+        load.d_error = "The AsyncResourceLoader was destroyed before the "
+                       "load completed.";
+    }
+
+    releasePrepared(0);
+
+    Logger::getSingleton().logEvent(
+        "CEGUI::AsyncResourceLoader singleton destroyed.");
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoadHandle AsyncResourceLoader::loadScheme(const String& filename,
+                                                const String& resource_group)
+{
+    return startLoad(AsyncLoad::RT_SCHEME, filename, resource_group);
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoadHandle AsyncResourceLoader::loadImageset(const String& filename,
+                                                  const String& resource_group)
+{
+    return startLoad(AsyncLoad::RT_IMAGESET, filename, resource_group);
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoadHandle AsyncResourceLoader::loadFont(const String& filename,
+                                              const String& resource_group)
+{
+    return startLoad(AsyncLoad::RT_FONT, filename, resource_group);
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoadHandle AsyncResourceLoader::loadLookNFeel(const String& filename,
+                                                   const String& resource_group)
+{
+    return startLoad(AsyncLoad::RT_LOOKNFEEL, filename, resource_group);
+}
+
+//----------------------------------------------------------------------------//
+AsyncLoadHandle AsyncResourceLoader::startLoad(AsyncLoad::ResourceType type,
+                                               const String& filename,
+                                               const String& resource_group)
+{
+    AsyncLoad* const load =
+        CEGUI_NEW_AO AsyncLoad(type, filename, resource_group);
+
+    // the default groups are resolved here, so the workers need not read them
+    load->d_defaultGroups[AsyncLoad::RT_SCHEME] =
+        Scheme::getDefaultResourceGroup();
+    load->d_defaultGroups[AsyncLoad::RT_IMAGESET] =
+        ImageManager::getImagesetDefaultResourceGroup();
+    load->d_defaultGroups[AsyncLoad::RT_FONT] = Font::getDefaultResourceGroup();
+    load->d_defaultGroups[AsyncLoad::RT_LOOKNFEEL] =
+        WidgetLookManager::getDefaultResourceGroup();
+
+    const AsyncLoadHandle handle(load);
+    d_loads.push_back(handle);
+
+    submitXML(*load, type, filename, resource_group);
+
+    return handle;
+}
+
+//----------------------------------------------------------------------------//
+size_t AsyncResourceLoader::update()
+{
+    size_t completed = 0;
+
+    while (!d_loads.empty())
+    {
+        AsyncLoadHandle handle(d_loads.front());
+        AsyncLoad& load = *handle;
+
+        if (load.getStatus() != AsyncLoad::S_READY)
+            break;
+
+        d_loads.pop_front();
+
+        logPrepareErrors(load);
+
+        bool failed = false;
+        String error;
+
+        CEGUI_TRY
+        {
+            createResource(load);
+        }
+        CEGUI_CATCH (const Exception& e)
+        {
+            failed = true;
+            error = e.getMessage();
+        }
+
+        releasePrepared(&load);
+
+        {
+            MutexLock lock(load.d_mutex);
+            load.d_status = failed ? AsyncLoad::S_FAILED :
+                                     AsyncLoad::S_COMPLETE;
+            load.d_error = error;
+        }
+
+        ++completed;
+    }
+
+    return completed;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::createResource(const AsyncLoad& load) const
+{
+    switch (load.d_type)
+    {
+    case AsyncLoad::RT_SCHEME:
+        SchemeManager::getSingleton().createFromFile(load.d_filename,
+                                                     load.d_resourceGroup);
+        break;
+
+    case AsyncLoad::RT_IMAGESET:
+        ImageManager::getSingleton().loadImageset(load.d_filename,
+                                                  load.d_resourceGroup);
+        break;
+
+    case AsyncLoad::RT_FONT:
+        FontManager::getSingleton().createFromFile(load.d_filename,
+                                                   load.d_resourceGroup);
+        break;
+
+    case AsyncLoad::RT_LOOKNFEEL:
+        WidgetLookManager::getSingleton().parseLookNFeelSpecificationFromFile(
+            load.d_filename, load.d_resourceGroup);
+        break;
+
+    default:
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::wait(const AsyncLoadHandle& load)
+{
+    while (!load->isComplete())
+    {
+        // once idle, every load started so far is ready to complete.
+        d_threadPool->waitUntilIdle();
+
+        if (!update())
+            break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::waitAll()
+{
+    while (!d_loads.empty())
+    {
+        d_threadPool->waitUntilIdle();
+
+        if (!update())
+            break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t AsyncResourceLoader::getPendingLoadCount() const
+{
+    return d_loads.size();
+}
+
+//----------------------------------------------------------------------------//
+ThreadPool& AsyncResourceLoader::getThreadPool()
+{
+    return *d_threadPool;
+}
+
+//----------------------------------------------------------------------------//
+XMLEventRecorder* AsyncResourceLoader::takePreparedXML(
+    const String& filename, const String& resource_group)
+{
+    MutexLock lock(d_mutex);
+
+    const PreparedXMLMap::iterator i =
+        d_preparedXML.find(FileKey(resource_group, filename));
+
+    if (i == d_preparedXML.end())
+        return 0;
+
+    PreparedXML* const prepared = i->second;
+    d_preparedXML.erase(i);
+
+    {
+        MutexLock owner_lock(prepared->d_owner->d_mutex);
+        ++prepared->d_owner->d_usedFiles;
+    }
+
+    XMLEventRecorder* const recorder = prepared->d_recorder;
+    CEGUI_DELETE_AO prepared;
+
+    return recorder;
+}
+
+//----------------------------------------------------------------------------//
+Texture* AsyncResourceLoader::createPreparedTexture(
+    const String& name, const String& filename, const String& resource_group)
+{
+    PreparedImage* image;
+
+    {
+        MutexLock lock(d_mutex);
+
+        const PreparedImageMap::iterator i =
+            d_preparedImages.find(FileKey(resource_group, filename));
+
+        if (i == d_preparedImages.end())
+            return 0;
+
+        image = i->second;
+        d_preparedImages.erase(i);
+
+        MutexLock owner_lock(image->d_owner->d_mutex);
+        ++image->d_owner->d_usedFiles;
+    }
+
+    Renderer* const renderer = System::getSingleton().getRenderer();
+    Texture& texture = renderer->createTexture(name);
+
+    CEGUI_TRY
+    {
+        texture.loadFromMemory(&image->d_pixels[0], image->d_size,
+                               image->d_format);
+    }
+    CEGUI_CATCH (...)
+    {
+        CEGUI_DELETE_AO image;
+        renderer->destroyTexture(texture);
+        CEGUI_RETHROW;
+    }
+
+    CEGUI_DELETE_AO image;
+
+    return &texture;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::submitXML(AsyncLoad& load,
+                                    AsyncLoad::ResourceType type,
+                                    const String& filename,
+                                    const String& resource_group)
+{
+    {
+        MutexLock lock(load.d_mutex);
+        ++load.d_pendingTasks;
+    }
+
+    d_threadPool->submit(CEGUI_NEW_AO AsyncPrepareXMLTask(*this, load, type,
+        filename,
+        resource_group.empty() ? load.d_defaultGroups[type] : resource_group));
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::submitImage(AsyncLoad& load, const String& filename,
+                                      const String& resource_group)
+{
+    {
+        MutexLock lock(load.d_mutex);
+        ++load.d_pendingTasks;
+    }
+
+    // images use the default group of imagesets, as in ImageManager.
+    d_threadPool->submit(CEGUI_NEW_AO AsyncPrepareImageTask(*this, load,
+        filename,
+        resource_group.empty() ? load.d_defaultGroups[AsyncLoad::RT_IMAGESET] :
+                                 resource_group));
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::taskFinished(AsyncLoad& load)
+{
+    MutexLock lock(load.d_mutex);
+
+    if (!--load.d_pendingTasks && load.d_status == AsyncLoad::S_PREPARING)
+        load.d_status = AsyncLoad::S_READY;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::prepareFailed(AsyncLoad& load, const String& filename,
+                                        const String& resource_group,
+                                        const String& error)
+{
+    MutexLock lock(load.d_mutex);
+    load.d_prepareErrors.push_back("AsyncResourceLoader: unable to prepare '" +
+        filename + "' from resource group '" + resource_group +
+        "', so it is loaded on the main thread instead: " + error);
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::logPrepareErrors(AsyncLoad& load) const
+{
+    AsyncLoad::ErrorList errors;
+
+    {
+        MutexLock lock(load.d_mutex);
+        errors.swap(load.d_prepareErrors);
+    }
+
+    for (size_t i = 0; i < errors.size(); ++i)
+        Logger::getSingleton().logEvent(errors[i], Warnings);
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::storeXML(AsyncLoad& load, const String& filename,
+                                   const String& resource_group,
+                                   XMLEventRecorder* recorder)
+{
+    MutexLock lock(d_mutex);
+
+    const FileKey key(resource_group, filename);
+
+    // another load prepared the same file first.
+    if (d_preparedXML.find(key) != d_preparedXML.end())
+    {
+        CEGUI_DELETE_AO recorder;
+        return;
+    }
+
+    PreparedXML* const prepared = CEGUI_NEW_AO PreparedXML;
+    prepared->d_owner = &load;
+    prepared->d_recorder = recorder;
+    d_preparedXML[key] = prepared;
+
+    MutexLock load_lock(load.d_mutex);
+    ++load.d_preparedFiles;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::storeImage(AsyncLoad& load, const String& filename,
+                                     const String& resource_group,
+                                     PreparedImage* image)
+{
+    MutexLock lock(d_mutex);
+
+    const FileKey key(resource_group, filename);
+
+    if (d_preparedImages.find(key) != d_preparedImages.end())
+    {
+        CEGUI_DELETE_AO image;
+        return;
+    }
+
+    image->d_owner = &load;
+    d_preparedImages[key] = image;
+
+    MutexLock load_lock(load.d_mutex);
+    ++load.d_preparedFiles;
+}
+
+//----------------------------------------------------------------------------//
+void AsyncResourceLoader::releasePrepared(const AsyncLoad* owner)
+{
+    MutexLock lock(d_mutex);
+
+    for (PreparedXMLMap::iterator i = d_preparedXML.begin();
+         i != d_preparedXML.end(); )
+    {
+        if (owner && i->second->d_owner != owner)
+        {
+            ++i;
+            continue;
+        }
+
+        CEGUI_DELETE_AO i->second->d_recorder;
+        CEGUI_DELETE_AO i->second;
+        d_preparedXML.erase(i++);
+    }
+
+    for (PreparedImageMap::iterator i = d_preparedImages.begin();
+         i != d_preparedImages.end(); )
+    {
+        if (owner && i->second->d_owner != owner)
+        {
+            ++i;
+            continue;
+        }
+
+        CEGUI_DELETE_AO i->second;
+        d_preparedImages.erase(i++);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -37,6 +37,21 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+namespace
+{
+inline void setPackedVertex(PackedVertex& vertex, float x, float y,
+                            float u, float v, argb_t colour)
+{
+    vertex.x = x;
+    vertex.y = y;
+    vertex.u = u;
+    vertex.v = v;
+    vertex.colour = colour;
+}
+}
+
+//----------------------------------------------------------------------------//
 const String ImageTypeAttribute( "type" );
 const String ImageNameAttribute( "name" );
 const String ImageTextureAttribute( "texture" );
@@ -112,6 +127,12 @@ void BasicImage::setTexture(Texture* texture)
     d_texture = texture;
 }
 
+//----------------------------------------------------------------------------//
+Texture* BasicImage::getTexture() const
+{
+    return d_texture;
+}
+
 //----------------------------------------------------------------------------//
 void BasicImage::setArea(const Rectf& pixel_area)
 {
@@ -182,32 +203,31 @@ const Vector2f& BasicImage::getRenderedOffset() const
 void BasicImage::render(GeometryBuffer& buffer, const Rectf& dest_area,
                         const Rectf* clip_area, const ColourRect& colours) const
 {
-    const QuadSplitMode quad_split_mode(TopLeftToBottomRight);
+    // buffers that draw packed vertices directly are given those instead.
+    if (buffer.isPackedGeometryNative())
+    {
+        PackedVertex vbuffer[6];
+        uint vertex_count;
+        Texture* texture;
 
-    Rectf dest(dest_area);
-    // apply rendering offset to the destination Rect
-    dest.offset(d_scaledOffset);
+        getPackedGeometry(vbuffer, vertex_count, texture,
+                          dest_area, clip_area, colours);
 
-    // get the rect area that we will actually draw to (i.e. perform clipping)
-    Rectf final_rect(clip_area ? dest.getIntersection(*clip_area) : dest );
+        if (vertex_count)
+        {
+            buffer.setActiveTexture(texture);
+            buffer.appendPackedGeometry(vbuffer, vertex_count);
+        }
 
-    // check if rect was totally clipped
-    if ((final_rect.getWidth() == 0) || (final_rect.getHeight() == 0))
         return;
+    }
 
-    // Obtain correct scale values from the texture
-    const Vector2f& scale = d_texture->getTexelScaling();
-    const Vector2f tex_per_pix(d_area.getWidth() / dest.getWidth(), d_area.getHeight() / dest.getHeight());
-
-    // calculate final, clipped, texture co-ordinates
-    const Rectf tex_rect((d_area.d_min + ((final_rect.d_min - dest.d_min) * tex_per_pix)) * scale,
-                          (d_area.d_max + ((final_rect.d_max - dest.d_max) * tex_per_pix)) * scale);
+    const QuadSplitMode quad_split_mode(TopLeftToBottomRight);
 
-    // URGENT FIXME: Shouldn't this be in the hands of the user?
-    final_rect.d_min.d_x = CoordConverter::alignToPixels(final_rect.d_min.d_x);
-    final_rect.d_min.d_y = CoordConverter::alignToPixels(final_rect.d_min.d_y);
-    final_rect.d_max.d_x = CoordConverter::alignToPixels(final_rect.d_max.d_x);
-    final_rect.d_max.d_y = CoordConverter::alignToPixels(final_rect.d_max.d_y);
+    Rectf final_rect;
+    Rectf tex_rect;
+    if (!getRenderAreas(dest_area, clip_area, final_rect, tex_rect))
+        return;
 
     Vertex vbuffer[6];
 
@@ -273,6 +293,73 @@ void BasicImage::render(GeometryBuffer& buffer, const Rectf& dest_area,
     buffer.appendGeometry(vbuffer, 6);
 }
 
+//----------------------------------------------------------------------------//
+bool BasicImage::getPackedGeometry(PackedVertex* vbuff, uint& vertex_count,
+                                   Texture*& texture, const Rectf& dest_area,
+                                   const Rectf* clip_area,
+                                   const ColourRect& colours) const
+{
+    vertex_count = 0;
+    texture = d_texture;
+
+    Rectf final_rect;
+    Rectf tex_rect;
+    if (!getRenderAreas(dest_area, clip_area, final_rect, tex_rect))
+        return true;
+
+    const argb_t top_left = colours.d_top_left.getARGB();
+    const argb_t bottom_right = colours.d_bottom_right.getARGB();
+
+    // the same two triangles as render, split top-left to bottom-right.
+    setPackedVertex(vbuff[0], final_rect.left(), final_rect.top(),
+                    tex_rect.left(), tex_rect.top(), top_left);
+    setPackedVertex(vbuff[1], final_rect.left(), final_rect.bottom(),
+                    tex_rect.left(), tex_rect.bottom(),
+                    colours.d_bottom_left.getARGB());
+    setPackedVertex(vbuff[2], final_rect.right(), final_rect.bottom(),
+                    tex_rect.right(), tex_rect.bottom(), bottom_right);
+    setPackedVertex(vbuff[3], final_rect.right(), final_rect.top(),
+                    tex_rect.right(), tex_rect.top(),
+                    colours.d_top_right.getARGB());
+    vbuff[4] = vbuff[0];
+    vbuff[5] = vbuff[2];
+
+    vertex_count = 6;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool BasicImage::getRenderAreas(const Rectf& dest_area, const Rectf* clip_area,
+                                Rectf& final_rect, Rectf& tex_rect) const
+{
+    Rectf dest(dest_area);
+    // apply rendering offset to the destination Rect
+    dest.offset(d_scaledOffset);
+
+    // get the rect area that we will actually draw to (i.e. perform clipping)
+    final_rect = clip_area ? dest.getIntersection(*clip_area) : dest;
+
+    // check if rect was totally clipped
+    if ((final_rect.getWidth() == 0) || (final_rect.getHeight() == 0))
+        return false;
+
+    // Obtain correct scale values from the texture
+    const Vector2f& scale = d_texture->getTexelScaling();
+    const Vector2f tex_per_pix(d_area.getWidth() / dest.getWidth(), d_area.getHeight() / dest.getHeight());
+
+    // calculate final, clipped, texture co-ordinates
+    tex_rect = Rectf((d_area.d_min + ((final_rect.d_min - dest.d_min) * tex_per_pix)) * scale,
+                     (d_area.d_max + ((final_rect.d_max - dest.d_max) * tex_per_pix)) * scale);
+
+    // URGENT FIXME: Shouldn't this be in the hands of the user?
+    final_rect.d_min.d_x = CoordConverter::alignToPixels(final_rect.d_min.d_x);
+    final_rect.d_min.d_y = CoordConverter::alignToPixels(final_rect.d_min.d_y);
+    final_rect.d_max.d_x = CoordConverter::alignToPixels(final_rect.d_max.d_x);
+    final_rect.d_max.d_y = CoordConverter::alignToPixels(final_rect.d_max.d_y);
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void BasicImage::notifyDisplaySizeChanged(const Sizef& size)
 {
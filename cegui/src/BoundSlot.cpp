@@ -34,14 +34,16 @@ namespace CEGUI
 BoundSlot::BoundSlot(Group group, const SubscriberSlot& subscriber, Event& event) :
     d_group(group),
     d_subscriber(new SubscriberSlot(subscriber)),
-    d_event(&event)
+    d_event(&event),
+    d_sequence(0)
 {}
 
 
 BoundSlot::BoundSlot(const BoundSlot& other) :
     d_group(other.d_group),
     d_subscriber(other.d_subscriber),
-    d_event(other.d_event)
+    d_event(other.d_event),
+    d_sequence(other.d_sequence)
 {
 }
 
@@ -58,6 +60,7 @@ BoundSlot& BoundSlot::operator=(const BoundSlot& other)
     d_group      = other.d_group;
     d_subscriber = other.d_subscriber;
     d_event      = other.d_event;
+    d_sequence   = other.d_sequence;
 
     return *this;
 }
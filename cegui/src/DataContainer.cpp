@@ -29,6 +29,12 @@
  ***************************************************************************/
 #include "CEGUI/DataContainer.h"
 
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <sys/mman.h>
+#endif
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -37,11 +43,22 @@ void RawDataContainer::release(void)
 {
     if (mData)
     {
-        CEGUI_DELETE_ARRAY_PT(mData, uint8, mSize, RawDataContainer);
+        if (mMapped)
+        {
+#if defined(__WIN32__) || defined(_WIN32)
+            UnmapViewOfFile(mData);
+#else
+            munmap(mData, mSize);
+#endif
+        }
+        else
+            CEGUI_DELETE_ARRAY_PT(mData, uint8, mSize, RawDataContainer);
 
         mData = 0;
         mSize = 0;
     }
+
+    mMapped = false;
 }
 
 } // End of  CEGUI namespace section
@@ -38,13 +38,94 @@
 #else
 #   include <sys/types.h>
 #   include <sys/stat.h>
+#   include <sys/mman.h>
 #   include <dirent.h>
+#   include <fcntl.h>
 #   include <fnmatch.h>
+#   include <unistd.h>
 #endif
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+const size_t DefaultResourceProvider::DefaultFileMappingMinimumSize = 64 * 1024;
+
+//----------------------------------------------------------------------------//
+// Map \a filename copy-on-write into \a output if it is at least
+// \a minimum_size bytes.  Returns false if the file was not mapped.
+static bool mapFile(const String& filename, size_t minimum_size,
+                    RawDataContainer& output)
+{
+    bool mapped = false;
+
+#if defined(__WIN32__) || defined(_WIN32)
+    const HANDLE file = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(filename).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 &&
+        static_cast<ULONGLONG>(file_size.QuadPart) >= minimum_size &&
+        static_cast<ULONGLONG>(file_size.QuadPart) <= static_cast<size_t>(-1))
+    {
+        const HANDLE mapping =
+            CreateFileMappingW(file, 0, PAGE_WRITECOPY, 0, 0, 0);
+
+        if (mapping)
+        {
+            void* const data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            // the view keeps the mapping open
+            CloseHandle(mapping);
+
+            if (data)
+            {
+                output.setMappedData(static_cast<uint8*>(data),
+                                     static_cast<size_t>(file_size.QuadPart));
+                mapped = true;
+            }
+        }
+    }
+
+    CloseHandle(file);
+#else
+    const int file = open(filename.c_str(), O_RDONLY);
+
+    if (file == -1)
+        return false;
+
+    struct stat s;
+    if (fstat(file, &s) == 0 && S_ISREG(s.st_mode) && s.st_size > 0 &&
+        static_cast<size_t>(s.st_size) >= minimum_size)
+    {
+        const size_t size = static_cast<size_t>(s.st_size);
+        // private and writable, so the data may still be modified in place
+        void* const data =
+            mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+
+        if (data != MAP_FAILED)
+        {
+            output.setMappedData(static_cast<uint8*>(data), size);
+            mapped = true;
+        }
+    }
+
+    close(file);
+#endif
+
+    return mapped;
+}
+
+//----------------------------------------------------------------------------//
+DefaultResourceProvider::DefaultResourceProvider() :
+    d_fileMappingEnabled(false),
+    d_fileMappingMinimumSize(DefaultFileMappingMinimumSize)
+{
+}
 
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::loadRawDataContainer(const String& filename,
@@ -57,6 +138,10 @@ void DefaultResourceProvider::loadRawDataContainer(const String& filename,
 
     const String final_filename(getFinalFilename(filename, resourceGroup));
 
+    if (d_fileMappingEnabled &&
+        mapFile(final_filename, d_fileMappingMinimumSize, output))
+        return;
+
 #if defined(__WIN32__) || defined(_WIN32)
     FILE* file = _wfopen(System::getStringTranscoder().stringToStdWString(final_filename).c_str(), L"rb");
 #else
@@ -93,6 +178,75 @@ void DefaultResourceProvider::unloadRawDataContainer(RawDataContainer& data)
     data.release();
 }
 
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::getFileStatus(const String& filename,
+                                            const String& resourceGroup,
+                                            uint64& size, uint64& modifiedTime)
+{
+    if (filename.empty())
+        return false;
+
+    const String final_filename(getFinalFilename(filename, resourceGroup));
+
+#if defined(__WIN32__) || defined(_WIN32)
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExW(
+            System::getStringTranscoder().stringToStdWString(final_filename).c_str(),
+            GetFileExInfoStandard, &attributes) ||
+        (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+        return false;
+
+    size = (static_cast<uint64>(attributes.nFileSizeHigh) << 32) |
+           attributes.nFileSizeLow;
+    // in 100 nanosecond intervals
+    modifiedTime =
+        (static_cast<uint64>(attributes.ftLastWriteTime.dwHighDateTime) << 32) |
+        attributes.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat s;
+    if (stat(final_filename.c_str(), &s) != 0 || !S_ISREG(s.st_mode))
+        return false;
+
+    size = static_cast<uint64>(s.st_size);
+
+    // in nanoseconds, as far as the platform records them
+    uint64 nanoseconds = 0;
+#   if defined(__linux__)
+    nanoseconds = s.st_mtim.tv_nsec;
+#   elif defined(__APPLE__)
+    nanoseconds = s.st_mtimespec.tv_nsec;
+#   endif
+    modifiedTime =
+        static_cast<uint64>(s.st_mtime) * 1000000000ULL + nanoseconds;
+#endif
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::setFileMappingEnabled(bool enabled)
+{
+    d_fileMappingEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultResourceProvider::isFileMappingEnabled() const
+{
+    return d_fileMappingEnabled;
+}
+
+//----------------------------------------------------------------------------//
+void DefaultResourceProvider::setFileMappingMinimumSize(size_t size)
+{
+    d_fileMappingMinimumSize = size;
+}
+
+//----------------------------------------------------------------------------//
+size_t DefaultResourceProvider::getFileMappingMinimumSize() const
+{
+    return d_fileMappingMinimumSize;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultResourceProvider::setResourceGroupDirectory(
                                                 const String& resourceGroup,
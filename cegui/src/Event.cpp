@@ -27,38 +27,121 @@
  ***************************************************************************/
 #include "CEGUI/Event.h"
 #include "CEGUI/EventArgs.h"
+#include "CEGUI/EventSet.h"
 
-#include <algorithm>
+#include <vector>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
+namespace
+{
+//! start value of the FNV-1a hash used for interned names.
+const uint32 NAME_HASH_BASIS = 2166136261u;
+
+//! continue the hash \a hash with the code point \a code_point.
+uint32 hashCodePoint(uint32 hash, uint32 code_point)
+{
+    return (hash ^ code_point) * 16777619u;
+}
+
+//! continue the hash \a hash with the code points of \a str.
+uint32 hashName(const String& str, uint32 hash)
+{
+    const size_t length = str.length();
+    for (size_t i = 0; i < length; ++i)
+        hash = hashCodePoint(hash, static_cast<uint32>(str[i]));
+
+    return hash;
+}
+
+//! an interned name, and its hash.
+struct InternedName
+{
+    String d_name;
+    uint32 d_hash;
+};
+
 /*!
 \brief
-    Implementation helper functor which is used to locate a BoundSlot in the
-    multimap collection of BoundSlots.
+    Open addressed hash table of the interned names.  The ID of a name is its
+    index in d_names, and d_slots holds those indices plus one, or 0 where a
+    slot is free.  Names are never removed.
 */
-class SubComp
+struct InternedNameTable
 {
-public:
-    SubComp(const BoundSlot& s) :
-        d_s(s)
+    std::vector<InternedName CEGUI_VECTOR_ALLOC(InternedName)> d_names;
+    std::vector<uint32 CEGUI_VECTOR_ALLOC(uint32)> d_slots;
+
+    InternedNameTable() :
+        d_slots(256, 0)
     {}
 
-    bool operator()(std::pair<Event::Group, Event::Connection> e) const
+    //! return the first slot to look in for a name with hash \a hash.
+    size_t getSlot(uint32 hash) const
+    {
+        return hash & (d_slots.size() - 1);
+    }
+
+    //! return the slot after \a slot.
+    size_t getNextSlot(size_t slot) const
     {
-        return *(e.second) == d_s;
+        return (slot + 1) & (d_slots.size() - 1);
     }
 
-private:
-    void operator=(const SubComp&) {}
-    const BoundSlot& d_s;
+    //! double the slot count, re-inserting the names.
+    void grow()
+    {
+        d_slots.assign(d_slots.size() * 2, 0);
+
+        for (size_t i = 0; i < d_names.size(); ++i)
+        {
+            size_t slot = getSlot(d_names[i].d_hash);
+            while (d_slots[slot])
+                slot = getNextSlot(slot);
+
+            d_slots[slot] = static_cast<uint32>(i + 1);
+        }
+    }
 };
 
+//! return the table of interned names.
+InternedNameTable& getInternedNames()
+{
+    static InternedNameTable table;
+    return table;
+}
+
+//! return whether \a str is \a prefix, a '/', and \a name.
+bool isJoinedName(const String& str, const String& prefix, const String& name)
+{
+    const size_t prefix_length = prefix.length();
+    const size_t name_length = name.length();
+
+    if (str.length() != prefix_length + 1 + name_length ||
+        str[prefix_length] != '/')
+            return false;
+
+    for (size_t i = 0; i < prefix_length; ++i)
+        if (str[i] != prefix[i])
+            return false;
+
+    for (size_t i = 0; i < name_length; ++i)
+        if (str[prefix_length + 1 + i] != name[i])
+            return false;
+
+    return true;
+}
+
+}
+
 //----------------------------------------------------------------------------//
 Event::Event(const String& name) :
-    d_name(name)
+    d_name(name),
+    d_id(internName(name)),
+    d_owner(0),
+    d_nextSequence(0)
 {
 }
 
@@ -88,7 +171,12 @@ Event::Connection Event::subscribe(Event::Group group,
                                    const Event::Subscriber& slot)
 {
     Event::Connection c(new BoundSlot(group, slot, *this));
-    d_slots.insert(std::pair<Group, Connection>(group, c));
+    c->d_sequence = d_nextSequence++;
+    d_slots.insert(std::make_pair(SlotKey(group, c->d_sequence), c));
+
+    if (d_owner)
+        d_owner->d_subscribedMask |= EventSet::getSubscribedMaskBit(d_id);
+
     return c;
 }
 
@@ -109,13 +197,85 @@ void Event::unsubscribe(const BoundSlot& slot)
 {
     // try to find the slot in our collection
     SlotContainer::iterator curr =
-        std::find_if(d_slots.begin(),
-                     d_slots.end(),
-                     SubComp(slot));
+        d_slots.find(SlotKey(slot.d_group, slot.d_sequence));
 
     // erase our reference to the slot, if we had one.
-    if (curr != d_slots.end())
+    if (curr != d_slots.end() && *curr->second == slot)
         d_slots.erase(curr);
+
+    // our owner may now skip firing us.
+    if (d_owner && d_slots.empty())
+        d_owner->updateSubscribedMask();
+}
+
+//----------------------------------------------------------------------------//
+Event::ID Event::internName(const String& name)
+{
+    ID id;
+    if (findInternedName(name, id))
+        return id;
+
+    InternedNameTable& table = getInternedNames();
+    const InternedName interned = { name, hashName(name, NAME_HASH_BASIS) };
+    table.d_names.push_back(interned);
+    id = static_cast<ID>(table.d_names.size() - 1);
+
+    // keep at least half of the slots free.
+    if (table.d_names.size() * 2 > table.d_slots.size())
+    {
+        table.grow();
+        return id;
+    }
+
+    size_t slot = table.getSlot(interned.d_hash);
+    while (table.d_slots[slot])
+        slot = table.getNextSlot(slot);
+
+    table.d_slots[slot] = id + 1;
+    return id;
+}
+
+//----------------------------------------------------------------------------//
+bool Event::findInternedName(const String& name, ID& id)
+{
+    const InternedNameTable& table = getInternedNames();
+    const uint32 hash = hashName(name, NAME_HASH_BASIS);
+
+    size_t slot = table.getSlot(hash);
+    for ( ; table.d_slots[slot]; slot = table.getNextSlot(slot))
+    {
+        const uint32 index = table.d_slots[slot] - 1;
+        if (table.d_names[index].d_hash == hash &&
+            table.d_names[index].d_name == name)
+        {
+            id = index;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+bool Event::findInternedName(const String& prefix, const String& name, ID& id)
+{
+    const InternedNameTable& table = getInternedNames();
+    const uint32 hash = hashName(name,
+        hashCodePoint(hashName(prefix, NAME_HASH_BASIS), '/'));
+
+    size_t slot = table.getSlot(hash);
+    for ( ; table.d_slots[slot]; slot = table.getNextSlot(slot))
+    {
+        const uint32 index = table.d_slots[slot] - 1;
+        if (table.d_names[index].d_hash == hash &&
+            isJoinedName(table.d_names[index].d_name, prefix, name))
+        {
+            id = index;
+            return true;
+        }
+    }
+
+    return false;
 }
 
 //----------------------------------------------------------------------------//
@@ -30,6 +30,7 @@
 #include "CEGUI/EventSet.h"
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/Profiler.h"
 #include "CEGUI/ScriptModule.h"
 #include "CEGUI/System.h"
 
@@ -38,7 +39,8 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 EventSet::EventSet() :
-    d_muted(false)
+    d_muted(false),
+    d_subscribedMask(0)
 {
 }
 
@@ -68,6 +70,10 @@ void EventSet::addEvent(Event& event)
     }
 
     d_events.insert(std::make_pair(name, &event));
+
+    event.d_owner = this;
+    if (event.hasSubscribers())
+        d_subscribedMask |= getSubscribedMaskBit(event.getID());
 }
 
 //----------------------------------------------------------------------------//
@@ -79,6 +85,8 @@ void EventSet::removeEvent(const String& name)
 	{
 		CEGUI_DELETE_AO pos->second;
 		d_events.erase(pos);
+
+		updateSubscribedMask();
 	}
 }
 
@@ -98,6 +106,7 @@ void EventSet::removeAllEvents(void)
 		CEGUI_DELETE_AO pos->second;
 
     d_events.clear();
+    d_subscribedMask = 0;
 }
 
 //----------------------------------------------------------------------------//
@@ -153,6 +162,8 @@ void EventSet::fireEvent(const String& name,
                          EventArgs& args,
                          const String& eventNamespace)
 {
+    CEGUI_PROFILE_COUNT(C_EVENTS_FIRED, 1);
+
     if (GlobalEventSet* ges = GlobalEventSet::getSingletonPtr())
         ges->fireEvent(name, args, eventNamespace);
 
@@ -192,12 +203,33 @@ Event* EventSet::getEventObject(const String& name, bool autoAdd)
 //----------------------------------------------------------------------------//
 void EventSet::fireEvent_impl(const String& name, EventArgs& args)
 {
+    // skip the lookups unless something may be subscribed to the event.
+    if (!d_subscribedMask || d_muted)
+        return;
+
+    Event::ID id;
+    if (!Event::findInternedName(name, id) || !mayHaveSubscribers(id))
+        return;
+
     Event* ev = getEventObject(name);
 
-    if ((ev != 0) && !d_muted)
+    if (ev != 0)
         (*ev)(args);
 }
 
+//----------------------------------------------------------------------------//
+void EventSet::updateSubscribedMask()
+{
+    d_subscribedMask = 0;
+
+    EventMap::const_iterator pos = d_events.begin();
+    const EventMap::const_iterator end = d_events.end();
+
+    for (; pos != end; ++pos)
+        if (pos->second->hasSubscribers())
+            d_subscribedMask |= getSubscribedMaskBit(pos->second->getID());
+}
+
 //----------------------------------------------------------------------------//
 EventSet::EventIterator EventSet::getEventIterator(void) const
 {
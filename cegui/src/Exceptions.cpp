@@ -30,6 +30,7 @@
 #include "CEGUI/Exceptions.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/PropertyHelper.h"
+#include "CEGUI/ThreadPool.h"
 #include <iostream>
 
 #if defined( __WIN32__ ) || defined( _WIN32)
@@ -181,6 +182,11 @@ Exception::Exception(const String& message, const String& name,
            "' (" + filename + ":" + PropertyHelper<int>::toString(line) + ") : " +
            message)
 {
+    // the Logger need not be thread safe, so exceptions on ThreadPool worker
+    // threads are left for the code catching them to report.
+    if (ThreadPool::isWorkerThread())
+        return;
+
     // Log exception if possible
     if (Logger* const logger = Logger::getSingletonPtr())
     {
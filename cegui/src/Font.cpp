@@ -31,6 +31,8 @@
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/System.h"
 #include "CEGUI/Image.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Vertex.h"
 
 namespace CEGUI
 {
@@ -40,9 +42,27 @@ namespace CEGUI
 // must be a power of two
 #define GLYPHS_PER_PAGE 256
 
+//----------------------------------------------------------------------------//
+namespace
+{
+//! number of glyph quads gathered by drawText before appending them.
+const uint PackedGlyphBlockSize = 64;
+
+void appendPackedGlyphs(GeometryBuffer& buffer, Texture* texture,
+                        const PackedVertex* vbuff, uint vertex_count)
+{
+    if (!vertex_count)
+        return;
+
+    buffer.setActiveTexture(texture);
+    buffer.appendPackedGeometry(vbuff, vertex_count);
+}
+}
+
 //----------------------------------------------------------------------------//
 const argb_t Font::DefaultColour = 0xFFFFFFFF;
 String Font::d_defaultResourceGroup;
+uint Font::d_renderSizeGeneration = 0;
 
 //----------------------------------------------------------------------------//
 const String Font::EventNamespace("Font");
@@ -152,6 +172,10 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
 
     const FontGlyph* const glyph = findFontGlyph(codepoint);
 
+    // nothing to rasterise for codepoints the font has no glyph for.
+    if (!glyph)
+        return 0;
+
     if (d_glyphPageLoaded)
     {
         // Check if glyph page has been rasterised
@@ -171,17 +195,47 @@ const FontGlyph* Font::getGlyphData(utf32 codepoint) const
 //----------------------------------------------------------------------------//
 const FontGlyph* Font::findFontGlyph(const utf32 codepoint) const
 {
-    CodepointMap::const_iterator pos = d_cp_map.find(codepoint);
-    return (pos != d_cp_map.end()) ? &pos->second : 0;
+    return d_glyphTable.find(codepoint);
+}
+
+//----------------------------------------------------------------------------//
+FontGlyph& Font::defineGlyph(const utf32 codepoint, const FontGlyph& glyph)
+{
+    std::pair<CodepointMap::iterator, bool> result =
+        d_cp_map.insert(std::make_pair(codepoint, glyph));
+
+    // map nodes are stable, so the table can point straight at the value.
+    if (result.second)
+        d_glyphTable.insert(codepoint, &result.first->second);
+    else
+        result.first->second = glyph;
+
+    return result.first->second;
+}
+
+//----------------------------------------------------------------------------//
+void Font::clearGlyphs()
+{
+    d_glyphTable.clear();
+    d_cp_map.clear();
 }
 
 //----------------------------------------------------------------------------//
 float Font::getTextExtent(const String& text, float x_scale) const
+{
+    return getTextExtent(text, 0, text.length(), x_scale);
+}
+
+//----------------------------------------------------------------------------//
+float Font::getTextExtent(const String& text, size_t start_char,
+                          size_t char_count, float x_scale) const
 {
     const FontGlyph* glyph;
     float cur_extent = 0, adv_extent = 0, width;
+    const size_t end_char =
+        ceguimin(text.length(), start_char + ceguimin(char_count, text.length()));
 
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = start_char; c < end_char; ++c)
     {
         glyph = getGlyphData(text[c]);
 
@@ -201,10 +255,19 @@ float Font::getTextExtent(const String& text, float x_scale) const
 
 //----------------------------------------------------------------------------//
 float Font::getTextAdvance(const String& text, float x_scale) const
+{
+    return getTextAdvance(text, 0, text.length(), x_scale);
+}
+
+//----------------------------------------------------------------------------//
+float Font::getTextAdvance(const String& text, size_t start_char,
+                           size_t char_count, float x_scale) const
 {
     float advance = 0.0f;
+    const size_t end_char =
+        ceguimin(text.length(), start_char + ceguimin(char_count, text.length()));
 
-    for (size_t c = 0; c < text.length(); ++c)
+    for (size_t c = start_char; c < end_char; ++c)
     {
         if (const FontGlyph* glyph = getGlyphData(text[c]))
             advance += glyph->getAdvance(x_scale);
@@ -250,6 +313,16 @@ float Font::drawText(GeometryBuffer& buffer, const String& text,
     const float base_y = position.d_y + getBaseline(y_scale);
     Vector2f glyph_pos(position);
 
+    // each glyph is rendered as a quad made of two triangles.
+    buffer.reserveVertices(static_cast<uint>(text.length() * 6));
+
+    // where the buffer draws packed vertices directly, glyph quads are
+    // gathered here and appended a block at a time per texture.
+    const bool packed = buffer.isPackedGeometryNative();
+    PackedVertex packed_verts[PackedGlyphBlockSize * 6];
+    uint packed_count = 0;
+    Texture* packed_texture = 0;
+
     for (size_t c = 0; c < text.length(); ++c)
     {
         const FontGlyph* glyph;
@@ -258,8 +331,49 @@ float Font::drawText(GeometryBuffer& buffer, const String& text,
             const Image* const img = glyph->getImage();
             glyph_pos.d_y =
                 base_y - (img->getRenderedOffset().d_y - img->getRenderedOffset().d_y * y_scale);
-            img->render(buffer, glyph_pos,
-                      glyph->getSize(x_scale, y_scale), clip_rect, colours);
+
+            const Rectf glyph_area(glyph_pos, glyph->getSize(x_scale, y_scale));
+            uint vertex_count = 0;
+            Texture* texture = 0;
+
+            if (packed &&
+                img->getPackedGeometry(&packed_verts[packed_count],
+                                       vertex_count, texture,
+                                       glyph_area, clip_rect, colours))
+            {
+                if (vertex_count && texture != packed_texture)
+                {
+                    // flush what came before, then move this glyph's
+                    // vertices to the front of the block.
+                    appendPackedGlyphs(buffer, packed_texture,
+                                       packed_verts, packed_count);
+                    for (uint v = 0; v < vertex_count; ++v)
+                        packed_verts[v] = packed_verts[packed_count + v];
+
+                    packed_count = 0;
+                    packed_texture = texture;
+                }
+
+                packed_count += vertex_count;
+
+                if (packed_count == PackedGlyphBlockSize * 6)
+                {
+                    appendPackedGlyphs(buffer, packed_texture,
+                                       packed_verts, packed_count);
+                    packed_count = 0;
+                }
+            }
+            else
+            {
+                // keep the draw order when an image can't be packed.
+                appendPackedGlyphs(buffer, packed_texture,
+                                   packed_verts, packed_count);
+                packed_count = 0;
+                packed_texture = 0;
+
+                img->render(buffer, glyph_area, clip_rect, colours);
+            }
+
             glyph_pos.d_x += glyph->getAdvance(x_scale);
             // apply extra spacing to space chars
             if (text[c] == ' ')
@@ -267,6 +381,8 @@ float Font::drawText(GeometryBuffer& buffer, const String& text,
         }
     }
 
+    appendPackedGlyphs(buffer, packed_texture, packed_verts, packed_count);
+
     return glyph_pos.d_x;
 }
 
@@ -359,6 +475,7 @@ void Font::writeXMLToStream(XMLSerializer& xml_stream) const
 //----------------------------------------------------------------------------//
 void Font::onRenderSizeChanged(FontEventArgs& e)
 {
+    ++d_renderSizeGeneration;
     fireEvent(EventRenderSizeChanged, e, EventNamespace);
 }
 
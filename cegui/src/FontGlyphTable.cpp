@@ -0,0 +1,161 @@
+/***********************************************************************
+    filename:   FontGlyphTable.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/FontGlyphTable.h"
+
+#include <string.h>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// initial number of slots in the hash; must be a power of two.
+static const size_t INITIAL_HASH_CAPACITY = 64;
+
+//----------------------------------------------------------------------------//
+static inline size_t hashCodepoint(utf32 codepoint)
+{
+    // Knuth's multiplicative hash; spreads runs of adjacent codepoints.
+    return static_cast<size_t>(codepoint * 2654435761u);
+}
+
+//----------------------------------------------------------------------------//
+FontGlyphTable::FontGlyphTable() :
+    d_hashCount(0),
+    d_count(0)
+{
+    memset(d_pages, 0, sizeof(d_pages));
+}
+
+//----------------------------------------------------------------------------//
+FontGlyphTable::~FontGlyphTable()
+{
+    clear();
+}
+
+//----------------------------------------------------------------------------//
+void FontGlyphTable::insert(utf32 codepoint, FontGlyph* glyph)
+{
+    if (codepoint < BMP_CODEPOINT_COUNT)
+    {
+        FontGlyph**& page = d_pages[codepoint >> PAGE_SHIFT];
+
+        if (!page)
+        {
+            page = CEGUI_NEW_ARRAY_PT(FontGlyph*, PAGE_SIZE, Font);
+            memset(page, 0, PAGE_SIZE * sizeof(FontGlyph*));
+        }
+
+        FontGlyph*& slot = page[codepoint & PAGE_MASK];
+
+        if (!slot)
+            ++d_count;
+
+        slot = glyph;
+        return;
+    }
+
+    // keep the load factor at or below one half
+    if ((d_hashCount + 1) * 2 > d_hashKeys.size())
+        rehash(d_hashKeys.empty() ? INITIAL_HASH_CAPACITY : d_hashKeys.size() * 2);
+
+    const size_t slot = findSlot(codepoint);
+
+    if (d_hashKeys[slot] == EMPTY_KEY)
+    {
+        d_hashKeys[slot] = codepoint;
+        ++d_hashCount;
+        ++d_count;
+    }
+
+    d_hashGlyphs[slot] = glyph;
+}
+
+//----------------------------------------------------------------------------//
+void FontGlyphTable::clear()
+{
+    for (uint i = 0; i < BMP_PAGE_COUNT; ++i)
+    {
+        if (d_pages[i])
+        {
+            CEGUI_DELETE_ARRAY_PT(d_pages[i], FontGlyph*, PAGE_SIZE, Font);
+            d_pages[i] = 0;
+        }
+    }
+
+    KeyList().swap(d_hashKeys);
+    GlyphList().swap(d_hashGlyphs);
+    d_hashCount = 0;
+    d_count = 0;
+}
+
+//----------------------------------------------------------------------------//
+FontGlyph* FontGlyphTable::findInHash(utf32 codepoint) const
+{
+    if (!d_hashCount)
+        return 0;
+
+    const size_t slot = findSlot(codepoint);
+    return (d_hashKeys[slot] == codepoint) ? d_hashGlyphs[slot] : 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t FontGlyphTable::findSlot(utf32 codepoint) const
+{
+    // the table is never full, so this always terminates.
+    const size_t mask = d_hashKeys.size() - 1;
+    size_t slot = hashCodepoint(codepoint) & mask;
+
+    while (d_hashKeys[slot] != codepoint && d_hashKeys[slot] != EMPTY_KEY)
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+//----------------------------------------------------------------------------//
+void FontGlyphTable::rehash(size_t capacity)
+{
+    KeyList old_keys(capacity, EMPTY_KEY);
+    GlyphList old_glyphs(capacity, static_cast<FontGlyph*>(0));
+    old_keys.swap(d_hashKeys);
+    old_glyphs.swap(d_hashGlyphs);
+
+    for (size_t i = 0; i < old_keys.size(); ++i)
+    {
+        if (old_keys[i] == EMPTY_KEY)
+            continue;
+
+        const size_t slot = findSlot(old_keys[i]);
+        d_hashKeys[slot] = old_keys[i];
+        d_hashGlyphs[slot] = old_glyphs[i];
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
@@ -29,6 +29,7 @@
  ***************************************************************************/
 #include "CEGUI/FreeTypeFont.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/GlyphAtlas.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/ImageManager.h"
 #include "CEGUI/System.h"
@@ -39,6 +40,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 #ifdef _MSC_VER
 #define snprintf _snprintf
@@ -57,6 +59,8 @@ namespace CEGUI
 static int ft_usage_count = 0;
 // A handle to the FreeType library
 static FT_Library ft_lib;
+// Glyph atlas shared by all FreeType fonts
+static GlyphAtlas* ft_glyph_atlas = 0;
 
 //----------------------------------------------------------------------------//
 #undef __FTERRORS_H__
@@ -80,7 +84,11 @@ FreeTypeFont::FreeTypeFont(const String& font_name, const float point_size,
     d_fontFace(0)
 {
     if (!ft_usage_count++)
+    {
         FT_Init_FreeType(&ft_lib);
+        ft_glyph_atlas = CEGUI_NEW_AO GlyphAtlas("FreeTypeFont_glyph_atlas",
+                                                256, INTER_GLYPH_PAD_SPACE);
+    }
 
     addFreeTypeFontProperties();
 
@@ -98,7 +106,17 @@ FreeTypeFont::~FreeTypeFont()
     free();
 
     if (!--ft_usage_count)
+    {
         FT_Done_FreeType(ft_lib);
+        CEGUI_DELETE_AO ft_glyph_atlas;
+        ft_glyph_atlas = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas* FreeTypeFont::getGlyphAtlas()
+{
+    return ft_glyph_atlas;
 }
 
 //----------------------------------------------------------------------------//
@@ -118,197 +136,64 @@ void FreeTypeFont::addFreeTypeFontProperties ()
     );
 }
 
-//----------------------------------------------------------------------------//
-uint FreeTypeFont::getTextureSize(CodepointMap::const_iterator s,
-                                  CodepointMap::const_iterator e) const
-{
-    uint texsize = 32; // start with 32x32
-    uint max_texsize = System::getSingleton().getRenderer()->getMaxTextureSize();
-    uint glyph_count = 0;
-
-    // Compute approximatively the optimal texture size for font
-    while (texsize < max_texsize)
-    {
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-        for (CodepointMap::const_iterator c = s; c != e; ++c)
-        {
-            // skip glyphs that are already rendered
-            if (c->second.getImage())
-                continue;
-
-            // load glyph metrics (don't render)
-            if (FT_Load_Char(d_fontFace, c->first,
-                             FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT))
-                continue;
-
-            uint glyph_w = int (ceil(d_fontFace->glyph->metrics.width * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-            uint glyph_h = int (ceil(d_fontFace->glyph->metrics.height * FT_POS_COEF)) +
-                           INTER_GLYPH_PAD_SPACE;
-
-            x += glyph_w;
-            if (x > texsize)
-            {
-                x = INTER_GLYPH_PAD_SPACE;
-                y = yb;
-            }
-            uint yy = y + glyph_h;
-            if (yy > texsize)
-                goto too_small;
-
-            if (yy > yb)
-                yb = yy;
-
-            ++glyph_count;
-        }
-        // Okay, the texture size is enough for holding our glyphs
-        break;
-
-    too_small:
-        texsize *= 2;
-    }
-
-    return glyph_count ? texsize : 0;
-}
-
 //----------------------------------------------------------------------------//
 void FreeTypeFont::rasterise(utf32 start_codepoint, utf32 end_codepoint) const
 {
     CodepointMap::iterator s = d_cp_map.lower_bound(start_codepoint);
-    if (s == d_cp_map.end())
-        return;
+    const CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
 
-    CodepointMap::iterator orig_s = s;
-    CodepointMap::iterator e = d_cp_map.upper_bound(end_codepoint);
-    while (true)
+    // Scratch buffer for the imagery of a single glyph
+    std::vector<argb_t CEGUI_VECTOR_ALLOC(argb_t)> glyph_buffer;
+
+    for (; s != e; ++s)
     {
-        // Create a new Imageset for glyphs
-        uint texsize = getTextureSize(s, e);
-        // If all glyphs were already rendered, do nothing
-        if (!texsize)
-            break;
+        // Check if glyph already rendered
+        if (s->second.getImage())
+            continue;
 
-        const String texture_name(d_name + "_auto_glyph_images_" +
-                                   PropertyHelper<int>::toString(s->first));
-        Texture& texture = System::getSingleton().getRenderer()->createTexture(
-            texture_name, Sizef(texsize, texsize));
-        d_glyphTextures.push_back(&texture);
-
-        // Create a memory buffer where we will render our glyphs
-        argb_t* mem_buffer = CEGUI_NEW_ARRAY_PT(argb_t, texsize * texsize, BufferAllocator);
-        memset(mem_buffer, 0, texsize * texsize * sizeof(argb_t));
-
-        // Go ahead, line by line, top-left to bottom-right
-        uint x = INTER_GLYPH_PAD_SPACE, y = INTER_GLYPH_PAD_SPACE;
-        uint yb = INTER_GLYPH_PAD_SPACE;
-
-        // Set to true when we finish rendering all glyphs we were asked to
-        bool finished = false;
-        // Set to false when we reach d_cp_map.end() and we start going backward
-        bool forward = true;
-
-        /* To conserve texture space we will render more glyphs than asked,
-         * but never less than asked. First we render all glyphs from s to e
-         * and after that we render glyphs until we reach d_cp_map.end(),
-         * and if there's still free texture space we will go backward
-         * from s until we hit d_cp_map.begin().
-         */
-        while (s != d_cp_map.end())
+        Rectf area(0, 0, 0, 0);
+        Vector2f offset(0, 0);
+        Texture* texture;
+
+        // Render the glyph
+        if (FT_Load_Char(d_fontFace, s->first, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
+                         (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
+        {
+            std::stringstream err;
+            err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
+            err << static_cast<unsigned int>(s->first);
+            err << ".  Will use an empty image for this glyph!";
+            Logger::getSingleton().logEvent(err.str().c_str(), Errors);
+
+            // Use a 'null' image for this glyph so we do not seg later
+            texture = &ft_glyph_atlas->allocate(0, 0, area);
+        }
+        else
         {
-            // Check if we finished rendering all the required glyphs
-            finished |= (s == e);
+            const uint glyph_w = d_fontFace->glyph->bitmap.width;
+            const uint glyph_h = d_fontFace->glyph->bitmap.rows;
 
-            // Check if glyph already rendered
-            if (!s->second.getImage())
+            texture = &ft_glyph_atlas->allocate(glyph_w, glyph_h, area);
+
+            // Upload just this glyph's area of the shared atlas texture
+            if (glyph_w && glyph_h)
             {
-                // Render the glyph
-                if (FT_Load_Char(d_fontFace, s->first, FT_LOAD_RENDER | FT_LOAD_FORCE_AUTOHINT |
-                                 (d_antiAliased ? FT_LOAD_TARGET_NORMAL : FT_LOAD_TARGET_MONO)))
-                {
-                    std::stringstream err;
-                    err << "Font::loadFreetypeGlyph - Failed to load glyph for codepoint: ";
-                    err << static_cast<unsigned int>(s->first);
-                    err << ".  Will use an empty image for this glyph!";
-                    Logger::getSingleton().logEvent(err.str().c_str(), Errors);
-
-                    // Create a 'null' image for this glyph so we do not seg later
-                    Rectf area(0, 0, 0, 0);
-                    Vector2f offset(0, 0);
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BasicImage* img =
-                        new BasicImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-                }
-                else
-                {
-                    uint glyph_w = d_fontFace->glyph->bitmap.width + INTER_GLYPH_PAD_SPACE;
-                    uint glyph_h = d_fontFace->glyph->bitmap.rows + INTER_GLYPH_PAD_SPACE;
-
-                    // Check if glyph right margin does not exceed texture size
-                    uint x_next = x + glyph_w;
-                    if (x_next > texsize)
-                    {
-                        x = INTER_GLYPH_PAD_SPACE;
-                        x_next = x + glyph_w;
-                        y = yb;
-                    }
-
-                    // Check if glyph bottom margine does not exceed texture size
-                    uint y_bot = y + glyph_h;
-                    if (y_bot > texsize)
-                        break;
-
-                    // Copy rendered glyph to memory buffer in RGBA format
-                    drawGlyphToBuffer(mem_buffer + (y * texsize) + x, texsize);
-
-                    // Create a new image in the imageset
-                    const Rectf area(static_cast<float>(x),
-                                      static_cast<float>(y),
-                                      static_cast<float>(x + glyph_w - INTER_GLYPH_PAD_SPACE),
-                                      static_cast<float>(y + glyph_h - INTER_GLYPH_PAD_SPACE));
-
-                    Vector2f offset(d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
-                                    -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
-
-                    const String name(PropertyHelper<unsigned long>::toString(s->first));
-                    BasicImage* img =
-                        new BasicImage(name, &texture, area, offset, ASM_Disabled,
-                                       d_nativeResolution);
-                    d_glyphImages.push_back(img);
-                    s->second.setImage(img);
-
-                    // Advance to next position
-                    x = x_next;
-                    if (y_bot > yb)
-                    {
-                        yb = y_bot;
-                    }
-                }
+                glyph_buffer.assign(glyph_w * glyph_h, 0);
+                drawGlyphToBuffer(&glyph_buffer[0], glyph_w);
+                texture->blitFromMemory(&glyph_buffer[0], area);
             }
 
-            // Go to next glyph, if we are going forward
-            if (forward)
-                if (++s == d_cp_map.end())
-                {
-                    finished = true;
-                    forward = false;
-                    s = orig_s;
-                }
-            // Go to previous glyph, if we are going backward
-            if (!forward)
-                if ((s == d_cp_map.begin()) || (--s == d_cp_map.begin()))
-                    break;
+            offset = Vector2f(
+                d_fontFace->glyph->metrics.horiBearingX * static_cast<float>(FT_POS_COEF),
+                -d_fontFace->glyph->metrics.horiBearingY * static_cast<float>(FT_POS_COEF));
         }
 
-        // Copy our memory buffer into the texture and free it
-        texture.loadFromMemory(mem_buffer, Sizef(texsize, texsize), Texture::PF_RGBA);
-        CEGUI_DELETE_ARRAY_PT(mem_buffer, argb_t, texsize * texsize, BufferAllocator);
-
-        if (finished)
-            break;
+        const String name(PropertyHelper<unsigned long>::toString(s->first));
+        BasicImage* img =
+            new BasicImage(name, texture, area, offset, ASM_Disabled,
+                           d_nativeResolution);
+        d_glyphImages.push_back(img);
+        s->second.setImage(img);
     }
 }
 
@@ -358,16 +243,15 @@ void FreeTypeFont::free()
     if (!d_fontFace)
         return;
 
-    d_cp_map.clear();
+    clearGlyphs();
 
     for (size_t i = 0; i < d_glyphImages.size(); ++i)
+    {
+        ft_glyph_atlas->release(*d_glyphImages[i]->getTexture());
         delete d_glyphImages[i];
+    }
     d_glyphImages.clear();
 
-    for (size_t i = 0; i < d_glyphTextures.size(); i++)
-        System::getSingleton().getRenderer()->destroyTexture(*d_glyphTextures[i]);
-    d_glyphTextures.clear();
-
     FT_Done_Face(d_fontFace);
     d_fontFace = 0;
     System::getSingleton().getResourceProvider()->unloadRawDataContainer(d_fontData);
@@ -477,7 +361,7 @@ void FreeTypeFont::initialiseGlyphMap()
         if (max_codepoint < codepoint)
             max_codepoint = codepoint;
 
-        d_cp_map[codepoint] = FontGlyph();
+        defineGlyph(codepoint, FontGlyph());
 
         codepoint = FT_Get_Next_Char(d_fontFace, codepoint, &gindex);
     }
@@ -488,30 +372,31 @@ void FreeTypeFont::initialiseGlyphMap()
 //----------------------------------------------------------------------------//
 const FontGlyph* FreeTypeFont::findFontGlyph(const utf32 codepoint) const
 {
-    CodepointMap::iterator pos = d_cp_map.find(codepoint);
+    FontGlyph* const glyph = d_glyphTable.find(codepoint);
 
-    if (pos == d_cp_map.end())
+    if (!glyph)
         return 0;
 
-    if (!pos->second.isValid())
-        initialiseFontGlyph(pos);
+    if (!glyph->isValid())
+        initialiseFontGlyph(codepoint, *glyph);
 
-    return &pos->second;
+    return glyph;
 }
 
 //----------------------------------------------------------------------------//
-void FreeTypeFont::initialiseFontGlyph(CodepointMap::iterator cp) const
+void FreeTypeFont::initialiseFontGlyph(const utf32 codepoint,
+                                       FontGlyph& glyph) const
 {
     // load-up required glyph metrics (don't render)
-    if (FT_Load_Char(d_fontFace, cp->first,
+    if (FT_Load_Char(d_fontFace, codepoint,
                      FT_LOAD_DEFAULT | FT_LOAD_FORCE_AUTOHINT))
         return;
 
     const float adv =
         d_fontFace->glyph->metrics.horiAdvance * static_cast<float>(FT_POS_COEF);
 
-    cp->second.setAdvance(adv);
-    cp->second.setValid(true);
+    glyph.setAdvance(adv);
+    glyph.setValid(true);
 }
 
 //----------------------------------------------------------------------------//
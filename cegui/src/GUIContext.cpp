@@ -33,6 +33,8 @@
 #include "CEGUI/Window.h"
 #include "CEGUI/widgets/Tooltip.h"
 #include "CEGUI/SimpleTimer.h"
+#include "CEGUI/HitTestIndex.h"
+#include "CEGUI/Profiler.h"
 
 namespace CEGUI
 {
@@ -96,7 +98,8 @@ GUIContext::GUIContext(RenderTarget& target) :
     d_windowDestroyedEventConnection(
         WindowManager::getSingleton().subscribeEvent(
             WindowManager::EventWindowDestroyed,
-            Event::Subscriber(&GUIContext::windowDestroyedHandler, this)))
+            Event::Subscriber(&GUIContext::windowDestroyedHandler, this))),
+    d_hitTestIndex(0)
 {
 }
 
@@ -109,6 +112,8 @@ GUIContext::~GUIContext()
         d_rootWindow->setGUIContext(0);
 
     delete[] d_mouseClickTrackers;
+
+    CEGUI_DELETE_AO d_hitTestIndex;
 }
 
 //----------------------------------------------------------------------------//
@@ -136,6 +141,9 @@ void GUIContext::setRootWindow(Window* new_root)
         d_rootWindow->syncTargetSurface();
     }
 
+    if (d_hitTestIndex)
+        d_hitTestIndex->invalidate();
+
     onRootWindowChanged(args);
 }
 
@@ -263,6 +271,8 @@ bool GUIContext::isDirty() const
 //----------------------------------------------------------------------------//
 void GUIContext::draw()
 {
+    CEGUI_PROFILE_ZONE("GUIContext::draw");
+
     if (d_isDirty)
         drawWindowContentToTarget();
 
@@ -291,6 +301,8 @@ void GUIContext::drawWindowContentToTarget()
 //----------------------------------------------------------------------------//
 void GUIContext::renderWindowHierarchyToSurfaces()
 {
+    CEGUI_PROFILE_ZONE("GUIContext::renderWindowHierarchyToSurfaces");
+
     RenderingSurface& rs = d_rootWindow->getTargetRenderingSurface();
     rs.clearGeometry();
 
@@ -391,6 +403,9 @@ bool GUIContext::areaChangedHandler(const EventArgs&)
     d_surfaceSize = d_target->getArea().getSize();
     d_mouseCursor.notifyDisplaySizeChanged(d_surfaceSize);
 
+    if (d_hitTestIndex)
+        d_hitTestIndex->setSurfaceSize(d_surfaceSize);
+
     if (d_rootWindow)
         updateRootWindowAreaRects();
 
@@ -403,6 +418,9 @@ bool GUIContext::windowDestroyedHandler(const EventArgs& args)
     const Window* const window =
         static_cast<const WindowEventArgs&>(args).window;
 
+    if (d_hitTestIndex)
+        d_hitTestIndex->removeWindow(*window);
+
     if (window == d_rootWindow)
         d_rootWindow = 0;
 
@@ -462,6 +480,8 @@ void GUIContext::onMouseButtonMultiClickToleranceChanged(GUIContextEventArgs& ar
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseMove(float delta_x, float delta_y)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseMove");
+
     MouseEventArgs ma(0);
     ma.moveDelta.d_x = delta_x * d_mouseMovementScalingFactor;
     ma.moveDelta.d_y = delta_y * d_mouseMovementScalingFactor;
@@ -501,6 +521,33 @@ bool GUIContext::mouseMoveInjection_impl(MouseEventArgs& ma)
     return ma.handled != 0;
 }
 
+//----------------------------------------------------------------------------//
+void GUIContext::setHitTestIndexEnabled(const bool enabled)
+{
+    if (enabled == isHitTestIndexEnabled())
+        return;
+
+    if (enabled)
+        d_hitTestIndex = CEGUI_NEW_AO HitTestIndex(*this);
+    else
+    {
+        CEGUI_DELETE_AO d_hitTestIndex;
+        d_hitTestIndex = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool GUIContext::isHitTestIndexEnabled() const
+{
+    return d_hitTestIndex != 0;
+}
+
+//----------------------------------------------------------------------------//
+HitTestIndex* GUIContext::getHitTestIndex() const
+{
+    return d_hitTestIndex;
+}
+
 //----------------------------------------------------------------------------//
 bool GUIContext::updateWindowContainingMouse()
 {
@@ -650,6 +697,8 @@ Window* GUIContext::getKeyboardTargetWindow() const
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseLeaves(void)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseLeaves");
+
     if (!d_windowContainingMouse)
         return false;
 
@@ -672,6 +721,8 @@ bool GUIContext::injectMouseLeaves(void)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseButtonDown(MouseButton button)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseButtonDown");
+
     d_systemKeys.mouseButtonPressed(button);
 
     MouseEventArgs ma(0);
@@ -750,6 +801,8 @@ bool GUIContext::injectMouseButtonDown(MouseButton button)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseButtonUp(MouseButton button)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseButtonUp");
+
     d_systemKeys.mouseButtonReleased(button);
 
     MouseEventArgs ma(0);
@@ -799,6 +852,8 @@ bool GUIContext::injectMouseButtonUp(MouseButton button)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectKeyDown(Key::Scan scan_code)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectKeyDown");
+
     d_systemKeys.keyPressed(scan_code);
 
     KeyEventArgs args(getKeyboardTargetWindow());
@@ -817,6 +872,8 @@ bool GUIContext::injectKeyDown(Key::Scan scan_code)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectKeyUp(Key::Scan scan_code)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectKeyUp");
+
     d_systemKeys.keyReleased(scan_code);
 
     KeyEventArgs args(getKeyboardTargetWindow());
@@ -835,6 +892,8 @@ bool GUIContext::injectKeyUp(Key::Scan scan_code)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectChar(String::value_type code_point)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectChar");
+
     KeyEventArgs args(getKeyboardTargetWindow());
 
     // if there's no destination window, input can't be handled.
@@ -851,6 +910,8 @@ bool GUIContext::injectChar(String::value_type code_point)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseWheelChange(float delta)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseWheelChange");
+
     MouseEventArgs ma(0);
     ma.position = d_mouseCursor.getPosition();
     ma.moveDelta = Vector2f(0.0f, 0.0f);
@@ -874,6 +935,8 @@ bool GUIContext::injectMouseWheelChange(float delta)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMousePosition(float x_pos, float y_pos)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMousePosition");
+
     const Vector2f new_position(x_pos, y_pos);
 
     // setup mouse movement event args object.
@@ -900,6 +963,8 @@ bool GUIContext::injectMousePosition(float x_pos, float y_pos)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectTimePulse(float timeElapsed)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectTimePulse");
+
     // if no visible active sheet, input can't be handled
     if (!d_rootWindow || !d_rootWindow->isEffectiveVisible())
         return false;
@@ -913,6 +978,8 @@ bool GUIContext::injectTimePulse(float timeElapsed)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseButtonClick(const MouseButton button)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseButtonClick");
+
     MouseEventArgs ma(0);
     ma.position = d_mouseCursor.getPosition();
     ma.window = getTargetWindow(ma.position, false);
@@ -936,6 +1003,8 @@ bool GUIContext::injectMouseButtonClick(const MouseButton button)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseButtonDoubleClick(const MouseButton button)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseButtonDoubleClick");
+
     MouseEventArgs ma(0);
     ma.position = d_mouseCursor.getPosition();
     ma.window = getTargetWindow(ma.position, false);
@@ -959,6 +1028,8 @@ bool GUIContext::injectMouseButtonDoubleClick(const MouseButton button)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectMouseButtonTripleClick(const MouseButton button)
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectMouseButtonTripleClick");
+
     MouseEventArgs ma(0);
     ma.position = d_mouseCursor.getPosition();
     ma.window = getTargetWindow(ma.position, false);
@@ -982,6 +1053,8 @@ bool GUIContext::injectMouseButtonTripleClick(const MouseButton button)
 //----------------------------------------------------------------------------//
 bool GUIContext::injectCopyRequest()
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectCopyRequest");
+
     Window* source = getKeyboardTargetWindow();
     return source ? source->performCopy(*System::getSingleton().getClipboard()) : false;
 }
@@ -989,6 +1062,8 @@ bool GUIContext::injectCopyRequest()
 //----------------------------------------------------------------------------//
 bool GUIContext::injectCutRequest()
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectCutRequest");
+
     Window* source = getKeyboardTargetWindow();
     return source ? source->performCut(*System::getSingleton().getClipboard()) : false;
 }
@@ -996,6 +1071,8 @@ bool GUIContext::injectCutRequest()
 //----------------------------------------------------------------------------//
 bool GUIContext::injectPasteRequest()
 {
+    CEGUI_PROFILE_ZONE("GUIContext::injectPasteRequest");
+
     Window* target = getKeyboardTargetWindow();
     return target ? target->performPaste(*System::getSingleton().getClipboard()) : false;
 }
@@ -293,10 +293,8 @@ void GUILayout_xmlHandler::elementUserStringStart(const XMLAttributes& attribute
         attributes.getValueAsString(Window::UserStringNameXMLAttributeName));
 
     // Get user string value
-    String userStringValue;
-    if (attributes.exists(Window::UserStringValueXMLAttributeName))
-        userStringValue = attributes.getValueAsString(
-            Window::UserStringValueXMLAttributeName);
+    const String userStringValue(
+        attributes.getValueAsString(Window::UserStringValueXMLAttributeName));
 
     // Short user string
     if (!userStringValue.empty())
@@ -338,9 +336,8 @@ void GUILayout_xmlHandler::elementPropertyStart(const XMLAttributes& attributes)
         attributes.getValueAsString(Property::NameXMLAttributeName));
 
     // get property value string
-    String propertyValue;
-    if (attributes.exists(Property::ValueXMLAttributeName))
-        propertyValue = attributes.getValueAsString(Property::ValueXMLAttributeName);
+    String propertyValue(
+        attributes.getValueAsString(Property::ValueXMLAttributeName));
 
     // Short property 
     if (!propertyValue.empty())
@@ -26,6 +26,8 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/VertexConverter.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -41,6 +43,49 @@ GeometryBuffer::~GeometryBuffer()
 {
 }
 
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isBatchCompatible(const GeometryBuffer& /*buffer*/) const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::drawBatched(const GeometryBuffer* const* buffers,
+                                 uint buffer_count) const
+{
+    for (uint i = 0; i < buffer_count; ++i)
+        buffers[i]->draw();
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::appendPackedGeometry(const PackedVertex* const vbuff,
+                                          uint vertex_count)
+{
+    // convert in fixed size blocks so that no temporary storage is allocated.
+    const uint block_size = 64;
+    Vertex block[block_size];
+
+    reserveVertices(vertex_count);
+
+    for (uint i = 0; i < vertex_count; i += block_size)
+    {
+        const uint count = ceguimin(block_size, vertex_count - i);
+        VertexConverter::fromPackedVertices(vbuff + i, count, block);
+        appendGeometry(block, count);
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool GeometryBuffer::isPackedGeometryNative() const
+{
+    return false;
+}
+
+//---------------------------------------------------------------------------//
+void GeometryBuffer::reserveVertices(uint /*vertex_count*/)
+{
+}
+
 //---------------------------------------------------------------------------//
 void GeometryBuffer::setBlendMode(const BlendMode mode)
 {
@@ -81,6 +81,16 @@ namespace CEGUI
 	*************************************************************************/
 	void GlobalEventSet::fireEvent(const String& name, EventArgs& args, const String& eventNamespace)
 	{
+        // this is done for every event fired by every EventSet, so skip
+        // building the name unless something may be subscribed to it.
+        if (!d_subscribedMask || d_muted)
+            return;
+
+        Event::ID id;
+        if (!Event::findInternedName(eventNamespace, name, id) ||
+            !mayHaveSubscribers(id))
+                return;
+
         // here we are very explicit about how we construct the event string.
         // Doing it 'longhand' like this saves significant time when compared
         // to the obvious - and previous - implementation:
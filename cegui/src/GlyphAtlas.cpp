@@ -0,0 +1,296 @@
+/***********************************************************************
+    filename:   GlyphAtlas.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+GlyphAtlas::GlyphAtlas(const String& name_prefix, uint initial_page_size,
+                       uint padding) :
+    d_namePrefix(name_prefix),
+    d_initialPageSize(initial_page_size),
+    d_padding(padding),
+    d_pageCounter(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::~GlyphAtlas()
+{
+    for (size_t i = 0; i < d_pages.size(); ++i)
+        destroyPage(d_pages[i]);
+}
+
+//----------------------------------------------------------------------------//
+Texture& GlyphAtlas::allocate(uint width, uint height, Rectf& area)
+{
+    const uint block_width = width + d_padding;
+    const uint block_height = height + d_padding;
+
+    // an empty area takes no space, just reference the newest page.
+    if (!block_width || !block_height)
+    {
+        Page* const page = d_pages.empty() ? createPage(0) : d_pages.back();
+        ++page->allocationCount;
+        area = Rectf(0, 0, 0, 0);
+        return *page->texture;
+    }
+
+    Page* page = 0;
+    int index = -1;
+    uint x = 0, y = 0;
+
+    for (size_t i = 0; i < d_pages.size() && index == -1; ++i)
+    {
+        page = d_pages[i];
+        index = findPosition(*page, block_width, block_height, x, y);
+    }
+
+    if (index == -1)
+    {
+        page = createPage(ceguimax(block_width, block_height) + d_padding);
+        index = findPosition(*page, block_width, block_height, x, y);
+    }
+
+    addSkylineLevel(*page, index, x, y, block_width, block_height);
+    ++page->allocationCount;
+    page->usedArea += block_width * block_height;
+
+    area = Rectf(static_cast<float>(x + d_padding),
+                 static_cast<float>(y + d_padding),
+                 static_cast<float>(x + d_padding + width),
+                 static_cast<float>(y + d_padding + height));
+
+    return *page->texture;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::release(const Texture& texture)
+{
+    for (PageList::iterator i = d_pages.begin(); i != d_pages.end(); ++i)
+    {
+        if ((*i)->texture != &texture)
+            continue;
+
+        if (!--(*i)->allocationCount)
+        {
+            destroyPage(*i);
+            d_pages.erase(i);
+        }
+
+        return;
+    }
+}
+
+//----------------------------------------------------------------------------//
+size_t GlyphAtlas::getPageCount() const
+{
+    return d_pages.size();
+}
+
+//----------------------------------------------------------------------------//
+Texture& GlyphAtlas::getPageTexture(size_t index) const
+{
+    if (index >= d_pages.size())
+        CEGUI_THROW(InvalidRequestException(
+            "The page index given is out of range for this GlyphAtlas"));
+
+    return *d_pages[index]->texture;
+}
+
+//----------------------------------------------------------------------------//
+uint GlyphAtlas::getPageAllocationCount(size_t index) const
+{
+    if (index >= d_pages.size())
+        CEGUI_THROW(InvalidRequestException(
+            "The page index given is out of range for this GlyphAtlas"));
+
+    return d_pages[index]->allocationCount;
+}
+
+//----------------------------------------------------------------------------//
+float GlyphAtlas::getPageOccupancy(size_t index) const
+{
+    if (index >= d_pages.size())
+        CEGUI_THROW(InvalidRequestException(
+            "The page index given is out of range for this GlyphAtlas"));
+
+    const Page& page = *d_pages[index];
+    return static_cast<float>(page.usedArea) /
+           (static_cast<float>(page.size) * page.size);
+}
+
+//----------------------------------------------------------------------------//
+int GlyphAtlas::findPosition(const Page& page, uint width, uint height,
+                             uint& x, uint& y) const
+{
+    // the right and bottom edges keep a padding margin too.
+    const uint limit = page.size - d_padding;
+
+    int best_index = -1;
+    uint best_bottom = 0;
+    uint best_width = 0;
+
+    for (size_t i = 0; i < page.skyline.size(); ++i)
+    {
+        const SkylineNode& node = page.skyline[i];
+        if (node.x + width > limit)
+            break;
+
+        // the area rests on the highest node it spans.
+        uint top = node.y;
+        uint remaining = width;
+        for (size_t j = i; remaining && j < page.skyline.size(); ++j)
+        {
+            top = ceguimax(top, page.skyline[j].y);
+            remaining -= ceguimin(remaining, page.skyline[j].width);
+        }
+
+        if (top + height > limit)
+            continue;
+
+        if (best_index == -1 || top + height < best_bottom ||
+            (top + height == best_bottom && node.width < best_width))
+        {
+            best_index = static_cast<int>(i);
+            best_bottom = top + height;
+            best_width = node.width;
+            x = node.x;
+            y = top;
+        }
+    }
+
+    return best_index;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::addSkylineLevel(Page& page, size_t index, uint x, uint y,
+                                 uint width, uint height) const
+{
+    SkylineNode node;
+    node.x = x;
+    node.y = y + height;
+    node.width = width;
+    page.skyline.insert(page.skyline.begin() + index, node);
+
+    // shrink or remove the nodes now covered by the new one.
+    for (size_t i = index + 1; i < page.skyline.size(); )
+    {
+        const SkylineNode& prev = page.skyline[i - 1];
+        SkylineNode& cur = page.skyline[i];
+        const uint prev_right = prev.x + prev.width;
+
+        if (cur.x >= prev_right)
+            break;
+
+        const uint overlap = prev_right - cur.x;
+        if (overlap < cur.width)
+        {
+            cur.x += overlap;
+            cur.width -= overlap;
+            break;
+        }
+
+        page.skyline.erase(page.skyline.begin() + i);
+    }
+
+    // merge neighbouring nodes at the same level.
+    for (size_t i = 1; i < page.skyline.size(); )
+    {
+        if (page.skyline[i - 1].y == page.skyline[i].y)
+        {
+            page.skyline[i - 1].width += page.skyline[i].width;
+            page.skyline.erase(page.skyline.begin() + i);
+        }
+        else
+            ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+GlyphAtlas::Page* GlyphAtlas::createPage(uint min_size)
+{
+    Renderer& renderer = *System::getSingleton().getRenderer();
+    const uint max_size = renderer.getMaxTextureSize();
+
+    uint size = d_pages.empty() ? d_initialPageSize :
+                                  d_pages.back()->size * 2;
+    while (size < min_size)
+        size *= 2;
+    size = ceguimin(size, max_size);
+
+    if (size < min_size)
+        CEGUI_THROW(InvalidRequestException(
+            "The requested area is too large to fit on a texture of the "
+            "maximum size supported by the renderer."));
+
+    const String name(d_namePrefix + "_" +
+                      PropertyHelper<uint>::toString(d_pageCounter++));
+    Texture& texture = renderer.createTexture(name, Sizef(size, size));
+
+    // clear the page once; glyphs are then uploaded individually.
+    argb_t* buffer = CEGUI_NEW_ARRAY_PT(argb_t, size * size, BufferAllocator);
+    memset(buffer, 0, size * size * sizeof(argb_t));
+    texture.loadFromMemory(buffer, Sizef(size, size), Texture::PF_RGBA);
+    CEGUI_DELETE_ARRAY_PT(buffer, argb_t, size * size, BufferAllocator);
+
+    Page* page = new Page;
+    page->texture = &texture;
+    page->size = size;
+    page->allocationCount = 0;
+    page->usedArea = 0;
+
+    SkylineNode node;
+    node.x = 0;
+    node.y = 0;
+    node.width = size - d_padding;
+    page->skyline.push_back(node);
+
+    d_pages.push_back(page);
+    return page;
+}
+
+//----------------------------------------------------------------------------//
+void GlyphAtlas::destroyPage(Page* page)
+{
+    System::getSingleton().getRenderer()->destroyTexture(*page->texture);
+    delete page;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
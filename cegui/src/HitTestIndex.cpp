@@ -0,0 +1,356 @@
+/***********************************************************************
+    filename:   HitTestIndex.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/HitTestIndex.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/RenderingWindow.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const float HitTestIndex::DefaultCellSize = 64.0f;
+
+//----------------------------------------------------------------------------//
+HitTestIndex::HitTestIndex(const GUIContext& context, float cell_size) :
+    d_context(context),
+    d_cellSize(ceguimax(1.0f, cell_size)),
+    d_surfaceSize(context.getSurfaceSize()),
+    d_columns(0),
+    d_rows(0),
+    d_valid(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+HitTestIndex::~HitTestIndex()
+{
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::setSurfaceSize(const Sizef& size)
+{
+    if (d_surfaceSize == size)
+        return;
+
+    d_surfaceSize = size;
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::setCellSize(float cell_size)
+{
+    cell_size = ceguimax(1.0f, cell_size);
+
+    if (d_cellSize == cell_size)
+        return;
+
+    d_cellSize = cell_size;
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+float HitTestIndex::getCellSize() const
+{
+    return d_cellSize;
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::invalidate()
+{
+    d_valid = false;
+    d_cells.clear();
+    d_unindexed.clear();
+    d_entries.clear();
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::updateWindow(const Window& wnd)
+{
+    // everything will be picked up by the rebuild anyway.
+    if (!d_valid)
+        return;
+
+    const EntryMap::iterator i = d_entries.find(&wnd);
+
+    if (!isIndexing(wnd))
+    {
+        if (i != d_entries.end())
+            removeWindow(wnd);
+
+        return;
+    }
+
+    if (i != d_entries.end())
+    {
+        eraseEntry(wnd, i->second);
+        d_entries.erase(i);
+    }
+
+    addWindow(const_cast<Window&>(wnd));
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::removeWindow(const Window& wnd)
+{
+    if (!d_valid)
+        return;
+
+    const EntryMap::iterator i = d_entries.find(&wnd);
+    if (i != d_entries.end())
+    {
+        eraseEntry(wnd, i->second);
+        d_entries.erase(i);
+    }
+
+    const size_t child_count = wnd.getChildCount();
+    for (size_t c = 0; c < child_count; ++c)
+        removeWindow(*wnd.getChildAtIdx(c));
+}
+
+//----------------------------------------------------------------------------//
+bool HitTestIndex::isIndexing(const Window& wnd) const
+{
+    const Window* const root = d_context.getRootWindow();
+
+    return root && (&wnd == root || wnd.isAncestor(root));
+}
+
+//----------------------------------------------------------------------------//
+Window* HitTestIndex::getChildAtPosition(const Window& start,
+                                         const Vector2f& position,
+                                         const bool allow_disabled,
+                                         const bool honour_pass_through) const
+{
+    rebuildIfRequired();
+
+    Window* best = 0;
+
+    if (d_columns > 0 && d_rows > 0)
+    {
+        const int col = ceguimax(0, ceguimin(d_columns - 1,
+            static_cast<int>(std::floor(position.d_x / d_cellSize))));
+        const int row = ceguimax(0, ceguimin(d_rows - 1,
+            static_cast<int>(std::floor(position.d_y / d_cellSize))));
+
+        const WindowList& cell = d_cells[row * d_columns + col];
+        for (WindowList::const_iterator i = cell.begin(); i != cell.end(); ++i)
+            testCandidate(*i, start, position, allow_disabled,
+                          honour_pass_through, best);
+    }
+
+    for (WindowList::const_iterator i = d_unindexed.begin();
+         i != d_unindexed.end(); ++i)
+    {
+        testCandidate(*i, start, localisePoint(start, **i, position),
+                      allow_disabled, honour_pass_through, best);
+    }
+
+    return best;
+}
+
+//----------------------------------------------------------------------------//
+size_t HitTestIndex::getWindowCount() const
+{
+    rebuildIfRequired();
+
+    return d_entries.size();
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::rebuildIfRequired() const
+{
+    if (d_valid)
+        return;
+
+    d_columns = static_cast<int>(
+        std::ceil(d_surfaceSize.d_width / d_cellSize));
+    d_rows = static_cast<int>(
+        std::ceil(d_surfaceSize.d_height / d_cellSize));
+
+    d_cells.clear();
+    d_cells.resize(ceguimax(0, d_columns * d_rows));
+    d_unindexed.clear();
+    d_entries.clear();
+
+    d_valid = true;
+
+    if (Window* const root = d_context.getRootWindow())
+        addWindowRecursive(*root);
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::addWindowRecursive(Window& wnd) const
+{
+    addWindow(wnd);
+
+    const size_t child_count = wnd.getChildCount();
+    for (size_t c = 0; c < child_count; ++c)
+        addWindowRecursive(*wnd.getChildAtIdx(c));
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::addWindow(Window& wnd) const
+{
+    Entry entry = {true, 0, 0, -1, -1};
+
+    if (isBeneathRotatedSurface(wnd))
+    {
+        entry.inGrid = false;
+        d_unindexed.push_back(&wnd);
+    }
+    else if (d_columns > 0 && d_rows > 0)
+    {
+        const Rectf area(wnd.getHitTestRect());
+
+        // zero sized areas can never be hit, so need no cells.
+        if (area.getWidth() != 0.0f && area.getHeight() != 0.0f)
+        {
+            entry.x0 = ceguimax(0, ceguimin(d_columns - 1,
+                static_cast<int>(std::floor(area.left() / d_cellSize))));
+            entry.y0 = ceguimax(0, ceguimin(d_rows - 1,
+                static_cast<int>(std::floor(area.top() / d_cellSize))));
+            entry.x1 = ceguimax(0, ceguimin(d_columns - 1,
+                static_cast<int>(std::floor(area.right() / d_cellSize))));
+            entry.y1 = ceguimax(0, ceguimin(d_rows - 1,
+                static_cast<int>(std::floor(area.bottom() / d_cellSize))));
+
+            for (int y = entry.y0; y <= entry.y1; ++y)
+                for (int x = entry.x0; x <= entry.x1; ++x)
+                    d_cells[y * d_columns + x].push_back(&wnd);
+        }
+    }
+
+    d_entries[&wnd] = entry;
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::eraseEntry(const Window& wnd, const Entry& entry) const
+{
+    if (!entry.inGrid)
+    {
+        WindowList::iterator i =
+            std::find(d_unindexed.begin(), d_unindexed.end(), &wnd);
+
+        if (i != d_unindexed.end())
+            d_unindexed.erase(i);
+
+        return;
+    }
+
+    for (int y = entry.y0; y <= entry.y1; ++y)
+    {
+        for (int x = entry.x0; x <= entry.x1; ++x)
+        {
+            WindowList& cell = d_cells[y * d_columns + x];
+            WindowList::iterator i = std::find(cell.begin(), cell.end(), &wnd);
+
+            // order within a cell is unimportant, so swap & pop.
+            if (i != cell.end())
+            {
+                *i = cell.back();
+                cell.pop_back();
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool HitTestIndex::isBeneathRotatedSurface(const Window& wnd)
+{
+    for (const Window* w = wnd.getParent(); w; w = w->getParent())
+    {
+        const RenderingSurface* const s = w->getRenderingSurface();
+
+        if (s && s->isRenderingWindow() &&
+            static_cast<const RenderingWindow*>(s)->getRotation() !=
+                Quaternion::IDENTITY)
+            return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------//
+Vector2f HitTestIndex::localisePoint(const Window& start, const Window& wnd,
+                                     const Vector2f& position)
+{
+    // collect the windows whose RenderingWindow (if any) the recursive walk
+    // would have unprojected through: start down to the parent of wnd.
+    std::vector<const Window*> chain;
+    for (const Window* w = wnd.getParent(); w; w = w->getParent())
+    {
+        chain.push_back(w);
+
+        if (w == &start)
+            break;
+    }
+
+    Vector2f p(position);
+    for (std::vector<const Window*>::reverse_iterator i = chain.rbegin();
+         i != chain.rend(); ++i)
+    {
+        RenderingSurface* const s = (*i)->getRenderingSurface();
+
+        if (s && s->isRenderingWindow())
+        {
+            Vector2f out;
+            static_cast<RenderingWindow*>(s)->unprojectPoint(p, out);
+            p = out;
+        }
+    }
+
+    return p;
+}
+
+//----------------------------------------------------------------------------//
+void HitTestIndex::testCandidate(Window* wnd, const Window& start,
+                                 const Vector2f& position,
+                                 const bool allow_disabled,
+                                 const bool honour_pass_through,
+                                 Window*& best)
+{
+    // only strict descendants of the starting window are of interest, and
+    // there is no point testing anything behind the best hit so far.
+    if (!wnd->isAncestor(&start) || (best && !wnd->isInFront(*best)))
+        return;
+
+    if (!wnd->isEffectiveVisible() ||
+        (honour_pass_through && wnd->isMousePassThroughEnabled()))
+        return;
+
+    if (wnd->isHit(position, allow_disabled))
+        best = wnd;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -39,6 +39,17 @@ Image::~Image()
 {
 }
 
+//----------------------------------------------------------------------------//
+bool Image::getPackedGeometry(PackedVertex* /*vbuff*/, uint& vertex_count,
+                              Texture*& texture, const Rectf& /*dest_area*/,
+                              const Rectf* /*clip_area*/,
+                              const ColourRect& /*colours*/) const
+{
+    vertex_count = 0;
+    texture = 0;
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 void Image::computeScalingFactors(AutoScaledMode mode,
                                   const Sizef& display_size,
@@ -35,6 +35,7 @@
 #include "CEGUI/System.h"
 #include "CEGUI/Texture.h"
 #include "CEGUI/BasicImage.h"
+#include "CEGUI/AsyncResourceLoader.h"
 
 #include <cstdio>
 #include <algorithm>
@@ -93,6 +94,8 @@ const String NativeVersion( "2" );
 static Texture* s_texture = 0;
 static AutoScaledMode s_autoScaled = ASM_Disabled;
 static Sizef s_nativeResolution(640.0f, 480.0f);
+// attribute block reused for every Image element of an imageset
+static XMLAttributes s_imageAttributes;
 
 //----------------------------------------------------------------------------//
 ImageManager::ImageManager()
@@ -174,7 +177,7 @@ Image& ImageManager::create(const XMLAttributes& attributes)
     static const String type_default("BasicImage");
     
     const String& type(attributes.getValueAsString(ImageTypeAttribute, type_default));
-    const String& name(attributes.getValueAsString(ImageNameAttribute));
+    const String name(attributes.getValueAsString(ImageNameAttribute));
 
     if (name.empty())
         CEGUI_THROW(InvalidRequestException(
@@ -313,10 +316,12 @@ void ImageManager::destroyImageCollection(const String& prefix,
 void ImageManager::addFromImageFile(const String& name, const String& filename,
                                     const String& resource_group)
 {
-    // create texture from image
-    Texture* tex = &System::getSingleton().getRenderer()->
-        createTexture(name, filename,
-            resource_group.empty() ? d_imagesetDefaultResourceGroup : resource_group);
+    const String& group(resource_group.empty() ?
+        d_imagesetDefaultResourceGroup : resource_group);
+
+    // create texture from image, using the pixels decoded by
+    // AsyncResourceLoader when there are some
+    Texture* tex = createTextureFromImage(name, filename, group);
 
     BasicImage& image = static_cast<BasicImage&>(create("BasicImage", name));
     image.setTexture(tex);
@@ -401,7 +406,7 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
     else
     {
         // create texture from image
-        s_texture = &renderer->createTexture(name, filename,
+        s_texture = createTextureFromImage(name, filename,
             resource_group.empty() ? d_imagesetDefaultResourceGroup :
                                      resource_group);
     }
@@ -416,6 +421,20 @@ void ImageManager::elementImagesetStart(const XMLAttributes& attributes)
                 attributes.getValueAsString(ImagesetAutoScaledAttribute, "false"));
 }
 
+//----------------------------------------------------------------------------//
+Texture* ImageManager::createTextureFromImage(const String& name,
+                                              const String& filename,
+                                              const String& resource_group)
+{
+    if (AsyncResourceLoader* loader = AsyncResourceLoader::getSingletonPtr())
+        if (Texture* tex = loader->createPreparedTexture(name, filename,
+                                                         resource_group))
+            return tex;
+
+    return &System::getSingleton().getRenderer()->
+        createTexture(name, filename, resource_group);
+}
+
 //----------------------------------------------------------------------------//
 void ImageManager::validateImagesetFileVersion(const XMLAttributes& attrs)
 {
@@ -445,7 +464,8 @@ void ImageManager::elementImageStart(const XMLAttributes& attributes)
         return;
     }
 
-    XMLAttributes rw_attrs(attributes);
+    XMLAttributes& rw_attrs(s_imageAttributes);
+    rw_attrs = attributes;
 
     // rewrite the name attribute to include the texture name
     rw_attrs.add(ImageNameAttribute, image_name);
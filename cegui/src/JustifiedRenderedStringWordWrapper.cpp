@@ -37,39 +37,22 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 template <>
-void RenderedStringWordWrapper<JustifiedRenderedString>::format(
-                                                        const Window* ref_wnd,
-                                                        const Sizef& area_size)
+void RenderedStringWordWrapper<JustifiedRenderedString>::createFormatters()
 {
-    deleteFormatters();
-
-    RenderedString rstring, lstring;
-    rstring = *d_renderedString;
-    float rs_width;
-
-    FormattedRenderedString* frs;
-
-    for (size_t line = 0; line < rstring.getLineCount(); ++line)
-    {
-        while ((rs_width = rstring.getPixelSize(ref_wnd, line).d_width) > 0)
-        {
-            // skip line if no wrapping occurs
-            if (rs_width <= area_size.d_width)
-                break;
-
-            // split rstring at width into lstring and remaining rstring
-            rstring.split(ref_wnd, line, area_size.d_width, lstring);
-            frs = CEGUI_NEW_AO JustifiedRenderedString(*CEGUI_NEW_AO RenderedString(lstring));
-            frs->format(ref_wnd, area_size);
-            d_lines.push_back(frs);
-            line = 0;
-        }
-    }
-
-    // last line (which we do not justify)
-    frs = CEGUI_NEW_AO LeftAlignedRenderedString(*CEGUI_NEW_AO RenderedString(rstring));
-    frs->format(ref_wnd, area_size);
-    d_lines.push_back(frs);
+    // Every line up to the last wrap point is justified; the lines after it
+    // are left aligned.
+    size_t justified_end = d_wrappedLines.size();
+    while (justified_end && !d_wrappedLines[justified_end - 1].wrapped)
+        --justified_end;
+
+    if (justified_end)
+        d_lines.push_back(CEGUI_NEW_AO JustifiedRenderedString(
+            createLineRun(0, justified_end)));
+
+    // keep one (possibly empty) left aligned formatter for the last line(s).
+    if (justified_end < d_wrappedLines.size() || d_lines.empty())
+        d_lines.push_back(CEGUI_NEW_AO LeftAlignedRenderedString(
+            createLineRun(justified_end, d_wrappedLines.size())));
 }
 
 //----------------------------------------------------------------------------//
@@ -45,12 +45,15 @@ KeyFrame::KeyFrame(Affector* parent, float position):
         d_parent(parent),
         d_position(position),
 
-        d_progression(P_Linear)
+        d_progression(P_Linear),
+        d_nativeValue(0)
 {}
 
 //----------------------------------------------------------------------------//
 KeyFrame::~KeyFrame(void)
-{}
+{
+    setNativeValue(0);
+}
 
 //----------------------------------------------------------------------------//
 Affector* KeyFrame::getParent() const
@@ -97,6 +100,7 @@ float KeyFrame::getPosition() const
 void KeyFrame::setValue(const String& value)
 {
     d_value = value;
+    setNativeValue(0);
 }
 
 //----------------------------------------------------------------------------//
@@ -109,6 +113,7 @@ const String& KeyFrame::getValue() const
 void KeyFrame::setSourceProperty(const String& sourceProperty)
 {
     d_sourceProperty = sourceProperty;
+    setNativeValue(0);
 }
 
 //----------------------------------------------------------------------------//
@@ -220,6 +225,23 @@ void KeyFrame::writeXMLToStream(XMLSerializer& xml_stream) const
     xml_stream.closeTag();
 }
 
+//----------------------------------------------------------------------------//
+KeyFrame::NativeValue* KeyFrame::getNativeValue() const
+{
+    return d_nativeValue;
+}
+
+//----------------------------------------------------------------------------//
+void KeyFrame::setNativeValue(NativeValue* value) const
+{
+    if (d_nativeValue == value)
+        return;
+
+    CEGUI_DELETE_AO d_nativeValue;
+    d_nativeValue = value;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
+
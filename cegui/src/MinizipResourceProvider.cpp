@@ -28,6 +28,7 @@
  *   OTHER DEALINGS IN THE SOFTWARE.
  ***************************************************************************/
 #include "CEGUI/MinizipResourceProvider.h"
+#include "CEGUI/ThreadPool.h"
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
 
@@ -36,7 +37,11 @@
 
 #include "minizip/unzip.h"
 
+#include <algorithm>
 #include <fstream>
+#include <list>
+#include <map>
+#include <string.h>
 
 #if defined (__WIN32__) || defined(_WIN32)
 #   include <Shlwapi.h>
@@ -56,15 +61,59 @@ namespace CEGUI
 // Impl struct: mainly used in order to keep unzip.h out of the public headers.
 struct MinizipResourceProvider::Impl
 {
+    //! location and size of a file in the archive.
+    struct IndexEntry
+    {
+        unz_file_pos d_position;
+        ulong d_size;
+    };
+
+    //! a decompressed file held in the cache.
+    struct CacheEntry
+    {
+        String d_name;
+        std::vector<uint8> d_data;
+    };
+
+    class PreloadTask;
+
+    //! in lexical order, so that the names under a directory are adjacent.
+    typedef std::map<String, IndexEntry> Index;
+    //! cached files, most recently used first.
+    typedef std::list<CacheEntry> CacheList;
+    typedef std::map<String, CacheList::iterator, StringFastLessCompare>
+        CacheMap;
+
     Impl(const bool loadLocal) :
         d_zfile(0),
-        d_loadLocal(loadLocal)
+        d_loadLocal(loadLocal),
+        d_cacheBytes(0),
+        d_cacheSize(0)
     {
     }
 
+    static const char* readEntry(unzFile zfile, const IndexEntry& entry,
+                                 uint8* buffer);
+
+    void buildIndex();
+    bool findEntry(const String& name, IndexEntry& entry);
+    bool copyFromCache(const String& name, RawDataContainer& output);
+    bool addToCache(const String& name, std::vector<uint8>& data);
+    void trimCache(size_t size);
+
     unzFile d_zfile;
     String  d_archive;
     bool    d_loadLocal;
+    //! every file in the archive, by name.
+    Index   d_index;
+    CacheList d_cache;
+    CacheMap d_cacheEntries;
+    //! bytes of data held by the cache.
+    size_t  d_cacheBytes;
+    //! maximum bytes of data the cache may hold.
+    size_t  d_cacheSize;
+    //! guards d_zfile and the cache.
+    Mutex   d_mutex;
 };
 
 //----------------------------------------------------------------------------//
@@ -74,6 +123,208 @@ bool nameMatchesPattern(const String& name, const String& pattern)
     return !FNMATCH(pattern.c_str(), name.c_str());
 }
 
+//----------------------------------------------------------------------------//
+// Decompress the file at \a entry into \a buffer, which must hold the
+// uncompressed size of the file.  Returns a description of the error, or an
+// empty string on success.
+const char* MinizipResourceProvider::Impl::readEntry(unzFile zfile,
+                                                    const IndexEntry& entry,
+                                                    uint8* buffer)
+{
+    unz_file_pos position = entry.d_position;
+
+    if (unzGoToFilePos(zfile, &position) != UNZ_OK)
+        return "error reading file header";
+
+    if (unzOpenCurrentFile(zfile) != Z_OK)
+        return "error opening file";
+
+    if (unzReadCurrentFile(zfile, buffer, entry.d_size) < 0)
+    {
+        unzCloseCurrentFile(zfile);
+        return "error reading file";
+    }
+
+    if (unzCloseCurrentFile(zfile) != UNZ_OK)
+        return "error validating file";
+
+    return "";
+}
+
+//----------------------------------------------------------------------------//
+// Decompresses files for MinizipResourceProvider::preloadFiles, using its
+// own handle to the archive so that several tasks can run at once.
+class MinizipResourceProvider::Impl::PreloadTask : public ThreadPool::Task
+{
+public:
+    PreloadTask(Impl& impl, const std::vector<String>& names, size_t& next,
+                size_t& added) :
+        d_impl(impl),
+        d_names(names),
+        d_next(next),
+        d_added(added)
+    {}
+
+    void execute()
+    {
+        unzFile zfile = unzOpen(d_impl.d_archive.c_str());
+        if (!zfile)
+            return;
+
+        for (;;)
+        {
+            String name;
+            IndexEntry entry;
+
+            {
+                MutexLock lock(d_impl.d_mutex);
+
+                if (d_next == d_names.size())
+                    break;
+
+                name = d_names[d_next++];
+
+                if (d_impl.d_cacheEntries.find(name) !=
+                        d_impl.d_cacheEntries.end() ||
+                    !d_impl.findEntry(name, entry) ||
+                    entry.d_size > d_impl.d_cacheSize)
+                    continue;
+            }
+
+            std::vector<uint8> data(entry.d_size);
+
+            if (*readEntry(zfile, entry, data.empty() ? 0 : &data[0]))
+                continue;
+
+            MutexLock lock(d_impl.d_mutex);
+            if (d_impl.addToCache(name, data))
+                ++d_added;
+        }
+
+        unzClose(zfile);
+    }
+
+private:
+    Impl& d_impl;
+    const std::vector<String>& d_names;
+    //! index of the next name to decompress; guarded by the Impl mutex.
+    size_t& d_next;
+    //! number of files added to the cache; guarded by the Impl mutex.
+    size_t& d_added;
+};
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::buildIndex()
+{
+    d_index.clear();
+
+    char current_name[1024];
+    unz_file_info file_info;
+    IndexEntry entry;
+
+    if (unzGoToFirstFile(d_zfile) != UNZ_OK)
+        return;
+
+    do
+    {
+        if (unzGetCurrentFileInfo(d_zfile, &file_info,
+                                  current_name, 1024, 0, 0, 0, 0) != UNZ_OK ||
+            unzGetFilePos(d_zfile, &entry.d_position) != UNZ_OK)
+        {
+            Logger::getSingleton().logEvent(
+                "MinizipResourceProvider::buildIndex: "
+                "unzGetCurrentFileInfo failed, terminating scan.", Errors);
+
+            return;
+        }
+
+        entry.d_size = file_info.uncompressed_size;
+        d_index[current_name] = entry;
+    }
+    while (unzGoToNextFile(d_zfile) == UNZ_OK);
+}
+
+//----------------------------------------------------------------------------//
+bool MinizipResourceProvider::Impl::findEntry(const String& name,
+                                              IndexEntry& entry)
+{
+    const Index::const_iterator i = d_index.find(name);
+
+    if (i != d_index.end())
+    {
+        entry = i->second;
+        return true;
+    }
+
+    // the index is case sensitive, but minizip matches names without case
+    // on some platforms.
+    unz_file_info file_info;
+
+    if (unzLocateFile(d_zfile, name.c_str(), 0) != UNZ_OK ||
+        unzGetCurrentFileInfo(d_zfile, &file_info,
+                              0, 0, 0, 0, 0, 0) != UNZ_OK ||
+        unzGetFilePos(d_zfile, &entry.d_position) != UNZ_OK)
+        return false;
+
+    entry.d_size = file_info.uncompressed_size;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool MinizipResourceProvider::Impl::copyFromCache(const String& name,
+                                                  RawDataContainer& output)
+{
+    const CacheMap::iterator i = d_cacheEntries.find(name);
+
+    if (i == d_cacheEntries.end())
+        return false;
+
+    // move to the front, as the most recently used.
+    d_cache.splice(d_cache.begin(), d_cache, i->second);
+
+    const std::vector<uint8>& data = i->second->d_data;
+    uint8* const buffer =
+        CEGUI_NEW_ARRAY_PT(uint8, data.size(), RawDataContainer);
+
+    if (!data.empty())
+        memcpy(buffer, &data[0], data.size());
+
+    output.setData(buffer);
+    output.setSize(data.size());
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+bool MinizipResourceProvider::Impl::addToCache(const String& name,
+                                               std::vector<uint8>& data)
+{
+    if (data.size() > d_cacheSize ||
+        d_cacheEntries.find(name) != d_cacheEntries.end())
+        return false;
+
+    trimCache(d_cacheSize - data.size());
+
+    d_cache.push_front(CacheEntry());
+    d_cache.front().d_name = name;
+    d_cache.front().d_data.swap(data);
+    d_cacheEntries[name] = d_cache.begin();
+    d_cacheBytes += d_cache.front().d_data.size();
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::Impl::trimCache(size_t size)
+{
+    while (d_cacheBytes > size)
+    {
+        d_cacheBytes -= d_cache.back().d_data.size();
+        d_cacheEntries.erase(d_cache.back().d_name);
+        d_cache.pop_back();
+    }
+}
+
 //----------------------------------------------------------------------------//
 MinizipResourceProvider::MinizipResourceProvider() :
     d_pimpl(new Impl(true))
@@ -128,6 +379,8 @@ void MinizipResourceProvider::openArchive()
         CEGUI_THROW(InvalidRequestException(
             "'" + d_pimpl->d_archive + "' does not exist"));
     }
+
+    d_pimpl->buildIndex();
 }
 
 //----------------------------------------------------------------------------//
@@ -145,6 +398,8 @@ void MinizipResourceProvider::closeArchive()
     }
 
     d_pimpl->d_zfile = 0;
+    d_pimpl->d_index.clear();
+    d_pimpl->trimCache(0);
 }
 
 //----------------------------------------------------------------------------//
@@ -169,46 +424,53 @@ void MinizipResourceProvider::loadRawDataContainer(const String& filename,
             "loaded because the archive has not been set"));
     }
 
-    if (unzLocateFile(d_pimpl->d_zfile, final_filename.c_str(), 0) != UNZ_OK)
-    {
-        CEGUI_THROW(InvalidRequestException("'" + final_filename +
-            "' does not exist"));
-    }
+    MutexLock lock(d_pimpl->d_mutex);
 
-    unz_file_info file_info;
+    if (d_pimpl->copyFromCache(final_filename, output))
+        return;
 
-    if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                              0, 0, 0, 0, 0, 0) != UNZ_OK)
-    {
-        CEGUI_THROW(FileIOException("'" + final_filename +
-            "' error reading file header"));
-    }
+    Impl::IndexEntry entry;
 
-    if (unzOpenCurrentFile(d_pimpl->d_zfile) != Z_OK)
+    if (!d_pimpl->findEntry(final_filename, entry))
     {
-        CEGUI_THROW(FileIOException("'" + final_filename +
-            "' error opening file"));
+        CEGUI_THROW(InvalidRequestException("'" + final_filename +
+            "' does not exist"));
     }
 
-    ulong size = file_info.uncompressed_size;
+    const ulong size = entry.d_size;
     uint8* buffer = CEGUI_NEW_ARRAY_PT(uint8, size, RawDataContainer);
 
-    if (unzReadCurrentFile(d_pimpl->d_zfile, buffer, size) < 0)
+    const char* const error = Impl::readEntry(d_pimpl->d_zfile, entry, buffer);
+
+    if (*error)
     {
-        CEGUI_THROW(FileIOException("'" + final_filename +
-            "' error reading file"));
+        CEGUI_DELETE_ARRAY_PT(buffer, uint8, size, RawDataContainer);
+        CEGUI_THROW(FileIOException("'" + final_filename + "' " + error));
     }
 
-    if (unzCloseCurrentFile(d_pimpl->d_zfile) != UNZ_OK)
+    if (size <= d_pimpl->d_cacheSize)
     {
-        CEGUI_THROW(GenericException("'" + final_filename +
-            "' error validating file"));
+        std::vector<uint8> data(buffer, buffer + size);
+        d_pimpl->addToCache(final_filename, data);
     }
 
     output.setData(buffer);
     output.setSize(size);
 }
 
+//----------------------------------------------------------------------------//
+bool MinizipResourceProvider::getFileStatus(const String& filename,
+                                            const String& resourceGroup,
+                                            uint64& size, uint64& modifiedTime)
+{
+    // files in the archive are not reported; only local ones are.
+    if (!d_pimpl->d_loadLocal)
+        return false;
+
+    return DefaultResourceProvider::getFileStatus(filename, resourceGroup,
+                                                  size, modifiedTime);
+}
+
 //----------------------------------------------------------------------------//
 size_t MinizipResourceProvider::getResourceGroupFileNames(
                                 std::vector<String>& out_vec,
@@ -234,39 +496,23 @@ size_t MinizipResourceProvider::getResourceGroupFileNames(
     if (!d_pimpl->d_zfile)
         return entries;
 
-    char current_name[1024];
-    unz_file_info file_info;
-    
-    if (unzGoToFirstFile(d_pimpl->d_zfile) != UNZ_OK)
-    {
-        Logger::getSingleton().logEvent(
-            "MinizipResourceProvider::getResourceGroupFileNames: "
-            "unzGoToFirstFile failed, skipping zip file scan.", Errors);
-
-        return entries;
-    }
+    const String pattern(dir_name + file_pattern);
 
-    do
+    // the index is sorted, so only names starting with the directory need to
+    // be matched.
+    for (Impl::Index::const_iterator i = d_pimpl->d_index.lower_bound(dir_name);
+         i != d_pimpl->d_index.end() &&
+         i->first.compare(0, dir_name.length(), dir_name) == 0;
+         ++i)
     {
-        if (unzGetCurrentFileInfo(d_pimpl->d_zfile, &file_info,
-                                  current_name, 1024, 0, 0, 0, 0) != UNZ_OK)
-        {
-            Logger::getSingleton().logEvent(
-                "MinizipResourceProvider::getResourceGroupFileNames: "
-                "unzGetCurrentFileInfo failed, terminating scan.", Errors);
-
-            return entries;
-        }
-
         // skip this file if it does not match the pattern.
-        if (!nameMatchesPattern(current_name, dir_name + file_pattern))
+        if (!nameMatchesPattern(i->first, pattern))
             continue;
 
         // strip the resource directory name and append the matched file
-        out_vec.push_back(String(current_name).substr(dir_name.length()));
+        out_vec.push_back(i->first.substr(dir_name.length()));
         ++entries;
     }
-    while (unzGoToNextFile(d_pimpl->d_zfile) == UNZ_OK);
 
     return entries;
 }
@@ -277,6 +523,73 @@ void MinizipResourceProvider::setLoadLocal(bool load)
     d_pimpl->d_loadLocal = load;
 }
 
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::setCacheSize(size_t bytes)
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    d_pimpl->d_cacheSize = bytes;
+    d_pimpl->trimCache(bytes);
+}
+
+//----------------------------------------------------------------------------//
+size_t MinizipResourceProvider::getCacheSize() const
+{
+    return d_pimpl->d_cacheSize;
+}
+
+//----------------------------------------------------------------------------//
+size_t MinizipResourceProvider::getCachedBytes() const
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    return d_pimpl->d_cacheBytes;
+}
+
+//----------------------------------------------------------------------------//
+void MinizipResourceProvider::clearCache()
+{
+    MutexLock lock(d_pimpl->d_mutex);
+    d_pimpl->trimCache(0);
+}
+
+//----------------------------------------------------------------------------//
+size_t MinizipResourceProvider::preloadFiles(
+                                    const std::vector<String>& filenames,
+                                    const String& resource_group,
+                                    size_t thread_count)
+{
+    if (!d_pimpl->d_zfile || !d_pimpl->d_cacheSize || filenames.empty())
+        return 0;
+
+    std::vector<String> names;
+    names.reserve(filenames.size());
+    for (size_t i = 0; i < filenames.size(); ++i)
+    {
+        const String final_filename(
+            getFinalFilename(filenames[i], resource_group));
+
+        // local files are loaded from outside the archive anyway
+        if (!d_pimpl->d_loadLocal || !doesFileExist(final_filename))
+            names.push_back(final_filename);
+    }
+
+    if (names.empty())
+        return 0;
+
+    size_t next = 0;
+    size_t added = 0;
+
+    ThreadPool pool(thread_count ? thread_count :
+                    std::min(ThreadPool::getProcessorCount(), names.size()));
+
+    for (size_t i = 0; i < pool.getThreadCount(); ++i)
+        pool.submit(CEGUI_NEW_AO Impl::PreloadTask(*d_pimpl, names,
+                                                   next, added));
+
+    pool.waitUntilIdle();
+
+    return added;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
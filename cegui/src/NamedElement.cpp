@@ -75,8 +75,10 @@ void NamedElement::setName(const String& name)
     }
 
     // log this under informative level
-    Logger::getSingleton().logEvent("Renamed element at: " + getNamePath() +
-                                    " as: " + name, Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.getLoggingLevel() >= Informative)
+        logger.logEvent("Renamed element at: " + getNamePath() +
+                        " as: " + name, Informative);
 
     d_name = name;
 
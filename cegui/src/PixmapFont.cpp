@@ -191,7 +191,7 @@ void PixmapFont::defineMapping(const utf32 codepoint, const String& image_name,
     d_height = d_ascender - d_descender;
 
     // add glyph to the map
-    d_cp_map[codepoint] = glyph;
+    defineGlyph(codepoint, glyph);
 }
 
 //----------------------------------------------------------------------------//
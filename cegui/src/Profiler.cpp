@@ -0,0 +1,402 @@
+/***********************************************************************
+    filename:   Profiler.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/Profiler.h"
+#include "CEGUI/ThreadPool.h"
+#include "CEGUI/Exceptions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <time.h>
+#   include <sys/time.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+template<> Profiler* Singleton<Profiler>::ms_Singleton = 0;
+
+//----------------------------------------------------------------------------//
+struct Profiler::Record
+{
+    //! index of the record plus one once written, 0 while being written.
+    volatile uint32 d_sequence;
+    uint32 d_thread;
+    const char* d_name;
+    uint64 d_start;
+    uint64 d_end;
+    char d_detail[MAX_DETAIL_LENGTH + 1];
+    //! whether this is a frame, with counters.
+    bool d_isFrame;
+    uint32 d_counters[C_COUNT];
+};
+
+//----------------------------------------------------------------------------//
+namespace
+{
+//! return a time in microseconds from an arbitrary point.
+uint64 platformTime()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return static_cast<uint64>(counter.QuadPart / frequency.QuadPart) *
+               1000000 +
+           static_cast<uint64>(counter.QuadPart % frequency.QuadPart) *
+               1000000 / frequency.QuadPart;
+#elif defined(CLOCK_MONOTONIC)
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<uint64>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+#else
+    timeval now;
+    gettimeofday(&now, 0);
+    return static_cast<uint64>(now.tv_sec) * 1000000 + now.tv_usec;
+#endif
+}
+
+//! copy at most max_length bytes of the utf8 \a src, without splitting a
+//! code point.
+void copyDetail(char* dst, const char* src, size_t max_length)
+{
+    size_t length = std::strlen(src);
+    if (length > max_length)
+    {
+        length = max_length;
+        while (length > 0 &&
+               (static_cast<unsigned char>(src[length]) & 0xC0) == 0x80)
+            --length;
+    }
+
+    std::memcpy(dst, src, length);
+    dst[length] = 0;
+}
+
+//! write \a str as a JSON string.
+void writeJSONString(OutStream& out, const char* str)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    out << '"';
+    for ( ; *str; ++str)
+    {
+        const unsigned char c = static_cast<unsigned char>(*str);
+
+        if (c == '"' || c == '\\')
+            out << '\\' << *str;
+        else if (c < 0x20)
+            out << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+        else
+            out << *str;
+    }
+    out << '"';
+}
+
+//! write \a counters as the members of a JSON object.
+void writeCounters(OutStream& out, const uint32* counters)
+{
+    out << '{';
+    for (int c = 0; c < Profiler::C_COUNT; ++c)
+        out << (c ? ",\"" : "\"")
+            << Profiler::getCounterName(static_cast<Profiler::Counter>(c))
+            << "\":" << counters[c];
+    out << '}';
+}
+
+}
+
+//----------------------------------------------------------------------------//
+Profiler::Profiler(size_t capacity) :
+    d_enabled(false),
+    d_capacity(1),
+    d_writeIndex(0),
+    d_frameNumber(0),
+    d_frameStart(0),
+    d_baseTime(platformTime())
+{
+    while (d_capacity < capacity && d_capacity < 0x80000000u)
+        d_capacity <<= 1;
+
+    for (int i = 0; i < C_COUNT; ++i)
+    {
+        d_counters[i] = 0;
+        d_lastFrameCounters[i] = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+Profiler::~Profiler()
+{
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::setEnabled(bool enabled)
+{
+    if (enabled && d_records.empty())
+    {
+        Record blank;
+        std::memset(&blank, 0, sizeof(blank));
+        d_records.resize(d_capacity, blank);
+    }
+
+    if (enabled && !d_enabled)
+        d_frameStart = getTime();
+
+    d_enabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::clear()
+{
+    for (size_t i = 0; i < d_records.size(); ++i)
+        d_records[i].d_sequence = 0;
+
+    for (int i = 0; i < C_COUNT; ++i)
+    {
+        Atomic::store(d_counters[i], 0);
+        d_lastFrameCounters[i] = 0;
+    }
+
+    Atomic::store(d_writeIndex, 0);
+    d_frameNumber = 0;
+    d_frameStart = getTime();
+}
+
+//----------------------------------------------------------------------------//
+uint64 Profiler::getTime() const
+{
+    return platformTime() - d_baseTime;
+}
+
+//----------------------------------------------------------------------------//
+Profiler::Record* Profiler::claimRecord(uint32& index)
+{
+    if (!d_enabled || d_records.empty())
+        return 0;
+
+    index = Atomic::add(d_writeIndex, 1) - 1;
+    Record& record = d_records[index & (d_capacity - 1)];
+    Atomic::store(record.d_sequence, 0);
+
+    return &record;
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::publishRecord(Record& record, uint32 index)
+{
+    Atomic::store(record.d_sequence, index + 1);
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::recordZone(const char* name, const char* detail,
+                          uint64 start, uint64 end)
+{
+    uint32 index;
+    Record* const record = claimRecord(index);
+    if (!record)
+        return;
+
+    record->d_thread = ThreadPool::getCurrentThreadID();
+    record->d_name = name;
+    record->d_start = start;
+    record->d_end = end;
+    copyDetail(record->d_detail, detail ? detail : "", MAX_DETAIL_LENGTH);
+    record->d_isFrame = false;
+
+    publishRecord(*record, index);
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::count(Counter counter, uint32 amount)
+{
+    Atomic::add(d_counters[counter], amount);
+}
+
+//----------------------------------------------------------------------------//
+uint32 Profiler::getCount(Counter counter) const
+{
+    return Atomic::load(d_counters[counter]);
+}
+
+//----------------------------------------------------------------------------//
+uint32 Profiler::getLastFrameCount(Counter counter) const
+{
+    return d_lastFrameCounters[counter];
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::endFrame()
+{
+    // subtracting what was read keeps counts added meanwhile by other threads
+    for (int i = 0; i < C_COUNT; ++i)
+    {
+        d_lastFrameCounters[i] = Atomic::load(d_counters[i]);
+        Atomic::add(d_counters[i], 0u - d_lastFrameCounters[i]);
+    }
+
+    ++d_frameNumber;
+
+    const uint64 now = getTime();
+    const uint64 start = d_frameStart;
+    d_frameStart = now;
+
+    uint32 index;
+    Record* const record = claimRecord(index);
+    if (!record)
+        return;
+
+    record->d_thread = ThreadPool::getCurrentThreadID();
+    record->d_name = "Frame";
+    record->d_start = start;
+    record->d_end = now;
+    record->d_detail[0] = 0;
+    record->d_isFrame = true;
+    std::copy(d_lastFrameCounters, d_lastFrameCounters + C_COUNT,
+              record->d_counters);
+
+    publishRecord(*record, index);
+}
+
+//----------------------------------------------------------------------------//
+uint32 Profiler::getFrameNumber() const
+{
+    return d_frameNumber;
+}
+
+//----------------------------------------------------------------------------//
+size_t Profiler::getRecordCount() const
+{
+    if (d_records.empty())
+        return 0;
+
+    return std::min(Atomic::load(d_writeIndex), d_capacity);
+}
+
+//----------------------------------------------------------------------------//
+const char* Profiler::getCounterName(Counter counter)
+{
+    switch (counter)
+    {
+    case C_WINDOWS_REDRAWN:
+        return "WindowsRedrawn";
+    case C_VERTICES:
+        return "Vertices";
+    case C_BATCHES:
+        return "Batches";
+    case C_TEXTURE_SWITCHES:
+        return "TextureSwitches";
+    case C_SURFACES_INVALIDATED:
+        return "SurfacesInvalidated";
+    case C_EVENTS_FIRED:
+        return "EventsFired";
+    default:
+        return "";
+    }
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::writeChromeTrace(OutStream& out) const
+{
+    out << "{\"traceEvents\":[";
+
+    const uint32 end = d_records.empty() ? 0 : Atomic::load(d_writeIndex);
+    const uint32 count = std::min(end, d_capacity);
+    bool first = true;
+
+    for (uint32 i = end - count; i != end; ++i)
+    {
+        const Record& slot = d_records[i & (d_capacity - 1)];
+
+        // skip records being written, or overwritten while copied.
+        if (Atomic::load(slot.d_sequence) != i + 1)
+            continue;
+
+        Record record;
+        std::memcpy(&record, &slot, sizeof(record));
+
+        if (Atomic::load(slot.d_sequence) != i + 1)
+            continue;
+
+        out << (first ? "\n" : ",\n") << "{\"name\":";
+        writeJSONString(out, record.d_name);
+        out << ",\"cat\":\"CEGUI\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+            << record.d_thread << ",\"ts\":" << record.d_start
+            << ",\"dur\":" << record.d_end - record.d_start;
+        first = false;
+
+        if (record.d_isFrame)
+        {
+            // also as a counter event, which viewers plot over time.
+            out << ",\"args\":";
+            writeCounters(out, record.d_counters);
+            out << "},\n{\"name\":\"Counters\",\"cat\":\"CEGUI\","
+                   "\"ph\":\"C\",\"pid\":1,\"tid\":" << record.d_thread
+                << ",\"ts\":" << record.d_end << ",\"args\":";
+            writeCounters(out, record.d_counters);
+            out << '}';
+        }
+        else if (record.d_detail[0])
+        {
+            out << ",\"args\":{\"detail\":";
+            writeJSONString(out, record.d_detail);
+            out << "}}";
+        }
+        else
+            out << "}";
+    }
+
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+//----------------------------------------------------------------------------//
+void Profiler::writeChromeTrace(const String& filename) const
+{
+    std::ofstream out(filename.c_str(), std::ios::binary);
+    if (!out)
+        CEGUI_THROW(FileIOException(
+            "Unable to open file '" + filename + "' for writing."));
+
+    writeChromeTrace(out);
+}
+
+//----------------------------------------------------------------------------//
+void ProfileZone::setDetail(const String& detail)
+{
+    copyDetail(d_detail, detail.c_str(), Profiler::MAX_DETAIL_LENGTH);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
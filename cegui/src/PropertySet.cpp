@@ -34,6 +34,25 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+/*************************************************************************
+	Storage for interned property names
+*************************************************************************/
+typedef std::map<String, PropertySet::PropertyID, StringFastLessCompare
+    CEGUI_MAP_ALLOC(String, PropertySet::PropertyID)> InternedPropertyIDMap;
+typedef std::vector<String
+    CEGUI_VECTOR_ALLOC(String)> InternedPropertyNameList;
+
+static InternedPropertyIDMap& getInternedPropertyIDs()
+{
+    static InternedPropertyIDMap ids;
+    return ids;
+}
+
+static InternedPropertyNameList& getInternedPropertyNames()
+{
+    static InternedPropertyNameList names;
+    return names;
+}
 
 /*************************************************************************
 	Add a new property to the set
@@ -63,6 +82,7 @@ void PropertySet::removeProperty(const String& name)
 	if (pos != d_properties.end())
 	{
 		d_properties.erase(pos);
+        d_propertyCache.clear();
 	}
 }
 
@@ -81,12 +101,69 @@ Property* PropertySet::getPropertyInstance(const String& name) const
     return pos->second;
 }
 
+/*************************************************************************
+	Retrieves a property instance from the set using an interned ID
+*************************************************************************/
+Property* PropertySet::getPropertyInstance(PropertyID id) const
+{
+    if (d_propertyCache.empty())
+        d_propertyCache.resize(PropertyCacheSize);
+
+    PropertyCacheEntry& entry = d_propertyCache[id & (PropertyCacheSize - 1)];
+
+    if (entry.d_property && entry.d_id == id)
+        return entry.d_property;
+
+    // only successful look ups are cached, so adding properties later on
+    // never leaves a stale entry behind.
+    entry.d_property = getPropertyInstance(getInternedPropertyName(id));
+    entry.d_id = id;
+
+    return entry.d_property;
+}
+
+/*************************************************************************
+	Intern a property name
+*************************************************************************/
+PropertySet::PropertyID PropertySet::internPropertyName(const String& name)
+{
+    InternedPropertyIDMap& ids = getInternedPropertyIDs();
+    InternedPropertyIDMap::const_iterator pos = ids.find(name);
+
+    if (pos != ids.end())
+        return pos->second;
+
+    InternedPropertyNameList& names = getInternedPropertyNames();
+    const PropertyID id = static_cast<PropertyID>(names.size());
+    names.push_back(name);
+    ids.insert(std::make_pair(name, id));
+
+    return id;
+}
+
+/*************************************************************************
+	Return the name interned for an ID
+*************************************************************************/
+const String& PropertySet::getInternedPropertyName(PropertyID id)
+{
+    const InternedPropertyNameList& names = getInternedPropertyNames();
+
+    if (id >= names.size())
+    {
+        CEGUI_THROW(UnknownObjectException("There is no property name interned as ID " +
+            PropertyHelper<uint>::toString(id) + "."));
+    }
+
+    return names[id];
+}
+
 /*************************************************************************
 	Remove all properties from the set
 *************************************************************************/
 void PropertySet::clearProperties(void)
 {
 	d_properties.clear();
+    d_propertyCache.clear();
 }
 
 /*************************************************************************
@@ -127,6 +204,14 @@ String PropertySet::getProperty(const String& name) const
 	return pos->second->get(this);
 }
 
+/*************************************************************************
+	Gets the current value of a property using an interned ID
+*************************************************************************/
+String PropertySet::getProperty(PropertyID id) const
+{
+    return getPropertyInstance(id)->get(this);
+}
+
 /*************************************************************************
 	Set the current value of a property
 *************************************************************************/
@@ -33,6 +33,7 @@
 #include "CEGUI/String.h"
 #include "CEGUI/PropertyHelper.h"
 #include "CEGUI/Exceptions.h"
+#include "CEGUI/TplInterpolators.h"
 #include <limits>
 
 // Start of CEGUI namespace section
@@ -189,6 +190,36 @@ String QuaternionSlerpInterpolator::interpolateRelativeMultiply(
     return Helper::toString(Quaternion::IDENTITY);
 }
 
+//----------------------------------------------------------------------------//
+bool QuaternionSlerpInterpolator::interpolateNative(Property& property,
+                                    AnimationInstance* instance,
+                                    Affector::ApplicationMethod method,
+                                    const KeyFrame& left,
+                                    const KeyFrame& right,
+                                    float position)
+{
+    TypedProperty<Quaternion>* const typedProperty =
+        dynamic_cast<TypedProperty<Quaternion>*>(&property);
+
+    // AM_RelativeMultiply is left to the String path, which reports the error
+    if (!typedProperty || method == Affector::AM_RelativeMultiply)
+        return false;
+
+    typedef TplInterpolatorNativeHelper<Quaternion> Native;
+
+    const Quaternion val1 = Native::getKeyFrameValue(left, instance);
+    const Quaternion val2 = Native::getKeyFrameValue(right, instance);
+
+    if (method == Affector::AM_Relative)
+        typedProperty->setNative(instance->getTarget(),
+            Native::getBaseValue(property, instance) * Quaternion::slerp(val1, val2, position));
+    else
+        typedProperty->setNative(instance->getTarget(),
+                                 Quaternion::slerp(val1, val2, position));
+
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
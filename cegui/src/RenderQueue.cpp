@@ -27,18 +27,101 @@
  ***************************************************************************/
 #include "CEGUI/RenderQueue.h"
 #include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+RenderQueue::RenderQueue() :
+    d_batchingEnabled(false)
+{
+}
+
+//----------------------------------------------------------------------------//
+#ifdef CEGUI_HAS_PROFILER
+// Count the batches in \a buffers and the texture switches between them.
+// Only the last texture of a buffer is known, so every batch of a buffer
+// holding several is taken to switch texture.
+template<typename T>
+static void countBatches(const T& buffers)
+{
+    Profiler* const profiler = Profiler::getSingletonPtr();
+    if (!profiler || !profiler->isEnabled())
+        return;
+
+    uint batches = 0;
+    uint switches = 0;
+    const Texture* texture = 0;
+
+    for (typename T::const_iterator i = buffers.begin(); i != buffers.end(); ++i)
+    {
+        const uint count = (*i)->getBatchCount();
+        if (!count)
+            continue;
+
+        batches += count;
+        switches += count - 1;
+
+        if ((*i)->getActiveTexture() != texture || count > 1)
+            ++switches;
+
+        texture = (*i)->getActiveTexture();
+    }
+
+    profiler->count(Profiler::C_BATCHES, batches);
+    profiler->count(Profiler::C_TEXTURE_SWITCHES, switches);
+}
+#endif
+
 //----------------------------------------------------------------------------//
 void RenderQueue::draw() const
 {
-    // draw the buffers
-    BufferList::const_iterator i = d_buffers.begin();
-    for ( ; i != d_buffers.end(); ++i)
-        (*i)->draw();
+#ifdef CEGUI_HAS_PROFILER
+    countBatches(d_buffers);
+#endif
+
+    if (!d_batchingEnabled)
+    {
+        // draw the buffers
+        BufferList::const_iterator i = d_buffers.begin();
+        for ( ; i != d_buffers.end(); ++i)
+            (*i)->draw();
+
+        return;
+    }
+
+    const size_t count = d_buffers.size();
+    size_t start = 0;
+    while (start < count)
+    {
+        // find the run of buffers that can be drawn with the first.
+        const GeometryBuffer& first = *d_buffers[start];
+        size_t end = start + 1;
+        while (end < count && first.isBatchCompatible(*d_buffers[end]))
+            ++end;
+
+        if (end - start == 1)
+            first.draw();
+        else
+            first.drawBatched(&d_buffers[start],
+                              static_cast<uint>(end - start));
+
+        start = end;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void RenderQueue::setBatchingEnabled(const bool enabled)
+{
+    d_batchingEnabled = enabled;
+}
+
+//----------------------------------------------------------------------------//
+bool RenderQueue::isBatchingEnabled() const
+{
+    return d_batchingEnabled;
 }
 
 //----------------------------------------------------------------------------//
@@ -33,7 +33,11 @@
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-RenderedString::RenderedString()
+uint RenderedString::d_lastRevision = 0;
+
+//----------------------------------------------------------------------------//
+RenderedString::RenderedString() :
+    d_revision(0)
 {
     // set up initial line info
     appendLineBreak();
@@ -50,6 +54,7 @@ void RenderedString::appendComponent(const RenderedStringComponent& component)
 {
     d_components.push_back(component.clone());
     ++d_lines.back().second;
+    updateRevision();
 }
 
 //----------------------------------------------------------------------------//
@@ -57,6 +62,7 @@ void RenderedString::clearComponents()
 {
     clearComponentList(d_components);
     d_lines.clear();
+    updateRevision();
 }
 
 //----------------------------------------------------------------------------//
@@ -66,10 +72,12 @@ size_t RenderedString::getComponentCount() const
 }
 
 //----------------------------------------------------------------------------//
-RenderedString::RenderedString(const RenderedString& other)
+RenderedString::RenderedString(const RenderedString& other) :
+    d_revision(0)
 {
     cloneComponentList(other.d_components);
     d_lines = other.d_lines;
+    updateRevision();
 }
 
 //----------------------------------------------------------------------------//
@@ -77,6 +85,7 @@ RenderedString& RenderedString::operator=(const RenderedString& rhs)
 {
     cloneComponentList(rhs.d_components);
     d_lines = rhs.d_lines;
+    updateRevision();
     return *this;
 }
 
@@ -111,6 +120,7 @@ void RenderedString::split(const Window* ref_wnd, const size_t line,
             "line number specified is invalid."));
 
     left.clearComponents();
+    updateRevision();
 
     if (d_components.empty())
         return;
@@ -233,6 +243,19 @@ void RenderedString::appendLineBreak()
         d_lines.back().first + d_lines.back().second;
 
     d_lines.push_back(LineInfo(first_component, 0));
+    updateRevision();
+}
+
+//----------------------------------------------------------------------------//
+uint RenderedString::getRevision() const
+{
+    return d_revision;
+}
+
+//----------------------------------------------------------------------------//
+void RenderedString::updateRevision()
+{
+    d_revision = ++d_lastRevision;
 }
 
 //----------------------------------------------------------------------------//
@@ -306,6 +329,8 @@ void RenderedString::draw(const Window* ref_wnd, const size_t line,
 //----------------------------------------------------------------------------//
 void RenderedString::setSelection(const Window* ref_wnd, float start, float end)
 {
+    updateRevision();
+
     const size_t last_component = d_lines[0].second;
     float partial_extent = 0;
     size_t idx = 0;
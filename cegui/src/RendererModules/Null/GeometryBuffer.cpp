@@ -29,12 +29,14 @@
 #include "CEGUI/RendererModules/Null/Texture.h"
 #include "CEGUI/Vertex.h"
 #include "CEGUI/RenderEffect.h"
+#include <limits>
 
 // Start of CEGUI namespace section
 namespace CEGUI
 {
 //----------------------------------------------------------------------------//
-NullGeometryBuffer::NullGeometryBuffer() :
+NullGeometryBuffer::NullGeometryBuffer(NullRenderer& owner) :
+    d_owner(&owner),
     d_activeTexture(0),
     d_clipRect(0, 0, 0, 0),
     d_clippingActive(true),
@@ -59,6 +61,11 @@ void NullGeometryBuffer::draw() const
         // set up RenderEffect
         if (d_effect)
             d_effect->performPreRenderFunctions(pass);
+
+        // 'draw' the batches
+        BatchList::const_iterator i = d_batches.begin();
+        for ( ; i != d_batches.end(); ++i)
+            d_owner->recordDrawCall(i->vertexCount);
     }
 
     // clean up RenderEffect
@@ -103,11 +110,29 @@ void NullGeometryBuffer::appendVertex(const Vertex& vertex)
 void NullGeometryBuffer::appendGeometry(const Vertex* const vbuff,
                                         uint vertex_count)
 {
-    // buffer these vertices
+    performBatchManagement();
+
+    // update size and extent of current batch
+    BatchInfo& batch = d_batches.back();
+    batch.vertexCount += vertex_count;
+
     for (uint i = 0; i < vertex_count; ++i)
     {
-        d_vertices.push_back(vbuff[i]);
+        const Vector3f& pos = vbuff[i].position;
+        batch.bounds.left(ceguimin(batch.bounds.left(), pos.d_x));
+        batch.bounds.top(ceguimin(batch.bounds.top(), pos.d_y));
+        batch.bounds.right(ceguimax(batch.bounds.right(), pos.d_x));
+        batch.bounds.bottom(ceguimax(batch.bounds.bottom(), pos.d_y));
     }
+
+    // buffer these vertices
+    d_vertices.insert(d_vertices.end(), vbuff, vbuff + vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::reserveVertices(uint vertex_count)
+{
+    d_vertices.reserve(d_vertices.size() + vertex_count);
 }
 
 //----------------------------------------------------------------------------//
@@ -119,6 +144,7 @@ void NullGeometryBuffer::setActiveTexture(Texture* texture)
 //----------------------------------------------------------------------------//
 void NullGeometryBuffer::reset()
 {
+    d_batches.clear();
     d_vertices.clear();
 }
 
@@ -137,7 +163,7 @@ uint NullGeometryBuffer::getVertexCount() const
 //----------------------------------------------------------------------------//
 uint NullGeometryBuffer::getBatchCount() const
 {
-    return 1;
+    return d_batches.size();
 }
 
 //----------------------------------------------------------------------------//
@@ -164,6 +190,94 @@ bool NullGeometryBuffer::isClippingActive() const
     return d_clippingActive;
 }
 
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isBatchCompatible(const GeometryBuffer& buffer) const
+{
+    const NullGeometryBuffer* const other =
+        dynamic_cast<const NullGeometryBuffer*>(&buffer);
+
+    return other &&
+           other->d_owner == d_owner &&
+           !d_effect && !other->d_effect &&
+           d_blendMode == other->d_blendMode &&
+           isTranslationOnly() && other->isTranslationOnly();
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::drawBatched(const GeometryBuffer* const* buffers,
+                                     uint buffer_count) const
+{
+    // state of the draw call currently being accumulated
+    const NullTexture* texture = 0;
+    bool clip = false;
+    Rectf clip_rect(0, 0, 0, 0);
+    uint vertex_count = 0;
+
+    for (uint i = 0; i < buffer_count; ++i)
+    {
+        const NullGeometryBuffer& gb =
+            static_cast<const NullGeometryBuffer&>(*buffers[i]);
+
+        BatchList::const_iterator b = gb.d_batches.begin();
+        for ( ; b != gb.d_batches.end(); ++b)
+        {
+            const bool batch_clip = gb.isBatchClipped(*b);
+
+            // issue the pending draw call if this batch needs other state.
+            if (vertex_count &&
+                (b->texture != texture || batch_clip != clip ||
+                 (clip && gb.d_clipRect != clip_rect)))
+            {
+                d_owner->recordDrawCall(vertex_count);
+                vertex_count = 0;
+            }
+
+            texture = b->texture;
+            clip = batch_clip;
+            clip_rect = gb.d_clipRect;
+            vertex_count += b->vertexCount;
+        }
+    }
+
+    if (vertex_count)
+        d_owner->recordDrawCall(vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void NullGeometryBuffer::performBatchManagement()
+{
+    // create a new batch if there are no batches yet, or if the active texture
+    // differs from that used by the current batch.
+    if (d_batches.empty() ||
+        d_activeTexture != d_batches.back().texture ||
+        d_clippingActive != d_batches.back().clip)
+    {
+        const float max = std::numeric_limits<float>::max();
+        const BatchInfo batch =
+            {d_activeTexture, 0, d_clippingActive, Rectf(max, max, -max, -max)};
+        d_batches.push_back(batch);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isTranslationOnly() const
+{
+    return d_rotation.d_x == 0.0f &&
+           d_rotation.d_y == 0.0f &&
+           d_rotation.d_z == 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool NullGeometryBuffer::isBatchClipped(const BatchInfo& batch) const
+{
+    // geometry lying entirely within the clip region is unaffected by it.
+    return batch.clip &&
+           (batch.bounds.left() + d_translation.d_x < d_clipRect.left() ||
+            batch.bounds.top() + d_translation.d_y < d_clipRect.top() ||
+            batch.bounds.right() + d_translation.d_x > d_clipRect.right() ||
+            batch.bounds.bottom() + d_translation.d_y > d_clipRect.bottom());
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
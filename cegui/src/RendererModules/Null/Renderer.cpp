@@ -108,7 +108,7 @@ RenderTarget& NullRenderer::getDefaultRenderTarget()
 //----------------------------------------------------------------------------//
 GeometryBuffer& NullRenderer::createGeometryBuffer()
 {
-    NullGeometryBuffer* gb = new NullGeometryBuffer();
+    NullGeometryBuffer* gb = new NullGeometryBuffer(*this);
 
     d_geometryBuffers.push_back(gb);
     return *gb;
@@ -306,11 +306,39 @@ const String& NullRenderer::getIdentifierString() const
     return d_rendererID;
 }
 
+//----------------------------------------------------------------------------//
+uint NullRenderer::getDrawCallCount() const
+{
+    return d_drawCallCount;
+}
+
+//----------------------------------------------------------------------------//
+uint NullRenderer::getDrawnVertexCount() const
+{
+    return d_drawnVertexCount;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::resetDrawStatistics()
+{
+    d_drawCallCount = 0;
+    d_drawnVertexCount = 0;
+}
+
+//----------------------------------------------------------------------------//
+void NullRenderer::recordDrawCall(uint vertex_count)
+{
+    ++d_drawCallCount;
+    d_drawnVertexCount += vertex_count;
+}
+
 //----------------------------------------------------------------------------//
 NullRenderer::NullRenderer() :
     d_displayDPI(96, 96),
     // TODO: should be set to correct value
-    d_maxTextureSize(2048)
+    d_maxTextureSize(2048),
+    d_drawCallCount(0),
+    d_drawnVertexCount(0)
 {
     constructor_impl();
 }
@@ -120,6 +120,60 @@ void OpenGLFBOTextureTarget::clear()
     glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGLFBOTextureTarget::isPartialRedrawSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLFBOTextureTarget::beginPartialRedraw(const Rectf& area)
+{
+    // restrict the geometry drawn to us to the area until endPartialRedraw.
+    d_owner.setRedrawArea(&area);
+
+    const Sizef sz(d_area.getSize());
+    if (sz.d_width == 0.f || sz.d_height == 0.f)
+        return;
+
+    // save old clear colour and scissor state
+    GLfloat old_col[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, old_col);
+    GLint old_scissor[4];
+    glGetIntegerv(GL_SCISSOR_BOX, old_scissor);
+    const GLboolean old_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+
+    // remember previously bound FBO to make sure we set it back
+    GLuint previousFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING_EXT,
+            reinterpret_cast<GLint*>(&previousFBO));
+
+    // switch to our FBO
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, d_frameBuffer);
+    // Clear the area only.
+    glScissor(static_cast<GLint>(area.left()),
+              static_cast<GLint>(sz.d_height - area.bottom()),
+              static_cast<GLint>(area.getWidth()),
+              static_cast<GLint>(area.getHeight()));
+    glEnable(GL_SCISSOR_TEST);
+    glClearColor(0,0,0,0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    // switch back to rendering to the previously bound FBO
+    glBindFramebufferEXT(GL_FRAMEBUFFER_EXT, previousFBO);
+
+    // restore previous scissor state and clear colour
+    glScissor(old_scissor[0], old_scissor[1], old_scissor[2], old_scissor[3]);
+    if (!old_scissor_test)
+        glDisable(GL_SCISSOR_TEST);
+    glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLFBOTextureTarget::endPartialRedraw()
+{
+    d_owner.setRedrawArea(0);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLFBOTextureTarget::initialiseRenderTexture()
 {
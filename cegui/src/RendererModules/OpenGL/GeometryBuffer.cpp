@@ -30,6 +30,8 @@
 #include "CEGUI/RenderEffect.h"
 #include "CEGUI/RendererModules/OpenGL/Texture.h"
 #include "CEGUI/Vertex.h"
+#include "CEGUI/VertexConverter.h"
+#include <limits>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -60,13 +62,8 @@ void OpenGLGeometryBuffer::appendVertex(const Vertex& vertex)
 //----------------------------------------------------------------------------//
 void OpenGLGeometryBuffer::draw() const
 {
-    // setup clip region
     GLint vp[4];
     glGetIntegerv(GL_VIEWPORT, vp);
-    glScissor(static_cast<GLint>(d_clipRect.left()),
-              static_cast<GLint>(vp[3] - d_clipRect.bottom()),
-              static_cast<GLint>(d_clipRect.getWidth()),
-              static_cast<GLint>(d_clipRect.getHeight()));
 
     // apply the transformations we need to use.
     if (!d_matrixValid)
@@ -90,15 +87,13 @@ void OpenGLGeometryBuffer::draw() const
         BatchList::const_iterator i = d_batches.begin();
         for ( ; i != d_batches.end(); ++i)
         {
-            if (i->clip)
-                glEnable(GL_SCISSOR_TEST);
-            else
-                glDisable(GL_SCISSOR_TEST);
+            // setup clip region
+            setupScissor(i->clip, d_clipRect, vp);
 
             glBindTexture(GL_TEXTURE_2D, i->texture);
             // set up pointers to the vertex element arrays
             glTexCoordPointer(2, GL_FLOAT, sizeof(GLVertex),
-                              &d_vertices[pos]);
+                              &d_vertices[pos].tex[0]);
             glColorPointer(4, GL_FLOAT, sizeof(GLVertex),
                            &d_vertices[pos].colour[0]);
             glVertexPointer(3, GL_FLOAT, sizeof(GLVertex),
@@ -114,6 +109,152 @@ void OpenGLGeometryBuffer::draw() const
         d_effect->performPostRenderFunctions();
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGLGeometryBuffer::isBatchCompatible(const GeometryBuffer& buffer) const
+{
+    const OpenGLGeometryBuffer* const other =
+        dynamic_cast<const OpenGLGeometryBuffer*>(&buffer);
+
+    return other &&
+           other->d_owner == d_owner &&
+           !d_effect && !other->d_effect &&
+           d_blendMode == other->d_blendMode &&
+           isTranslationOnly() && other->isTranslationOnly();
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLGeometryBuffer::drawBatched(const GeometryBuffer* const* buffers,
+                                       uint buffer_count) const
+{
+    GLint vp[4];
+    glGetIntegerv(GL_VIEWPORT, vp);
+
+    // translations are applied to the merged vertices, so use no transform.
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+
+    // activate desired blending mode (shared by all buffers in the run)
+    d_owner->setupRenderingBlendMode(d_blendMode);
+
+    d_mergedVertices.clear();
+
+    // state of the draw call currently being accumulated
+    GLuint texture = 0;
+    bool clip = false;
+    Rectf clip_rect(0, 0, 0, 0);
+    size_t start = 0;
+
+    for (uint i = 0; i < buffer_count; ++i)
+    {
+        const OpenGLGeometryBuffer& gb =
+            static_cast<const OpenGLGeometryBuffer&>(*buffers[i]);
+        const Vector3f& t = gb.d_translation;
+
+        size_t pos = 0;
+        BatchList::const_iterator b = gb.d_batches.begin();
+        for ( ; b != gb.d_batches.end(); ++b)
+        {
+            const bool batch_clip = gb.isBatchClipped(*b);
+
+            // issue the pending draw call if this batch needs other state.
+            if (d_mergedVertices.size() > start &&
+                (b->texture != texture || batch_clip != clip ||
+                 (clip && gb.d_clipRect != clip_rect)))
+            {
+                drawMergedBatch(&d_mergedVertices[start],
+                                d_mergedVertices.size() - start,
+                                texture, clip, clip_rect, vp);
+                start = d_mergedVertices.size();
+            }
+
+            texture = b->texture;
+            clip = batch_clip;
+            clip_rect = gb.d_clipRect;
+
+            // append this batch's vertices, translated into place.
+            const size_t first = d_mergedVertices.size();
+            d_mergedVertices.insert(d_mergedVertices.end(),
+                                    gb.d_vertices.begin() + pos,
+                                    gb.d_vertices.begin() + pos + b->vertexCount);
+            for (size_t v = first; v < d_mergedVertices.size(); ++v)
+            {
+                d_mergedVertices[v].position[0] += t.d_x;
+                d_mergedVertices[v].position[1] += t.d_y;
+                d_mergedVertices[v].position[2] += t.d_z;
+            }
+
+            pos += b->vertexCount;
+        }
+    }
+
+    if (d_mergedVertices.size() > start)
+        drawMergedBatch(&d_mergedVertices[start],
+                        d_mergedVertices.size() - start,
+                        texture, clip, clip_rect, vp);
+
+    // buffers drawn individually after this will reload their own matrix.
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLGeometryBuffer::drawMergedBatch(const GLVertex* vertices,
+                                           uint count, uint texture,
+                                           bool clip, const Rectf& clip_rect,
+                                           const int* viewport) const
+{
+    setupScissor(clip, clip_rect, viewport);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    // set up pointers to the vertex element arrays
+    glTexCoordPointer(2, GL_FLOAT, sizeof(GLVertex), &vertices->tex[0]);
+    glColorPointer(4, GL_FLOAT, sizeof(GLVertex), &vertices->colour[0]);
+    glVertexPointer(3, GL_FLOAT, sizeof(GLVertex), &vertices->position[0]);
+    // draw the geometry
+    glDrawArrays(GL_TRIANGLES, 0, count);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLGeometryBuffer::setupScissor(bool clip, const Rectf& clip_rect,
+                                        const int* viewport) const
+{
+    const Rectf* const redraw_area = d_owner->getRedrawArea();
+
+    if (!clip && !redraw_area)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
+
+    Rectf scissor_rect(clip_rect);
+    if (redraw_area)
+        scissor_rect = clip ? clip_rect.getIntersection(*redraw_area) :
+                              *redraw_area;
+
+    glScissor(static_cast<GLint>(scissor_rect.left()),
+              static_cast<GLint>(viewport[3] - scissor_rect.bottom()),
+              static_cast<GLint>(scissor_rect.getWidth()),
+              static_cast<GLint>(scissor_rect.getHeight()));
+    glEnable(GL_SCISSOR_TEST);
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLGeometryBuffer::isTranslationOnly() const
+{
+    return d_rotation.d_x == 0.0f &&
+           d_rotation.d_y == 0.0f &&
+           d_rotation.d_z == 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGLGeometryBuffer::isBatchClipped(const BatchInfo& batch) const
+{
+    // geometry lying entirely within the clip region is unaffected by it.
+    return batch.clip &&
+           (batch.bounds.left() + d_translation.d_x < d_clipRect.left() ||
+            batch.bounds.top() + d_translation.d_y < d_clipRect.top() ||
+            batch.bounds.right() + d_translation.d_x > d_clipRect.right() ||
+            batch.bounds.bottom() + d_translation.d_y > d_clipRect.bottom());
+}
+
 //----------------------------------------------------------------------------//
 void OpenGLGeometryBuffer::setTranslation(const Vector3f& v)
 {
@@ -150,27 +291,35 @@ void OpenGLGeometryBuffer::appendGeometry(const Vertex* const vbuff,
 {
     performBatchManagement();
 
-    // update size of current batch
-    d_batches.back().vertexCount += vertex_count;
+    // update size and extent of current batch
+    BatchInfo& batch = d_batches.back();
+    batch.vertexCount += vertex_count;
 
-    // buffer these vertices
-    GLVertex vd;
-    const Vertex* vs = vbuff;
-    for (uint i = 0; i < vertex_count; ++i, ++vs)
+    for (uint i = 0; i < vertex_count; ++i)
     {
-        // copy vertex info the buffer, converting from CEGUI::Vertex to
-        // something directly usable by OpenGL as needed.
-        vd.tex[0]      = vs->tex_coords.d_x;
-        vd.tex[1]      = vs->tex_coords.d_y;
-        vd.colour[0]   = vs->colour_val.getRed();
-        vd.colour[1]   = vs->colour_val.getGreen();
-        vd.colour[2]   = vs->colour_val.getBlue();
-        vd.colour[3]   = vs->colour_val.getAlpha();
-        vd.position[0] = vs->position.d_x;
-        vd.position[1] = vs->position.d_y;
-        vd.position[2] = vs->position.d_z;
-        d_vertices.push_back(vd);
+        const Vector3f& pos = vbuff[i].position;
+        batch.bounds.left(ceguimin(batch.bounds.left(), pos.d_x));
+        batch.bounds.top(ceguimin(batch.bounds.top(), pos.d_y));
+        batch.bounds.right(ceguimax(batch.bounds.right(), pos.d_x));
+        batch.bounds.bottom(ceguimax(batch.bounds.bottom(), pos.d_y));
     }
+
+    // nothing to buffer, and &d_vertices[first] would be out of range.
+    if (vertex_count == 0)
+        return;
+
+    // buffer these vertices, converting from CEGUI::Vertex to something
+    // directly usable by OpenGL in a single pass over the whole span.
+    const VertexList::size_type first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+    VertexConverter::toPositionTexColourFloats(
+        vbuff, vertex_count, &d_vertices[first].position[0]);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGLGeometryBuffer::reserveVertices(uint vertex_count)
+{
+    d_vertices.reserve(d_vertices.size() + vertex_count);
 }
 
 //----------------------------------------------------------------------------//
@@ -217,7 +366,9 @@ void OpenGLGeometryBuffer::performBatchManagement()
         gltex != d_batches.back().texture ||
         d_clippingActive != d_batches.back().clip)
     {
-        const BatchInfo batch = {gltex, 0, d_clippingActive};
+        const float max = std::numeric_limits<float>::max();
+        const BatchInfo batch =
+            {gltex, 0, d_clippingActive, Rectf(max, max, -max, -max)};
         d_batches.push_back(batch);
     }
 }
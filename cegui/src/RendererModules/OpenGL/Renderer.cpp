@@ -186,7 +186,9 @@ void OpenGLRenderer::destroy(OpenGLRenderer& renderer)
 OpenGLRenderer::OpenGLRenderer(const TextureTargetType tt_type) :
     d_displayDPI(96, 96),
     d_initExtraStates(false),
-    d_activeBlendMode(BM_INVALID)
+    d_activeBlendMode(BM_INVALID),
+    d_redrawArea(0, 0, 0, 0),
+    d_redrawAreaActive(false)
 {
     // get rough max texture size
     GLint max_tex_size;
@@ -216,7 +218,9 @@ OpenGLRenderer::OpenGLRenderer(const Sizef& display_size,
     d_displaySize(display_size),
     d_displayDPI(96, 96),
     d_initExtraStates(false),
-    d_activeBlendMode(BM_INVALID)
+    d_activeBlendMode(BM_INVALID),
+    d_redrawArea(0, 0, 0, 0),
+    d_redrawAreaActive(false)
 {
     // get rough max texture size
     GLint max_tex_size;
@@ -700,6 +704,21 @@ void OpenGLRenderer::setupRenderingBlendMode(const BlendMode mode,
     }
 }
 
+//----------------------------------------------------------------------------//
+void OpenGLRenderer::setRedrawArea(const Rectf* area)
+{
+    d_redrawAreaActive = area != 0;
+
+    if (area)
+        d_redrawArea = *area;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf* OpenGLRenderer::getRedrawArea() const
+{
+    return d_redrawAreaActive ? &d_redrawArea : 0;
+}
+
 //----------------------------------------------------------------------------//
 
 void initialiseGLExtensions()
@@ -123,6 +123,60 @@ void OpenGL3FBOTextureTarget::clear()
     glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
 }
 
+//----------------------------------------------------------------------------//
+bool OpenGL3FBOTextureTarget::isPartialRedrawSupported() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3FBOTextureTarget::beginPartialRedraw(const Rectf& area)
+{
+    // restrict the geometry drawn to us to the area until endPartialRedraw.
+    d_owner.setRedrawArea(&area);
+
+    const Sizef sz(d_area.getSize());
+    if (sz.d_width == 0.f || sz.d_height == 0.f)
+        return;
+
+    // save old clear colour and scissor state
+    GLfloat old_col[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, old_col);
+    GLint old_scissor[4];
+    glGetIntegerv(GL_SCISSOR_BOX, old_scissor);
+    const GLboolean old_scissor_test = glIsEnabled(GL_SCISSOR_TEST);
+
+    // remember previously bound FBO to make sure we set it back
+    GLuint previousFBO = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING,
+            reinterpret_cast<GLint*>(&previousFBO));
+
+    // switch to our FBO
+    glBindFramebuffer(GL_FRAMEBUFFER, d_frameBuffer);
+    // Clear the area only.
+    glScissor(static_cast<GLint>(area.left()),
+              static_cast<GLint>(sz.d_height - area.bottom()),
+              static_cast<GLint>(area.getWidth()),
+              static_cast<GLint>(area.getHeight()));
+    glEnable(GL_SCISSOR_TEST);
+    glClearColor(0,0,0,0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    // switch back to rendering to the previously bound FBO
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFBO);
+
+    // restore previous scissor state and clear colour
+    glScissor(old_scissor[0], old_scissor[1], old_scissor[2], old_scissor[3]);
+    if (!old_scissor_test)
+        glDisable(GL_SCISSOR_TEST);
+    glClearColor(old_col[0], old_col[1], old_col[2], old_col[3]);
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3FBOTextureTarget::endPartialRedraw()
+{
+    d_owner.setRedrawArea(0);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3FBOTextureTarget::initialiseRenderTexture()
 {
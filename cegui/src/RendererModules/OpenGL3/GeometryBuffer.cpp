@@ -35,6 +35,7 @@
 #include "CEGUI/RenderEffect.h"
 #include "CEGUI/RendererModules/OpenGL3/Texture.h"
 #include "CEGUI/Vertex.h"
+#include "CEGUI/VertexConverter.h"
 #include "CEGUI/RendererModules/OpenGL3/ShaderManager.h"
 #include "CEGUI/RendererModules/OpenGL3/Shader.h"
 #include "CEGUI/RendererModules/OpenGL3/StateChangeWrapper.h"
@@ -62,8 +63,15 @@ OpenGL3GeometryBuffer::OpenGL3GeometryBuffer(OpenGL3Renderer& owner) :
     d_shaderTexCoordLoc(owner.getShaderStandardTexCoordLoc()),
     d_shaderColourLoc(owner.getShaderStandardColourLoc()),
     d_shaderStandardMatrixLoc(owner.getShaderStandardMatrixUniformLoc()),
+    d_shaderPacked(owner.getShaderPacked()),
+    d_shaderPackedPosLoc(owner.getShaderPackedPositionLoc()),
+    d_shaderPackedTexCoordLoc(owner.getShaderPackedTexCoordLoc()),
+    d_shaderPackedColourLoc(owner.getShaderPackedColourLoc()),
+    d_shaderPackedMatrixLoc(owner.getShaderPackedMatrixUniformLoc()),
     d_glStateChanger(owner.getOpenGLStateChanger()),
-    d_bufferSize(0)
+    d_bufferSize(0),
+    d_packedBufferSize(0),
+    d_bufferDirty(false)
 {
     d_matrix = new mat4Pimpl();
 
@@ -87,12 +95,11 @@ void OpenGL3GeometryBuffer::appendVertex(const Vertex& vertex)
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::draw() const
 {
-    CEGUI::Rectf viewPort = d_owner->getActiveViewPort();
+    // upload any geometry appended since we were last drawn
+    if (d_bufferDirty)
+        updateOpenGLBuffers();
 
-    d_glStateChanger->scissor(static_cast<GLint>(d_clipRect.left()),
-              static_cast<GLint>(viewPort.getHeight() - d_clipRect.bottom()),
-              static_cast<GLint>(d_clipRect.getWidth()),
-              static_cast<GLint>(d_clipRect.getHeight()));
+    CEGUI::Rectf viewPort = d_owner->getActiveViewPort();
 
     // apply the transformations we need to use.
     if (!d_matrixValid)
@@ -108,8 +115,12 @@ void OpenGL3GeometryBuffer::draw() const
     // Bind our vao
     d_glStateChanger->bindVertexArray(d_verticesVAO);
 
+    // packed batches are drawn with their own vao and shader, switched to as
+    // needed; the packed shader is given the matrix on first use.
+    bool packed_bound = false;
+    bool packed_matrix_set = false;
+
     const int pass_count = d_effect ? d_effect->getPassCount() : 1;
-     size_t pos = 0;
     for (int pass = 0; pass < pass_count; ++pass)
     {
         // set up RenderEffect
@@ -117,28 +128,52 @@ void OpenGL3GeometryBuffer::draw() const
             d_effect->performPreRenderFunctions(pass);
 
         // draw the batches
-       
+        size_t pos = 0;
+        size_t packed_pos = 0;
         BatchList::const_iterator i = d_batches.begin();
         for ( ; i != d_batches.end(); ++i)
         {
             const BatchInfo& currentBatch = *i;
 
-            if (currentBatch.clip)
-                glEnable(GL_SCISSOR_TEST);
-            else
-                glDisable(GL_SCISSOR_TEST);
+            if (currentBatch.packed != packed_bound)
+            {
+                packed_bound = currentBatch.packed;
+
+                if (packed_bound)
+                {
+                    d_shaderPacked->bind();
+                    d_glStateChanger->bindVertexArray(d_packedVerticesVAO);
+
+                    if (!packed_matrix_set)
+                    {
+                        glUniformMatrix4fv(d_shaderPackedMatrixLoc, 1, GL_FALSE,
+                            glm::value_ptr(modelViewProjectionMatrix));
+                        packed_matrix_set = true;
+                    }
+                }
+                else
+                {
+                    d_shader->bind();
+                    d_glStateChanger->bindVertexArray(d_verticesVAO);
+                }
+            }
+
+            setupScissor(currentBatch.clip, viewPort.getHeight());
 
             glBindTexture(GL_TEXTURE_2D, currentBatch.texture);
 
             // draw the geometry
             const unsigned int numVertices = currentBatch.vertexCount;
-            glDrawArrays(GL_TRIANGLES, pos, numVertices);
+            size_t& first = currentBatch.packed ? packed_pos : pos;
+            glDrawArrays(GL_TRIANGLES, first, numVertices);
 
-            pos += numVertices;
+            first += numVertices;
         }
     }
 
-    
+    // the rest of the frame is drawn with the standard shader.
+    if (packed_bound)
+        d_shader->bind();
 
     // clean up RenderEffect
     if (d_effect)
@@ -179,31 +214,56 @@ void OpenGL3GeometryBuffer::setClippingRegion(const Rectf& region)
 void OpenGL3GeometryBuffer::appendGeometry(const Vertex* const vbuff,
     uint vertex_count)
 {
-    performBatchManagement();
+    performBatchManagement(false);
 
     // update size of current batch
     d_batches.back().vertexCount += vertex_count;
 
-    // buffer these vertices
-    GLVertex vd;
-    const Vertex* vs = vbuff;
-    for (uint i = 0; i < vertex_count; ++i, ++vs)
-    {
-        // copy vertex info the buffer, converting from CEGUI::Vertex to
-        // something directly usable by OpenGL as needed.
-        vd.tex[0]      = vs->tex_coords.d_x;
-        vd.tex[1]      = vs->tex_coords.d_y;
-        vd.colour[0]   = vs->colour_val.getRed();
-        vd.colour[1]   = vs->colour_val.getGreen();
-        vd.colour[2]   = vs->colour_val.getBlue();
-        vd.colour[3]   = vs->colour_val.getAlpha();
-        vd.position[0] = vs->position.d_x;
-        vd.position[1] = vs->position.d_y;
-        vd.position[2] = vs->position.d_z;
-        d_vertices.push_back(vd);
-    }
+    // nothing to buffer, and &d_vertices[first] would be out of range.
+    if (vertex_count == 0)
+        return;
+
+    // buffer these vertices, converting from CEGUI::Vertex to something
+    // directly usable by OpenGL in a single pass over the whole span.
+    const VertexList::size_type first = d_vertices.size();
+    d_vertices.resize(first + vertex_count);
+    VertexConverter::toPositionTexColourFloats(
+        vbuff, vertex_count, &d_vertices[first].position[0]);
+
+    d_bufferDirty = true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::appendPackedGeometry(
+    const PackedVertex* const vbuff, uint vertex_count)
+{
+    performBatchManagement(true);
+
+    // update size of current batch
+    d_batches.back().vertexCount += vertex_count;
 
-    updateOpenGLBuffers();
+    // packed vertices are uploaded as they are, so no conversion is needed.
+    d_packedVertices.insert(d_packedVertices.end(), vbuff,
+                            vbuff + vertex_count);
+
+    d_bufferDirty = true;
+}
+
+//----------------------------------------------------------------------------//
+bool OpenGL3GeometryBuffer::isPackedGeometryNative() const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::reserveVertices(uint vertex_count)
+{
+    // reserve in the store in use by the current batch; images and text are
+    // appended as packed vertices, so that is the more likely one otherwise.
+    if (!d_batches.empty() && !d_batches.back().packed)
+        d_vertices.reserve(d_vertices.size() + vertex_count);
+    else
+        d_packedVertices.reserve(d_packedVertices.size() + vertex_count);
 }
 
 //----------------------------------------------------------------------------//
@@ -217,8 +277,9 @@ void OpenGL3GeometryBuffer::reset()
 {
     d_batches.clear();
     d_vertices.clear();
+    d_packedVertices.clear();
     d_activeTexture = 0;
-    updateOpenGLBuffers();
+    d_bufferDirty = true;
 }
 
 //----------------------------------------------------------------------------//
@@ -230,7 +291,7 @@ Texture* OpenGL3GeometryBuffer::getActiveTexture() const
 //----------------------------------------------------------------------------//
 uint OpenGL3GeometryBuffer::getVertexCount() const
 {
-    return d_vertices.size();
+    return d_vertices.size() + d_packedVertices.size();
 }
 
 //----------------------------------------------------------------------------//
@@ -240,18 +301,19 @@ uint OpenGL3GeometryBuffer::getBatchCount() const
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::performBatchManagement()
+void OpenGL3GeometryBuffer::performBatchManagement(bool packed)
 {
     const GLuint gltex = d_activeTexture ?
                             d_activeTexture->getOpenGLTexture() : 0;
 
     // create a new batch if there are no batches yet, or if the active texture
-    // differs from that used by the current batch.
+    // or vertex format differs from that used by the current batch.
     if (d_batches.empty() ||
         gltex != d_batches.back().texture ||
-        d_clippingActive != d_batches.back().clip)
+        d_clippingActive != d_batches.back().clip ||
+        packed != d_batches.back().packed)
     {
-        const BatchInfo batch = {gltex, 0, d_clippingActive};
+        const BatchInfo batch = {gltex, 0, d_clippingActive, packed};
         d_batches.push_back(batch);
     }
 }
@@ -277,6 +339,30 @@ const mat4Pimpl* OpenGL3GeometryBuffer::getMatrix() const
     return d_matrix;
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3GeometryBuffer::setupScissor(bool clip,
+                                         float viewport_height) const
+{
+    const Rectf* const redraw_area = d_owner->getRedrawArea();
+
+    if (!clip && !redraw_area)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        return;
+    }
+
+    Rectf scissor_rect(d_clipRect);
+    if (redraw_area)
+        scissor_rect = clip ? d_clipRect.getIntersection(*redraw_area) :
+                              *redraw_area;
+
+    d_glStateChanger->scissor(static_cast<GLint>(scissor_rect.left()),
+              static_cast<GLint>(viewport_height - scissor_rect.bottom()),
+              static_cast<GLint>(scissor_rect.getWidth()),
+              static_cast<GLint>(scissor_rect.getHeight()));
+    glEnable(GL_SCISSOR_TEST);
+}
+
 //----------------------------------------------------------------------------//
 void OpenGL3GeometryBuffer::updateMatrix() const
 {
@@ -319,17 +405,43 @@ void OpenGL3GeometryBuffer::initialiseOpenGLBuffers()
     
     GLsizei stride = 9 * sizeof(GL_FLOAT);
 
-    glVertexAttribPointer(d_shaderTexCoordLoc, 2, GL_FLOAT, GL_FALSE, stride, 0);
+    glVertexAttribPointer(d_shaderPosLoc, 3, GL_FLOAT, GL_FALSE, stride, 0);
+    glEnableVertexAttribArray(d_shaderPosLoc);
+
+    glVertexAttribPointer(d_shaderTexCoordLoc, 2, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(3 * sizeof(GL_FLOAT)));
     glEnableVertexAttribArray(d_shaderTexCoordLoc);
 
-    glVertexAttribPointer(d_shaderColourLoc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(2 * sizeof(GL_FLOAT)));
+    glVertexAttribPointer(d_shaderColourLoc, 4, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(5 * sizeof(GL_FLOAT)));
     glEnableVertexAttribArray(d_shaderColourLoc);
 
-    glVertexAttribPointer(d_shaderPosLoc, 3, GL_FLOAT, GL_FALSE, stride, BUFFER_OFFSET(6 * sizeof(GL_FLOAT)));
-    glEnableVertexAttribArray(d_shaderPosLoc);
-
     d_shader->unbind();
 
+    // Generate and bind vao and vbo for geometry in the PackedVertex format
+    glGenVertexArrays(1, &d_packedVerticesVAO);
+    glBindVertexArray(d_packedVerticesVAO);
+
+    glGenBuffers(1, &d_packedVerticesVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, d_packedVerticesVBO);
+
+    glBufferData(GL_ARRAY_BUFFER, 0, 0, GL_DYNAMIC_DRAW);
+
+    d_shaderPacked->bind();
+
+    const GLsizei packed_stride = sizeof(PackedVertex);
+
+    glVertexAttribPointer(d_shaderPackedPosLoc, 2, GL_FLOAT, GL_FALSE, packed_stride, 0);
+    glEnableVertexAttribArray(d_shaderPackedPosLoc);
+
+    glVertexAttribPointer(d_shaderPackedTexCoordLoc, 2, GL_FLOAT, GL_FALSE, packed_stride, BUFFER_OFFSET(2 * sizeof(float)));
+    glEnableVertexAttribArray(d_shaderPackedTexCoordLoc);
+
+    // an ARGB colour is held as the bytes B, G, R, A on little endian hosts,
+    // which GL_BGRA hands to the shader as normalised RGBA.
+    glVertexAttribPointer(d_shaderPackedColourLoc, GL_BGRA, GL_UNSIGNED_BYTE, GL_TRUE, packed_stride, BUFFER_OFFSET(4 * sizeof(float)));
+    glEnableVertexAttribArray(d_shaderPackedColourLoc);
+
+    d_shaderPacked->unbind();
+
     // Unbind Vertex Attribute Array (VAO)
     glBindVertexArray(0);
 
@@ -342,33 +454,50 @@ void OpenGL3GeometryBuffer::deinitialiseOpenGLBuffers()
 {
     glDeleteVertexArrays(1, &d_verticesVAO);
     glDeleteBuffers(1, &d_verticesVBO);
+    glDeleteVertexArrays(1, &d_packedVerticesVAO);
+    glDeleteBuffers(1, &d_packedVerticesVBO);
 }
 
 //----------------------------------------------------------------------------//
-void OpenGL3GeometryBuffer::updateOpenGLBuffers()
+void OpenGL3GeometryBuffer::updateOpenGLBuffers() const
 {
-    bool needNewBuffer = false;
-    unsigned int vertexCount = d_vertices.size();
+    const GLuint vertexCount = static_cast<GLuint>(d_vertices.size());
+
+    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesVBO);
 
-    if(d_bufferSize < vertexCount)
+    // grow the VBO in line with the vertex store's capacity so that repeated
+    // appends do not re-create the buffer each time.
+    if (d_bufferSize < vertexCount)
     {
-        needNewBuffer = true;
-        d_bufferSize = vertexCount;
+        d_bufferSize = static_cast<GLuint>(d_vertices.capacity());
+        glBufferData(GL_ARRAY_BUFFER, d_bufferSize * sizeof(GLVertex), 0,
+                     GL_DYNAMIC_DRAW);
     }
 
+    if (vertexCount)
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(GLVertex),
+                        &d_vertices[0]);
 
-    d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_verticesVBO);
-
-    GLsizei dataSize = d_bufferSize * sizeof(GLVertex);
+    const GLuint packedCount = static_cast<GLuint>(d_packedVertices.size());
 
-    if(needNewBuffer)
+    if (packedCount)
     {
-        glBufferData(GL_ARRAY_BUFFER, dataSize, d_vertices.data(), GL_DYNAMIC_DRAW);
-    }
-    else
-    {
-        glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, d_vertices.data());
+        d_glStateChanger->bindBuffer(GL_ARRAY_BUFFER, d_packedVerticesVBO);
+
+        if (d_packedBufferSize < packedCount)
+        {
+            d_packedBufferSize =
+                static_cast<GLuint>(d_packedVertices.capacity());
+            glBufferData(GL_ARRAY_BUFFER,
+                         d_packedBufferSize * sizeof(PackedVertex), 0,
+                         GL_DYNAMIC_DRAW);
+        }
+
+        glBufferSubData(GL_ARRAY_BUFFER, 0, packedCount * sizeof(PackedVertex),
+                        &d_packedVertices[0]);
     }
+
+    d_bufferDirty = false;
 }
 
 //----------------------------------------------------------------------------//
@@ -176,8 +176,11 @@ OpenGL3Renderer::OpenGL3Renderer() :
     d_initExtraStates(false),
     d_activeBlendMode(BM_INVALID),
     d_shaderStandard(0),
+    d_shaderPacked(0),
     d_viewProjectionMatrix(0),
     d_activeRenderTarget(0),
+    d_redrawArea(0, 0, 0, 0),
+    d_redrawAreaActive(false),
     d_openGLStateChanger(0),
     d_shaderManager(0)
 {
@@ -208,6 +211,9 @@ OpenGL3Renderer::OpenGL3Renderer(const Sizef& display_size) :
     d_initExtraStates(false),
     d_activeBlendMode(BM_INVALID),
     d_shaderStandard(0),
+    d_shaderPacked(0),
+    d_redrawArea(0, 0, 0, 0),
+    d_redrawAreaActive(false),
     d_openGLStateChanger(0),
     d_shaderManager(0)
 {
@@ -626,6 +632,36 @@ GLint OpenGL3Renderer::getShaderStandardMatrixUniformLoc()
     return d_shaderStandardMatrixLoc;
 }
 
+//----------------------------------------------------------------------------//
+OpenGL3Shader*& OpenGL3Renderer::getShaderPacked()
+{
+    return d_shaderPacked;
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGL3Renderer::getShaderPackedPositionLoc()
+{
+    return d_shaderPackedPosLoc;
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGL3Renderer::getShaderPackedTexCoordLoc()
+{
+    return d_shaderPackedTexCoordLoc;
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGL3Renderer::getShaderPackedColourLoc()
+{
+    return d_shaderPackedColourLoc;
+}
+
+//----------------------------------------------------------------------------//
+GLint OpenGL3Renderer::getShaderPackedMatrixUniformLoc()
+{
+    return d_shaderPackedMatrixLoc;
+}
+
 //----------------------------------------------------------------------------//
 const mat4Pimpl* OpenGL3Renderer::getViewProjectionMatrix()
 {
@@ -659,6 +695,21 @@ RenderTarget* OpenGL3Renderer::getActiveRenderTarget()
     return d_activeRenderTarget;
 }
 
+//----------------------------------------------------------------------------//
+void OpenGL3Renderer::setRedrawArea(const Rectf* area)
+{
+    d_redrawAreaActive = area != 0;
+
+    if (area)
+        d_redrawArea = *area;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf* OpenGL3Renderer::getRedrawArea() const
+{
+    return d_redrawAreaActive ? &d_redrawArea : 0;
+}
+
 //----------------------------------------------------------------------------//
 OpenGL3StateChangeWrapper* OpenGL3Renderer::getOpenGLStateChanger()
 {
@@ -684,6 +735,18 @@ void OpenGL3Renderer::initialiseOpenGLShaders()
     d_shaderStandardColourLoc = d_shaderStandard->getAttribLocation("inColour");
 
     d_shaderStandardMatrixLoc = d_shaderStandard->getUniformLocation("modelViewPerspMatrix");
+
+    d_shaderPacked = d_shaderManager->getShader(SHADER_ID_PACKEDSHADER);
+    texLoc = d_shaderPacked->getUniformLocation("texture0");
+    d_shaderPacked->bind();
+    glUniform1i(texLoc, 0);
+    d_shaderPacked->unbind();
+
+    d_shaderPackedPosLoc = d_shaderPacked->getAttribLocation("inPosition");
+    d_shaderPackedTexCoordLoc = d_shaderPacked->getAttribLocation("inTexCoord");
+    d_shaderPackedColourLoc = d_shaderPacked->getAttribLocation("inColour");
+
+    d_shaderPackedMatrixLoc = d_shaderPacked->getUniformLocation("modelViewPerspMatrix");
 }
 
 //----------------------------------------------------------------------------//
@@ -32,6 +32,7 @@
 
 #include "CEGUI/RendererModules/OpenGL3/StandardShaderVert.h"
 #include "CEGUI/RendererModules/OpenGL3/StandardShaderFrag.h"
+#include "CEGUI/RendererModules/OpenGL3/PackedShaderVert.h"
 
 #include "CEGUI/Logger.h"
 #include "CEGUI/Exceptions.h"
@@ -73,9 +74,11 @@ namespace CEGUI
         if(!d_shadersInitialised)
         {
             loadShader(SHADER_ID_STANDARDSHADER, StandardShaderVert, StandardShaderFrag);
+            loadShader(SHADER_ID_PACKEDSHADER, PackedShaderVert, StandardShaderFrag);
 
 
-            if(!getShader(SHADER_ID_STANDARDSHADER)->isCreatedSuccessfully())
+            if(!getShader(SHADER_ID_STANDARDSHADER)->isCreatedSuccessfully() ||
+               !getShader(SHADER_ID_PACKEDSHADER)->isCreatedSuccessfully())
             {   
                 const std::string errorString("Critical Error - One or multiple shader programs weren't created successfully");
                 CEGUI_THROW(RendererException(errorString));
@@ -354,15 +354,22 @@ void OpenGL3Texture::blitFromMemory(void* sourceData, const Rectf& area)
     GLuint old_tex;
     glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&old_tex));
 
-    // set texture to required size
+    GLint old_pack;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &old_pack);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
     glBindTexture(GL_TEXTURE_2D, d_ogltexture);
-    
+
+    // only the given sub-rectangle is uploaded; the rest of the texture is
+    // left as it is.
     glTexSubImage2D(GL_TEXTURE_2D, 0,
         GLint(area.left()), GLint(area.top()),
         GLsizei(area.getWidth()), GLsizei(area.getHeight()),
-        GL_RGBA8, GL_UNSIGNED_BYTE, sourceData
+        d_format, d_subpixelFormat, sourceData
     );
 
+    glPixelStorei(GL_UNPACK_ALIGNMENT, old_pack);
+
     // restore previous texture binding.
     glBindTexture(GL_TEXTURE_2D, old_tex);
 }
@@ -0,0 +1,351 @@
+/***********************************************************************
+    filename:   GeometryBuffer.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/RenderEffect.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// tangent of half the vertical field of view used by the OpenGL renderer, so
+// that rotated geometry gets the same perspective.
+static const float FOV_Y_TAN = 0.267949192431123f;
+
+//----------------------------------------------------------------------------//
+static Vector3f cross(const Vector3f& a, const Vector3f& b)
+{
+    return Vector3f(a.d_y * b.d_z - a.d_z * b.d_y,
+                    a.d_z * b.d_x - a.d_x * b.d_z,
+                    a.d_x * b.d_y - a.d_y * b.d_x);
+}
+
+//----------------------------------------------------------------------------//
+static float dot(const Vector3f& a, const Vector3f& b)
+{
+    return a.d_x * b.d_x + a.d_y * b.d_y + a.d_z * b.d_z;
+}
+
+//----------------------------------------------------------------------------//
+// rotate \a v by the unit quaternion \a q.
+static Vector3f rotate(const Quaternion& q, const Vector3f& v)
+{
+    const Vector3f axis(q.d_x, q.d_y, q.d_z);
+    const Vector3f t(cross(axis, v) * 2.0f);
+
+    return v + t * q.d_w + cross(axis, t);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::SoftwareGeometryBuffer(SoftwareRenderer& owner) :
+    d_owner(&owner),
+    d_activeTexture(0),
+    d_clipRect(0, 0, 0, 0),
+    d_clippingActive(true),
+    d_translation(0, 0, 0),
+    d_rotation(Quaternion::IDENTITY),
+    d_pivot(0, 0, 0),
+    d_effect(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareGeometryBuffer::~SoftwareGeometryBuffer()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::draw() const
+{
+    SoftwareRasteriser* const rasteriser = d_owner->getActiveRasteriser();
+    if (!rasteriser || !rasteriser->getSurface())
+        return;
+
+    const Rectf& area = rasteriser->getArea();
+    const SoftwareTexture& surface = *rasteriser->getSurface();
+    const Rectf surface_rect(0, 0,
+                             static_cast<float>(surface.getPixelWidth()),
+                             static_cast<float>(surface.getPixelHeight()));
+
+    const int pass_count = d_effect ? d_effect->getPassCount() : 1;
+    for (int pass = 0; pass < pass_count; ++pass)
+    {
+        // set up RenderEffect
+        if (d_effect)
+            d_effect->performPreRenderFunctions(pass);
+
+        // queue the triangles of each batch
+        size_t pos = 0;
+        BatchList::const_iterator i = d_batches.begin();
+        for ( ; i != d_batches.end(); ++i)
+        {
+            // scissor areas are not offset by the target area, as in OpenGL.
+            const Rectf& clip = i->clip ? d_clipRect : surface_rect;
+
+            // a batch outside of the scissor area has nothing to redraw.
+            if (rasteriser->isScissorActive() &&
+                clip.getIntersection(
+                    rasteriser->getScissorArea()).getWidth() == 0)
+            {
+                pos += i->vertexCount;
+                continue;
+            }
+
+            const size_t end = pos + i->vertexCount - i->vertexCount % 3;
+
+            for ( ; pos < end; pos += 3)
+            {
+                SoftwareRasteriser::RasterVertex rv[3];
+                bool visible = true;
+
+                for (int v = 0; v < 3; ++v)
+                {
+                    const Vertex& vs = d_vertices[pos + v];
+                    Vector2f p;
+                    visible &= transformPoint(vs.position, area, p);
+
+                    rv[v].x = p.d_x + area.left();
+                    rv[v].y = p.d_y + area.top();
+                    rv[v].u = vs.tex_coords.d_x;
+                    rv[v].v = vs.tex_coords.d_y;
+                    rv[v].r = vs.colour_val.getRed();
+                    rv[v].g = vs.colour_val.getGreen();
+                    rv[v].b = vs.colour_val.getBlue();
+                    rv[v].a = vs.colour_val.getAlpha();
+                }
+
+                if (visible)
+                    rasteriser->addTriangle(rv, i->texture, d_blendMode, clip);
+            }
+
+            pos += i->vertexCount % 3;
+        }
+    }
+
+    // clean up RenderEffect
+    if (d_effect)
+        d_effect->performPostRenderFunctions();
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareGeometryBuffer::transformPoint(const Vector3f& pos,
+                                            const Rectf& area,
+                                            Vector2f& p_out) const
+{
+    // quick path for the unrotated geometry most things use
+    if (d_rotation == Quaternion::IDENTITY &&
+        pos.d_z + d_translation.d_z == 0.0f)
+    {
+        p_out.d_x = pos.d_x + d_translation.d_x;
+        p_out.d_y = pos.d_y + d_translation.d_y;
+        return true;
+    }
+
+    const Vector3f p(rotate(d_rotation, pos - d_pivot) + d_pivot +
+                     d_translation);
+
+    // perspective, looking at the middle of the target from the distance at
+    // which the z = 0 plane maps one unit to one pixel.
+    const float mid_x = area.getWidth() * 0.5f;
+    const float mid_y = area.getHeight() * 0.5f;
+    const float view_distance = mid_y / FOV_Y_TAN;
+    const float depth = view_distance + p.d_z;
+
+    if (depth <= 0.0f)
+        return false;
+
+    const float scale = view_distance / depth;
+    p_out.d_x = mid_x + (p.d_x - mid_x) * scale;
+    p_out.d_y = mid_y + (p.d_y - mid_y) * scale;
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::unprojectPoint(const Rectf& area,
+                                            const Vector2f& p_in,
+                                            Vector2f& p_out) const
+{
+    const float mid_x = area.getWidth() * 0.5f;
+    const float mid_y = area.getHeight() * 0.5f;
+    const float view_distance = mid_y / FOV_Y_TAN;
+
+    // ray from the eye through the point on the z = 0 plane
+    const Vector3f eye(mid_x, mid_y, -view_distance);
+    const Vector3f ray(Vector3f(p_in.d_x, p_in.d_y, 0) - eye);
+
+    // plane of the geometry, once transformed
+    const Vector3f origin(rotate(d_rotation, Vector3f(0, 0, 0) - d_pivot) +
+                          d_pivot + d_translation);
+    const Vector3f normal(rotate(d_rotation, Vector3f(0, 0, 1)));
+
+    const float denom = dot(normal, ray);
+    if (denom == 0.0f)
+    {
+        p_out = p_in;
+        return;
+    }
+
+    const float t = dot(normal, origin - eye) / denom;
+    const Vector3f hit(eye + ray * t);
+
+    // back into the co-ordinates of the geometry
+    const Quaternion inverse(d_rotation.d_w, -d_rotation.d_x,
+                             -d_rotation.d_y, -d_rotation.d_z);
+    const Vector3f local(rotate(inverse, hit - d_pivot - d_translation) +
+                         d_pivot);
+
+    p_out.d_x = local.d_x;
+    p_out.d_y = local.d_y;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setTranslation(const Vector3f& v)
+{
+    d_translation = v;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRotation(const Quaternion& r)
+{
+    d_rotation = r;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setPivot(const Vector3f& p)
+{
+    d_pivot = p;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingRegion(const Rectf& region)
+{
+    d_clipRect.top(ceguimax(0.0f, region.top()));
+    d_clipRect.bottom(ceguimax(0.0f, region.bottom()));
+    d_clipRect.left(ceguimax(0.0f, region.left()));
+    d_clipRect.right(ceguimax(0.0f, region.right()));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendVertex(const Vertex& vertex)
+{
+    appendGeometry(&vertex, 1);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::appendGeometry(const Vertex* const vbuff,
+                                            uint vertex_count)
+{
+    performBatchManagement();
+
+    // update size of current batch
+    d_batches.back().vertexCount += vertex_count;
+
+    // buffer these vertices
+    d_vertices.insert(d_vertices.end(), vbuff, vbuff + vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::reserveVertices(uint vertex_count)
+{
+    d_vertices.reserve(d_vertices.size() + vertex_count);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setActiveTexture(Texture* texture)
+{
+    d_activeTexture = static_cast<SoftwareTexture*>(texture);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::reset()
+{
+    d_batches.clear();
+    d_vertices.clear();
+}
+
+//----------------------------------------------------------------------------//
+Texture* SoftwareGeometryBuffer::getActiveTexture() const
+{
+    return d_activeTexture;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getVertexCount() const
+{
+    return d_vertices.size();
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareGeometryBuffer::getBatchCount() const
+{
+    return d_batches.size();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setRenderEffect(RenderEffect* effect)
+{
+    d_effect = effect;
+}
+
+//----------------------------------------------------------------------------//
+RenderEffect* SoftwareGeometryBuffer::getRenderEffect()
+{
+    return d_effect;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::setClippingActive(const bool active)
+{
+    d_clippingActive = active;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareGeometryBuffer::isClippingActive() const
+{
+    return d_clippingActive;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareGeometryBuffer::performBatchManagement()
+{
+    // create a new batch if there are no batches yet, or if the active texture
+    // or clipping differs from that used by the current batch.
+    if (d_batches.empty() ||
+        d_activeTexture != d_batches.back().texture ||
+        d_clippingActive != d_batches.back().clip)
+    {
+        const BatchInfo batch = {d_activeTexture, 0, d_clippingActive};
+        d_batches.push_back(batch);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
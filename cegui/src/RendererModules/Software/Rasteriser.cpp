@@ -0,0 +1,799 @@
+/***********************************************************************
+    filename:   Rasteriser.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CEGUI_SOFTWARERASTERISER_SSE2
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// Rasterises the tiles at index first, first + stride, ... of the list of
+// covered tiles.
+struct SoftwareRasteriser::TileTask : public ThreadPool::Task
+{
+    TileTask(const SoftwareRasteriser& rasteriser, size_t first,
+             size_t stride) :
+        d_rasteriser(rasteriser),
+        d_first(first),
+        d_stride(stride)
+    {}
+
+    void execute()
+    {
+        const std::vector<size_t>& tiles = d_rasteriser.d_coveredTiles;
+
+        for (size_t i = d_first; i < tiles.size(); i += d_stride)
+            d_rasteriser.rasteriseTile(tiles[i]);
+    }
+
+    const SoftwareRasteriser& d_rasteriser;
+    const size_t d_first;
+    const size_t d_stride;
+};
+
+//----------------------------------------------------------------------------//
+namespace
+{
+// positions are snapped to 1/256th of a pixel.
+const int SUBPIXEL_BITS = 8;
+const int SUBPIXEL_SCALE = 1 << SUBPIXEL_BITS;
+// keeps the products in the edge functions well within 64 bits.
+const float MAX_COORDINATE = static_cast<float>(1 << 20);
+const float INV_255 = 1.0f / 255.0f;
+
+// indices of the attributes in the planes of a Triangle.
+enum Attribute
+{
+    A_U,
+    A_V,
+    A_RED,
+    A_GREEN,
+    A_BLUE,
+    A_ALPHA
+};
+
+//----------------------------------------------------------------------------//
+int64 floorDiv(int64 num, int64 den)
+{
+    // den is always positive here.
+    const int64 q = num / den;
+    return (num % den != 0 && num < 0) ? q - 1 : q;
+}
+
+//----------------------------------------------------------------------------//
+int64 ceilDiv(int64 num, int64 den)
+{
+    const int64 q = num / den;
+    return (num % den != 0 && num > 0) ? q + 1 : q;
+}
+
+//----------------------------------------------------------------------------//
+int floorToInt(float f)
+{
+    const int i = static_cast<int>(f);
+    return static_cast<float>(i) > f ? i - 1 : i;
+}
+
+//----------------------------------------------------------------------------//
+int clampInt(int i, int max)
+{
+    return i < 0 ? 0 : (i > max ? max : i);
+}
+
+//----------------------------------------------------------------------------//
+float clampFloat(float f, float min, float max)
+{
+    return f < min ? min : (f > max ? max : f);
+}
+
+//----------------------------------------------------------------------------//
+int clipEdge(float f)
+{
+    return static_cast<int>(clampFloat(f, -MAX_COORDINATE, MAX_COORDINATE));
+}
+
+//----------------------------------------------------------------------------//
+uint32 readTexel(const uint8* pixels, uint width, int x, int y)
+{
+    uint32 texel;
+    std::memcpy(&texel, pixels + (y * width + x) * 4, sizeof(texel));
+    return texel;
+}
+
+//----------------------------------------------------------------------------//
+float channel(const uint8* pixel, int c)
+{
+    return static_cast<float>(pixel[c]);
+}
+
+//----------------------------------------------------------------------------//
+// Colour of the triangle at one pixel, 0 to 255.  The SSE2 span filler
+// below does the same operations in the same order, so both give the same
+// result.
+void shadePixel(const SoftwareRasteriser::Triangle& tri, const float* row,
+                float x, float* src)
+{
+    for (int c = 0; c < 4; ++c)
+        src[c] = row[A_RED + c] + tri.d_dx[A_RED + c] * x;
+
+    if (tri.d_sampling == SoftwareRasteriser::S_NONE)
+        return;
+
+    const SoftwareTexture& tex = *tri.d_texture;
+    const uint8* pixels = tex.getPixels();
+    const int w = static_cast<int>(tex.getPixelWidth());
+    const int h = static_cast<int>(tex.getPixelHeight());
+    const float u = clampFloat(row[A_U] + tri.d_dx[A_U] * x,
+                               -1.0f, static_cast<float>(w));
+    const float v = clampFloat(row[A_V] + tri.d_dx[A_V] * x,
+                               -1.0f, static_cast<float>(h));
+
+    float texel[4];
+
+    if (tri.d_sampling == SoftwareRasteriser::S_NEAREST)
+    {
+        const uint8* t = pixels + (clampInt(floorToInt(v + 0.5f), h - 1) * w +
+                                   clampInt(floorToInt(u + 0.5f), w - 1)) * 4;
+
+        for (int c = 0; c < 4; ++c)
+            texel[c] = channel(t, c);
+    }
+    else
+    {
+        const int x0 = floorToInt(u);
+        const int y0 = floorToInt(v);
+        const float fx = u - static_cast<float>(x0);
+        const float fy = v - static_cast<float>(y0);
+        const int xa = clampInt(x0, w - 1), xb = clampInt(x0 + 1, w - 1);
+        const int ya = clampInt(y0, h - 1), yb = clampInt(y0 + 1, h - 1);
+        const uint8* t00 = pixels + (ya * w + xa) * 4;
+        const uint8* t10 = pixels + (ya * w + xb) * 4;
+        const uint8* t01 = pixels + (yb * w + xa) * 4;
+        const uint8* t11 = pixels + (yb * w + xb) * 4;
+
+        for (int c = 0; c < 4; ++c)
+        {
+            const float top =
+                channel(t00, c) * (1.0f - fx) + channel(t10, c) * fx;
+            const float bottom =
+                channel(t01, c) * (1.0f - fx) + channel(t11, c) * fx;
+            texel[c] = top * (1.0f - fy) + bottom * fy;
+        }
+    }
+
+    for (int c = 0; c < 4; ++c)
+        src[c] = src[c] * texel[c] * INV_255;
+}
+
+//----------------------------------------------------------------------------//
+uint8 toByte(float f)
+{
+    return static_cast<uint8>(
+        static_cast<int>(clampFloat(f, 0.0f, 255.0f) + 0.5f));
+}
+
+//----------------------------------------------------------------------------//
+void blendPixel(BlendMode mode, const float* src, uint8* dst)
+{
+    const float sa = src[3] * INV_255;
+    const float inv_sa = 1.0f - sa;
+    const float da = static_cast<float>(dst[3]);
+
+    if (mode == BM_RTT_PREMULTIPLIED)
+    {
+        for (int c = 0; c < 3; ++c)
+            dst[c] = toByte(src[c] + static_cast<float>(dst[c]) * inv_sa);
+
+        dst[3] = toByte(src[3] + da * inv_sa);
+    }
+    else
+    {
+        for (int c = 0; c < 3; ++c)
+            dst[c] = toByte(src[c] * sa + static_cast<float>(dst[c]) * inv_sa);
+
+        dst[3] = toByte(src[3] * (1.0f - da * INV_255) + da);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void fillSpanScalar(const SoftwareRasteriser::Triangle& tri, const float* row,
+                    int x, int end, uint8* dst)
+{
+    for ( ; x < end; ++x, dst += 4)
+    {
+        float src[4];
+        shadePixel(tri, row, static_cast<float>(x), src);
+        blendPixel(tri.d_blendMode, src, dst);
+    }
+}
+
+#if defined(CEGUI_SOFTWARERASTERISER_SSE2)
+//----------------------------------------------------------------------------//
+__m128i floorToInt4(__m128 f)
+{
+    // truncation rounds negative values up; the compare mask is -1 there.
+    const __m128i i = _mm_cvttps_epi32(f);
+    return _mm_add_epi32(i, _mm_castps_si128(
+        _mm_cmpgt_ps(_mm_cvtepi32_ps(i), f)));
+}
+
+//----------------------------------------------------------------------------//
+__m128 clamp4(__m128 f, __m128 min, __m128 max)
+{
+    return _mm_min_ps(_mm_max_ps(f, min), max);
+}
+
+//----------------------------------------------------------------------------//
+// split four RGBA pixels into one register per channel.
+void unpack4(__m128i pixels, __m128* channels)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+
+    channels[0] = _mm_cvtepi32_ps(_mm_and_si128(pixels, mask));
+    channels[1] = _mm_cvtepi32_ps(
+        _mm_and_si128(_mm_srli_epi32(pixels, 8), mask));
+    channels[2] = _mm_cvtepi32_ps(
+        _mm_and_si128(_mm_srli_epi32(pixels, 16), mask));
+    channels[3] = _mm_cvtepi32_ps(_mm_srli_epi32(pixels, 24));
+}
+
+//----------------------------------------------------------------------------//
+__m128i toBytes4(__m128 f)
+{
+    const __m128 clamped = clamp4(f, _mm_setzero_ps(), _mm_set1_ps(255.0f));
+    return _mm_cvttps_epi32(_mm_add_ps(clamped, _mm_set1_ps(0.5f)));
+}
+
+//----------------------------------------------------------------------------//
+void sample4(const SoftwareRasteriser::Triangle& tri, const float* row,
+             __m128 x, __m128* texel)
+{
+    const SoftwareTexture& tex = *tri.d_texture;
+    const uint8* pixels = tex.getPixels();
+    const uint pitch = tex.getPixelWidth();
+    const int w = static_cast<int>(tex.getPixelWidth());
+    const int h = static_cast<int>(tex.getPixelHeight());
+
+    const __m128 u = clamp4(
+        _mm_add_ps(_mm_set1_ps(row[A_U]),
+                   _mm_mul_ps(_mm_set1_ps(tri.d_dx[A_U]), x)),
+        _mm_set1_ps(-1.0f), _mm_set1_ps(static_cast<float>(w)));
+    const __m128 v = clamp4(
+        _mm_add_ps(_mm_set1_ps(row[A_V]),
+                   _mm_mul_ps(_mm_set1_ps(tri.d_dx[A_V]), x)),
+        _mm_set1_ps(-1.0f), _mm_set1_ps(static_cast<float>(h)));
+
+    if (tri.d_sampling == SoftwareRasteriser::S_NEAREST)
+    {
+        const __m128 half = _mm_set1_ps(0.5f);
+        int xs[4], ys[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(xs),
+                         floorToInt4(_mm_add_ps(u, half)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ys),
+                         floorToInt4(_mm_add_ps(v, half)));
+
+        uint32 t[4];
+        for (int i = 0; i < 4; ++i)
+            t[i] = readTexel(pixels, pitch, clampInt(xs[i], w - 1),
+                             clampInt(ys[i], h - 1));
+
+        unpack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t)), texel);
+        return;
+    }
+
+    const __m128i x0 = floorToInt4(u);
+    const __m128i y0 = floorToInt4(v);
+    const __m128 fx = _mm_sub_ps(u, _mm_cvtepi32_ps(x0));
+    const __m128 fy = _mm_sub_ps(v, _mm_cvtepi32_ps(y0));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 inv_fx = _mm_sub_ps(one, fx);
+    const __m128 inv_fy = _mm_sub_ps(one, fy);
+
+    int xs[4], ys[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(xs), x0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ys), y0);
+
+    uint32 t00[4], t10[4], t01[4], t11[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const int xa = clampInt(xs[i], w - 1), xb = clampInt(xs[i] + 1, w - 1);
+        const int ya = clampInt(ys[i], h - 1), yb = clampInt(ys[i] + 1, h - 1);
+        t00[i] = readTexel(pixels, pitch, xa, ya);
+        t10[i] = readTexel(pixels, pitch, xb, ya);
+        t01[i] = readTexel(pixels, pitch, xa, yb);
+        t11[i] = readTexel(pixels, pitch, xb, yb);
+    }
+
+    __m128 c00[4], c10[4], c01[4], c11[4];
+    unpack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t00)), c00);
+    unpack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t10)), c10);
+    unpack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t01)), c01);
+    unpack4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(t11)), c11);
+
+    for (int c = 0; c < 4; ++c)
+    {
+        const __m128 top = _mm_add_ps(_mm_mul_ps(c00[c], inv_fx),
+                                      _mm_mul_ps(c10[c], fx));
+        const __m128 bottom = _mm_add_ps(_mm_mul_ps(c01[c], inv_fx),
+                                         _mm_mul_ps(c11[c], fx));
+        texel[c] = _mm_add_ps(_mm_mul_ps(top, inv_fy),
+                              _mm_mul_ps(bottom, fy));
+    }
+}
+
+//----------------------------------------------------------------------------//
+// fills four pixels at a time, then leaves the rest to fillSpanScalar.
+void fillSpan(const SoftwareRasteriser::Triangle& tri, const float* row,
+              int x, int end, uint8* dst)
+{
+    const __m128 inv_255 = _mm_set1_ps(INV_255);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const bool premultiplied = tri.d_blendMode == BM_RTT_PREMULTIPLIED;
+
+    for ( ; x + 4 <= end; x += 4, dst += 16)
+    {
+        const float fx = static_cast<float>(x);
+        const __m128 xs = _mm_set_ps(fx + 3.0f, fx + 2.0f, fx + 1.0f, fx);
+
+        __m128 src[4];
+        for (int c = 0; c < 4; ++c)
+            src[c] = _mm_add_ps(_mm_set1_ps(row[A_RED + c]),
+                                _mm_mul_ps(_mm_set1_ps(tri.d_dx[A_RED + c]),
+                                           xs));
+
+        if (tri.d_sampling != SoftwareRasteriser::S_NONE)
+        {
+            __m128 texel[4];
+            sample4(tri, row, xs, texel);
+
+            for (int c = 0; c < 4; ++c)
+                src[c] = _mm_mul_ps(_mm_mul_ps(src[c], texel[c]), inv_255);
+        }
+
+        __m128i* const out = reinterpret_cast<__m128i*>(dst);
+        __m128 d[4];
+        unpack4(_mm_loadu_si128(out), d);
+
+        const __m128 sa = _mm_mul_ps(src[3], inv_255);
+        const __m128 inv_sa = _mm_sub_ps(one, sa);
+        __m128 result[4];
+
+        if (premultiplied)
+        {
+            for (int c = 0; c < 3; ++c)
+                result[c] = _mm_add_ps(src[c], _mm_mul_ps(d[c], inv_sa));
+
+            result[3] = _mm_add_ps(src[3], _mm_mul_ps(d[3], inv_sa));
+        }
+        else
+        {
+            for (int c = 0; c < 3; ++c)
+                result[c] = _mm_add_ps(_mm_mul_ps(src[c], sa),
+                                       _mm_mul_ps(d[c], inv_sa));
+
+            result[3] = _mm_add_ps(
+                _mm_mul_ps(src[3], _mm_sub_ps(one, _mm_mul_ps(d[3], inv_255))),
+                d[3]);
+        }
+
+        _mm_storeu_si128(out, _mm_or_si128(
+            _mm_or_si128(toBytes4(result[0]),
+                         _mm_slli_epi32(toBytes4(result[1]), 8)),
+            _mm_or_si128(_mm_slli_epi32(toBytes4(result[2]), 16),
+                         _mm_slli_epi32(toBytes4(result[3]), 24))));
+    }
+
+    fillSpanScalar(tri, row, x, end, dst);
+}
+#else
+//----------------------------------------------------------------------------//
+void fillSpan(const SoftwareRasteriser::Triangle& tri, const float* row,
+              int x, int end, uint8* dst)
+{
+    fillSpanScalar(tri, row, x, end, dst);
+}
+#endif
+
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::SoftwareRasteriser() :
+    d_surface(0),
+    d_area(0, 0, 0, 0),
+    d_scissorArea(0, 0, 0, 0),
+    d_scissorActive(false),
+    d_tilesAcross(0),
+    d_tilesDown(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser::~SoftwareRasteriser()
+{
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setSurface(SoftwareTexture* surface)
+{
+    discard();
+    d_surface = surface;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture* SoftwareRasteriser::getSurface() const
+{
+    return d_surface;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setArea(const Rectf& area)
+{
+    d_area = area;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& SoftwareRasteriser::getArea() const
+{
+    return d_area;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setScissorArea(const Rectf& area)
+{
+    d_scissorArea = area;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& SoftwareRasteriser::getScissorArea() const
+{
+    return d_scissorArea;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::setScissorActive(bool active)
+{
+    d_scissorActive = active;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::isScissorActive() const
+{
+    return d_scissorActive;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::addTriangle(const RasterVertex* vertices,
+                                     const SoftwareTexture* texture,
+                                     BlendMode blend_mode,
+                                     const Rectf& clip)
+{
+    if (!d_surface)
+        return;
+
+    if (texture && !texture->getPixels())
+        return;
+
+    // snap the positions to the sub-pixel grid.
+    int64 x[3], y[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        const float vx = vertices[i].x;
+        const float vy = vertices[i].y;
+
+        // also rejects NaN.
+        if (!(std::fabs(vx) <= MAX_COORDINATE && std::fabs(vy) <= MAX_COORDINATE))
+            return;
+
+        x[i] = static_cast<int64>(std::floor(vx * SUBPIXEL_SCALE + 0.5f));
+        y[i] = static_cast<int64>(std::floor(vy * SUBPIXEL_SCALE + 0.5f));
+    }
+
+    const int64 area2 = (x[1] - x[0]) * (y[2] - y[0]) -
+                        (x[2] - x[0]) * (y[1] - y[0]);
+    if (area2 == 0)
+        return;
+
+    // wind the triangle so its inside is where the edge functions are
+    // positive.
+    int order[3] = {0, 1, 2};
+    if (area2 < 0)
+        std::swap(order[1], order[2]);
+
+    Triangle tri;
+
+    for (int e = 0; e < 3; ++e)
+    {
+        const int i = order[e];
+        const int j = order[(e + 1) % 3];
+        const int64 a = y[i] - y[j];
+        const int64 b = x[j] - x[i];
+        // pixels exactly on an edge belong to the triangle only if the edge
+        // is a top or left one.
+        const bool top_left = a > 0 || (a == 0 && b > 0);
+
+        tri.d_edgeA[e] = a;
+        tri.d_edgeB[e] = b;
+        tri.d_edgeC[e] = x[i] * y[j] - x[j] * y[i] - (top_left ? 0 : 1);
+    }
+
+    // area the triangle covers, clipped to the clip area and the surface.
+    const Rectf scissored_clip(d_scissorActive ?
+        clip.getIntersection(d_scissorArea) : clip);
+    const int64 min_x = std::min(x[0], std::min(x[1], x[2]));
+    const int64 max_x = std::max(x[0], std::max(x[1], x[2]));
+    const int64 min_y = std::min(y[0], std::min(y[1], y[2]));
+    const int64 max_y = std::max(y[0], std::max(y[1], y[2]));
+
+    tri.d_left = std::max(clipEdge(scissored_clip.left()), std::max(0,
+        static_cast<int>(floorDiv(min_x, SUBPIXEL_SCALE))));
+    tri.d_top = std::max(clipEdge(scissored_clip.top()), std::max(0,
+        static_cast<int>(floorDiv(min_y, SUBPIXEL_SCALE))));
+    tri.d_right = std::min(clipEdge(scissored_clip.right()), std::min(
+        static_cast<int>(d_surface->getPixelWidth()),
+        static_cast<int>(ceilDiv(max_x, SUBPIXEL_SCALE))));
+    tri.d_bottom = std::min(clipEdge(scissored_clip.bottom()), std::min(
+        static_cast<int>(d_surface->getPixelHeight()),
+        static_cast<int>(ceilDiv(max_y, SUBPIXEL_SCALE))));
+
+    if (tri.d_left >= tri.d_right || tri.d_top >= tri.d_bottom)
+        return;
+
+    // attribute planes, from the snapped positions.
+    const double inv_scale = 1.0 / SUBPIXEL_SCALE;
+    const double x0 = x[0] * inv_scale, y0 = y[0] * inv_scale;
+    const double x1 = x[1] * inv_scale, y1 = y[1] * inv_scale;
+    const double x2 = x[2] * inv_scale, y2 = y[2] * inv_scale;
+    const double det = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+
+    const float tex_width =
+        texture ? static_cast<float>(texture->getPixelWidth()) : 0.0f;
+    const float tex_height =
+        texture ? static_cast<float>(texture->getPixelHeight()) : 0.0f;
+
+    for (int a = 0; a < 6; ++a)
+    {
+        float f[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            const RasterVertex& vtx = vertices[i];
+            switch (a)
+            {
+            // texture co-ordinates are in texels, offset so that texel
+            // centres are at whole numbers.
+            case A_U:     f[i] = vtx.u * tex_width - 0.5f; break;
+            case A_V:     f[i] = vtx.v * tex_height - 0.5f; break;
+            case A_RED:   f[i] = vtx.r * 255.0f; break;
+            case A_GREEN: f[i] = vtx.g * 255.0f; break;
+            case A_BLUE:  f[i] = vtx.b * 255.0f; break;
+            default:      f[i] = vtx.a * 255.0f; break;
+            }
+        }
+
+        const double dx = ((f[1] - f[0]) * (y2 - y0) -
+                           (f[2] - f[0]) * (y1 - y0)) / det;
+        const double dy = ((f[2] - f[0]) * (x1 - x0) -
+                           (f[1] - f[0]) * (x2 - x0)) / det;
+
+        // planes are sampled at pixel centres.
+        tri.d_base[a] = static_cast<float>(
+            f[0] - dx * (x0 - 0.5) - dy * (y0 - 0.5));
+        tri.d_dx[a] = static_cast<float>(dx);
+        tri.d_dy[a] = static_cast<float>(dy);
+    }
+
+    tri.d_texture = texture;
+    tri.d_blendMode = blend_mode;
+
+    // texels that map one to one onto pixels need no filtering.
+    if (!texture)
+        tri.d_sampling = S_NONE;
+    else if (std::fabs(tri.d_dx[A_U] - 1.0f) < 1e-5f &&
+             std::fabs(tri.d_dy[A_U]) < 1e-5f &&
+             std::fabs(tri.d_dx[A_V]) < 1e-5f &&
+             std::fabs(tri.d_dy[A_V] - 1.0f) < 1e-5f &&
+             std::fabs(tri.d_base[A_U] - std::floor(tri.d_base[A_U] + 0.5f)) < 1e-3f &&
+             std::fabs(tri.d_base[A_V] - std::floor(tri.d_base[A_V] + 0.5f)) < 1e-3f)
+        tri.d_sampling = S_NEAREST;
+    else
+        tri.d_sampling = S_BILINEAR;
+
+    d_triangles.push_back(tri);
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRasteriser::isFlushNeeded() const
+{
+    return !d_triangles.empty();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::flush(ThreadPool* pool)
+{
+    if (d_triangles.empty())
+        return;
+
+    updateTiles();
+
+    // sort the triangles into the tiles they may cover.
+    const int width = static_cast<int>(d_surface->getPixelWidth());
+    const int height = static_cast<int>(d_surface->getPixelHeight());
+
+    for (uint i = 0; i < d_triangles.size(); ++i)
+    {
+        const Triangle& tri = d_triangles[i];
+        const int right = std::min(tri.d_right, width);
+        const int bottom = std::min(tri.d_bottom, height);
+
+        for (int ty = tri.d_top / TileSize; ty * TileSize < bottom; ++ty)
+        {
+            for (int tx = tri.d_left / TileSize; tx * TileSize < right; ++tx)
+            {
+                const size_t tile = ty * d_tilesAcross + tx;
+
+                if (d_tiles[tile].empty())
+                    d_coveredTiles.push_back(tile);
+
+                d_tiles[tile].push_back(i);
+            }
+        }
+    }
+
+    const size_t task_count = pool ?
+        std::min(pool->getThreadCount(), d_coveredTiles.size()) : 1;
+
+    if (task_count > 1)
+    {
+        for (size_t i = 0; i < task_count; ++i)
+            pool->submit(new TileTask(*this, i, task_count));
+
+        pool->waitUntilIdle();
+    }
+    else
+    {
+        for (size_t i = 0; i < d_coveredTiles.size(); ++i)
+            rasteriseTile(d_coveredTiles[i]);
+    }
+
+    discard();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::discard()
+{
+    for (size_t i = 0; i < d_coveredTiles.size(); ++i)
+        d_tiles[d_coveredTiles[i]].clear();
+
+    d_coveredTiles.clear();
+    d_triangles.clear();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::updateTiles()
+{
+    const int across =
+        (static_cast<int>(d_surface->getPixelWidth()) + TileSize - 1) / TileSize;
+    const int down =
+        (static_cast<int>(d_surface->getPixelHeight()) + TileSize - 1) / TileSize;
+
+    if (across == d_tilesAcross && down == d_tilesDown)
+        return;
+
+    d_tilesAcross = across;
+    d_tilesDown = down;
+    d_tiles.clear();
+    d_tiles.resize(across * down);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::rasteriseTile(size_t tile) const
+{
+    const int tile_left = static_cast<int>(tile % d_tilesAcross) * TileSize;
+    const int tile_top = static_cast<int>(tile / d_tilesAcross) * TileSize;
+    const int tile_right = std::min(tile_left + TileSize,
+        static_cast<int>(d_surface->getPixelWidth()));
+    const int tile_bottom = std::min(tile_top + TileSize,
+        static_cast<int>(d_surface->getPixelHeight()));
+
+    const TriangleIndexList& triangles = d_tiles[tile];
+
+    for (size_t i = 0; i < triangles.size(); ++i)
+    {
+        const Triangle& tri = d_triangles[triangles[i]];
+        const int left = std::max(tile_left, tri.d_left);
+        const int right = std::min(tile_right, tri.d_right);
+        const int bottom = std::min(tile_bottom, tri.d_bottom);
+
+        for (int y = std::max(tile_top, tri.d_top); y < bottom; ++y)
+            rasteriseRow(tri, y, left, right);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRasteriser::rasteriseRow(const Triangle& tri, int y,
+                                      int left, int right) const
+{
+    // narrow the columns to those whose centres are inside every edge.
+    const int64 sample_y = static_cast<int64>(y) * SUBPIXEL_SCALE +
+                           SUBPIXEL_SCALE / 2;
+    int64 first = left;
+    int64 last = static_cast<int64>(right) - 1;
+
+    for (int e = 0; e < 3 && first <= last; ++e)
+    {
+        // edge function at the centre of column x is a * x + k.
+        const int64 a = tri.d_edgeA[e] * SUBPIXEL_SCALE;
+        const int64 k = tri.d_edgeA[e] * (SUBPIXEL_SCALE / 2) +
+                        tri.d_edgeB[e] * sample_y + tri.d_edgeC[e];
+
+        if (a > 0)
+            first = std::max(first, ceilDiv(-k, a));
+        else if (a < 0)
+            last = std::min(last, floorDiv(k, -a));
+        else if (k < 0)
+            return;
+    }
+
+    if (first > last)
+        return;
+
+    const float fy = static_cast<float>(y);
+    float row[6];
+    for (int a = 0; a < 6; ++a)
+        row[a] = tri.d_base[a] + tri.d_dy[a] * fy;
+
+    uint8* dst = d_surface->getPixels() +
+                 (static_cast<size_t>(y) * d_surface->getPixelWidth() +
+                  static_cast<size_t>(first)) * 4;
+
+    fillSpan(tri, row, static_cast<int>(first), static_cast<int>(last) + 1, dst);
+}
+
+//----------------------------------------------------------------------------//
+const char* SoftwareRasteriser::getImplementationName()
+{
+#if defined(CEGUI_SOFTWARERASTERISER_SSE2)
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
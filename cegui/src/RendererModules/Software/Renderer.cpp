@@ -0,0 +1,415 @@
+/***********************************************************************
+    filename:   Renderer.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Software/TextureTarget.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/RendererModules/Software/Rasteriser.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/ThreadPool.h"
+
+#include <algorithm>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+String SoftwareRenderer::d_rendererID(
+    String("CEGUI::SoftwareRenderer - Rasterises on the CPU.  Spans are "
+           "filled using ") + SoftwareRasteriser::getImplementationName() + ".");
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::bootstrapSystem(const Sizef& display_size,
+                                                    uint thread_count,
+                                                    const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    if (System::getSingletonPtr())
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is already initialised."));
+
+    SoftwareRenderer& renderer = create(display_size, thread_count);
+    DefaultResourceProvider* rp(new DefaultResourceProvider());
+    System::create(renderer, rp);
+
+    return renderer;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroySystem()
+{
+    System* sys;
+    if (!(sys = System::getSingletonPtr()))
+        CEGUI_THROW(InvalidRequestException(
+            "CEGUI::System object is not created or was already destroyed."));
+
+    SoftwareRenderer* renderer =
+        static_cast<SoftwareRenderer*>(sys->getRenderer());
+    ResourceProvider* rp = sys->getResourceProvider();
+
+    System::destroy();
+    delete rp;
+    destroy(*renderer);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer& SoftwareRenderer::create(const Sizef& display_size,
+                                           uint thread_count,
+                                           const int abi)
+{
+    System::performVersionTest(CEGUI_VERSION_ABI, abi, CEGUI_FUNCTION_NAME);
+
+    return *new SoftwareRenderer(display_size, thread_count);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroy(SoftwareRenderer& renderer)
+{
+    delete &renderer;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture& SoftwareRenderer::getDisplaySurface() const
+{
+    return *d_displaySurface;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setClearColour(const Colour& colour)
+{
+    d_clearColour = colour;
+}
+
+//----------------------------------------------------------------------------//
+const Colour& SoftwareRenderer::getClearColour() const
+{
+    return d_clearColour;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRenderer::getThreadCount() const
+{
+    return d_threadPool ? static_cast<uint>(d_threadPool->getThreadCount()) : 1;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::pushActiveRasteriser(SoftwareRasteriser& rasteriser)
+{
+    d_activeRasterisers.push_back(&rasteriser);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::popActiveRasteriser()
+{
+    if (d_activeRasterisers.empty())
+        return;
+
+    d_activeRasterisers.back()->flush(d_threadPool);
+    d_activeRasterisers.pop_back();
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRasteriser* SoftwareRenderer::getActiveRasteriser() const
+{
+    return d_activeRasterisers.empty() ? 0 : d_activeRasterisers.back();
+}
+
+//----------------------------------------------------------------------------//
+RenderTarget& SoftwareRenderer::getDefaultRenderTarget()
+{
+    return *d_defaultTarget;
+}
+
+//----------------------------------------------------------------------------//
+GeometryBuffer& SoftwareRenderer::createGeometryBuffer()
+{
+    SoftwareGeometryBuffer* gb = new SoftwareGeometryBuffer(*this);
+
+    d_geometryBuffers.push_back(gb);
+    return *gb;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyGeometryBuffer(const GeometryBuffer& buffer)
+{
+    GeometryBufferList::iterator i = std::find(d_geometryBuffers.begin(),
+                                               d_geometryBuffers.end(),
+                                               &buffer);
+
+    if (d_geometryBuffers.end() != i)
+    {
+        d_geometryBuffers.erase(i);
+        delete &buffer;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllGeometryBuffers()
+{
+    while (!d_geometryBuffers.empty())
+        destroyGeometryBuffer(**d_geometryBuffers.begin());
+}
+
+//----------------------------------------------------------------------------//
+TextureTarget* SoftwareRenderer::createTextureTarget()
+{
+    TextureTarget* tt = new SoftwareTextureTarget(*this);
+    d_textureTargets.push_back(tt);
+    return tt;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTextureTarget(TextureTarget* target)
+{
+    TextureTargetList::iterator i = std::find(d_textureTargets.begin(),
+                                              d_textureTargets.end(),
+                                              target);
+
+    if (d_textureTargets.end() != i)
+    {
+        d_textureTargets.erase(i);
+        delete target;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextureTargets()
+{
+    while (!d_textureTargets.empty())
+        destroyTextureTarget(*d_textureTargets.begin());
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name,
+                                         const String& filename,
+                                         const String& resourceGroup)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, filename, resourceGroup);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::createTexture(const String& name, const Sizef& size)
+{
+    throwIfNameExists(name);
+
+    SoftwareTexture* t = new SoftwareTexture(name, size);
+    d_textures[name] = t;
+
+    logTextureCreation(name);
+
+    return *t;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::throwIfNameExists(const String& name) const
+{
+    if (d_textures.find(name) != d_textures.end())
+        CEGUI_THROW(AlreadyExistsException(
+            "[SoftwareRenderer] Texture already exists: " + name));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureCreation(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Created texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(Texture& texture)
+{
+    destroyTexture(texture.getName());
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyTexture(const String& name)
+{
+    TextureMap::iterator i = d_textures.find(name);
+
+    if (d_textures.end() != i)
+    {
+        logTextureDestruction(name);
+        delete i->second;
+        d_textures.erase(i);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::logTextureDestruction(const String& name)
+{
+    Logger* logger = Logger::getSingletonPtr();
+    if (logger)
+        logger->logEvent("[SoftwareRenderer] Destroyed texture: " + name);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::destroyAllTextures()
+{
+    while (!d_textures.empty())
+        destroyTexture(d_textures.begin()->first);
+}
+
+//----------------------------------------------------------------------------//
+Texture& SoftwareRenderer::getTexture(const String& name) const
+{
+    TextureMap::const_iterator i = d_textures.find(name);
+
+    if (i == d_textures.end())
+        CEGUI_THROW(UnknownObjectException(
+            "Texture does not exist: " + name));
+
+    return *i->second;
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareRenderer::isTextureDefined(const String& name) const
+{
+    return d_textures.find(name) != d_textures.end();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::beginRendering()
+{
+    d_displaySurface->fill(d_clearColour);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::endRendering()
+{
+    // targets should all have been deactivated, but make sure nothing drawn
+    // is left out of the display image.
+    while (!d_activeRasterisers.empty())
+        popActiveRasteriser();
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareRenderer::getDisplaySize() const
+{
+    return d_displaySize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2f& SoftwareRenderer::getDisplayDPI() const
+{
+    return d_displayDPI;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareRenderer::getMaxTextureSize() const
+{
+    // limited by the 1/256 pixel fixed point co-ordinates of the rasteriser.
+    return 16384;
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareRenderer::getIdentifierString() const
+{
+    return d_rendererID;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::SoftwareRenderer(const Sizef& display_size,
+                                   uint thread_count) :
+    d_displaySize(display_size),
+    d_displayDPI(96, 96),
+    d_displaySurface(new SoftwareTexture("__cegui_software_display__",
+                                         display_size)),
+    d_clearColour(0, 0, 0, 0),
+    d_threadPool(thread_count != 1 ? new ThreadPool(thread_count) : 0)
+{
+    // create default target & rendering root (surface) that uses it
+    d_defaultTarget = new SoftwareRenderTarget<>(*this, d_displaySurface);
+    d_defaultTarget->setArea(Rectf(Vector2f(0, 0), display_size));
+
+    // a single thread is no better than rasterising on the calling thread.
+    if (d_threadPool && d_threadPool->getThreadCount() < 2)
+    {
+        delete d_threadPool;
+        d_threadPool = 0;
+    }
+}
+
+//----------------------------------------------------------------------------//
+SoftwareRenderer::~SoftwareRenderer()
+{
+    destroyAllGeometryBuffers();
+    destroyAllTextureTargets();
+    destroyAllTextures();
+
+    delete d_defaultTarget;
+    delete d_displaySurface;
+    delete d_threadPool;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareRenderer::setDisplaySize(const Sizef& sz)
+{
+    if (sz != d_displaySize)
+    {
+        d_displaySize = sz;
+        d_displaySurface->setPixelSize(static_cast<uint>(sz.d_width),
+                                       static_cast<uint>(sz.d_height));
+
+        Rectf area(d_defaultTarget->getArea());
+        area.setSize(sz);
+        d_defaultTarget->setArea(area);
+    }
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
+
+//----------------------------------------------------------------------------//
+// Implementation of template base class
+#include "./RenderTarget.inl"
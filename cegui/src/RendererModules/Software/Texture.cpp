@@ -0,0 +1,335 @@
+/***********************************************************************
+    filename:   Texture.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/ImageCodec.h"
+#include "CEGUI/System.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+// convert a colour component from 0 - 1 to a byte.
+static uint8 toByte(float value)
+{
+    return static_cast<uint8>(ceguimax(0.0f, ceguimin(1.0f, value)) * 255.0f
+                              + 0.5f);
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelWidth() const
+{
+    return d_pixelWidth;
+}
+
+//----------------------------------------------------------------------------//
+uint SoftwareTexture::getPixelHeight() const
+{
+    return d_pixelHeight;
+}
+
+//----------------------------------------------------------------------------//
+const uint8* SoftwareTexture::getPixels() const
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+uint8* SoftwareTexture::getPixels()
+{
+    return d_pixels.empty() ? 0 : &d_pixels[0];
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::setPixelSize(uint width, uint height)
+{
+    d_pixelWidth = width;
+    d_pixelHeight = height;
+    d_pixels.assign(static_cast<size_t>(width) * height * 4, 0);
+
+    d_size.d_width = static_cast<float>(width);
+    d_size.d_height = static_cast<float>(height);
+    d_dataSize = d_size;
+    updateCachedScaleValues();
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::fill(const Colour& colour)
+{
+    const uint8 rgba[4] = { toByte(colour.getRed()), toByte(colour.getGreen()),
+                            toByte(colour.getBlue()), toByte(colour.getAlpha()) };
+
+    if (rgba[0] == rgba[1] && rgba[0] == rgba[2] && rgba[0] == rgba[3])
+    {
+        std::fill(d_pixels.begin(), d_pixels.end(), rgba[0]);
+        return;
+    }
+
+    for (size_t i = 0; i < d_pixels.size(); i += 4)
+        std::memcpy(&d_pixels[i], rgba, 4);
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::fill(const Colour& colour, const Rectf& area)
+{
+    const uint8 rgba[4] = { toByte(colour.getRed()), toByte(colour.getGreen()),
+                            toByte(colour.getBlue()), toByte(colour.getAlpha()) };
+
+    const int width = static_cast<int>(d_pixelWidth);
+    const int height = static_cast<int>(d_pixelHeight);
+    const int left = std::max(0, static_cast<int>(std::floor(area.left())));
+    const int top = std::max(0, static_cast<int>(std::floor(area.top())));
+    const int right =
+        std::min(width, static_cast<int>(std::ceil(area.right())));
+    const int bottom =
+        std::min(height, static_cast<int>(std::ceil(area.bottom())));
+
+    for (int y = top; y < bottom; ++y)
+        for (int x = left; x < right; ++x)
+            std::memcpy(&d_pixels[(y * width + x) * 4], rgba, 4);
+}
+
+//----------------------------------------------------------------------------//
+const String& SoftwareTexture::getName() const
+{
+    return d_name;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getSize() const
+{
+    return d_size;
+}
+
+//----------------------------------------------------------------------------//
+const Sizef& SoftwareTexture::getOriginalDataSize() const
+{
+    return d_dataSize;
+}
+
+//----------------------------------------------------------------------------//
+const Vector2f& SoftwareTexture::getTexelScaling() const
+{
+    return d_texelScaling;
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromFile(const String& filename,
+                                   const String& resourceGroup)
+{
+    // get and check existence of CEGUI::System object
+    System* sys = System::getSingletonPtr();
+    if (!sys)
+        CEGUI_THROW(RendererException(
+            "CEGUI::System object has not been created!"));
+
+    // load file to memory via resource provider
+    RawDataContainer texFile;
+    sys->getResourceProvider()->loadRawDataContainer(filename, texFile,
+                                                     resourceGroup);
+
+    Texture* res = sys->getImageCodec().load(texFile, this);
+
+    // unload file data buffer
+    sys->getResourceProvider()->unloadRawDataContainer(texFile);
+
+    // throw exception if data was load loaded to texture.
+    if (!res)
+        CEGUI_THROW(RendererException(
+            sys->getImageCodec().getIdentifierString() +
+            " failed to load image '" + filename + "'."));
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::loadFromMemory(const void* buffer,
+                                     const Sizef& buffer_size,
+                                     PixelFormat pixel_format)
+{
+    if (!isPixelFormatSupported(pixel_format))
+        CEGUI_THROW(InvalidRequestException(
+            "Data was supplied in an unsupported pixel format."));
+
+    setPixelSize(static_cast<uint>(buffer_size.d_width),
+                 static_cast<uint>(buffer_size.d_height));
+
+    const size_t count = static_cast<size_t>(d_pixelWidth) * d_pixelHeight;
+    const uint8* src = static_cast<const uint8*>(buffer);
+    uint8* dst = getPixels();
+
+    switch (pixel_format)
+    {
+    case PF_RGBA:
+        if (count)
+            std::memcpy(dst, src, count * 4);
+        break;
+
+    case PF_RGB:
+        for (size_t i = 0; i < count; ++i, src += 3, dst += 4)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = 0xFF;
+        }
+        break;
+
+    // the packed formats are native 16 bit values with red in the top bits,
+    // as OpenGL reads GL_UNSIGNED_SHORT_4_4_4_4 and GL_UNSIGNED_SHORT_5_6_5.
+    case PF_RGBA_4444:
+        for (size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const uint16 p = static_cast<const uint16*>(buffer)[i];
+            dst[0] = static_cast<uint8>(((p >> 12) & 0xF) * 17);
+            dst[1] = static_cast<uint8>(((p >> 8) & 0xF) * 17);
+            dst[2] = static_cast<uint8>(((p >> 4) & 0xF) * 17);
+            dst[3] = static_cast<uint8>((p & 0xF) * 17);
+        }
+        break;
+
+    case PF_RGB_565:
+        for (size_t i = 0; i < count; ++i, dst += 4)
+        {
+            const uint16 p = static_cast<const uint16*>(buffer)[i];
+            dst[0] = static_cast<uint8>((((p >> 11) & 0x1F) * 255 + 15) / 31);
+            dst[1] = static_cast<uint8>((((p >> 5) & 0x3F) * 255 + 31) / 63);
+            dst[2] = static_cast<uint8>(((p & 0x1F) * 255 + 15) / 31);
+            dst[3] = 0xFF;
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitFromMemory(void* sourceData, const Rectf& area)
+{
+    // only the part of the area within the texture is copied.
+    const int width = static_cast<int>(area.getWidth());
+    const int left = static_cast<int>(area.left());
+    const int top = static_cast<int>(area.top());
+    const int first_col = ceguimax(0, -left);
+    const int last_col =
+        ceguimin(width, static_cast<int>(d_pixelWidth) - left);
+    const int first_row = ceguimax(0, -top);
+    const int last_row = ceguimin(static_cast<int>(area.getHeight()),
+                                  static_cast<int>(d_pixelHeight) - top);
+
+    if (first_col >= last_col)
+        return;
+
+    const uint8* const src = static_cast<const uint8*>(sourceData);
+    for (int row = first_row; row < last_row; ++row)
+    {
+        std::memcpy(&d_pixels[((static_cast<size_t>(top + row) * d_pixelWidth)
+                               + left + first_col) * 4],
+                    src + (static_cast<size_t>(row) * width + first_col) * 4,
+                    static_cast<size_t>(last_col - first_col) * 4);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::blitToMemory(void* targetData)
+{
+    if (!d_pixels.empty())
+        std::memcpy(targetData, &d_pixels[0], d_pixels.size());
+}
+
+//----------------------------------------------------------------------------//
+bool SoftwareTexture::isPixelFormatSupported(const PixelFormat fmt) const
+{
+    switch (fmt)
+    {
+    case PF_RGBA:
+    case PF_RGB:
+    case PF_RGBA_4444:
+    case PF_RGB_565:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void SoftwareTexture::updateCachedScaleValues()
+{
+    d_texelScaling.d_x = d_size.d_width > 0 ? 1.0f / d_size.d_width : 0.0f;
+    d_texelScaling.d_y = d_size.d_height > 0 ? 1.0f / d_size.d_height : 0.0f;
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_pixelWidth(0),
+    d_pixelHeight(0)
+{
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const String& filename,
+                                 const String& resourceGroup) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_pixelWidth(0),
+    d_pixelHeight(0)
+{
+    loadFromFile(filename, resourceGroup);
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::SoftwareTexture(const String& name, const Sizef& sz) :
+    d_size(0, 0),
+    d_dataSize(0, 0),
+    d_texelScaling(0, 0),
+    d_name(name),
+    d_pixelWidth(0),
+    d_pixelHeight(0)
+{
+    setPixelSize(static_cast<uint>(sz.d_width),
+                 static_cast<uint>(sz.d_height));
+}
+
+//----------------------------------------------------------------------------//
+SoftwareTexture::~SoftwareTexture()
+{
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -28,6 +28,7 @@
 #include "CEGUI/RenderingSurface.h"
 #include "CEGUI/RenderTarget.h"
 #include "CEGUI/RenderingWindow.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm>
 
 // Start of CEGUI namespace section
@@ -53,7 +54,8 @@ const String RenderingSurface::EventRenderQueueEnded("RenderQueueEnded");
 //----------------------------------------------------------------------------//
 RenderingSurface::RenderingSurface(RenderTarget& target) :
     d_target(&target),
-    d_invalidated(true)
+    d_invalidated(true),
+    d_batchingEnabled(false)
 {
 }
 
@@ -70,7 +72,9 @@ RenderingSurface::~RenderingSurface()
 void RenderingSurface::addGeometryBuffer(const RenderQueueID queue,
     const GeometryBuffer& buffer)
 {
-    d_queues[queue].addGeometryBuffer(buffer);
+    RenderQueue& render_queue = d_queues[queue];
+    render_queue.setBatchingEnabled(d_batchingEnabled);
+    render_queue.addGeometryBuffer(buffer);
 }
 
 //----------------------------------------------------------------------------//
@@ -98,6 +102,8 @@ void RenderingSurface::clearGeometry()
 //----------------------------------------------------------------------------//
 void RenderingSurface::draw()
 {
+    CEGUI_PROFILE_ZONE("RenderingSurface::draw");
+
     d_target->activate();
 
     drawContent();
@@ -135,9 +141,18 @@ void RenderingSurface::draw(const RenderQueue& queue,
 //----------------------------------------------------------------------------//
 void RenderingSurface::invalidate()
 {
+    if (!d_invalidated)
+        CEGUI_PROFILE_COUNT(C_SURFACES_INVALIDATED, 1);
+
     d_invalidated = true;
 }
 
+//----------------------------------------------------------------------------//
+void RenderingSurface::invalidateArea(const Rectf&)
+{
+    invalidate();
+}
+
 //----------------------------------------------------------------------------//
 bool RenderingSurface::isInvalidated() const
 {
@@ -200,6 +215,7 @@ void RenderingSurface::detatchWindow(RenderingWindow& w)
 void RenderingSurface::attachWindow(RenderingWindow& w)
 {
     d_windows.push_back(&w);
+    w.setBatchingEnabled(d_batchingEnabled);
     invalidate();
 }
 
@@ -216,6 +232,31 @@ RenderTarget& RenderingSurface::getRenderTarget()
         static_cast<const RenderingSurface*>(this)->getRenderTarget());
 }
 
+//----------------------------------------------------------------------------//
+void RenderingSurface::setBatchingEnabled(const bool enabled)
+{
+    if (d_batchingEnabled == enabled)
+        return;
+
+    d_batchingEnabled = enabled;
+
+    for (RenderQueueList::iterator i = d_queues.begin();
+         d_queues.end() != i;
+         ++i)
+        i->second.setBatchingEnabled(enabled);
+
+    for (size_t i = 0; i < d_windows.size(); ++i)
+        d_windows[i]->setBatchingEnabled(enabled);
+
+    invalidate();
+}
+
+//----------------------------------------------------------------------------//
+bool RenderingSurface::isBatchingEnabled() const
+{
+    return d_batchingEnabled;
+}
+
 //----------------------------------------------------------------------------//
 
 } // End of  CEGUI namespace section
@@ -34,6 +34,8 @@
 #include "CEGUI/Texture.h"
 #include "CEGUI/RenderEffect.h"
 
+#include <cmath>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -47,7 +49,9 @@ RenderingWindow::RenderingWindow(TextureTarget& target, RenderingSurface& owner)
     d_geometryValid(false),
     d_position(0, 0),
     d_size(0, 0),
-    d_rotation(Quaternion::IDENTITY)
+    d_rotation(Quaternion::IDENTITY),
+    d_partiallyInvalidated(false),
+    d_invalidatedArea(0, 0, 0, 0)
 {
     d_geometry->setBlendMode(BM_RTT_PREMULTIPLIED);
 }
@@ -98,10 +102,16 @@ void RenderingWindow::setSize(const Sizef& size)
     // URGENT FIXME: Isn't this in the hands of the user?
     /*d_size.d_width = PixelAligned(size.d_width);
     d_size.d_height = PixelAligned(size.d_height);*/
+    const bool resized = d_size != size;
+
     d_size = size;
     d_geometryValid = false;
 
     d_textarget.declareRenderSize(d_size);
+
+    // the texture may have been recreated, so none of its content can be kept.
+    if (resized)
+        invalidate();
 }
 
 //----------------------------------------------------------------------------//
@@ -204,10 +214,20 @@ void RenderingWindow::draw()
 
     if (d_invalidated)
     {
+        if (d_partiallyInvalidated)
+            d_textarget.beginPartialRedraw(d_invalidatedArea);
+        else
+            d_textarget.clear();
+
         // base class will render out queues for us
         RenderingSurface::draw();
+
+        if (d_partiallyInvalidated)
+            d_textarget.endPartialRedraw();
+
         // mark as no longer invalidated
         d_invalidated = false;
+        d_partiallyInvalidated = false;
     }
 
     // add our geometry to our owner for rendering
@@ -217,16 +237,76 @@ void RenderingWindow::draw()
 //----------------------------------------------------------------------------//
 void RenderingWindow::invalidate()
 {
-    // this override is potentially expensive, so only do the main work when we
-    // have to.
+    // the cached imagery gets cleared when we are next drawn.
+    RenderingSurface::invalidate();
+    d_partiallyInvalidated = false;
+
+    // also invalidate what we render back to.
+    d_owner->invalidate();
+}
+
+//----------------------------------------------------------------------------//
+void RenderingWindow::invalidateArea(const Rectf& area)
+{
+    if (!d_textarget.isPartialRedrawSupported())
+    {
+        invalidate();
+        return;
+    }
+
+    // only whole pixels can be cleared and redrawn.
+    const Rectf pixel_area(
+        Rectf(std::floor(area.left()), std::floor(area.top()),
+              std::ceil(area.right()), std::ceil(area.bottom())).
+            getIntersection(Rectf(0, 0, std::ceil(d_size.d_width),
+                                  std::ceil(d_size.d_height))));
+
+    // nothing we hold is affected.
+    if (pixel_area.getWidth() <= 0 || pixel_area.getHeight() <= 0)
+        return;
+
     if (!d_invalidated)
     {
         RenderingSurface::invalidate();
-        d_textarget.clear();
+        d_partiallyInvalidated = true;
+        d_invalidatedArea = pixel_area;
     }
+    else if (d_partiallyInvalidated)
+        d_invalidatedArea = d_invalidatedArea.getUnion(pixel_area);
 
-    // also invalidate what we render back to.
-    d_owner->invalidate();
+    // also invalidate what we render back to.  Unless we are rotated or have
+    // an effect, our imagery changes there only within the same area.
+    if (d_rotation == Quaternion::IDENTITY && !d_geometry->getRenderEffect())
+    {
+        Rectf owner_area(pixel_area);
+        owner_area.offset(d_position);
+
+        // the owner's area is relative to the owner's position, if that is a
+        // RenderingWindow.
+        if (d_owner->isRenderingWindow())
+        {
+            const Vector2f& owner_position =
+                static_cast<RenderingWindow*>(d_owner)->d_position;
+            owner_area.offset(Vector2f(-owner_position.d_x,
+                                       -owner_position.d_y));
+        }
+
+        d_owner->invalidateArea(owner_area);
+    }
+    else
+        d_owner->invalidate();
+}
+
+//----------------------------------------------------------------------------//
+bool RenderingWindow::isPartiallyInvalidated() const
+{
+    return d_invalidated && d_partiallyInvalidated;
+}
+
+//----------------------------------------------------------------------------//
+const Rectf& RenderingWindow::getInvalidatedArea() const
+{
+    return d_invalidatedArea;
 }
 
 //----------------------------------------------------------------------------//
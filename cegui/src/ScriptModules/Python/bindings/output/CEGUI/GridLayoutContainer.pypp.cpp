@@ -27,10 +27,6 @@ struct GridLayoutContainer_wrapper : CEGUI::GridLayoutContainer, bp::wrapper< CE
         CEGUI::GridLayoutContainer::addChild_impl( boost::python::ptr(element) );
     }
 
-    ::CEGUI::Window * createDummy(  ){
-        return CEGUI::GridLayoutContainer::createDummy(  );
-    }
-
     ::CEGUI::UVector2 getGridCellOffset( ::std::vector< CEGUI::UDim > const & colSizes, ::std::vector< CEGUI::UDim > const & rowSizes, ::size_t gridX, ::size_t gridY ) const {
         return CEGUI::GridLayoutContainer::getGridCellOffset( boost::ref(colSizes), boost::ref(rowSizes), gridX, gridY );
     }
@@ -39,10 +35,6 @@ struct GridLayoutContainer_wrapper : CEGUI::GridLayoutContainer, bp::wrapper< CE
         return CEGUI::GridLayoutContainer::getGridSize( boost::ref(colSizes), boost::ref(rowSizes) );
     }
 
-    bool isDummy( ::CEGUI::Window * wnd ) const {
-        return CEGUI::GridLayoutContainer::isDummy( boost::python::ptr(wnd) );
-    }
-
     virtual void layout(  ) {
         if( bp::override func_layout = this->get_override( "layout" ) )
             func_layout(  );
@@ -1533,17 +1525,6 @@ void register_GridLayoutContainer_class(){
                 Skips given number of cells in the auto positioning sequence\n\
             *\n" );
         
-        }
-        { //::CEGUI::GridLayoutContainer::createDummy
-        
-            typedef ::CEGUI::Window * ( GridLayoutContainer_wrapper::*createDummy_function_type )(  ) ;
-            
-            GridLayoutContainer_exposer.def( 
-                "createDummy"
-                , createDummy_function_type( &GridLayoutContainer_wrapper::createDummy )
-                , bp::return_value_policy< bp::reference_existing_object >()
-                , "! creates a dummy window\n" );
-        
         }
         { //::CEGUI::GridLayoutContainer::getAutoPositioning
         
@@ -1646,18 +1627,6 @@ void register_GridLayoutContainer_class(){
                 time when addChild is called.\n\
             *\n" );
         
-        }
-        { //::CEGUI::GridLayoutContainer::isDummy
-        
-            typedef bool ( GridLayoutContainer_wrapper::*isDummy_function_type )( ::CEGUI::Window * ) const;
-            
-            GridLayoutContainer_exposer.def( 
-                "isDummy"
-                , isDummy_function_type( &GridLayoutContainer_wrapper::isDummy )
-                , ( bp::arg("wnd") )
-                , "! creates a dummy window\n\
-            ! checks whether given window is a dummy\n" );
-        
         }
         { //::CEGUI::GridLayoutContainer::layout
         
@@ -1899,9 +1868,6 @@ void register_GridLayoutContainer_class(){
                 , "! translates auto positioning index to absolute grid index\n" );
         
         }
-        GridLayoutContainer_exposer.add_static_property( "DummyName"
-                        , bp::make_getter( &CEGUI::GridLayoutContainer::DummyName
-                                , bp::return_value_policy< bp::return_by_value >() ) );
         GridLayoutContainer_exposer.add_static_property( "EventChildOrderChanged"
                         , bp::make_getter( &CEGUI::GridLayoutContainer::EventChildOrderChanged
                                 , bp::return_value_policy< bp::return_by_value >() ) );
@@ -57,6 +57,7 @@
 #include "CEGUI/ImageCodec.h"
 #include "CEGUI/widgets/All.h"
 #include "CEGUI/RegexMatcher.h"
+#include "CEGUI/Profiler.h"
 #ifdef CEGUI_HAS_PCRE_REGEX
 #   include "CEGUI/PCRERegexMatcher.h"
 #endif
@@ -424,6 +425,10 @@ void System::renderAllGUIContexts()
 
     // do final destruction on dead-pool windows
     WindowManager::getSingleton().cleanDeadPool();
+
+    Profiler& profiler = Profiler::getSingleton();
+    if (profiler.isEnabled())
+        profiler.endFrame();
 }
 
 
@@ -674,6 +679,7 @@ void System::addStandardWindowFactories()
 void System::createSingletons()
 {
     // cause creation of other singleton objects
+    CEGUI_NEW_AO Profiler();
     CEGUI_NEW_AO ImageManager();
     CEGUI_NEW_AO FontManager();
     CEGUI_NEW_AO WindowFactoryManager();
@@ -698,6 +704,7 @@ void System::destroySingletons()
     CEGUI_DELETE_AO FontManager::getSingletonPtr();
     CEGUI_DELETE_AO ImageManager::getSingletonPtr();
     CEGUI_DELETE_AO GlobalEventSet::getSingletonPtr();
+    CEGUI_DELETE_AO Profiler::getSingletonPtr();
 }
 
 //----------------------------------------------------------------------------//
@@ -0,0 +1,450 @@
+/***********************************************************************
+    filename:   ThreadPool.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/ThreadPool.h"
+#include "CEGUI/Exceptions.h"
+
+#include <deque>
+#include <vector>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#   include <process.h>
+#else
+#   include <pthread.h>
+#   include <unistd.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+#if defined(__WIN32__) || defined(_WIN32)
+typedef CRITICAL_SECTION NativeMutex;
+typedef CONDITION_VARIABLE NativeCondition;
+typedef HANDLE NativeThread;
+#else
+typedef pthread_mutex_t NativeMutex;
+typedef pthread_cond_t NativeCondition;
+typedef pthread_t NativeThread;
+#endif
+
+//----------------------------------------------------------------------------//
+Mutex::Mutex() :
+    d_impl(new NativeMutex)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    InitializeCriticalSection(static_cast<NativeMutex*>(d_impl));
+#else
+    pthread_mutex_init(static_cast<NativeMutex*>(d_impl), 0);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+Mutex::~Mutex()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    DeleteCriticalSection(static_cast<NativeMutex*>(d_impl));
+#else
+    pthread_mutex_destroy(static_cast<NativeMutex*>(d_impl));
+#endif
+    delete static_cast<NativeMutex*>(d_impl);
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::lock()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    EnterCriticalSection(static_cast<NativeMutex*>(d_impl));
+#else
+    pthread_mutex_lock(static_cast<NativeMutex*>(d_impl));
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void Mutex::unlock()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    LeaveCriticalSection(static_cast<NativeMutex*>(d_impl));
+#else
+    pthread_mutex_unlock(static_cast<NativeMutex*>(d_impl));
+#endif
+}
+
+//----------------------------------------------------------------------------//
+uint32 Atomic::add(volatile uint32& target, uint32 value)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    return static_cast<uint32>(InterlockedExchangeAdd(
+        reinterpret_cast<volatile LONG*>(&target),
+        static_cast<LONG>(value))) + value;
+#else
+    return __sync_add_and_fetch(&target, value);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+uint32 Atomic::load(const volatile uint32& source)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    MemoryBarrier();
+    const uint32 value = source;
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+    const uint32 value = source;
+    __sync_synchronize();
+#endif
+    return value;
+}
+
+//----------------------------------------------------------------------------//
+void Atomic::store(volatile uint32& target, uint32 value)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    MemoryBarrier();
+    target = value;
+    MemoryBarrier();
+#else
+    __sync_synchronize();
+    target = value;
+    __sync_synchronize();
+#endif
+}
+
+//----------------------------------------------------------------------------//
+ThreadPool::Task::~Task()
+{
+}
+
+//----------------------------------------------------------------------------//
+struct ThreadPool::Impl
+{
+    Impl();
+    ~Impl();
+
+    //! wait on \a condition, which must be signalled with d_mutex locked.
+    void wait(NativeCondition& condition);
+    //! wake all threads waiting on \a condition.
+    static void wakeAll(NativeCondition& condition);
+    //! wake one thread waiting on \a condition.
+    static void wakeOne(NativeCondition& condition);
+
+    //! body of each worker thread.
+    void run();
+
+#if defined(__WIN32__) || defined(_WIN32)
+    static unsigned __stdcall threadEntry(void* impl);
+#else
+    static void* threadEntry(void* impl);
+#endif
+
+    Mutex d_mutex;
+    //! signalled when a task is queued or the pool is stopping.
+    NativeCondition d_workAvailable;
+    //! signalled when the queue is empty and no task is executing.
+    NativeCondition d_idle;
+    std::vector<NativeThread> d_threads;
+    std::deque<Task*> d_queue;
+    //! number of tasks being executed.
+    size_t d_busy;
+    //! true once the pool is being destroyed.
+    bool d_stopping;
+};
+
+//----------------------------------------------------------------------------//
+ThreadPool::Impl::Impl() :
+    d_busy(0),
+    d_stopping(false)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    InitializeConditionVariable(&d_workAvailable);
+    InitializeConditionVariable(&d_idle);
+#else
+    pthread_cond_init(&d_workAvailable, 0);
+    pthread_cond_init(&d_idle, 0);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+ThreadPool::Impl::~Impl()
+{
+#if !defined(__WIN32__) && !defined(_WIN32)
+    pthread_cond_destroy(&d_workAvailable);
+    pthread_cond_destroy(&d_idle);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::Impl::wait(NativeCondition& condition)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    SleepConditionVariableCS(&condition,
+        static_cast<NativeMutex*>(d_mutex.d_impl), INFINITE);
+#else
+    pthread_cond_wait(&condition, static_cast<NativeMutex*>(d_mutex.d_impl));
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::Impl::wakeAll(NativeCondition& condition)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    WakeAllConditionVariable(&condition);
+#else
+    pthread_cond_broadcast(&condition);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::Impl::wakeOne(NativeCondition& condition)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    WakeConditionVariable(&condition);
+#else
+    pthread_cond_signal(&condition);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::Impl::run()
+{
+    d_mutex.lock();
+
+    for (;;)
+    {
+        while (d_queue.empty() && !d_stopping)
+            wait(d_workAvailable);
+
+        // only stop once every queued task has been done
+        if (d_queue.empty())
+            break;
+
+        Task* const task = d_queue.front();
+        d_queue.pop_front();
+        ++d_busy;
+
+        d_mutex.unlock();
+
+        CEGUI_TRY
+        {
+            task->execute();
+        }
+        CEGUI_CATCH (...)
+        {
+            // tasks report their own failures
+        }
+
+        CEGUI_DELETE_AO task;
+
+        d_mutex.lock();
+
+        if (!--d_busy && d_queue.empty())
+            wakeAll(d_idle);
+    }
+
+    d_mutex.unlock();
+}
+
+//----------------------------------------------------------------------------//
+#if defined(__WIN32__) || defined(_WIN32)
+namespace
+{
+#if defined(_MSC_VER)
+__declspec(thread) bool s_workerThread = false;
+#else
+__thread bool s_workerThread = false;
+#endif
+}
+
+unsigned __stdcall ThreadPool::Impl::threadEntry(void* impl)
+{
+    s_workerThread = true;
+    static_cast<Impl*>(impl)->run();
+    return 0;
+}
+#else
+namespace
+{
+pthread_key_t s_workerThreadKey;
+pthread_once_t s_workerThreadOnce = PTHREAD_ONCE_INIT;
+
+void createWorkerThreadKey()
+{
+    pthread_key_create(&s_workerThreadKey, 0);
+}
+}
+
+void* ThreadPool::Impl::threadEntry(void* impl)
+{
+    pthread_once(&s_workerThreadOnce, &createWorkerThreadKey);
+    // any non-null value marks the thread as a worker
+    pthread_setspecific(s_workerThreadKey, impl);
+
+    static_cast<Impl*>(impl)->run();
+    return 0;
+}
+#endif
+
+//----------------------------------------------------------------------------//
+ThreadPool::ThreadPool(size_t thread_count) :
+    d_impl(new Impl)
+{
+    if (!thread_count)
+        thread_count = getProcessorCount();
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+#if defined(__WIN32__) || defined(_WIN32)
+        const NativeThread thread = reinterpret_cast<HANDLE>(
+            _beginthreadex(0, 0, &Impl::threadEntry, d_impl, 0, 0));
+        const bool started = thread != 0;
+#else
+        NativeThread thread;
+        const bool started =
+            pthread_create(&thread, 0, &Impl::threadEntry, d_impl) == 0;
+#endif
+
+        if (!started)
+            break;
+
+        d_impl->d_threads.push_back(thread);
+    }
+
+    if (d_impl->d_threads.empty())
+    {
+        delete d_impl;
+        CEGUI_THROW(GenericException("Unable to start any worker threads."));
+    }
+}
+
+//----------------------------------------------------------------------------//
+ThreadPool::~ThreadPool()
+{
+    d_impl->d_mutex.lock();
+    d_impl->d_stopping = true;
+    Impl::wakeAll(d_impl->d_workAvailable);
+    d_impl->d_mutex.unlock();
+
+    for (size_t i = 0; i < d_impl->d_threads.size(); ++i)
+    {
+#if defined(__WIN32__) || defined(_WIN32)
+        WaitForSingleObject(d_impl->d_threads[i], INFINITE);
+        CloseHandle(d_impl->d_threads[i]);
+#else
+        pthread_join(d_impl->d_threads[i], 0);
+#endif
+    }
+
+    delete d_impl;
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::submit(Task* task)
+{
+    MutexLock lock(d_impl->d_mutex);
+    d_impl->d_queue.push_back(task);
+    Impl::wakeOne(d_impl->d_workAvailable);
+}
+
+//----------------------------------------------------------------------------//
+void ThreadPool::waitUntilIdle()
+{
+    MutexLock lock(d_impl->d_mutex);
+
+    while (d_impl->d_busy || !d_impl->d_queue.empty())
+        d_impl->wait(d_impl->d_idle);
+}
+
+//----------------------------------------------------------------------------//
+size_t ThreadPool::getThreadCount() const
+{
+    return d_impl->d_threads.size();
+}
+
+//----------------------------------------------------------------------------//
+size_t ThreadPool::getProcessorCount()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const long count = static_cast<long>(info.dwNumberOfProcessors);
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    return count > 0 ? static_cast<size_t>(count) : 1;
+}
+
+//----------------------------------------------------------------------------//
+#if !defined(__WIN32__) && !defined(_WIN32)
+namespace
+{
+pthread_key_t s_threadIDKey;
+pthread_once_t s_threadIDOnce = PTHREAD_ONCE_INIT;
+volatile uint32 s_lastThreadID = 0;
+
+void createThreadIDKey()
+{
+    pthread_key_create(&s_threadIDKey, 0);
+}
+}
+#endif
+
+uint32 ThreadPool::getCurrentThreadID()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    return static_cast<uint32>(GetCurrentThreadId());
+#else
+    // pthread_t is opaque, so threads are numbered as they first ask.
+    pthread_once(&s_threadIDOnce, &createThreadIDKey);
+
+    size_t id = reinterpret_cast<size_t>(pthread_getspecific(s_threadIDKey));
+    if (!id)
+    {
+        id = Atomic::add(s_lastThreadID, 1);
+        pthread_setspecific(s_threadIDKey, reinterpret_cast<void*>(id));
+    }
+
+    return static_cast<uint32>(id);
+#endif
+}
+
+//----------------------------------------------------------------------------//
+bool ThreadPool::isWorkerThread()
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    return s_workerThread;
+#else
+    pthread_once(&s_workerThreadOnce, &createWorkerThreadKey);
+    return pthread_getspecific(s_workerThreadKey) != 0;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -0,0 +1,146 @@
+/***********************************************************************
+    filename:   VertexConverter.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/VertexConverter.h"
+#include "CEGUI/Vertex.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   include <emmintrin.h>
+#   define CEGUI_VERTEXCONVERTER_SSE2
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#   include <arm_neon.h>
+#   define CEGUI_VERTEXCONVERTER_NEON
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const uint VertexConverter::PositionTexColourFloatCount;
+
+//----------------------------------------------------------------------------//
+// The SIMD paths rely on Vertex starting with the position immediately
+// followed by the texture co-ords (five consecutive floats), and on Colour
+// starting with its four float components in ARGB order.
+//----------------------------------------------------------------------------//
+void VertexConverter::toPositionTexColourFloats(const Vertex* vbuff,
+                                                uint vertex_count,
+                                                float* dest)
+{
+    const Vertex* vs = vbuff;
+    const Vertex* const end = vbuff + vertex_count;
+
+#if defined(CEGUI_VERTEXCONVERTER_SSE2)
+    for (; vs != end; ++vs, dest += PositionTexColourFloatCount)
+    {
+        const float* const src = &vs->position.d_x;
+        _mm_storeu_ps(dest, _mm_loadu_ps(src));
+        dest[4] = vs->tex_coords.d_y;
+
+        // ARGB -> RGBA
+        const __m128 argb =
+            _mm_loadu_ps(reinterpret_cast<const float*>(&vs->colour_val));
+        _mm_storeu_ps(dest + 5, _mm_shuffle_ps(argb, argb,
+                                               _MM_SHUFFLE(0, 3, 2, 1)));
+    }
+#elif defined(CEGUI_VERTEXCONVERTER_NEON)
+    for (; vs != end; ++vs, dest += PositionTexColourFloatCount)
+    {
+        const float* const src = &vs->position.d_x;
+        vst1q_f32(dest, vld1q_f32(src));
+        dest[4] = vs->tex_coords.d_y;
+
+        // ARGB -> RGBA
+        const float32x4_t argb =
+            vld1q_f32(reinterpret_cast<const float*>(&vs->colour_val));
+        vst1q_f32(dest + 5, vextq_f32(argb, argb, 1));
+    }
+#else
+    for (; vs != end; ++vs, dest += PositionTexColourFloatCount)
+    {
+        dest[0] = vs->position.d_x;
+        dest[1] = vs->position.d_y;
+        dest[2] = vs->position.d_z;
+        dest[3] = vs->tex_coords.d_x;
+        dest[4] = vs->tex_coords.d_y;
+        dest[5] = vs->colour_val.getRed();
+        dest[6] = vs->colour_val.getGreen();
+        dest[7] = vs->colour_val.getBlue();
+        dest[8] = vs->colour_val.getAlpha();
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------//
+void VertexConverter::toPackedVertices(const Vertex* vbuff, uint vertex_count,
+                                       PackedVertex* dest)
+{
+    const Vertex* const end = vbuff + vertex_count;
+
+    for (const Vertex* vs = vbuff; vs != end; ++vs, ++dest)
+    {
+        dest->x = vs->position.d_x;
+        dest->y = vs->position.d_y;
+        dest->u = vs->tex_coords.d_x;
+        dest->v = vs->tex_coords.d_y;
+        dest->colour = vs->colour_val.getARGB();
+    }
+}
+
+//----------------------------------------------------------------------------//
+void VertexConverter::fromPackedVertices(const PackedVertex* vbuff,
+                                         uint vertex_count,
+                                         Vertex* dest)
+{
+    const PackedVertex* const end = vbuff + vertex_count;
+
+    for (const PackedVertex* vs = vbuff; vs != end; ++vs, ++dest)
+    {
+        dest->position.d_x = vs->x;
+        dest->position.d_y = vs->y;
+        dest->position.d_z = 0.0f;
+        dest->tex_coords.d_x = vs->u;
+        dest->tex_coords.d_y = vs->v;
+        dest->colour_val.setARGB(vs->colour);
+    }
+}
+
+//----------------------------------------------------------------------------//
+const char* VertexConverter::getImplementationName()
+{
+#if defined(CEGUI_VERTEXCONVERTER_SSE2)
+    return "SSE2";
+#elif defined(CEGUI_VERTEXCONVERTER_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -43,9 +43,11 @@
 #include "CEGUI/falagard/WidgetComponent.h"
 #include "CEGUI/GeometryBuffer.h"
 #include "CEGUI/GUIContext.h"
+#include "CEGUI/HitTestIndex.h"
 #include "CEGUI/RenderingContext.h"
 #include "CEGUI/RenderingWindow.h"
 #include "CEGUI/GlobalEventSet.h"
+#include "CEGUI/Profiler.h"
 #include <algorithm>
 #include <iterator>
 #include <cmath>
@@ -195,6 +197,7 @@ Window::Window(const String& type, const String& name):
     d_geometry(&System::getSingleton().getRenderer()->createGeometryBuffer()),
     d_surface(0),
     d_needsRedraw(true),
+    d_drawnArea(0, 0, 0, 0),
     d_autoRenderingWindow(false),
     d_mouseCursor(0),
 
@@ -587,6 +590,11 @@ bool Window::isHit(const Vector2f& position, const bool allow_disabled) const
 //----------------------------------------------------------------------------//
 Window* Window::getChildAtPosition(const Vector2f& position) const
 {
+    // use the GUIContext's spatial index when that is available to us.
+    const HitTestIndex* const index = getGUIContext().getHitTestIndex();
+    if (index && index->isIndexing(*this))
+        return index->getChildAtPosition(*this, position, false, false);
+
     const ChildDrawList::const_reverse_iterator end = d_drawList.rend();
 
     Vector2f p;
@@ -621,6 +629,11 @@ Window* Window::getChildAtPosition(const Vector2f& position) const
 Window* Window::getTargetChildAtPosition(const Vector2f& position,
                                          const bool allow_disabled) const
 {
+    // use the GUIContext's spatial index when that is available to us.
+    const HitTestIndex* const index = getGUIContext().getHitTestIndex();
+    if (index && index->isIndexing(*this))
+        return index->getChildAtPosition(*this, position, allow_disabled, true);
+
     const ChildDrawList::const_reverse_iterator end = d_drawList.rend();
 
     Vector2f p;
@@ -1077,6 +1090,19 @@ void Window::render()
     if (ctx.owner == this)
         ctx.surface->clearGeometry();
 
+    // remember where we draw to, so that area is redrawn when it changes.
+    if (ctx.owner != this)
+        d_drawnArea = getRenderedArea(ctx.offset);
+    else if (ctx.surface->isRenderingWindow())
+    {
+        const RenderingSurface& owner =
+            static_cast<RenderingWindow*>(ctx.surface)->getOwner();
+
+        d_drawnArea = getRenderedArea(owner.isRenderingWindow() ?
+            static_cast<const RenderingWindow&>(owner).getPosition() :
+            Vector2f(0, 0));
+    }
+
     // redraw if no surface set, or if surface is invalidated
     if (!d_surface || d_surface->isInvalidated())
     {
@@ -1107,6 +1133,10 @@ void Window::bufferGeometry(const RenderingContext&)
 {
     if (d_needsRedraw)
     {
+        CEGUI_PROFILE_ZONE_DETAIL("Window::bufferGeometry",
+            d_lookName.empty() ? getNamePath() :
+                                 getNamePath() + " [" + d_lookName + "]");
+
         // dispose of already cached geometry.
         d_geometry->reset();
 
@@ -1129,6 +1159,9 @@ void Window::bufferGeometry(const RenderingContext&)
 
         // mark ourselves as no longer needed a redraw.
         d_needsRedraw = false;
+
+        CEGUI_PROFILE_COUNT(C_WINDOWS_REDRAWN, 1);
+        CEGUI_PROFILE_COUNT(C_VERTICES, d_geometry->getVertexCount());
     }
 }
 
@@ -1217,6 +1250,9 @@ void Window::removeChild_impl(Element* element)
     // remove from draw list
     removeWindowFromDrawList(*wnd);
 
+    if (HitTestIndex* const index = getGUIContext().getHitTestIndex())
+        index->removeWindow(*wnd);
+
     Element::removeChild_impl(wnd);
     
     // find this window in the child list
@@ -1748,6 +1784,95 @@ void Window::destroy(void)
     invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void Window::resetForReuse()
+{
+    // drop the subscriptions of the previous user
+    removeAllEvents();
+    d_muted = false;
+
+    // Element state, as set by the Element constructor
+    d_nonClient = false;
+    d_area = URect(cegui_reldim(0), cegui_reldim(0),
+                   cegui_reldim(0), cegui_reldim(0));
+    d_horizontalAlignment = HA_LEFT;
+    d_verticalAlignment = VA_TOP;
+    d_minSize = USize(cegui_reldim(0), cegui_reldim(0));
+    d_maxSize = USize(cegui_reldim(0), cegui_reldim(0));
+    d_aspectMode = AM_IGNORE;
+    d_aspectRatio = 1.0f;
+    d_pixelAligned = true;
+    d_pixelSize = Sizef(0.0f, 0.0f);
+    d_rotation = Quaternion::IDENTITY;
+    d_unclippedOuterRect.invalidateCache();
+    d_unclippedInnerRect.invalidateCache();
+
+    // Window state, as set by the constructor.  destroy has already released
+    // the look'n'feel, WindowRenderer, children, tooltip and rendering window.
+    d_autoWindow = false;
+    d_initialising = false;
+    d_destructionStarted = false;
+    d_enabled = true;
+    d_visible = true;
+    d_active = false;
+    d_destroyedByParent = true;
+    d_clippedByParent = true;
+    d_lookName.clear();
+    d_falagardType.clear();
+    d_surface = 0;
+    d_needsRedraw = true;
+    d_drawnArea = Rectf(0, 0, 0, 0);
+    d_autoRenderingWindow = false;
+    d_mouseCursor = 0;
+    d_alpha = 1.0f;
+    d_inheritsAlpha = true;
+    d_oldCapture = 0;
+    d_restoreOldCapture = false;
+    d_distCapturedInputs = false;
+    d_font = 0;
+    d_textLogical.clear();
+    d_bidiDataValid = false;
+    d_renderedString = RenderedString();
+    d_renderedStringValid = false;
+    d_customStringParser = 0;
+    d_textParsingEnabled = true;
+    d_margin = UBox(UDim(0, 0));
+    d_ID = 0;
+    d_userData = 0;
+    d_userStrings.clear();
+    d_alwaysOnTop = false;
+    d_riseOnClick = true;
+    d_zOrderingEnabled = true;
+    d_wantsMultiClicks = true;
+    d_mousePassThroughEnabled = false;
+    d_autoRepeat = false;
+    d_repeatDelay = 0.3f;
+    d_repeatRate = 0.06f;
+    d_repeatButton = NoButton;
+    d_repeating = false;
+    d_repeatElapsed = 0.0f;
+    d_dragDropTarget = true;
+    d_tooltipText.clear();
+    d_inheritsTipText = true;
+    d_allowWriteXML = true;
+    d_bannedXMLProperties.clear();
+    d_outerRectClipperValid = false;
+    d_innerRectClipperValid = false;
+    d_hitTestRectValid = false;
+    d_updateMode = WUM_VISIBLE;
+    d_propagateMouseInputs = false;
+    d_guiContext = 0;
+    d_containsMouse = false;
+
+    d_geometry->reset();
+}
+
+//----------------------------------------------------------------------------//
+bool Window::isReusable() const
+{
+    return false;
+}
+
 //----------------------------------------------------------------------------//
 bool Window::isUsingDefaultTooltip(void) const
 {
@@ -1892,8 +2017,10 @@ void Window::setLookNFeel(const String& look)
     }
 
     d_lookName = look;
-    Logger::getSingleton().logEvent("Assigning LookNFeel '" + look +
-        "' to window '" + d_name + "'.", Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.getLoggingLevel() >= Informative)
+        logger.logEvent("Assigning LookNFeel '" + look +
+            "' to window '" + d_name + "'.", Informative);
 
     // Work to initialise the look and feel...
     const WidgetLookFeel& wlf = wlMgr.getWidgetLook(look);
@@ -2788,8 +2915,10 @@ void Window::setWindowRenderer(const String& name)
 
     if (!name.empty())
     {
-        Logger::getSingleton().logEvent("Assigning the window renderer '" +
-            name + "' to the window '" + d_name + "'", Informative);
+        Logger& logger(Logger::getSingleton());
+        if (logger.getLoggingLevel() >= Informative)
+            logger.logEvent("Assigning the window renderer '" +
+                name + "' to the window '" + d_name + "'", Informative);
         d_windowRenderer = wrm.createWindowRenderer(name);
         WindowEventArgs e(this);
         onWindowRendererAttached(e);
@@ -2976,6 +3105,7 @@ bool Window::isPropertyAtDefault(const Property* property) const
 void Window::notifyClippingChanged(void)
 {
     markCachedWindowRectsInvalid();
+    updateHitTestIndex();
 
     // inform children that their clipped screen areas must be updated
     const size_t num = d_children.size();
@@ -2989,10 +3119,18 @@ void Window::notifyScreenAreaChanged(bool recursive /* = true */)
 {
     markCachedWindowRectsInvalid();
     Element::notifyScreenAreaChanged(recursive);
+    updateHitTestIndex();
 
     updateGeometryRenderSettings();
 }
 
+//----------------------------------------------------------------------------//
+void Window::updateHitTestIndex() const
+{
+    if (HitTestIndex* const index = getGUIContext().getHitTestIndex())
+        index->updateWindow(*this);
+}
+
 //----------------------------------------------------------------------------//
 void Window::updateGeometryRenderSettings()
 {
@@ -3186,7 +3324,57 @@ void Window::invalidateRenderingSurface()
         d_surface->invalidate();
     // else look through the hierarchy for a surface chain to invalidate.
     else if (d_parent)
-        getParent()->invalidateRenderingSurface();
+    {
+        RenderingContext ctx;
+        getRenderingContext(ctx);
+
+        // a RenderingWindow need only redraw the area we affect.
+        if (ctx.surface->isRenderingWindow())
+        {
+            Rectf area(0, 0, 0, 0);
+            addRedrawArea(area, ctx.offset);
+            ctx.surface->invalidateArea(area);
+        }
+        else
+            getParent()->invalidateRenderingSurface();
+    }
+}
+
+//----------------------------------------------------------------------------//
+Rectf Window::getRenderedArea(const Vector2f& offset) const
+{
+    Rectf area(0, 0, 0, 0);
+
+    // a RenderingWindow is drawn within the region set in initialiseClippers.
+    if (d_surface)
+    {
+        if (!d_surface->isRenderingWindow())
+            return area;
+
+        area = (d_clippedByParent && d_parent) ?
+            getParent()->getClipRect(d_nonClient) :
+            Rectf(Vector2f(0, 0), getRootContainerSize());
+    }
+    else
+        area = getOuterRectClipper();
+
+    area.offset(Vector2f(-offset.d_x, -offset.d_y));
+    return area;
+}
+
+//----------------------------------------------------------------------------//
+void Window::addRedrawArea(Rectf& area, const Vector2f& offset) const
+{
+    area = area.getUnion(d_drawnArea).getUnion(getRenderedArea(offset));
+
+    // children of a surface of our own draw within the area above.
+    if (d_surface)
+        return;
+
+    // children not clipped by us may cover areas outside of ours.
+    const size_t child_count = getChildCount();
+    for (size_t i = 0; i < child_count; ++i)
+        getChildAtIdx(i)->addRedrawArea(area, offset);
 }
 
 //----------------------------------------------------------------------------//
@@ -3332,6 +3520,11 @@ void Window::initialiseClippers(const RenderingContext& ctx)
 void Window::onRotated(ElementEventArgs& e)
 {
     Element::onRotated(e);
+
+    // hit-testing of everything below us now needs unprojecting, so the
+    // spatial index needs to re-sort things.
+    if (HitTestIndex* const index = getGUIContext().getHitTestIndex())
+        index->invalidate();
     
     // if we have no surface set, enable the auto surface
     if (!d_surface)
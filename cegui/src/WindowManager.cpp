@@ -83,6 +83,7 @@ WindowManager::~WindowManager(void)
 {
 	destroyAllWindows();
     cleanDeadPool();
+    clearWindowPools();
 
     char addr_buff[32];
     sprintf(addr_buff, "(%p)", static_cast<void*>(this));
@@ -104,14 +105,27 @@ Window* WindowManager::createWindow(const String& type, const String& name)
     String finalName(name.empty() ? generateUniqueWindowName() : name);
 
     WindowFactoryManager& wfMgr = WindowFactoryManager::getSingleton();
-    WindowFactory* factory = wfMgr.getFactory(type);
+    Window* newWindow;
 
-    Window* newWindow = factory->createWindow(finalName);
+    // reuse a pooled window of this type if there is one
+    WindowPoolMap::iterator pool = d_windowPools.find(type);
+    if (pool != d_windowPools.end() && !pool->second.d_windows.empty())
+    {
+        newWindow = pool->second.d_windows.back();
+        pool->second.d_windows.pop_back();
+        newWindow->setName(finalName);
+    }
+    else
+        newWindow = wfMgr.getFactory(type)->createWindow(finalName);
 
-    char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
-    Logger::getSingleton().logEvent("Window '" + finalName +"' of type '" +
-        type + "' has been created. " + addr_buff, Informative);
+    Logger& logger(Logger::getSingleton());
+    if (logger.getLoggingLevel() >= Informative)
+    {
+        char addr_buff[32];
+        sprintf(addr_buff, "(%p)", static_cast<void*>(newWindow));
+        logger.logEvent("Window '" + finalName +"' of type '" +
+            type + "' has been created. " + addr_buff, Informative);
+    }
 
     // see if we need to assign a look to this window
     if (wfMgr.isFalagardMappedType(type))
@@ -126,6 +140,7 @@ Window* WindowManager::createWindow(const String& type, const String& name)
         initialiseRenderEffect(newWindow, fwm.d_effectName);
     }
 
+    d_registryIndex[newWindow] = d_windowRegistry.size();
 	d_windowRegistry.push_back(newWindow);
 
     // fire event to notify interested parites about the new window.
@@ -189,16 +204,13 @@ void WindowManager::initialiseRenderEffect(
 *************************************************************************/
 void WindowManager::destroyWindow(Window* window)
 {
-	WindowVector::iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
+    const RegistryIndex::iterator index = d_registryIndex.find(window);
 
     char addr_buff[32];
-    sprintf(addr_buff, "(%p)", static_cast<void*>(&window));
 
-	if (iter == d_windowRegistry.end())
+	if (index == d_registryIndex.end())
     {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(window));
         Logger::getSingleton().logEvent("[WindowManager] Attempt to delete "
             "Window that does not exist!  Address was: " + String(addr_buff) +
             ". WARNING: This could indicate a double-deletion issue!!",
@@ -206,10 +218,26 @@ void WindowManager::destroyWindow(Window* window)
         return;
     }
 
-    d_windowRegistry.erase(iter);
+    // move the last window into the slot of the one being removed
+    const size_t slot = index->second;
+    d_registryIndex.erase(index);
 
-    Logger::getSingleton().logEvent("Window at '" + window->getNamePath() +
-        "' will be added to dead pool. " + addr_buff, Informative);
+    if (slot != d_windowRegistry.size() - 1)
+    {
+        Window* const last = d_windowRegistry.back();
+        d_windowRegistry[slot] = last;
+        d_registryIndex[last] = slot;
+    }
+
+    d_windowRegistry.pop_back();
+
+    Logger& logger(Logger::getSingleton());
+    if (logger.getLoggingLevel() >= Informative)
+    {
+        sprintf(addr_buff, "(%p)", static_cast<void*>(window));
+        logger.logEvent("Window at '" + window->getNamePath() +
+            "' will be added to dead pool. " + addr_buff, Informative);
+    }
 
     // do 'safe' part of cleanup
     window->destroy();
@@ -236,12 +264,7 @@ void WindowManager::destroyAllWindows(void)
 //----------------------------------------------------------------------------//
 bool WindowManager::isAlive(const Window* window) const
 {
-	WindowVector::const_iterator iter =
-        std::find(d_windowRegistry.begin(),
-                  d_windowRegistry.end(),
-                  window);
-
-	return iter != d_windowRegistry.end();
+    return d_registryIndex.find(window) != d_registryIndex.end();
 }
 
 Window* WindowManager::loadLayoutFromContainer(const RawDataContainer& source, PropertyCallback* callback, void* userdata)
@@ -333,6 +356,10 @@ bool WindowManager::isDeadPoolEmpty(void) const
 
 void WindowManager::cleanDeadPool(void)
 {
+    // factory of the last type seen; dead windows often share a type
+    String last_type;
+    WindowFactory* last_factory = 0;
+
     WindowVector::reverse_iterator curr = d_deathrow.rbegin();
     for (; curr != d_deathrow.rend(); ++curr)
     {
@@ -341,14 +368,87 @@ void WindowManager::cleanDeadPool(void)
         CEGUI_LOGINSANE("Window '" + (*curr)->getName() + "' about to be finally destroyed from dead pool.");
 #endif
 
-        WindowFactory* factory = WindowFactoryManager::getSingleton().getFactory((*curr)->getType());
-        factory->destroyWindow(*curr);
+        // keep the window for reuse if its type is pooled, its class can be
+        // reset, and there is room
+        WindowPoolMap::iterator pool = d_windowPools.find((*curr)->getType());
+        if (pool != d_windowPools.end() && (*curr)->isReusable() &&
+            pool->second.d_windows.size() < pool->second.d_size)
+        {
+            (*curr)->resetForReuse();
+            pool->second.d_windows.push_back(*curr);
+        }
+        else
+            deleteWindow(*curr, last_type, last_factory);
     }
 
     // all done here, so clear all pointers from dead pool
     d_deathrow.clear();
 }
 
+//----------------------------------------------------------------------------//
+void WindowManager::deleteWindow(Window* window, String& last_type,
+                                 WindowFactory*& last_factory) const
+{
+    if (!last_factory || window->getType() != last_type)
+    {
+        last_type = window->getType();
+        last_factory = WindowFactoryManager::getSingleton().getFactory(last_type);
+    }
+
+    last_factory->destroyWindow(window);
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::setWindowPoolSize(const String& type, size_t size)
+{
+    WindowPool& pool = d_windowPools[type];
+    pool.d_size = size;
+
+    String last_type;
+    WindowFactory* last_factory = 0;
+
+    while (pool.d_windows.size() > size)
+    {
+        deleteWindow(pool.d_windows.back(), last_type, last_factory);
+        pool.d_windows.pop_back();
+    }
+
+    if (!size)
+        d_windowPools.erase(type);
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getWindowPoolSize(const String& type) const
+{
+    const WindowPoolMap::const_iterator pool = d_windowPools.find(type);
+    return pool != d_windowPools.end() ? pool->second.d_size : 0;
+}
+
+//----------------------------------------------------------------------------//
+size_t WindowManager::getPooledWindowCount(const String& type) const
+{
+    const WindowPoolMap::const_iterator pool = d_windowPools.find(type);
+    return pool != d_windowPools.end() ? pool->second.d_windows.size() : 0;
+}
+
+//----------------------------------------------------------------------------//
+void WindowManager::clearWindowPools()
+{
+    String last_type;
+    WindowFactory* last_factory = 0;
+
+    for (WindowPoolMap::iterator pool = d_windowPools.begin();
+         pool != d_windowPools.end(); ++pool)
+    {
+        WindowVector& windows = pool->second.d_windows;
+
+        for (size_t i = 0; i < windows.size(); ++i)
+            deleteWindow(windows[i], last_type, last_factory);
+
+        windows.clear();
+    }
+}
+
 void WindowManager::writeLayoutToStream(const Window& window, OutStream& out_stream) const
 {
 
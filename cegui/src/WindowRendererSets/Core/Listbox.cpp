@@ -147,23 +147,26 @@ namespace CEGUI
         // calculate position of area we have to render into
         Rectf itemsArea(getListRenderArea());
 
+        // only the items overlapping the visible area need to be drawn.
+        const float scrollPos = lb->getVertScrollbar()->getScrollPosition();
+        const size_t itemCount = lb->getItemCount();
+        size_t i = lb->getItemIndexAtOffset(scrollPos);
+
         // set up some initial positional details for items
         itemPos.d_x = itemsArea.left() - lb->getHorzScrollbar()->getScrollPosition();
-        itemPos.d_y = itemsArea.top() - lb->getVertScrollbar()->getScrollPosition();
+        itemPos.d_y = itemsArea.top() - scrollPos + lb->getItemOffset(i);
         itemPos.d_z = 0.0f;
 
         const float alpha = lb->getEffectiveAlpha();
 
-        // loop through the items
-        size_t itemCount = lb->getItemCount();
+        // allow item to have full width of box if this is wider than items
+        itemSize.d_width = ceguimax(itemsArea.getWidth(), widest);
 
-        for (size_t i = 0; i < itemCount; ++i)
+        // loop through the visible items
+        for (; (i < itemCount) && (itemPos.d_y < itemsArea.bottom()); ++i)
         {
             ListboxItem* listItem = lb->getListboxItemFromIndex(i);
-            itemSize.d_height = listItem->getPixelSize().d_height;
-
-            // allow item to have full width of box if this is wider than items
-            itemSize.d_width = ceguimax(itemsArea.getWidth(), widest);
+            itemSize.d_height = lb->getItemOffset(i + 1) - lb->getItemOffset(i);
 
             // calculate destination area for this item.
             itemRect.left(itemPos.d_x);
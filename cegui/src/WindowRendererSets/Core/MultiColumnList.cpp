@@ -104,15 +104,42 @@ namespace CEGUI
 
         const float alpha = w->getEffectiveAlpha();
 
+        uint i = 0;
+
+        // rows from a data source all share the same height, so we can skip
+        // straight to the first visible row without visiting those above it.
+        if (w->getDataSource() && (w->getRowCount() != 0))
+        {
+            const float rowHeight = w->getHighestRowItemHeight(0);
+
+            if (rowHeight > 0.0f)
+            {
+                i = ceguimin(w->getRowCount(), static_cast<uint>(
+                    vertScrollbar->getScrollPosition() / rowHeight));
+                itemPos.d_y += i * rowHeight;
+            }
+        }
+
         // loop through the items
-        for (uint i = 0; i < w->getRowCount(); ++i)
+        for (; i < w->getRowCount(); ++i)
         {
+            // no more rows are visible once we are beyond the list area.
+            if (itemPos.d_y >= itemsArea.bottom())
+                break;
+
             // set initial x position for this row.
             itemPos.d_x = itemsArea.left() - horzScrollbar->getScrollPosition();
 
             // calculate height for this row.
             itemSize.d_height = w->getHighestRowItemHeight(i);
 
+            // skip rows that are above the list area.
+            if (itemPos.d_y + itemSize.d_height <= itemsArea.top())
+            {
+                itemPos.d_y += itemSize.d_height;
+                continue;
+            }
+
             // loop through the columns in this row
             for (uint j = 0; j < w->getColumnCount(); ++j)
             {
@@ -27,8 +27,10 @@
  ***************************************************************************/
 #include "CEGUI/XMLAttributes.h"
 #include "CEGUI/Exceptions.h"
-#include <sstream>
-#include <iterator>
+#include <climits>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -39,22 +41,82 @@ namespace CEGUI
     XMLAttributes::~XMLAttributes(void)
     {}
 
+    XMLAttributes::XMLAttributes(const XMLAttributes& other) :
+        AllocatedObject<XMLAttributes>(other)
+    {
+        *this = other;
+    }
+
+    XMLAttributes& XMLAttributes::operator=(const XMLAttributes& other)
+    {
+        if (this == &other)
+            return *this;
+
+        clear();
+        d_attrs.reserve(other.d_attrs.size());
+
+        // copy the text into our own storage so the copy does not depend on
+        // the lifetime of any parser buffer.
+        for (AttributeList::const_iterator i = other.d_attrs.begin();
+             i != other.d_attrs.end(); ++i)
+        {
+            Attribute attr(*i);
+            attr.d_name = storeText(other.getText(i->d_name), i->d_name.d_length);
+            attr.d_value = storeText(other.getText(i->d_value), i->d_value.d_length);
+            d_attrs.push_back(attr);
+        }
+
+        return *this;
+    }
+
     void XMLAttributes::add(const String& attrName, const String& attrValue)
     {
-        d_attrs[attrName] = attrValue;
+        const char* const name = attrName.c_str();
+        const char* const value = attrValue.c_str();
+
+        Attribute attr;
+        attr.d_name = storeText(name, std::strlen(name));
+        attr.d_value = storeText(value, std::strlen(value));
+        attr.d_nameString = attrName;
+        attr.d_valueString = attrValue;
+        attr.d_nameConverted = true;
+        attr.d_valueConverted = true;
+
+        setAttribute(find(attrName), attr);
+    }
+
+    void XMLAttributes::addView(const char* attrName, const char* attrValue)
+    {
+        Attribute attr;
+        attr.d_name.d_data = attrName;
+        attr.d_name.d_offset = 0;
+        attr.d_name.d_length = std::strlen(attrName);
+        attr.d_value.d_data = attrValue;
+        attr.d_value.d_offset = 0;
+        attr.d_value.d_length = std::strlen(attrValue);
+        attr.d_nameConverted = false;
+        attr.d_valueConverted = false;
+
+        setAttribute(find(attrName, attr.d_name.d_length), attr);
+    }
+
+    void XMLAttributes::clear(void)
+    {
+        d_attrs.clear();
+        d_storage.clear();
     }
 
     void XMLAttributes::remove(const String& attrName)
     {
-        AttributeMap::iterator pos = d_attrs.find(attrName);
+        const int index = find(attrName);
 
-        if (pos != d_attrs.end())
-            d_attrs.erase(pos);
+        if (index != -1)
+            d_attrs.erase(d_attrs.begin() + index);
     }
 
     bool XMLAttributes::exists(const String& attrName) const
     {
-        return d_attrs.find(attrName) != d_attrs.end();
+        return find(attrName) != -1;
     }
 
     size_t XMLAttributes::getCount(void) const
@@ -70,10 +132,7 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block."));
         }
 
-        AttributeMap::const_iterator iter = d_attrs.begin();
-        std::advance(iter, index);
-
-        return (*iter).first;
+        return getNameString(index);
     }
 
     const String& XMLAttributes::getValue(size_t index) const
@@ -84,19 +143,16 @@ namespace CEGUI
                 "The specified index is out of range for this XMLAttributes block."));
         }
 
-        AttributeMap::const_iterator iter = d_attrs.begin();
-        std::advance(iter, index);
-
-        return (*iter).second;
+        return getValueString(index);
     }
 
     const String& XMLAttributes::getValue(const String& attrName) const
     {
-        AttributeMap::const_iterator pos = d_attrs.find(attrName);
+        const int index = find(attrName);
 
-        if (pos != d_attrs.end())
+        if (index != -1)
         {
-            return (*pos).second;
+            return getValueString(index);
         }
         else
         {
@@ -107,78 +163,201 @@ namespace CEGUI
 
     const String& XMLAttributes::getValueAsString(const String& attrName, const String& def) const
     {
-        return (exists(attrName)) ? getValue(attrName) : def;
+        const int index = find(attrName);
+        return (index != -1) ? getValueString(index) : def;
     }
 
+    const char* XMLAttributes::getValueAsUTF8(const String& attrName, const char* def) const
+    {
+        const int index = find(attrName);
+        return (index != -1) ? getText(d_attrs[index].d_value) : def;
+    }
 
     bool XMLAttributes::getValueAsBool(const String& attrName, bool def) const
     {
-        if (!exists(attrName))
+        const int index = find(attrName);
+
+        if (index == -1)
         {
             return def;
         }
 
-        const String& val = getValue(attrName);
+        const char* const val = getText(d_attrs[index].d_value);
 
-        if (val == "false" || val == "False" || val == "0")
+        if (!std::strcmp(val, "false") || !std::strcmp(val, "False") || !std::strcmp(val, "0"))
         {
             return false;
         }
-        else if (val == "true" || val == "True" || val == "1")
+        else if (!std::strcmp(val, "true") || !std::strcmp(val, "True") || !std::strcmp(val, "1"))
         {
             return true;
         }
         else
         {
-            CEGUI_THROW(InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to bool."));
+            throwConversionError(attrName, "bool");
+            return def;
         }
     }
 
     int XMLAttributes::getValueAsInteger(const String& attrName, int def) const
     {
-        if (!exists(attrName))
+        const int index = find(attrName);
+
+        if (index == -1)
         {
             return def;
         }
 
-        int val;
-        std::istringstream strm(getValue(attrName).c_str());
-
-        strm >> val;
+        const char* const val = getText(d_attrs[index].d_value);
+        char* end;
+        errno = 0;
+        const long result = std::strtol(val, &end, 10);
 
         // success?
-        if (strm.fail())
+        if (end == val || errno == ERANGE || result < INT_MIN || result > INT_MAX)
         {
-            CEGUI_THROW(InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to integer."));
+            throwConversionError(attrName, "integer");
         }
 
-        return val;
+        return static_cast<int>(result);
     }
 
     float XMLAttributes::getValueAsFloat(const String& attrName, float def) const
     {
-        if (!exists(attrName))
+        const int index = find(attrName);
+
+        if (index == -1)
         {
             return def;
         }
 
-        float val;
-        std::istringstream strm(getValue(attrName).c_str());
-
-        strm >> val;
+        const char* const val = getText(d_attrs[index].d_value);
+        char* end;
+        const double result = std::strtod(val, &end);
 
         // success?
-        if (strm.fail())
+        if (end == val)
         {
-            CEGUI_THROW(InvalidRequestException(
-                "failed to convert attribute '" + attrName + "' with value '" + getValue(attrName) + "' to float."));
+            throwConversionError(attrName, "float");
+        }
+
+        return static_cast<float>(result);
+    }
+
+    int XMLAttributes::find(const String& attrName) const
+    {
+        for (size_t i = 0; i < d_attrs.size(); ++i)
+        {
+            if (isEqual(d_attrs[i].d_name, attrName))
+                return static_cast<int>(i);
         }
 
-        return val;
+        return -1;
     }
 
+    int XMLAttributes::find(const char* attrName, size_t length) const
+    {
+        for (size_t i = 0; i < d_attrs.size(); ++i)
+        {
+            const Text& name = d_attrs[i].d_name;
 
+            if (name.d_length == length &&
+                !std::memcmp(getText(name), attrName, length))
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    const char* XMLAttributes::getText(const Text& text) const
+    {
+        return text.d_data ? text.d_data : &d_storage[text.d_offset];
+    }
+
+    bool XMLAttributes::isEqual(const Text& text, const String& str) const
+    {
+        // every code point takes at least one byte of UTF-8
+        if (text.d_length < str.length())
+            return false;
+
+        const char* const data = getText(text);
+
+        // attribute names are nearly always ASCII, so compare byte by byte
+        // and only decode the text if a multi-byte sequence turns up.  Up to
+        // that point each byte is one code point.
+        for (size_t i = 0; i < text.d_length; ++i)
+        {
+            const unsigned char c = static_cast<unsigned char>(data[i]);
+
+            if (c >= 0x80)
+                return String(reinterpret_cast<const encoded_char*>(data),
+                              text.d_length) == str;
+
+            if (i == str.length() || c != str[i])
+                return false;
+        }
+
+        // all ASCII, and the initial check makes the lengths equal.
+        return true;
+    }
+
+    XMLAttributes::Text XMLAttributes::storeText(const char* data, size_t length)
+    {
+        Text text;
+        text.d_data = 0;
+        text.d_offset = d_storage.size();
+        text.d_length = length;
+
+        d_storage.insert(d_storage.end(), data, data + length);
+        d_storage.push_back(0);
+
+        return text;
+    }
+
+    const String& XMLAttributes::getNameString(size_t index) const
+    {
+        const Attribute& attr = d_attrs[index];
+
+        if (!attr.d_nameConverted)
+        {
+            attr.d_nameString.assign(
+                reinterpret_cast<const encoded_char*>(getText(attr.d_name)),
+                attr.d_name.d_length);
+            attr.d_nameConverted = true;
+        }
+
+        return attr.d_nameString;
+    }
+
+    const String& XMLAttributes::getValueString(size_t index) const
+    {
+        const Attribute& attr = d_attrs[index];
+
+        if (!attr.d_valueConverted)
+        {
+            attr.d_valueString.assign(
+                reinterpret_cast<const encoded_char*>(getText(attr.d_value)),
+                attr.d_value.d_length);
+            attr.d_valueConverted = true;
+        }
+
+        return attr.d_valueString;
+    }
+
+    void XMLAttributes::setAttribute(int index, const Attribute& attr)
+    {
+        if (index != -1)
+            d_attrs[index] = attr;
+        else
+            d_attrs.push_back(attr);
+    }
+
+    void XMLAttributes::throwConversionError(const String& attrName,
+                                             const char* type) const
+    {
+        CEGUI_THROW(InvalidRequestException(
+            "failed to convert attribute '" + attrName + "' with value '" +
+            getValue(attrName) + "' to " + type + "."));
+    }
 
 } // End of  CEGUI namespace section
@@ -0,0 +1,378 @@
+/***********************************************************************
+    filename:   XMLBinaryCache.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLEventRecorder.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Logger.h"
+#include "CEGUI/System.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#if defined(__WIN32__) || defined(_WIN32)
+#   include <windows.h>
+#else
+#   include <sys/types.h>
+#   include <sys/stat.h>
+#   include <sys/mman.h>
+#   include <fcntl.h>
+#   include <unistd.h>
+#endif
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+const uint32 XMLBinaryCache::FormatVersion = 1;
+
+//----------------------------------------------------------------------------//
+// Identifies a cache file; also fails to match if the byte order differs.
+static const uint32 CACHE_MAGIC = 0x43584243;
+
+//----------------------------------------------------------------------------//
+// Header at the start of every cache file.  It is followed by the events, as
+// d_eventWords 32 bit words, and then the string table of d_stringBytes bytes.
+struct CacheHeader
+{
+    uint32 d_magic;
+    uint32 d_version;
+    uint64 d_sourceKey;
+    uint64 d_sourceSize;
+    uint32 d_eventWords;
+    uint32 d_stringBytes;
+};
+
+//----------------------------------------------------------------------------//
+static FILE* openCacheFile(const String& filename, bool write)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    return _wfopen(System::getStringTranscoder().stringToStdWString(filename).c_str(),
+                   write ? L"wb" : L"rb");
+#else
+    return fopen(filename.c_str(), write ? "wb" : "rb");
+#endif
+}
+
+//----------------------------------------------------------------------------//
+static void removeCacheFile(const String& filename)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    _wremove(System::getStringTranscoder().stringToStdWString(filename).c_str());
+#else
+    remove(filename.c_str());
+#endif
+}
+
+//----------------------------------------------------------------------------//
+static bool renameCacheFile(const String& from, const String& to)
+{
+#if defined(__WIN32__) || defined(_WIN32)
+    // rename does not replace an existing file here
+    removeCacheFile(to);
+    return _wrename(System::getStringTranscoder().stringToStdWString(from).c_str(),
+                    System::getStringTranscoder().stringToStdWString(to).c_str()) == 0;
+#else
+    return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+//----------------------------------------------------------------------------//
+// Map \a filename read only into \a output.  Returns false if the file could
+// not be mapped.  The mapping starts on a page boundary, so the events that
+// follow the header are suitably aligned to be used in place.
+static bool mapCacheFile(const String& filename, RawDataContainer& output)
+{
+    bool mapped = false;
+
+#if defined(__WIN32__) || defined(_WIN32)
+    const HANDLE file = CreateFileW(
+        System::getStringTranscoder().stringToStdWString(filename).c_str(),
+        GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, 0);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER file_size;
+    if (GetFileSizeEx(file, &file_size) &&
+        static_cast<ULONGLONG>(file_size.QuadPart) >= sizeof(CacheHeader) &&
+        static_cast<ULONGLONG>(file_size.QuadPart) <= static_cast<size_t>(-1))
+    {
+        const HANDLE mapping =
+            CreateFileMappingW(file, 0, PAGE_READONLY, 0, 0, 0);
+
+        if (mapping)
+        {
+            void* const data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            // the view keeps the mapping open
+            CloseHandle(mapping);
+
+            if (data)
+            {
+                output.setMappedData(static_cast<uint8*>(data),
+                                     static_cast<size_t>(file_size.QuadPart));
+                mapped = true;
+            }
+        }
+    }
+
+    CloseHandle(file);
+#else
+    const int file = open(filename.c_str(), O_RDONLY);
+
+    if (file == -1)
+        return false;
+
+    struct stat s;
+    if (fstat(file, &s) == 0 && S_ISREG(s.st_mode) &&
+        static_cast<size_t>(s.st_size) >= sizeof(CacheHeader))
+    {
+        const size_t size = static_cast<size_t>(s.st_size);
+        void* const data = mmap(0, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+        if (data != MAP_FAILED)
+        {
+            output.setMappedData(static_cast<uint8*>(data), size);
+            mapped = true;
+        }
+    }
+
+    close(file);
+#endif
+
+    return mapped;
+}
+
+//----------------------------------------------------------------------------//
+static String makeCacheFilename(const String& directory, uint64 hash)
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    String filename(directory);
+    if (!filename.empty() &&
+        filename[filename.length() - 1] != '/' &&
+        filename[filename.length() - 1] != '\\')
+        filename += '/';
+
+    for (int shift = 60; shift >= 0; shift -= 4)
+        filename += hex_digits[(hash >> shift) & 0xF];
+
+    return filename + ".cxb";
+}
+
+//----------------------------------------------------------------------------//
+// Write the events recorded by \a recorder to \a filename.
+static bool writeCacheFile(const XMLEventRecorder& recorder,
+                           const String& filename, uint64 key,
+                           uint64 source_size)
+{
+    const XMLEventRecorder::EventList& events(recorder.getEvents());
+    const std::string& strings(recorder.getStrings());
+
+    CacheHeader header;
+    header.d_magic = CACHE_MAGIC;
+    header.d_version = XMLBinaryCache::FormatVersion;
+    header.d_sourceKey = key;
+    header.d_sourceSize = source_size;
+    header.d_eventWords = static_cast<uint32>(events.size());
+    header.d_stringBytes = static_cast<uint32>(strings.size());
+
+    // write to a temporary file first so no reader sees a partial file
+    const String temp_filename(filename + ".tmp");
+    FILE* file = openCacheFile(temp_filename, true);
+    if (!file)
+        return false;
+
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    if (ok && !events.empty())
+        ok = fwrite(&events[0], sizeof(uint32), events.size(), file) ==
+             events.size();
+    if (ok && !strings.empty())
+        ok = fwrite(strings.data(), 1, strings.size(), file) == strings.size();
+
+    ok = (fclose(file) == 0) && ok;
+
+    if (ok)
+        ok = renameCacheFile(temp_filename, filename);
+
+    if (!ok)
+        removeCacheFile(temp_filename);
+
+    return ok;
+}
+
+//----------------------------------------------------------------------------//
+static const uint64 FNV_OFFSET_BASIS = 14695981039346656037ULL;
+static const uint64 FNV_PRIME = 1099511628211ULL;
+
+//----------------------------------------------------------------------------//
+// Continue the 64 bit FNV-1a \a hash over \a size bytes at \a data.
+static uint64 hashBytes(uint64 hash, const void* data, size_t size)
+{
+    const uint8* bytes = static_cast<const uint8*>(data);
+    const uint8* const end = bytes + size;
+
+    for (; bytes != end; ++bytes)
+    {
+        hash ^= *bytes;
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------//
+// Continue \a hash over \a value, least significant byte first.
+static uint64 hashValue(uint64 hash, uint64 value)
+{
+    uint8 bytes[8];
+    for (int i = 0; i < 8; ++i)
+        bytes[i] = static_cast<uint8>(value >> (i * 8));
+
+    return hashBytes(hash, bytes, sizeof(bytes));
+}
+
+//----------------------------------------------------------------------------//
+uint64 XMLBinaryCache::computeHash(const RawDataContainer& source)
+{
+    return hashBytes(FNV_OFFSET_BASIS, source.getDataPtr(), source.getSize());
+}
+
+//----------------------------------------------------------------------------//
+uint64 XMLBinaryCache::computeFileKey(const String& filename,
+                                      const String& resourceGroup,
+                                      uint64 size, uint64 modifiedTime)
+{
+    uint64 key = hashBytes(FNV_OFFSET_BASIS, resourceGroup.c_str(),
+                           strlen(resourceGroup.c_str()) + 1);
+    key = hashBytes(key, filename.c_str(), strlen(filename.c_str()) + 1);
+    key = hashValue(key, size);
+
+    return hashValue(key, modifiedTime);
+}
+
+//----------------------------------------------------------------------------//
+String XMLBinaryCache::getCacheFilename(const String& directory,
+                                        const RawDataContainer& source)
+{
+    return makeCacheFilename(directory, computeHash(source));
+}
+
+//----------------------------------------------------------------------------//
+String XMLBinaryCache::getCacheFilename(const String& directory, uint64 key)
+{
+    return makeCacheFilename(directory, key);
+}
+
+//----------------------------------------------------------------------------//
+bool XMLBinaryCache::replay(XMLHandler& handler, const String& directory,
+                            const RawDataContainer& source)
+{
+    return replay(handler, directory, computeHash(source), source.getSize());
+}
+
+//----------------------------------------------------------------------------//
+bool XMLBinaryCache::replay(XMLHandler& handler, const String& directory,
+                            uint64 key, uint64 sourceSize)
+{
+    const String filename(makeCacheFilename(directory, key));
+
+    RawDataContainer data;
+    if (!mapCacheFile(filename, data))
+        return false;
+
+    const size_t file_size = data.getSize();
+
+    CacheHeader header;
+    memcpy(&header, data.getDataPtr(), sizeof(header));
+    bool ok = header.d_magic == CACHE_MAGIC &&
+              header.d_version == FormatVersion &&
+              header.d_sourceKey == key &&
+              header.d_sourceSize == sourceSize &&
+              header.d_stringBytes > 0 &&
+              sizeof(header) + header.d_eventWords * sizeof(uint32) +
+                 header.d_stringBytes == file_size;
+
+    const uint32* const events = ok ?
+        reinterpret_cast<const uint32*>(data.getDataPtr() + sizeof(header)) : 0;
+    const char* const strings = ok ?
+        reinterpret_cast<const char*>(events + header.d_eventWords) : 0;
+
+    if (ok)
+        ok = strings[header.d_stringBytes - 1] == 0 &&
+             XMLEventRecorder::validate(events, header.d_eventWords,
+                                        header.d_stringBytes);
+
+    if (!ok)
+    {
+        Logger::getSingleton().logEvent("XMLBinaryCache::replay: ignoring "
+            "invalid or out of date cache file '" + filename + "'.", Warnings);
+        return false;
+    }
+
+    // the attribute blocks passed to the handler refer into the mapping, which
+    // is released along with data once replay is done.
+    XMLEventRecorder::replay(handler, events, header.d_eventWords, strings);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::parseAndStore(XMLParser& parser, XMLHandler& handler,
+                                   const String& directory,
+                                   const RawDataContainer& source,
+                                   const String& schemaName)
+{
+    parseAndStore(parser, handler, directory, source, schemaName,
+                  computeHash(source));
+}
+
+//----------------------------------------------------------------------------//
+void XMLBinaryCache::parseAndStore(XMLParser& parser, XMLHandler& handler,
+                                   const String& directory,
+                                   const RawDataContainer& source,
+                                   const String& schemaName, uint64 key)
+{
+    XMLEventRecorder recorder(&handler);
+    parser.parseXML(recorder, source, schemaName);
+
+    const String filename(makeCacheFilename(directory, key));
+
+    if (writeCacheFile(recorder, filename, key, source.getSize()))
+        Logger::getSingleton().logEvent("XMLBinaryCache::parseAndStore: "
+            "wrote cache file '" + filename + "'.", Informative);
+    else
+        Logger::getSingleton().logEvent("XMLBinaryCache::parseAndStore: "
+            "unable to write cache file '" + filename + "'.", Warnings);
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
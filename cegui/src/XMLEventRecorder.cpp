@@ -0,0 +1,216 @@
+/***********************************************************************
+    filename:   XMLEventRecorder.cpp
+    created:    Sat Oct 17 2026
+    author:     The CEGUI Development Team
+*************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLEventRecorder.h"
+#include "CEGUI/XMLAttributes.h"
+
+// Start of CEGUI namespace section
+namespace CEGUI
+{
+//----------------------------------------------------------------------------//
+XMLEventRecorder::XMLEventRecorder(XMLHandler* target) :
+    d_target(target)
+{
+}
+
+//----------------------------------------------------------------------------//
+const String& XMLEventRecorder::getSchemaName() const
+{
+    return d_target ? d_target->getSchemaName() : XMLHandler::getSchemaName();
+}
+
+//----------------------------------------------------------------------------//
+const String& XMLEventRecorder::getDefaultResourceGroup() const
+{
+    static const String no_group;
+    return d_target ? d_target->getDefaultResourceGroup() : no_group;
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::elementStart(const String& element,
+                                    const XMLAttributes& attributes)
+{
+    d_events.push_back(ET_ELEMENT_START);
+    d_events.push_back(addString(element));
+    d_events.push_back(static_cast<uint32>(attributes.getCount()));
+
+    for (size_t i = 0; i < attributes.getCount(); ++i)
+    {
+        d_events.push_back(addString(attributes.getName(i)));
+        d_events.push_back(addString(attributes.getValue(i)));
+    }
+
+    if (d_target)
+        d_target->elementStart(element, attributes);
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::elementEnd(const String& element)
+{
+    d_events.push_back(ET_ELEMENT_END);
+    d_events.push_back(addString(element));
+
+    if (d_target)
+        d_target->elementEnd(element);
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::text(const String& text)
+{
+    d_events.push_back(ET_TEXT);
+    d_events.push_back(addString(text));
+
+    if (d_target)
+        d_target->text(text);
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::replay(XMLHandler& handler) const
+{
+    if (!d_events.empty())
+        replay(handler, &d_events[0], d_events.size(), d_strings.c_str());
+}
+
+//----------------------------------------------------------------------------//
+const XMLEventRecorder::EventList& XMLEventRecorder::getEvents() const
+{
+    return d_events;
+}
+
+//----------------------------------------------------------------------------//
+const std::string& XMLEventRecorder::getStrings() const
+{
+    return d_strings;
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::clear()
+{
+    d_events.clear();
+    d_strings.clear();
+    d_stringOffsets.clear();
+}
+
+//----------------------------------------------------------------------------//
+void XMLEventRecorder::replay(XMLHandler& handler, const uint32* events,
+                              size_t event_words, const char* strings)
+{
+    // element names are converted once and reused for every element
+    typedef std::map<uint32, String, std::less<uint32>
+        CEGUI_MAP_ALLOC(uint32, String)> NameMap;
+    NameMap names;
+
+    XMLAttributes attributes;
+
+    size_t i = 0;
+    while (i < event_words)
+    {
+        const uint32 type = events[i++];
+        const uint32 str = events[i++];
+
+        if (type == ET_TEXT)
+        {
+            handler.text(reinterpret_cast<const encoded_char*>(strings + str));
+            continue;
+        }
+
+        NameMap::iterator name = names.find(str);
+        if (name == names.end())
+            name = names.insert(std::make_pair(str, String(
+                reinterpret_cast<const encoded_char*>(strings + str)))).first;
+
+        if (type == ET_ELEMENT_END)
+        {
+            handler.elementEnd(name->second);
+            continue;
+        }
+
+        attributes.clear();
+        for (uint32 count = events[i++]; count; --count, i += 2)
+            attributes.addView(strings + events[i], strings + events[i + 1]);
+
+        handler.elementStart(name->second, attributes);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool XMLEventRecorder::validate(const uint32* events, size_t event_words,
+                                size_t string_bytes)
+{
+    size_t i = 0;
+    while (i < event_words)
+    {
+        size_t strings = 1;
+
+        switch (events[i++])
+        {
+        case ET_ELEMENT_START:
+            // element name, then the attribute count and the attributes
+            if (event_words - i < 2 || events[i] >= string_bytes)
+                return false;
+            strings = 2 * static_cast<size_t>(events[i + 1]);
+            i += 2;
+            break;
+
+        case ET_ELEMENT_END:
+        case ET_TEXT:
+            break;
+
+        default:
+            return false;
+        }
+
+        if (strings > event_words - i)
+            return false;
+
+        for (; strings; --strings)
+            if (events[i++] >= string_bytes)
+                return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------//
+uint32 XMLEventRecorder::addString(const String& str)
+{
+    const std::string utf8(str.c_str());
+
+    StringOffsetMap::const_iterator i = d_stringOffsets.find(utf8);
+    if (i != d_stringOffsets.end())
+        return i->second;
+
+    const uint32 offset = static_cast<uint32>(d_strings.size());
+    d_strings.append(utf8.c_str(), utf8.length() + 1);
+    d_stringOffsets[utf8] = offset;
+
+    return offset;
+}
+
+//----------------------------------------------------------------------------//
+
+} // End of  CEGUI namespace section
@@ -30,6 +30,9 @@
 #include "CEGUI/System.h"
 #include "CEGUI/ResourceProvider.h"
 #include "CEGUI/Logger.h"
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLEventRecorder.h"
+#include "CEGUI/AsyncResourceLoader.h"
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -54,31 +57,97 @@ namespace CEGUI
         return d_initialised;
     }
 
+    // hint the name of the file the last thrown exception was related to
+    static void logFileException(const String& filename, const String& resourceGroup)
+    {
+        Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
+                                        filename + "' from resource group '" + resourceGroup + "'.", Errors);
+    }
+
     void XMLParser::parseXMLFile(XMLHandler& handler, const String& filename, const String& schemaName, const String& resourceGroup)
     {
+        // use the events parsed on a worker thread by AsyncResourceLoader
+        if (AsyncResourceLoader* loader = AsyncResourceLoader::getSingletonPtr())
+        {
+            if (XMLEventRecorder* recorder = loader->takePreparedXML(filename, resourceGroup))
+            {
+                try
+                {
+                    recorder->replay(handler);
+                }
+                catch (const Exception&)
+                {
+                    CEGUI_DELETE_AO recorder;
+
+                    logFileException(filename, resourceGroup);
+                    CEGUI_RETHROW;
+                }
+
+                CEGUI_DELETE_AO recorder;
+                return;
+            }
+        }
+
+        ResourceProvider* const provider = System::getSingleton().getResourceProvider();
+
+        // when the provider reports the file's size and modification time the
+        // cache is keyed on those, and a hit needs no loading or hashing.
+        uint64 source_size;
+        uint64 modified_time;
+        const bool keyed = !d_binaryCacheDirectory.empty() &&
+            provider->getFileStatus(filename, resourceGroup, source_size, modified_time);
+        const uint64 key = keyed ?
+            XMLBinaryCache::computeFileKey(filename, resourceGroup, source_size, modified_time) : 0;
+
+        if (keyed)
+        {
+            try
+            {
+                if (XMLBinaryCache::replay(handler, d_binaryCacheDirectory, key, source_size))
+                    return;
+            }
+            catch (const Exception&)
+            {
+                logFileException(filename, resourceGroup);
+                CEGUI_RETHROW;
+            }
+        }
+
         // Acquire resource using CEGUI ResourceProvider
         RawDataContainer rawXMLData;
-        System::getSingleton().getResourceProvider()->loadRawDataContainer(filename, rawXMLData, resourceGroup);
+        provider->loadRawDataContainer(filename, rawXMLData, resourceGroup);
 
         try
         {
-            // The actual parsing action (this is overridden and depends on the specific parser)
-            parseXML(handler, rawXMLData, schemaName);
+            if (d_binaryCacheDirectory.empty())
+            {
+                // The actual parsing action (this is overridden and depends on the specific parser)
+                parseXML(handler, rawXMLData, schemaName);
+            }
+            else if (keyed)
+            {
+                XMLBinaryCache::parseAndStore(*this, handler, d_binaryCacheDirectory,
+                                              rawXMLData, schemaName, key);
+            }
+            // use the cached parse if there is one, otherwise parse and cache
+            else if (!XMLBinaryCache::replay(handler, d_binaryCacheDirectory, rawXMLData))
+            {
+                XMLBinaryCache::parseAndStore(*this, handler, d_binaryCacheDirectory,
+                                              rawXMLData, schemaName);
+            }
         }
         catch (const Exception&)
         {
-            // hint the related file name in the log
-            Logger::getSingleton().logEvent("The last thrown exception was related to XML file '" +
-                                            filename + "' from resource group '" + resourceGroup + "'.", Errors);
+            logFileException(filename, resourceGroup);
 
             // exception safety
-            System::getSingleton().getResourceProvider()->unloadRawDataContainer(rawXMLData);
+            provider->unloadRawDataContainer(rawXMLData);
 
             CEGUI_RETHROW;
         }
 
         // Release resource
-        System::getSingleton().getResourceProvider()->unloadRawDataContainer(rawXMLData);
+        provider->unloadRawDataContainer(rawXMLData);
     }
 
     void XMLParser::parseXMLString(XMLHandler& handler, const String& source, const String& schemaName)
@@ -124,4 +193,14 @@ namespace CEGUI
         return d_identifierString;
     }
 
+    void XMLParser::setBinaryCacheDirectory(const String& directory)
+    {
+        d_binaryCacheDirectory = directory;
+    }
+
+    const String& XMLParser::getBinaryCacheDirectory() const
+    {
+        return d_binaryCacheDirectory;
+    }
+
 } // End of  CEGUI namespace section
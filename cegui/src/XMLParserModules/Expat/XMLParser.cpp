@@ -37,6 +37,14 @@
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//! state passed to the Expat callbacks while parsing a document.
+struct ExpatParseState
+{
+    XMLHandler* d_handler;
+    //! attribute block reused for every element of the document.
+    XMLAttributes d_attributes;
+};
+
 ExpatParser::ExpatParser(void)
 {
     // set ID string
@@ -57,7 +65,10 @@ void ExpatParser::parseXML(XMLHandler& handler, const RawDataContainer& source,
         CEGUI_THROW(GenericException("Unable to create a new Expat Parser"));
     }
 
-    XML_SetUserData(parser, (void*)&handler); // Initialise user data
+    ExpatParseState state;
+    state.d_handler = &handler;
+
+    XML_SetUserData(parser, (void*)&state); // Initialise user data
     XML_SetElementHandler(parser, startElement, endElement); // Register callback for elements
     XML_SetCharacterDataHandler(parser, characterData); // Register callback for character data
 
@@ -87,24 +98,26 @@ void ExpatParser::cleanupImpl(void)
 
 void ExpatParser::startElement(void* data, const char* element, const char** attr)
 {
-    XMLHandler* handler = static_cast<XMLHandler*>(data);
-    XMLAttributes attrs;
+    ExpatParseState* state = static_cast<ExpatParseState*>(data);
+    XMLAttributes& attrs = state->d_attributes;
+    attrs.clear();
 
+    // Expat's attribute strings stay valid for the duration of this call
     for(size_t i = 0 ; attr[i] ; i += 2)
-        attrs.add((const encoded_char*)attr[i], (const encoded_char*)attr[i+1]);
+        attrs.addView(attr[i], attr[i+1]);
 
-    handler->elementStart((const encoded_char*)element, attrs);
+    state->d_handler->elementStart((const encoded_char*)element, attrs);
 }
 
 void ExpatParser::endElement(void* data, const char* element)
 {
-    XMLHandler* handler = static_cast<XMLHandler*>(data);
+    XMLHandler* handler = static_cast<ExpatParseState*>(data)->d_handler;
     handler->elementEnd((const encoded_char*)element);
 }
 
 void ExpatParser::characterData(void *data, const char *text, int len)
 {
-    XMLHandler* handler = static_cast<XMLHandler*>(data);
+    XMLHandler* handler = static_cast<ExpatParseState*>(data)->d_handler;
     String str((const encoded_char*)text, static_cast<String::size_type>(len));
     handler->text(str);
 }
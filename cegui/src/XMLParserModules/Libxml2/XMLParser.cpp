@@ -41,18 +41,34 @@
 namespace CEGUI
 {
 // internal helper function to process elements
-void processXMLElement(XMLHandler& handler, xmlNode* node)
+void processXMLElement(XMLHandler& handler, xmlNode* node, XMLAttributes& attrs)
 {
     // build attributes block for the element
-    XMLAttributes attrs;
+    attrs.clear();
 
     xmlAttrPtr currAttr = node->properties;
     while (currAttr)
     {
-        xmlChar* val = xmlGetProp(node, currAttr->name);
-        attrs.add(reinterpret_cast<const encoded_char*>(currAttr->name),
-                  reinterpret_cast<const encoded_char*>(val));
-        xmlFree(val);
+        const xmlNode* const valNode = currAttr->children;
+
+        // a value held in a single text node can be referred to in place
+        if (!valNode)
+        {
+            attrs.addView(reinterpret_cast<const char*>(currAttr->name), "");
+        }
+        else if (!valNode->next && valNode->type == XML_TEXT_NODE)
+        {
+            attrs.addView(reinterpret_cast<const char*>(currAttr->name),
+                          reinterpret_cast<const char*>(valNode->content));
+        }
+        else
+        {
+            xmlChar* val = xmlGetProp(node, currAttr->name);
+            attrs.add(reinterpret_cast<const encoded_char*>(currAttr->name),
+                      reinterpret_cast<const encoded_char*>(val));
+            xmlFree(val);
+        }
+
         currAttr = currAttr->next;
     }
 
@@ -64,7 +80,7 @@ void processXMLElement(XMLHandler& handler, xmlNode* node)
         switch(cur_node->type)
         {
         case XML_ELEMENT_NODE:
-            processXMLElement(handler, cur_node);
+            processXMLElement(handler, cur_node, attrs);
             break;
 
         case XML_TEXT_NODE:
@@ -112,8 +128,11 @@ void LibxmlParser::parseXML(XMLHandler& handler,
     // get root element
     xmlNode* root = xmlDocGetRootElement(doc);
 
+    // attribute block reused for every element of the document
+    XMLAttributes attrs;
+
     // process all elements from root to end of doc
-    processXMLElement(handler, root);
+    processXMLElement(handler, root, attrs);
 
     // release the xmlDoc 
     xmlFreeDoc(doc);
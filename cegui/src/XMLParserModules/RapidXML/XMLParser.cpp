@@ -59,6 +59,8 @@ protected:
 
 private:
     XMLHandler* d_handler;
+    //! attribute block reused for every element of the document.
+    XMLAttributes d_attributes;
 };
 
 //----------------------------------------------------------------------------//
@@ -117,15 +119,16 @@ RapidXMLDocument::RapidXMLDocument(XMLHandler& handler,
 //----------------------------------------------------------------------------//
 void RapidXMLDocument::processElement(const rapidxml::xml_node<>* element)
 {
-    // build attributes block for the element
-    XMLAttributes attrs;
+    // build attributes block for the element.  The document is parsed in
+    // place, so names and values are zero terminated strings in our buffer.
+    XMLAttributes& attrs = d_attributes;
+    attrs.clear();
 
     rapidxml::xml_attribute<>* currAttr = element->first_attribute(0);
 
     while (currAttr)
     {
-        attrs.add(reinterpret_cast<encoded_char*>(currAttr->name()),
-                  reinterpret_cast<encoded_char*>(currAttr->value()));
+        attrs.addView(currAttr->name(), currAttr->value());
         currAttr = currAttr->next_attribute();
     }
 
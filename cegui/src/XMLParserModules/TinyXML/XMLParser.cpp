@@ -58,6 +58,8 @@ namespace CEGUI
 
     private:
         XMLHandler* d_handler;
+        //! attribute block reused for every element of the document.
+        XMLAttributes d_attributes;
     };
 
     TinyXMLDocument::TinyXMLDocument(XMLHandler& handler, const RawDataContainer& source, const String& /*schemaName*/)
@@ -108,13 +110,15 @@ namespace CEGUI
 
     void TinyXMLDocument::processElement(const TiXmlElement* element)
     {
-        // build attributes block for the element
-        XMLAttributes attrs;
+        // build attributes block for the element, referring to the text held
+        // by the document
+        XMLAttributes& attrs = d_attributes;
+        attrs.clear();
 
         const TiXmlAttribute *currAttr = element->FirstAttribute();
         while (currAttr)
         {
-            attrs.add((encoded_char*)currAttr->Name(), (encoded_char*)currAttr->Value());
+            attrs.addView(currAttr->Name(), currAttr->Value());
             currAttr = currAttr->Next();
         }
 
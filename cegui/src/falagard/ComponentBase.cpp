@@ -35,7 +35,8 @@ namespace CEGUI
 {
 //----------------------------------------------------------------------------//
 FalagardComponentBase::FalagardComponentBase() :
-    d_colours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF)
+    d_colours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+    d_colourPropertyID(0)
 {}
 
 //----------------------------------------------------------------------------//
@@ -103,6 +104,7 @@ void FalagardComponentBase::setColours(const ColourRect& cols)
 void FalagardComponentBase::setColoursPropertySource(const String& property)
 {
     d_colourPropertyName = property;
+    d_colourPropertyID = PropertySet::internPropertyName(property);
 }
 
 //----------------------------------------------------------------------------//
@@ -114,8 +116,7 @@ void FalagardComponentBase::initColoursRect(const Window& wnd,
     if (!d_colourPropertyName.empty())
     {
         // if property accesses a ColourRect or a colour
-        cr = PropertyHelper<ColourRect>::fromString(
-            wnd.getProperty(d_colourPropertyName));
+        cr = wnd.getProperty<ColourRect>(d_colourPropertyID);
     }
     // use explicit ColourRect.
     else
@@ -421,7 +421,8 @@ void ImageDim::writeXMLElementAttributes_impl(XMLSerializer& xml_stream) const
 ImagePropertyDim::ImagePropertyDim(const String& property_name,
                                    DimensionType dim) :
     ImageDimBase(dim),
-    d_propertyName(property_name)
+    d_propertyName(property_name),
+    d_propertyID(PropertySet::internPropertyName(property_name))
 {
 }
 
@@ -435,12 +436,21 @@ const String& ImagePropertyDim::getSourceProperty() const
 void ImagePropertyDim::setSourceProperty(const String& property_name)
 {
     d_propertyName = property_name;
+    d_propertyID = PropertySet::internPropertyName(property_name);
 }
 
 //----------------------------------------------------------------------------//
 const Image* ImagePropertyDim::getSourceImage(const Window& wnd) const
 {
-    const String& image_name(wnd.getProperty(d_propertyName));
+    const Property* const property = wnd.getPropertyInstance(d_propertyID);
+
+    if (const TypedProperty<Image*>* const typed_property =
+            dynamic_cast<const TypedProperty<Image*>*>(property))
+        return typed_property->getNative(&wnd);
+
+    // unlike PropertyHelper<Image*>::fromString, this throws for an unknown
+    // image name.
+    const String image_name(property->get(&wnd));
     return image_name.empty() ? 0 : &ImageManager::getSingleton().get(image_name);
 }
 
@@ -750,6 +760,7 @@ bool FontDim::handleFontRenderSizeChange(Window& window,
 PropertyDim::PropertyDim(const String& name, const String& property,
     DimensionType type) :
     d_property(property),
+    d_propertyID(PropertySet::internPropertyName(property)),
     d_childName(name),
     d_type (type)
 {
@@ -777,6 +788,7 @@ const String& PropertyDim::getPropertyName() const
 void PropertyDim::setPropertyName(const String& property)
 {
     d_property = property;
+    d_propertyID = PropertySet::internPropertyName(property);
 }
 
 //----------------------------------------------------------------------------//
@@ -800,15 +812,15 @@ float PropertyDim::getValue(const Window& wnd) const
     if (d_type == DT_INVALID)
     {
         // check property data type and convert to float if necessary
-        Property* pi = sourceWindow.getPropertyInstance(d_property);
+        Property* pi = sourceWindow.getPropertyInstance(d_propertyID);
         if (pi->getDataType() == "bool")
-            return PropertyHelper<bool>::fromString(sourceWindow.getProperty(d_property)) ? 1.0f : 0.0f;
+            return sourceWindow.getProperty<bool>(d_propertyID) ? 1.0f : 0.0f;
 
         // return float property value.
-        return PropertyHelper<float>::fromString(sourceWindow.getProperty(d_property));
+        return sourceWindow.getProperty<float>(d_propertyID);
     }
 
-    const UDim d = PropertyHelper<UDim>::fromString(sourceWindow.getProperty(d_property));
+    const UDim d = sourceWindow.getProperty<UDim>(d_propertyID);
     const Sizef s = sourceWindow.getPixelSize();
 
     switch (d_type)
@@ -1065,7 +1077,8 @@ ComponentArea::ComponentArea() :
     d_left(AbsoluteDim(0.0f), DT_LEFT_EDGE),
     d_top(AbsoluteDim(0.0f), DT_TOP_EDGE),
     d_right_or_width(UnifiedDim(UDim(1.0f, 0.0f), DT_WIDTH), DT_RIGHT_EDGE),
-    d_bottom_or_height(UnifiedDim(UDim(1.0f, 0.0f), DT_HEIGHT), DT_BOTTOM_EDGE)
+    d_bottom_or_height(UnifiedDim(UDim(1.0f, 0.0f), DT_HEIGHT), DT_BOTTOM_EDGE),
+    d_namedSourcePropertyID(0)
 {}
 
 //----------------------------------------------------------------------------//
@@ -1077,7 +1090,7 @@ Rectf ComponentArea::getPixelRect(const Window& wnd) const
     if (isAreaFetchedFromProperty())
     {
         pixelRect = CoordConverter::asAbsolute(
-            PropertyHelper<URect>::fromString(wnd.getProperty(d_namedSource)), wnd.getPixelSize());
+            wnd.getProperty<URect>(d_namedSourcePropertyID), wnd.getPixelSize());
     }
     else if (isAreaFetchedFromNamedArea())
     {
@@ -1122,7 +1135,7 @@ Rectf ComponentArea::getPixelRect(const Window& wnd, const Rectf& container) con
     if (isAreaFetchedFromProperty())
     {
         pixelRect = CoordConverter::asAbsolute(
-            PropertyHelper<URect>::fromString(wnd.getProperty(d_namedSource)), wnd.getPixelSize());
+            wnd.getProperty<URect>(d_namedSourcePropertyID), wnd.getPixelSize());
     }
     else if (isAreaFetchedFromNamedArea())
     {
@@ -1204,6 +1217,7 @@ const String& ComponentArea::getAreaPropertySource() const
 void ComponentArea::setAreaPropertySource(const String& property)
 {
     d_namedSource = property;
+    d_namedSourcePropertyID = PropertySet::internPropertyName(property);
     d_namedAreaSourceLook.clear();
 }
 
@@ -175,8 +175,16 @@ const Image* FrameComponent::getImage(FrameImageComponent part,
     if (d_frameImages[part].d_propertyName.empty())
         return d_frameImages[part].d_image;
 
-    const String& image_name(
-        wnd.getProperty(d_frameImages[part].d_propertyName));
+    const Property* const property =
+        wnd.getPropertyInstance(d_frameImages[part].d_propertyID);
+
+    if (const TypedProperty<Image*>* const typed_property =
+            dynamic_cast<const TypedProperty<Image*>*>(property))
+        return typed_property->getNative(&wnd);
+
+    // unlike PropertyHelper<Image*>::fromString, this throws for an unknown
+    // image name.
+    const String image_name(property->get(&wnd));
 
     if (image_name.empty())
         return 0;
@@ -219,6 +227,7 @@ void FrameComponent::setImagePropertySource(FrameImageComponent part,
     d_frameImages[part].d_image = 0;
     d_frameImages[part].d_specified = !name.empty();
     d_frameImages[part].d_propertyName = name;
+    d_frameImages[part].d_propertyID = PropertySet::internPropertyName(name);
 }
 
 //----------------------------------------------------------------------------//
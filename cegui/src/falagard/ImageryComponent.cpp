@@ -43,7 +43,8 @@ namespace CEGUI
     ImageryComponent::ImageryComponent() :
         d_image(0),
         d_vertFormatting(VF_TOP_ALIGNED),
-        d_horzFormatting(HF_LEFT_ALIGNED)
+        d_horzFormatting(HF_LEFT_ALIGNED),
+        d_imagePropertyID(0)
     {}
 
     const Image* ImageryComponent::getImage() const
@@ -104,7 +105,7 @@ namespace CEGUI
     {
         // get final image to use.
         const Image* img = isImageFetchedFromProperty() ?
-            PropertyHelper<Image*>::fromString(srcWindow.getProperty(d_imagePropertyName)) :
+            srcWindow.getProperty<Image*>(d_imagePropertyID) :
             d_image;
 
         // do not draw anything if image is not set.
@@ -272,6 +273,7 @@ namespace CEGUI
     void ImageryComponent::setImagePropertySource(const String& property)
     {
         d_imagePropertyName = property;
+        d_imagePropertyID = PropertySet::internPropertyName(property);
     }
 
 } // End of  CEGUI namespace section
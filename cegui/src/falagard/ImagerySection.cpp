@@ -34,12 +34,14 @@
 namespace CEGUI
 {
     ImagerySection::ImagerySection() :
-        d_masterColours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF)
+        d_masterColours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+        d_colourPropertyID(0)
     {}
 
     ImagerySection::ImagerySection(const String& name) :
         d_name(name),
-        d_masterColours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF)
+        d_masterColours(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF),
+        d_colourPropertyID(0)
     {}
 
     void ImagerySection::render(Window& srcWindow, const CEGUI::ColourRect* modColours, const Rectf* clipper, bool clipToDisplay) const
@@ -188,6 +190,7 @@ namespace CEGUI
     void ImagerySection::setMasterColoursPropertySource(const String& property)
     {
         d_colourPropertyName = property;
+        d_colourPropertyID = PropertySet::internPropertyName(property);
     }
 
     void ImagerySection::initMasterColourRect(const Window& wnd, ColourRect& cr) const
@@ -196,7 +199,7 @@ namespace CEGUI
         if (!d_colourPropertyName.empty())
         {
             // if property accesses a ColourRect or a colour
-            cr = PropertyHelper<ColourRect>::fromString(wnd.getProperty(d_colourPropertyName));
+            cr = wnd.getProperty<ColourRect>(d_colourPropertyID);
         }
         // use explicit ColourRect.
         else
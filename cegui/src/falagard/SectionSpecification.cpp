@@ -41,7 +41,9 @@ namespace CEGUI
     // Static string holding parent link identifier
     const String S_parentIdentifier("__parent__");
     SectionSpecification::SectionSpecification() :
-        d_usingColourOverride(false)
+        d_usingColourOverride(false),
+        d_colourPropertyID(0),
+        d_renderControlPropertyID(0)
     {}
 
     SectionSpecification::SectionSpecification(const String& owner,
@@ -52,7 +54,9 @@ namespace CEGUI
         d_owner(owner),
         d_sectionName(sectionName),
         d_usingColourOverride(false),
+        d_colourPropertyID(0),
         d_renderControlProperty(controlPropertySource),
+        d_renderControlPropertyID(PropertySet::internPropertyName(controlPropertySource)),
         d_renderControlValue(controlPropertyValue),
         d_renderControlWidget(controlPropertyWidget)
     {}
@@ -67,7 +71,9 @@ namespace CEGUI
         d_sectionName(sectionName),
         d_coloursOverride(cols),
         d_usingColourOverride(true),
+        d_colourPropertyID(0),
         d_renderControlProperty(controlPropertySource),
+        d_renderControlPropertyID(PropertySet::internPropertyName(controlPropertySource)),
         d_renderControlValue(controlPropertyValue),
         d_renderControlWidget(controlPropertyWidget)
     {}
@@ -183,6 +189,7 @@ namespace CEGUI
     void SectionSpecification::setOverrideColoursPropertySource(const String& property)
     {
         d_colourPropertyName = property;
+        d_colourPropertyID = PropertySet::internPropertyName(property);
     }
 
     void SectionSpecification::initColourRectForOverride(const Window& wnd, ColourRect& cr) const
@@ -200,7 +207,7 @@ namespace CEGUI
         else if (!d_colourPropertyName.empty())
         {
             // if property accesses a ColourRect or a colour
-            cr = PropertyHelper<ColourRect>::fromString(wnd.getProperty(d_colourPropertyName));
+            cr = wnd.getProperty<ColourRect>(d_colourPropertyID);
         }
         // override is an explicitly defined ColourRect.
         else
@@ -217,6 +224,7 @@ namespace CEGUI
     void SectionSpecification::setRenderControlPropertySource(const String& property)
     {
         d_renderControlProperty = property;
+        d_renderControlPropertyID = PropertySet::internPropertyName(property);
     }
 
     void SectionSpecification::writeXMLToStream(XMLSerializer& xml_stream) const
@@ -283,11 +291,10 @@ bool SectionSpecification::shouldBeDrawn(const Window& wnd) const
 
     // return whether to draw based on property value.
     if (d_renderControlValue.empty())
-        return PropertyHelper<bool>::fromString(
-            property_source->getProperty(d_renderControlProperty));
+        return property_source->getProperty<bool>(d_renderControlPropertyID);
     else
         return property_source->
-            getProperty(d_renderControlProperty) == d_renderControlValue;
+            getProperty(d_renderControlPropertyID) == d_renderControlValue;
 }
 
 //----------------------------------------------------------------------------//
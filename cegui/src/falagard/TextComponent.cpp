@@ -63,7 +63,9 @@ namespace CEGUI
         d_formattedRenderedString(CEGUI_NEW_AO LeftAlignedRenderedString(d_renderedString)),
         d_lastHorzFormatting(HTF_LEFT_ALIGNED),
         d_vertFormatting(VTF_TOP_ALIGNED),
-        d_horzFormatting(HTF_LEFT_ALIGNED)
+        d_horzFormatting(HTF_LEFT_ALIGNED),
+        d_textPropertyID(0),
+        d_fontPropertyID(0)
     {}
 
     TextComponent::~TextComponent()
@@ -89,7 +91,9 @@ namespace CEGUI
         d_vertFormatting(obj.d_vertFormatting),
         d_horzFormatting(obj.d_horzFormatting),
         d_textPropertyName(obj.d_textPropertyName),
-        d_fontPropertyName(obj.d_fontPropertyName)
+        d_fontPropertyName(obj.d_fontPropertyName),
+        d_textPropertyID(obj.d_textPropertyID),
+        d_fontPropertyID(obj.d_fontPropertyID)
     {
     }
 
@@ -113,6 +117,8 @@ namespace CEGUI
         d_horzFormatting = other.d_horzFormatting;
         d_textPropertyName = other.d_textPropertyName;
         d_fontPropertyName = other.d_fontPropertyName;
+        d_textPropertyID = other.d_textPropertyID;
+        d_fontPropertyID = other.d_fontPropertyID;
 
         return *this;
     }
@@ -249,9 +255,9 @@ namespace CEGUI
             #ifdef CEGUI_BIDI_SUPPORT
                 BidiVisualMapping::StrIndexList l2v, v2l;
                 d_bidiVisualMapping->reorderFromLogicalToVisual(
-                    srcWindow.getProperty(d_textPropertyName), vis, l2v, v2l);
+                    srcWindow.getProperty(d_textPropertyID), vis, l2v, v2l);
             #else
-                vis = srcWindow.getProperty(d_textPropertyName);
+                vis = srcWindow.getProperty(d_textPropertyID);
             #endif
             // parse string using parser from Window.
             d_renderedString =
@@ -310,7 +316,7 @@ namespace CEGUI
         {
             return d_fontPropertyName.empty() ?
                 (d_font.empty() ? window.getFont() : &FontManager::getSingleton().get(d_font))
-                : &FontManager::getSingleton().get(window.getProperty(d_fontPropertyName));
+                : &FontManager::getSingleton().get(window.getProperty(d_fontPropertyID));
         }
         CEGUI_CATCH (UnknownObjectException&)
         {
@@ -375,6 +381,7 @@ namespace CEGUI
     void TextComponent::setTextPropertySource(const String& property)
     {
         d_textPropertyName = property;
+        d_textPropertyID = PropertySet::internPropertyName(property);
     }
 
     bool TextComponent::isFontFetchedFromProperty() const
@@ -390,6 +397,7 @@ namespace CEGUI
     void TextComponent::setFontPropertySource(const String& property)
     {
         d_fontPropertyName = property;
+        d_fontPropertyID = PropertySet::internPropertyName(property);
     }
 
     const String& TextComponent::getTextVisual() const
@@ -436,7 +444,7 @@ namespace CEGUI
 String TextComponent::getEffectiveText(const Window& wnd) const
 {
     if (!d_textPropertyName.empty())
-        return wnd.getProperty(d_textPropertyName);
+        return wnd.getProperty(d_textPropertyID);
     else if (d_textLogical.empty())
         return wnd.getText();
     else
@@ -454,7 +462,7 @@ String TextComponent::getEffectiveVisualText(const Window& wnd) const
         String visual;
         BidiVisualMapping::StrIndexList l2v, v2l;
         d_bidiVisualMapping->reorderFromLogicalToVisual(
-            wnd.getProperty(d_textPropertyName), visual, l2v, v2l);
+            wnd.getProperty(d_textPropertyID), visual, l2v, v2l);
 
         return visual;
     }
@@ -470,7 +478,7 @@ String TextComponent::getEffectiveVisualText(const Window& wnd) const
 String TextComponent::getEffectiveFont(const Window& wnd) const
 {
     if (!d_fontPropertyName.empty())
-        return wnd.getProperty(d_fontPropertyName);
+        return wnd.getProperty(d_fontPropertyID);
     else if (d_font.empty())
     {
         if (const Font* font = wnd.getFont())
@@ -48,7 +48,7 @@
 #include "CEGUI/widgets/ListHeaderSegment.h"
 #include "CEGUI/widgets/MultiColumnList.h"
 
-#include <sstream>
+#include <cstdlib>
 
 // Start of CEGUI namespace section
 namespace CEGUI
@@ -277,11 +277,12 @@ namespace CEGUI
     *************************************************************************/
     argb_t Falagard_xmlHandler::hexStringToARGB(const String& str)
     {
-        argb_t val;
-        std::istringstream s(str.c_str());
-        s >> std::hex >> val;
+        return hexStringToARGB(str.c_str());
+    }
 
-        return val;
+    argb_t Falagard_xmlHandler::hexStringToARGB(const char* str)
+    {
+        return static_cast<argb_t>(std::strtoul(str, 0, 16));
     }
 
     /*************************************************************************
@@ -529,10 +530,10 @@ namespace CEGUI
     void Falagard_xmlHandler::elementColoursStart(const XMLAttributes& attributes)
     {
         ColourRect cols(
-            hexStringToARGB(attributes.getValueAsString(TopLeftAttribute)),
-            hexStringToARGB(attributes.getValueAsString(TopRightAttribute)),
-            hexStringToARGB(attributes.getValueAsString(BottomLeftAttribute)),
-            hexStringToARGB(attributes.getValueAsString(BottomRightAttribute)));
+            hexStringToARGB(attributes.getValueAsUTF8(TopLeftAttribute)),
+            hexStringToARGB(attributes.getValueAsUTF8(TopRightAttribute)),
+            hexStringToARGB(attributes.getValueAsUTF8(BottomLeftAttribute)),
+            hexStringToARGB(attributes.getValueAsUTF8(BottomRightAttribute)));
 
         assignColours(cols);
     }
@@ -1239,7 +1240,7 @@ namespace CEGUI
     *************************************************************************/
     void Falagard_xmlHandler::elementColourStart(const XMLAttributes& attributes)
     {
-        ColourRect cols(hexStringToARGB(attributes.getValueAsString(ColourAttribute)));
+        ColourRect cols(hexStringToARGB(attributes.getValueAsUTF8(ColourAttribute)));
         assignColours(cols);
     }
 
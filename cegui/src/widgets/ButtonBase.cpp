@@ -53,6 +53,18 @@ ButtonBase::~ButtonBase(void)
 }
 
 
+/*************************************************************************
+	Prepare a destroyed button for being reused
+*************************************************************************/
+void ButtonBase::resetForReuse()
+{
+	Window::resetForReuse();
+
+	d_pushed = false;
+	d_hovering = false;
+}
+
+
 /*************************************************************************
 	Update the internal state of the Widget
 *************************************************************************/
@@ -48,6 +48,22 @@ DefaultWindow::DefaultWindow(const String& type, const String& name) :
     setSize(sz);
 }
 
+//----------------------------------------------------------------------------//
+void DefaultWindow::resetForReuse()
+{
+    Window::resetForReuse();
+
+    USize sz(cegui_reldim(1.0f), cegui_reldim(1.0f));
+    setMaxSize(sz);
+    setSize(sz);
+}
+
+//----------------------------------------------------------------------------//
+bool DefaultWindow::isReusable() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void DefaultWindow::onMouseMove(MouseEventArgs& e)
 {
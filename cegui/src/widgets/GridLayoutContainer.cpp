@@ -39,8 +39,6 @@ namespace CEGUI
 *************************************************************************/
 // type name for this widget
 const String GridLayoutContainer::WidgetTypeName("GridLayoutContainer");
-// name for dummies, a number is added to the end of that
-const String GridLayoutContainer::DummyName("__auto_dummy_");
 
 const String GridLayoutContainer::EventNamespace("GridLayoutContainer");
 
@@ -62,11 +60,9 @@ GridLayoutContainer::GridLayoutContainer(const String& type,
     d_nextGridX(std::numeric_limits<size_t>::max()),
     d_nextGridY(std::numeric_limits<size_t>::max()),
 
-    d_nextDummyIdx(0)
+    d_cellSizesValid(false),
+    d_cellSizesContentSize(0, 0)
 {
-    // grid size is 0x0 that means 0 child windows,
-    // no need to populate d_children with dummies
-
     addGridLayoutContainerProperties();
 }
 
@@ -77,73 +73,33 @@ GridLayoutContainer::~GridLayoutContainer(void)
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::setGridDimensions(size_t width, size_t height)
 {
-    // copy the old children list
-    ChildList oldChildren = d_children;
-
-    // remove all child windows
-    while (getChildCount() != 0)
-    {
-        Window* wnd = static_cast<Window*>(d_children[0]);
-        removeChild(wnd);
-    }
+    // children whose cells are still inside the grid simply stay where they
+    // are, only the ones that no longer fit have to go.
+    std::vector<Window*> outside;
 
-    // we simply fill the grid with dummies to ensure everything works smoothly
-    // when something is added to the grid, it simply replaces the dummy
-    for (size_t i = 0; i < width * height; ++i)
+    for (CellMap::const_iterator i = d_cells.begin(); i != d_cells.end(); ++i)
     {
-        Window* dummy = createDummy();
-        addChild(dummy);
+        if (i->first.first >= height || i->first.second >= width)
+            outside.push_back(i->second);
     }
 
-    const size_t oldWidth = d_gridWidth;
-
-    const size_t oldHeight = d_gridHeight;
-
-    const AutoPositioning oldAO = d_autoPositioning;
-
     d_gridWidth = width;
-
     d_gridHeight = height;
 
-    // now we have to map oldChildren to new children
-    for (size_t y = 0; y < height; ++y)
+    for (size_t i = 0; i < outside.size(); ++i)
     {
-        for (size_t x = 0; x < width; ++x)
-        {
-            // we have to skip if we are out of the old grid
-            if (x >= oldWidth || y >= oldHeight)
-                continue;
-
-            const size_t oldIdx = mapFromGridToIdx(x, y, oldWidth, oldHeight);
-            Window* previous = static_cast<Window*>(oldChildren[oldIdx]);
-
-            if (isDummy(previous))
-            {
-                WindowManager::getSingleton().destroyWindow(previous);
-            }
-            else
-            {
-                addChildToPosition(previous, x, y);
-            }
+        removeChild(outside[i]);
 
-            oldChildren[oldIdx] = 0;
-        }
+        if (outside[i]->isDestroyedByParent())
+            WindowManager::getSingleton().destroyWindow(outside[i]);
     }
 
-    setAutoPositioning(oldAO);
     // oldAOIdx could mean something completely different now!
     // todo: perhaps convert oldAOOdx to new AOIdx?
     setNextAutoPositioningIdx(0);
 
-    // we have to destroy windows that don't fit the new grid if they are set
-    // to be destroyed by parent
-    for (size_t i = 0; i < oldChildren.size(); ++i)
-    {
-        if (oldChildren[i] && static_cast<Window*>(oldChildren[i])->isDestroyedByParent())
-        {
-            WindowManager::getSingleton().destroyWindow(static_cast<Window*>(oldChildren[i]));
-        }
-    }
+    d_cellSizesValid = false;
+    markNeedsLayouting();
 }
 
 //----------------------------------------------------------------------------//
@@ -221,23 +177,33 @@ Window* GridLayoutContainer::getChildAtPosition(size_t gridX,
     assert(gridX < d_gridWidth && "out of bounds");
     assert(gridY < d_gridHeight && "out of bounds");
 
-    return getChildAtIdx(mapFromGridToIdx(gridX, gridY,
-                                          d_gridWidth, d_gridHeight));
+    const CellMap::const_iterator i = d_cells.find(CellKey(gridY, gridX));
+
+    return i != d_cells.end() ? i->second : 0;
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::removeChildFromPosition(size_t gridX,
                                                   size_t gridY)
 {
-    removeChild(getChildAtPosition(gridX, gridY));
+    Window* const wnd = getChildAtPosition(gridX, gridY);
+
+    if (wnd)
+        removeChild(wnd);
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::swapChildPositions(size_t wnd1, size_t wnd2)
 {
-    if (wnd1 < d_children.size() && wnd2 < d_children.size())
+    const size_t cellCount = d_gridWidth * d_gridHeight;
+
+    if (wnd1 < cellCount && wnd2 < cellCount)
     {
-        std::swap(d_children[wnd1], d_children[wnd2]);
+        size_t gridX1, gridY1, gridX2, gridY2;
+        mapFromIdxToGrid(wnd1, gridX1, gridY1, d_gridWidth, d_gridHeight);
+        mapFromIdxToGrid(wnd2, gridX2, gridY2, d_gridWidth, d_gridHeight);
+
+        swapCells(CellKey(gridY1, gridX1), CellKey(gridY2, gridX2));
 
         WindowEventArgs args(this);
         onChildOrderChanged(args);
@@ -256,8 +222,19 @@ void GridLayoutContainer::swapChildPositions(size_t gridX1, size_t gridY1,
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::swapChildren(Window* wnd1, Window* wnd2)
 {
-    swapChildPositions(getIdxOfChild(wnd1),
-                       getIdxOfChild(wnd2));
+    const ChildCellMap::const_iterator cell1 = d_childCells.find(wnd1);
+    const ChildCellMap::const_iterator cell2 = d_childCells.find(wnd2);
+
+    if (cell1 != d_childCells.end() && cell2 != d_childCells.end())
+    {
+        // copies, since swapCells updates the entries these refer to
+        const CellKey key1(cell1->second);
+        const CellKey key2(cell2->second);
+        swapCells(key1, key2);
+
+        WindowEventArgs args(this);
+        onChildOrderChanged(args);
+    }
 }
 
 //----------------------------------------------------------------------------//
@@ -290,63 +267,41 @@ void GridLayoutContainer::moveChildToPosition(const String& wnd,
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::layout()
 {
-    std::vector<UDim> colSizes(d_gridWidth, UDim(0, 0));
-    std::vector<UDim> rowSizes(d_gridHeight, UDim(0, 0));
-
     // used to compare UDims
-    const float absWidth = getChildContentArea().get().getWidth();
-    const float absHeight = getChildContentArea().get().getHeight();
+    const Sizef contentSize(getChildContentArea().get().getSize());
 
-    // first, we need to determine rowSizes and colSizes, this is needed before
-    // any layouting work takes place
-    for (size_t y = 0; y < d_gridHeight; ++y)
-    {
-        for (size_t x = 0; x < d_gridWidth; ++x)
-        {
-            // x and y is the position of window in the grid
-            const size_t childIdx =
-                mapFromGridToIdx(x, y, d_gridWidth, d_gridHeight);
+    // first, we need to determine row and column sizes, this is needed before
+    // any layouting work takes place.  They are only recalculated when
+    // something that affects them has changed.
+    if (!d_cellSizesValid || contentSize != d_cellSizesContentSize)
+        updateCellSizes(contentSize);
 
-            Window* window = getChildAtIdx(childIdx);
-            const UVector2 size = getBoundingSizeForWindow(window);
+    // OK, now in d_rowSizes[y] is the height of y-th row
+    //         in d_colSizes[x] is the width of x-th column
 
-            if (CoordConverter::asAbsolute(colSizes[x], absWidth) <
-                CoordConverter::asAbsolute(size.d_x, absWidth))
-            {
-                colSizes[x] = size.d_x;
-            }
+    // accumulate the offsets of all columns and rows once, rather than once
+    // for every cell
+    std::vector<UDim> colOffsets(d_gridWidth, UDim(0, 0));
+    std::vector<UDim> rowOffsets(d_gridHeight, UDim(0, 0));
 
-            if (CoordConverter::asAbsolute(rowSizes[y], absHeight) <
-                CoordConverter::asAbsolute(size.d_y, absHeight))
-            {
-                rowSizes[y] = size.d_y;
-            }
-        }
-    }
+    for (size_t x = 1; x < d_gridWidth; ++x)
+        colOffsets[x] = colOffsets[x - 1] + d_colSizes[x - 1];
 
-    // OK, now in rowSizes[y] is the height of y-th row
-    //         in colSizes[x] is the width of x-th column
+    for (size_t y = 1; y < d_gridHeight; ++y)
+        rowOffsets[y] = rowOffsets[y - 1] + d_rowSizes[y - 1];
 
-    // second layouting phase starts now
-    for (size_t y = 0; y < d_gridHeight; ++y)
+    // second layouting phase starts now, empty cells have nothing to position
+    for (CellMap::const_iterator i = d_cells.begin(); i != d_cells.end(); ++i)
     {
-        for (size_t x = 0; x < d_gridWidth; ++x)
-        {
-            // x and y is the position of window in the grid
-            const size_t childIdx = mapFromGridToIdx(x, y,
-                                                     d_gridWidth, d_gridHeight);
-            Window* window = getChildAtIdx(childIdx);
-            const UVector2 offset = getOffsetForWindow(window);
-            const UVector2 gridCellOffset = getGridCellOffset(colSizes,
-                                                              rowSizes,
-                                                              x, y);
-
-            window->setPosition(gridCellOffset + offset);
-        }
+        Window* const window = i->second;
+        const UVector2 gridCellOffset(colOffsets[i->first.second],
+                                      rowOffsets[i->first.first]);
+
+        window->setPosition(gridCellOffset + getOffsetForWindow(window));
     }
 
     // now we just need to determine the total width and height and set it
-    setSize(getGridSize(colSizes, rowSizes));
+    setSize(getGridSize(d_colSizes, d_rowSizes));
 }
 
 //----------------------------------------------------------------------------//
@@ -357,6 +312,68 @@ void GridLayoutContainer::onChildOrderChanged(WindowEventArgs& e)
     fireEvent(EventChildOrderChanged, e, EventNamespace);
 }
 
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::swapCells(const CellKey& cell1, const CellKey& cell2)
+{
+    const CellMap::iterator i1 = d_cells.find(cell1);
+    const CellMap::iterator i2 = d_cells.find(cell2);
+
+    Window* const wnd1 = i1 != d_cells.end() ? i1->second : 0;
+    Window* const wnd2 = i2 != d_cells.end() ? i2->second : 0;
+
+    if (wnd1)
+        d_cells.erase(i1);
+
+    if (wnd2)
+        d_cells.erase(i2);
+
+    if (wnd1)
+    {
+        d_cells[cell2] = wnd1;
+        d_childCells[wnd1] = cell2;
+    }
+
+    if (wnd2)
+    {
+        d_cells[cell1] = wnd2;
+        d_childCells[wnd2] = cell1;
+    }
+
+    d_cellSizesValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::updateCellSizes(const Sizef& contentSize)
+{
+    d_colSizes.assign(d_gridWidth, UDim(0, 0));
+    d_rowSizes.assign(d_gridHeight, UDim(0, 0));
+
+    for (CellMap::const_iterator i = d_cells.begin(); i != d_cells.end(); ++i)
+        growCellSizes(i->first.second, i->first.first,
+                      getBoundingSizeForWindow(i->second), contentSize);
+
+    d_cellSizesContentSize = contentSize;
+    d_cellSizesValid = true;
+}
+
+//----------------------------------------------------------------------------//
+void GridLayoutContainer::growCellSizes(size_t gridX, size_t gridY,
+                                        const UVector2& size,
+                                        const Sizef& contentSize)
+{
+    if (CoordConverter::asAbsolute(d_colSizes[gridX], contentSize.d_width) <
+        CoordConverter::asAbsolute(size.d_x, contentSize.d_width))
+    {
+        d_colSizes[gridX] = size.d_x;
+    }
+
+    if (CoordConverter::asAbsolute(d_rowSizes[gridY], contentSize.d_height) <
+        CoordConverter::asAbsolute(size.d_y, contentSize.d_height))
+    {
+        d_rowSizes[gridY] = size.d_y;
+    }
+}
+
 //----------------------------------------------------------------------------//
 size_t GridLayoutContainer::mapFromGridToIdx(size_t gridX,
                                              size_t gridY,
@@ -490,31 +507,6 @@ size_t GridLayoutContainer::translateAPToGridIdx(size_t APIdx) const
     return APIdx;
 }
 
-//----------------------------------------------------------------------------//
-Window* GridLayoutContainer::createDummy()
-{
-    char i_buff[32];
-    sprintf(i_buff, "%lu", d_nextDummyIdx);
-    ++d_nextDummyIdx;
-
-    Window* dummy = WindowManager::getSingleton().createWindow("DefaultWindow",
-                    DummyName + String(i_buff));
-
-    dummy->setAutoWindow(true);
-    dummy->setVisible(false);
-    dummy->setSize(USize(UDim(0, 0), UDim(0, 0)));
-    dummy->setDestroyedByParent(true);
-
-    return dummy;
-}
-
-//----------------------------------------------------------------------------//
-bool GridLayoutContainer::isDummy(Window* wnd) const
-{
-    // all auto windows inside grid are dummies
-    return wnd->isAutoWindow();
-}
-
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::addChild_impl(Element* element)
 {
@@ -526,77 +518,109 @@ void GridLayoutContainer::addChild_impl(Element* element)
             "GridLayoutContainer can only have Elements of type Window added "
             "as children (Window path: " + getNamePath() + ")."));
     }
-    
-    if (isDummy(wnd))
+
+    // work out the cell the child goes to before anything is changed
+    size_t gridX, gridY;
+
+    if (d_autoPositioning == AP_Disabled)
     {
-        LayoutContainer::addChild_impl(wnd);
+        if ((d_nextGridX == std::numeric_limits<size_t>::max()) &&
+            (d_nextGridY == std::numeric_limits<size_t>::max()))
+        {
+            CEGUI_THROW(InvalidRequestException(
+                "Unable to add child without explicit grid position "
+                "because auto positioning is disabled.  Consider using the "
+                "GridLayoutContainer::addChildToPosition functions."));
+        }
+
+        gridX = d_nextGridX;
+        gridY = d_nextGridY;
+
+        // reset location to sentinel values.
+        d_nextGridX = d_nextGridY = std::numeric_limits<size_t>::max();
     }
     else
     {
-        LayoutContainer::addChild_impl(wnd);
+        if (d_nextAutoPositioningIdx >= d_gridWidth * d_gridHeight)
+        {
+            CEGUI_THROW(InvalidRequestException(
+                "Unable to add child because the auto positioning sequence "
+                "is past the last cell of the grid (Window path: " +
+                getNamePath() + ")."));
+        }
 
-        // OK, wnd is already in d_children
+        mapFromIdxToGrid(translateAPToGridIdx(d_nextAutoPositioningIdx),
+                         gridX, gridY, d_gridWidth, d_gridHeight);
+        ++d_nextAutoPositioningIdx;
+    }
 
-        // idx is the future index of the child that's being added
-        size_t idx;
+    if (gridX >= d_gridWidth || gridY >= d_gridHeight)
+    {
+        CEGUI_THROW(InvalidRequestException(
+            "Unable to add child at a position outside of the grid "
+            "(Window path: " + getNamePath() + ")."));
+    }
 
-        if (d_autoPositioning == AP_Disabled)
-        {
-            if ((d_nextGridX == std::numeric_limits<size_t>::max()) &&
-                (d_nextGridY == std::numeric_limits<size_t>::max()))
-            {
-                CEGUI_THROW(InvalidRequestException(
-                    "Unable to add child without explicit grid position "
-                    "because auto positioning is disabled.  Consider using the "
-                    "GridLayoutContainer::addChildToPosition functions."));
-            }
+    const CellKey cell(gridY, gridX);
 
-            idx = mapFromGridToIdx(d_nextGridX, d_nextGridY,
-                                   d_gridWidth, d_gridHeight);
+    // whatever is in the cell already gets replaced by the added child
+    const CellMap::iterator occupant = d_cells.find(cell);
 
-            // reset location to sentinel values.
-            d_nextGridX = d_nextGridY = std::numeric_limits<size_t>::max();
-        }
-        else
+    if (occupant != d_cells.end() && occupant->second != wnd)
+    {
+        Window* const previous = occupant->second;
+        removeChild(previous);
+
+        if (previous->isDestroyedByParent())
         {
-            idx = translateAPToGridIdx(d_nextAutoPositioningIdx);
-            ++d_nextAutoPositioningIdx;
+            WindowManager::getSingleton().destroyWindow(previous);
         }
+    }
 
-        // we swap the dummy and the added child
-        // this essentially places the added child to it's right position and
-        // puts the dummy at the end of d_children it will soon get removed from
-        std::swap(d_children[idx], d_children[d_children.size() - 1]);
+    LayoutContainer::addChild_impl(wnd);
 
-        Window* toBeRemoved = static_cast<Window*>(d_children[d_children.size() - 1]);
-        removeChild(toBeRemoved);
+    d_cells[cell] = wnd;
+    d_childCells[wnd] = cell;
 
-        if (toBeRemoved->isDestroyedByParent())
-        {
-            WindowManager::getSingleton().destroyWindow(toBeRemoved);
-        }
-    }
+    // a new child can only make its row and column bigger
+    if (d_cellSizesValid)
+        growCellSizes(gridX, gridY, getBoundingSizeForWindow(wnd),
+                      d_cellSizesContentSize);
 }
 
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::removeChild_impl(Element* element)
 {
     Window* wnd = static_cast<Window*>(element);
-    
-    if (!isDummy(wnd) && !WindowManager::getSingleton().isLocked())
-    {
-        // before we remove the child, we must add new dummy and place it
-        // instead of the removed child
-        Window* dummy = createDummy();
-        addChild(dummy);
 
-        const size_t i = getIdxOfChild(wnd);
-        std::swap(d_children[i], d_children[d_children.size() - 1]);
+    const ChildCellMap::iterator cell = d_childCells.find(wnd);
+
+    if (cell != d_childCells.end())
+    {
+        d_cells.erase(cell->second);
+        d_childCells.erase(cell);
+        d_cellSizesValid = false;
     }
 
     LayoutContainer::removeChild_impl(wnd);
 }
 
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::handleChildSized(const EventArgs& e)
+{
+    d_cellSizesValid = false;
+
+    return LayoutContainer::handleChildSized(e);
+}
+
+//----------------------------------------------------------------------------//
+bool GridLayoutContainer::handleChildMarginChanged(const EventArgs& e)
+{
+    d_cellSizesValid = false;
+
+    return LayoutContainer::handleChildMarginChanged(e);
+}
+
 //----------------------------------------------------------------------------//
 void GridLayoutContainer::addGridLayoutContainerProperties(void)
 {
@@ -50,6 +50,12 @@ HorizontalLayoutContainer::HorizontalLayoutContainer(const String& type,
 HorizontalLayoutContainer::~HorizontalLayoutContainer(void)
 {}
 
+//----------------------------------------------------------------------------//
+bool HorizontalLayoutContainer::isReusable() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void HorizontalLayoutContainer::layout()
 {
@@ -55,6 +55,27 @@ LayoutCell::LayoutCell(const String& type, const String& name):
                    Event::Subscriber(&LayoutCell::handleChildRemoved, this));
 }
 
+//----------------------------------------------------------------------------//
+void LayoutCell::resetForReuse()
+{
+    Window::resetForReuse();
+
+    d_clientChildContentArea.invalidateCache();
+    setSize(USize(cegui_reldim(1), cegui_reldim(1)));
+
+    // the base class dropped our own subscriptions too
+    subscribeEvent(Window::EventChildAdded,
+                   Event::Subscriber(&LayoutCell::handleChildAdded, this));
+    subscribeEvent(Window::EventChildRemoved,
+                   Event::Subscriber(&LayoutCell::handleChildRemoved, this));
+}
+
+//----------------------------------------------------------------------------//
+bool LayoutCell::isReusable() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 LayoutCell::~LayoutCell(void)
 {}
@@ -56,6 +56,22 @@ LayoutContainer::LayoutContainer(const String& type, const String& name):
                    Event::Subscriber(&LayoutContainer::handleChildRemoved, this));
 }
 
+//----------------------------------------------------------------------------//
+void LayoutContainer::resetForReuse()
+{
+    Window::resetForReuse();
+
+    d_needsLayouting = false;
+    d_clientChildContentArea.invalidateCache();
+    setSize(USize(cegui_reldim(1), cegui_reldim(1)));
+
+    // the base class dropped our own subscriptions too
+    subscribeEvent(Window::EventChildAdded,
+                   Event::Subscriber(&LayoutContainer::handleChildAdded, this));
+    subscribeEvent(Window::EventChildRemoved,
+                   Event::Subscriber(&LayoutContainer::handleChildRemoved, this));
+}
+
 //----------------------------------------------------------------------------//
 LayoutContainer::~LayoutContainer(void)
 {}
@@ -77,7 +77,11 @@ Listbox::Listbox(const String& type, const String& name)
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_itemTooltips(false),
-	d_lastSelected(0)
+	d_lastSelected(0),
+	d_itemOffsets(1, 0.0f),
+	d_validItemOffsets(1),
+	d_widestItemWidth(0.0f),
+	d_widestItemWidthValid(true)
 {
 	addListboxProperties();
 }
@@ -286,12 +290,16 @@ void Listbox::addItem(ListboxItem* item)
 		// if sorting is enabled, re-sort the list
 		if (isSortEnabled())
 		{
-			d_listItems.insert(std::upper_bound(d_listItems.begin(), d_listItems.end(), item, &lbi_less), item);
+			LBItemList::iterator ins_pos =
+                std::upper_bound(d_listItems.begin(), d_listItems.end(), item, &lbi_less);
+            insertItemMetrics(std::distance(d_listItems.begin(), ins_pos));
+			d_listItems.insert(ins_pos, item);
 
 		}
 		// not sorted, just stick it on the end.
 		else
 		{
+            insertItemMetrics(d_listItems.size());
 			d_listItems.push_back(item);
 		}
 
@@ -338,6 +346,7 @@ void Listbox::insertItem(ListboxItem* item, const ListboxItem* position)
 
 		}
 
+        insertItemMetrics(std::distance(d_listItems.begin(), ins_pos));
 		d_listItems.insert(ins_pos, item);
 
 		WindowEventArgs args(this);
@@ -363,6 +372,7 @@ void Listbox::removeItem(const ListboxItem* item)
 			(*pos)->setOwnerWindow(0);
 
 			// remove item
+            eraseItemMetrics(std::distance(d_listItems.begin(), pos));
 			d_listItems.erase(pos);
 
 			// if item was the last selected item, reset that to NULL
@@ -556,10 +566,28 @@ void Listbox::handleUpdatedItemData(void)
     if (d_sorted)
         resortList();
 
+    invalidateItemMetrics();
 	configureScrollbars();
 	invalidate();
 }
 
+//----------------------------------------------------------------------------//
+void Listbox::handleUpdatedItemData(size_t item_index)
+{
+    if (item_index >= d_listItems.size())
+        CEGUI_THROW(InvalidRequestException(
+            "the value passed in the 'item_index' parameter is out of range for this Listbox."));
+
+    // a change may have moved the item; resorting re-measures everything.
+    if (d_sorted)
+        resortList();
+    else
+        invalidateItemMetrics(item_index);
+
+    configureScrollbars();
+    invalidate();
+}
+
 
 /*************************************************************************
 	display required integrated scroll bars according to current state
@@ -680,14 +708,8 @@ void Listbox::selectRange(size_t start, size_t end)
 *************************************************************************/
 float Listbox::getTotalItemsHeight(void) const
 {
-	float height = 0;
-
-	for (size_t i = 0; i < getItemCount(); ++i)
-	{
-		height += d_listItems[i]->getPixelSize().d_height;
-	}
-
-	return height;
+    updateItemMetrics();
+    return d_itemOffsets.back();
 }
 
 
@@ -696,20 +718,103 @@ float Listbox::getTotalItemsHeight(void) const
 *************************************************************************/
 float Listbox::getWidestItemWidth(void) const
 {
-	float widest = 0;
+    updateItemMetrics();
 
-	for (size_t i = 0; i < getItemCount(); ++i)
-	{
-		float thisWidth = d_listItems[i]->getPixelSize().d_width;
+    if (!d_widestItemWidthValid)
+    {
+        d_widestItemWidth = 0.0f;
 
-		if (thisWidth > widest)
-		{
-			widest = thisWidth;
-		}
+        for (size_t i = 0; i < d_itemSizes.size(); ++i)
+            d_widestItemWidth = ceguimax(d_widestItemWidth, d_itemSizes[i].d_width);
 
-	}
+        d_widestItemWidthValid = true;
+    }
+
+	return d_widestItemWidth;
+}
+
+//----------------------------------------------------------------------------//
+float Listbox::getItemOffset(size_t item_index) const
+{
+    updateItemMetrics();
+    return d_itemOffsets[ceguimin(item_index, d_listItems.size())];
+}
+
+//----------------------------------------------------------------------------//
+size_t Listbox::getItemIndexAtOffset(float offset) const
+{
+    updateItemMetrics();
 
-	return widest;
+    // first offset beyond the one requested is just past the item we want.
+    const ItemOffsetList::const_iterator pos =
+        std::upper_bound(d_itemOffsets.begin(), d_itemOffsets.end(), offset);
+
+    return (pos == d_itemOffsets.begin()) ?
+        0 : static_cast<size_t>(pos - d_itemOffsets.begin()) - 1;
+}
+
+//----------------------------------------------------------------------------//
+void Listbox::updateItemMetrics() const
+{
+    const size_t itemCount = d_listItems.size();
+
+    if ((d_validItemOffsets == itemCount + 1) &&
+        (d_itemOffsets.size() == itemCount + 1))
+        return;
+
+    d_itemOffsets.resize(itemCount + 1);
+
+    // sizes before the first stale offset are known to be valid.
+    for (size_t i = d_validItemOffsets - 1; i < itemCount; ++i)
+    {
+        if (d_itemSizes[i].d_width < 0.0f)
+        {
+            d_itemSizes[i] = d_listItems[i]->getPixelSize();
+
+            if (d_widestItemWidthValid)
+                d_widestItemWidth = ceguimax(d_widestItemWidth, d_itemSizes[i].d_width);
+        }
+
+        d_itemOffsets[i + 1] = d_itemOffsets[i] + d_itemSizes[i].d_height;
+    }
+
+    d_validItemOffsets = itemCount + 1;
+}
+
+//----------------------------------------------------------------------------//
+void Listbox::invalidateItemMetrics()
+{
+    d_itemSizes.assign(d_listItems.size(), Sizef(-1.0f, 0.0f));
+    d_validItemOffsets = 1;
+    d_widestItemWidthValid = false;
+}
+
+//----------------------------------------------------------------------------//
+void Listbox::invalidateItemMetrics(size_t item_index)
+{
+    // the item may have been the widest, and no longer be.
+    if (d_itemSizes[item_index].d_width >= d_widestItemWidth)
+        d_widestItemWidthValid = false;
+
+    d_itemSizes[item_index].d_width = -1.0f;
+    d_validItemOffsets = ceguimin(d_validItemOffsets, item_index + 1);
+}
+
+//----------------------------------------------------------------------------//
+void Listbox::insertItemMetrics(size_t item_index)
+{
+    d_itemSizes.insert(d_itemSizes.begin() + item_index, Sizef(-1.0f, 0.0f));
+    d_validItemOffsets = ceguimin(d_validItemOffsets, item_index + 1);
+}
+
+//----------------------------------------------------------------------------//
+void Listbox::eraseItemMetrics(size_t item_index)
+{
+    if (d_itemSizes[item_index].d_width >= d_widestItemWidth)
+        d_widestItemWidthValid = false;
+
+    d_itemSizes.erase(d_itemSizes.begin() + item_index);
+    d_validItemOffsets = ceguimin(d_validItemOffsets, item_index + 1);
 }
 
 
@@ -746,21 +851,15 @@ ListboxItem* Listbox::getItemAtPoint(const Vector2f& pt) const
 	// point must be within the rendering area of the Listbox.
 	if (renderArea.isPointInRect(local_pos))
 	{
-		float y = renderArea.d_min.d_x - getVertScrollbar()->getScrollPosition();
+		const float y = renderArea.d_min.d_y - getVertScrollbar()->getScrollPosition();
 
 		// test if point is above first item
 		if (local_pos.d_y >= y)
 		{
-			for (size_t i = 0; i < getItemCount(); ++i)
-			{
-				y += d_listItems[i]->getPixelSize().d_height;
-
-				if (local_pos.d_y < y)
-				{
-					return d_listItems[i];
-				}
+            const size_t index = getItemIndexAtOffset(local_pos.d_y - y);
 
-			}
+            if (index < getItemCount())
+                return d_listItems[index];
 		}
 	}
 
@@ -845,6 +944,40 @@ void Listbox::onSized(ElementEventArgs& e)
 }
 
 
+//----------------------------------------------------------------------------//
+void Listbox::onFontChanged(WindowEventArgs& e)
+{
+    Window::onFontChanged(e);
+
+    // item sizes usually depend upon the Listbox font.
+    invalidateItemMetrics();
+    configureScrollbars();
+}
+
+//----------------------------------------------------------------------------//
+bool Listbox::handleFontRenderSizeChange(const EventArgs& args)
+{
+    bool res = Window::handleFontRenderSizeChange(args);
+
+    const Font* const font = static_cast<const FontEventArgs&>(args).font;
+
+    for (size_t i = 0; !res && i < getItemCount(); ++i)
+        res = d_listItems[i]->handleFontRenderSizeChange(font);
+
+    if (res)
+    {
+        invalidateItemMetrics();
+
+        // windows pending deletion have already lost their scrollbars.
+        if (!d_destructionStarted)
+            configureScrollbars();
+
+        invalidate();
+    }
+
+    return res;
+}
+
 /*************************************************************************
 	Handler for when mouse button is pressed
 *************************************************************************/
@@ -973,19 +1106,11 @@ void Listbox::ensureItemIsVisible(size_t item_index)
 	}
 	else
 	{
-		float bottom;
 		float listHeight = getListRenderArea().getHeight();
-		float top = 0;
-
-		// get height to top of item
-		size_t i;
-		for (i = 0; i < item_index; ++i)
-		{
-			top += d_listItems[i]->getPixelSize().d_height;
-		}
 
-		// calculate height to bottom of item
-		bottom = top + d_listItems[i]->getPixelSize().d_height;
+		// get height to top and bottom of item
+		float top = getItemOffset(item_index);
+		float bottom = getItemOffset(item_index + 1);
 
 		// account for current scrollbar value
 		float currPos = vertScrollbar->getScrollPosition();
@@ -1098,6 +1223,7 @@ bool Listbox::resetList_impl(void)
 
 		// clear out the list.
 		d_listItems.clear();
+        invalidateItemMetrics();
 
 		d_lastSelected = 0;
 
@@ -1163,6 +1289,7 @@ bool Listbox::validateWindowRenderer(const WindowRenderer* renderer) const
 void Listbox::resortList()
 {
     std::sort(d_listItems.begin(), d_listItems.end(), &lbi_less);
+    invalidateItemMetrics();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -40,9 +40,38 @@
 #include <algorithm>
 
 
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
+//----------------------------------------------------------------------------//
+// Predicate ordering data source rows on the sort column.
+namespace
+{
+class SourceRowLess
+{
+public:
+    SourceRowLess(const MultiColumnListDataSource& source, uint col_id,
+                  bool descending) :
+        d_source(source),
+        d_colID(col_id),
+        d_descending(descending)
+    {}
+
+    bool operator()(uint lhs, uint rhs) const
+    {
+        return d_descending ? d_source.isRowLess(rhs, lhs, d_colID) :
+                              d_source.isRowLess(lhs, rhs, d_colID);
+    }
+
+private:
+    const MultiColumnListDataSource& d_source;
+    uint d_colID;
+    bool d_descending;
+};
+}
+
+//----------------------------------------------------------------------------//
 const String MultiColumnList::EventNamespace("MultiColumnList");
 const String MultiColumnList::WidgetTypeName("CEGUI/MultiColumnList");
 
@@ -88,7 +117,11 @@ MultiColumnList::MultiColumnList(const String& type, const String& name) :
 	d_nominatedSelectRow(0),
 	d_lastSelected(0),
     d_columnCount(0),
-    d_autoSizeColumnUsesHeader(false)
+    d_autoSizeColumnUsesHeader(false),
+    d_dataSource(0),
+    d_updateDepth(0),
+    d_updateContentsChanged(false),
+    d_updateNeedsSort(false)
 {
 	// add properties
 	addMultiColumnListProperties();
@@ -151,7 +184,7 @@ uint MultiColumnList::getColumnCount(void) const
 *************************************************************************/
 uint MultiColumnList::getRowCount(void) const
 {
-	return (uint)d_grid.size();
+	return d_dataSource ? (uint)d_sourceRows.size() : (uint)d_grid.size();
 }
 
 
@@ -239,14 +272,18 @@ ListHeaderSegment& MultiColumnList::getHeaderSegmentForColumn(uint col_idx) cons
 *************************************************************************/
 uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		if (isListboxItemInRow(item, i))
-		{
-			return i;
-		}
-
-	}
+    if (!d_dataSource)
+    {
+        ItemRowMap::const_iterator pos = d_itemRows.find(item);
+        if (item && pos != d_itemRows.end())
+            return pos->second;
+    }
+    else
+    {
+        MCLGridRef grid_ref(0, 0);
+        if (item && findSourceItem(item, grid_ref))
+            return grid_ref.row;
+    }
 
 	// item is not attached to the list box, throw...
 	CEGUI_THROW(InvalidRequestException(
@@ -259,9 +296,16 @@ uint MultiColumnList::getItemRowIndex(const ListboxItem* item) const
 *************************************************************************/
 uint MultiColumnList::getItemColumnIndex(const ListboxItem* item) const
 {
+    MCLGridRef grid_ref(0, 0);
+    if (d_dataSource && item && findSourceItem(item, grid_ref))
+        return grid_ref.column;
+
+	// NB: throws InvalidRequestException if item is not attached
+	const uint row = getItemRowIndex(item);
+
 	for (uint i = 0; i < getColumnCount(); ++i)
 	{
-		if (isListboxItemInColumn(item, i))
+		if (getGridItem(row, i) == item)
 		{
 			return i;
 		}
@@ -302,7 +346,7 @@ ListboxItem* MultiColumnList::getItemAtGridReference(const MCLGridRef& grid_ref)
 	}
 	else
 	{
-		return d_grid[grid_ref.row][grid_ref.column];
+		return getGridItem(grid_ref.row, grid_ref.column);
 	}
 
 }
@@ -319,11 +363,17 @@ bool MultiColumnList::isListboxItemInColumn(const ListboxItem* item, uint col_id
 		CEGUI_THROW(InvalidRequestException(
             "the column index given is out of range."));
 	}
+	else if (d_dataSource)
+	{
+        MCLGridRef grid_ref(0, 0);
+        return item && findSourceItem(item, grid_ref) &&
+               (grid_ref.column == col_idx);
+	}
 	else
 	{
 		for (uint i = 0; i < getRowCount(); ++i)
 		{
-			if (d_grid[i][col_idx] == item)
+			if (getGridItem(i, col_idx) == item)
 			{
 				return true;
 			}
@@ -348,11 +398,17 @@ bool MultiColumnList::isListboxItemInRow(const ListboxItem* item, uint row_idx)
 		CEGUI_THROW(InvalidRequestException(
             "the row index given is out of range."));
 	}
+	else if (d_dataSource)
+	{
+        MCLGridRef grid_ref(0, 0);
+        return item && findSourceItem(item, grid_ref) &&
+               (grid_ref.row == row_idx);
+	}
 	else
 	{
 		for (uint i = 0; i < getColumnCount(); ++i)
 		{
-			if (d_grid[row_idx][i] == item)
+			if (getGridItem(row_idx, i) == item)
 			{
 				return true;
 			}
@@ -371,20 +427,21 @@ bool MultiColumnList::isListboxItemInRow(const ListboxItem* item, uint row_idx)
 *************************************************************************/
 bool MultiColumnList::isListboxItemInList(const ListboxItem* item) const
 {
-	for (uint i = 0; i < getRowCount(); ++i)
-	{
-		for (uint j = 0; j < getColumnCount(); ++j)
-		{
-			if (d_grid[i][j] == item)
-			{
-				return true;
-			}
-
-		}
-
-	}
+    if (!d_dataSource)
+    {
+        CEGUI_TRY
+        {
+            getItemRowIndex(item);
+            return true;
+        }
+        CEGUI_CATCH (InvalidRequestException&)
+        {
+            return false;
+        }
+    }
 
-	return false;
+    MCLGridRef grid_ref(0, 0);
+    return item && findSourceItem(item, grid_ref);
 }
 
 
@@ -408,9 +465,11 @@ ListboxItem* MultiColumnList::findColumnItemWithText(const String& text, uint co
 	for ( ; i < getRowCount(); ++i)
 	{
 		// does this item match?
-		if (d_grid[i][col_idx]->getText() == text)
+		ListboxItem* item = getGridItem(i, col_idx);
+
+		if ((item != 0) && (item->getText() == text))
 		{
-			return d_grid[i][col_idx];
+			return item;
 		}
 
 	}
@@ -440,9 +499,11 @@ ListboxItem* MultiColumnList::findRowItemWithText(const String& text, uint row_i
 	for ( ; i < getColumnCount(); ++i)
 	{
 		// does this item match?
-		if (d_grid[row_idx][i]->getText() == text)
+		ListboxItem* item = getGridItem(row_idx, i);
+
+		if ((item != 0) && (item->getText() == text))
 		{
-			return d_grid[row_idx][i];
+			return item;
 		}
 
 	}
@@ -476,9 +537,11 @@ ListboxItem* MultiColumnList::findListItemWithText(const String& text, const Lis
 		for (uint j = startRef.column; j < getColumnCount(); ++j)
 		{
 			// does this item match?
-			if (d_grid[i][j]->getText() == text)
+			ListboxItem* item = getGridItem(i, j);
+
+			if ((item != 0) && (item->getText() == text))
 			{
-				return d_grid[i][j];
+				return item;
 			}
 
 		}
@@ -522,17 +585,44 @@ ListboxItem* MultiColumnList::getNextSelected(const ListboxItem* start_item) con
 		}
 	}
 
+    // only rows holding selected data source cells have their items fetched.
+    if (d_dataSource)
+    {
+        for (uint i = startRef.row;
+             (i < getRowCount()) && !d_selectedSourceCells.empty(); ++i)
+        {
+            SourceCellSet::const_iterator cell = d_selectedSourceCells.lower_bound(
+                SourceCell(d_sourceRows[i], 0));
+
+            if ((cell == d_selectedSourceCells.end()) ||
+                (cell->first != d_sourceRows[i]))
+                continue;
+
+            for (uint j = (i == startRef.row) ? startRef.column : 0;
+                 j < getColumnCount(); ++j)
+            {
+                ListboxItem* item = isSourceCellSelected(i, j) ?
+                    getGridItem(i, j) : 0;
+
+                if (item)
+                    return item;
+            }
+        }
+
+        return 0;
+    }
+
 	// perform the search
 	for (uint i = startRef.row; i < getRowCount(); ++i)
 	{
 		for (uint j = startRef.column; j < getColumnCount(); ++j)
 		{
 			// does this item match?
-			ListboxItem* item = d_grid[i][j];
+			ListboxItem* item = getGridItem(i, j);
 
 			if ((item != 0) && item->isSelected())
 			{
-				return d_grid[i][j];
+				return item;
 			}
 
 		}
@@ -549,13 +639,16 @@ ListboxItem* MultiColumnList::getNextSelected(const ListboxItem* start_item) con
 *************************************************************************/
 uint MultiColumnList::getSelectedCount(void) const
 {
+    if (d_dataSource)
+        return static_cast<uint>(d_selectedSourceCells.size());
+
 	uint count = 0;
 
 	for (uint i = 0; i < getRowCount(); ++i)
 	{
 		for (uint j = 0; j < getColumnCount(); ++j)
 		{
-			ListboxItem* item = d_grid[i][j];
+			ListboxItem* item = getGridItem(i, j);
 
 			if ((item != 0) && item->isSelected())
 			{
@@ -664,8 +757,7 @@ void MultiColumnList::resetList(void)
 {
 	if (resetList_impl())
 	{
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyContentsChanged();
 	}
 
 }
@@ -750,7 +842,7 @@ void MultiColumnList::insertColumn(const String& text, uint col_id, const UDim&
     segment.banPropertyFromXML("Font");
 
 	// Insert a blank entry at the appropriate position in each row.
-	for (uint i = 0; i < getRowCount(); ++i)
+	for (uint i = 0; i < d_grid.size(); ++i)
 	{
         d_grid[i].d_items.insert(
             d_grid[i].d_items.begin() + position,
@@ -789,7 +881,7 @@ void MultiColumnList::removeColumn(uint col_idx)
 		}
 
 		// remove the column from each row
-		for (uint i = 0; i < getRowCount(); ++i)
+		for (uint i = 0; i < d_grid.size(); ++i)
 		{
 			// extract the item pointer.
 			ListboxItem* item = d_grid[i][col_idx];
@@ -797,6 +889,9 @@ void MultiColumnList::removeColumn(uint col_idx)
 			// remove the column entry from the row
 			d_grid[i].d_items.erase(d_grid[i].d_items.begin() + col_idx);
 
+			if (item != 0)
+				d_itemRows.erase(item);
+
 			// delete the ListboxItem as needed.
 			if ((item != 0) && item->isAutoDeleted())
 			{
@@ -805,6 +900,30 @@ void MultiColumnList::removeColumn(uint col_idx)
 
 		}
 
+        // forget any data source cells of the column.
+        if (d_dataSource)
+        {
+            const uint col_id = getColumnID(col_idx);
+
+            for (SourceCellSet::iterator i = d_selectedSourceCells.begin();
+                 i != d_selectedSourceCells.end(); )
+            {
+                if (i->second == col_id)
+                    d_selectedSourceCells.erase(i++);
+                else
+                    ++i;
+            }
+
+            for (SourceItemMap::iterator i = d_sourceItemCells.begin();
+                 i != d_sourceItemCells.end(); )
+            {
+                if (i->second.second == col_id)
+                    d_sourceItemCells.erase(i++);
+                else
+                    ++i;
+            }
+        }
+
 		// remove header segment
 		getListHeader()->removeColumn(col_idx);
         --d_columnCount;
@@ -859,6 +978,8 @@ uint MultiColumnList::addRow(uint row_id)
 *************************************************************************/
 uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
 {
+	checkNoDataSource();
+
 	uint col_idx = 0;
 
 	// Build the new row
@@ -881,7 +1002,14 @@ uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
 
 	// if sorting is enabled, insert at an appropriate position
     const ListHeaderSegment::SortDirection dir = getSortDirection();
-	if (dir != ListHeaderSegment::None)
+	if (dir != ListHeaderSegment::None && d_updateDepth)
+	{
+		// batch in progress; append now and sort once in endUpdate.
+		pos = getRowCount();
+		d_grid.push_back(row);
+		d_updateNeedsSort = true;
+	}
+	else if (dir != ListHeaderSegment::None)
 	{
         // calculate where the row should be inserted
         ListItemGrid::iterator ins_pos = dir == ListHeaderSegment::Descending ?
@@ -899,9 +1027,14 @@ uint MultiColumnList::addRow(ListboxItem* item, uint col_id, uint row_id)
 		d_grid.push_back(row);
 	}
 
+    // items in rows after the new one have moved down a row.
+    if (pos + 1 < getRowCount())
+        shiftItemRows(pos, true);
+
+    addItemRows(pos);
+
 	// signal a change to the list contents
-	WindowEventArgs args(this);
-	onListContentsChanged(args);
+	notifyContentsChanged();
 
 	return pos;
 }
@@ -928,12 +1061,21 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 	}
 	else
 	{
+		checkNoDataSource();
+
 		// Build the new row (empty)
 		ListRow row;
 		row.d_sortColumn = getSortColumn();
 		row.d_items.resize(getColumnCount(), 0);
 		row.d_rowID = row_id;
 
+		// set the initial item in the new row
+		if (item)
+		{
+			item->setOwnerWindow(this);
+			row[getColumnWithID(col_id)] = item;
+		}
+
 		// if row index is too big, just insert at end.
 		if (row_idx > getRowCount())
 		{
@@ -942,12 +1084,13 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 
 		d_grid.insert(d_grid.begin() + row_idx, row);
 
-		// set the initial item in the new row
-		setItem(item, col_id, row_idx);
+        if (row_idx + 1 < getRowCount())
+            shiftItemRows(row_idx, true);
+
+        addItemRows(row_idx);
 
 		// signal a change to the list contents
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyContentsChanged();
 
 		return row_idx;
 	}
@@ -960,6 +1103,8 @@ uint MultiColumnList::insertRow(ListboxItem* item, uint col_id, uint row_idx, ui
 *************************************************************************/
 void MultiColumnList::removeRow(uint row_idx)
 {
+	checkNoDataSource();
+
 	// ensure row exists
 	if (row_idx >= getRowCount())
 	{
@@ -968,6 +1113,8 @@ void MultiColumnList::removeRow(uint row_idx)
 	}
 	else
 	{
+		removeItemRows(row_idx);
+
 		// delete items we are supposed to
 		for (uint i = 0; i < getColumnCount(); ++i)
 		{
@@ -982,6 +1129,7 @@ void MultiColumnList::removeRow(uint row_idx)
 
 		// erase the row from the grid.
 		d_grid.erase(d_grid.begin() + row_idx);
+		shiftItemRows(row_idx + 1, false);
 
 		// if we have erased the selection row, reset that to 0
 		if (d_nominatedSelectRow == row_idx)
@@ -990,8 +1138,7 @@ void MultiColumnList::removeRow(uint row_idx)
 		}
 
 		// signal a change to the list contents
-		WindowEventArgs args(this);
-		onListContentsChanged(args);
+		notifyContentsChanged();
 	}
 
 }
@@ -1003,6 +1150,8 @@ void MultiColumnList::removeRow(uint row_idx)
 *************************************************************************/
 void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 {
+	checkNoDataSource();
+
 	// validate grid ref
 	if (position.column >= getColumnCount())
 	{
@@ -1018,6 +1167,9 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 	// delete old item as required
 	ListboxItem* oldItem = d_grid[position.row][position.column];
 
+	if (oldItem != 0)
+		d_itemRows.erase(oldItem);
+
 	if ((oldItem != 0) && oldItem->isAutoDeleted())
 	{
 		CEGUI_DELETE_AO oldItem;
@@ -1029,10 +1181,11 @@ void MultiColumnList::setItem(ListboxItem* item, const MCLGridRef& position)
 
 	d_grid[position.row][position.column] = item;
 
+	if (item)
+		d_itemRows[item] = position.row;
 
 	// signal a change to the list contents
-	WindowEventArgs args(this);
-	onListContentsChanged(args);
+	notifyContentsChanged();
 }
 
 
@@ -1447,11 +1600,10 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 	{
 		for (uint j = tmpStart.column; j <= tmpEnd.column; ++j)
 		{
-			ListboxItem* item = d_grid[i][j];
-
-			if (item)
+			// data source cells are selected without fetching their items.
+			if (d_dataSource || getGridItem(i, j))
 			{
-				modified |= setItemSelectState_impl(getItemGridReference(item), true);
+				modified |= setItemSelectState_impl(MCLGridRef(i, j), true);
 			}
 
 		}
@@ -1467,6 +1619,10 @@ bool MultiColumnList::selectRange(const MCLGridRef& start, const MCLGridRef& end
 *************************************************************************/
 float MultiColumnList::getTotalRowsHeight(void) const
 {
+	// all rows from a data source share the same height
+	if (d_dataSource)
+		return getRowCount() * getDataSourceRowHeight();
+
 	float height = 0.0f;
 
 	for (uint i = 0; i < getRowCount(); ++i)
@@ -1495,7 +1651,7 @@ float MultiColumnList::getWidestColumnItemWidth(uint col_idx) const
 		// check each item in the column
 		for (uint i = 0; i < getRowCount(); ++i)
 		{
-			ListboxItem* item = d_grid[i][col_idx];
+			ListboxItem* item = getGridItem(i, col_idx);
 
 			// if the slot has an item in it
 			if (item)
@@ -1530,6 +1686,10 @@ float MultiColumnList::getHighestRowItemHeight(uint row_idx) const
 		CEGUI_THROW(InvalidRequestException(
             "specified row is out of range."));
 	}
+	else if (d_dataSource)
+	{
+		return getDataSourceRowHeight();
+	}
 	else
 	{
 		float height = 0.0f;
@@ -1567,6 +1727,14 @@ float MultiColumnList::getHighestRowItemHeight(uint row_idx) const
 *************************************************************************/
 bool MultiColumnList::clearAllSelections_impl(void)
 {
+    // items from a data source pick up the cleared state as they are fetched.
+    if (d_dataSource)
+    {
+        const bool modified = !d_selectedSourceCells.empty();
+        d_selectedSourceCells.clear();
+        return modified;
+    }
+
 	// flag used so we can track if we did anything.
 	bool modified = false;
 
@@ -1574,7 +1742,7 @@ bool MultiColumnList::clearAllSelections_impl(void)
 	{
 		for (uint j = 0; j < getColumnCount(); ++j)
 		{
-			ListboxItem* item = d_grid[i][j];
+			ListboxItem* item = getGridItem(i, j);
 
 			// if slot has an item, and item is selected
 			if ((item != 0) && item->isSelected())
@@ -1603,8 +1771,22 @@ ListboxItem* MultiColumnList::getItemAtPoint(const Vector2f& pt) const
 
     float y = listArea.d_min.d_y - getVertScrollbar()->getScrollPosition();
     float x = listArea.d_min.d_x - getHorzScrollbar()->getScrollPosition();
+    uint i = 0;
+
+    // rows from a data source are of uniform height, so go straight to the
+    // row containing the point.
+    if (d_dataSource && (pt.d_y > y))
+    {
+        const float row_height = getDataSourceRowHeight();
+
+        if (row_height <= 0.0f)
+            return 0;
+
+        i = static_cast<uint>((pt.d_y - y) / row_height);
+        y += i * row_height;
+    }
 
-    for (uint i = 0; i < getRowCount(); ++i)
+    for (; i < getRowCount(); ++i)
     {
         y += getHighestRowItemHeight(i);
 
@@ -1621,7 +1803,7 @@ ListboxItem* MultiColumnList::getItemAtPoint(const Vector2f& pt) const
                 if (pt.d_x < x)
                 {
                     // return contents of grid element that was clicked.
-                    return d_grid[i][j];
+                    return getGridItem(i, j);
                 }
             }
         }
@@ -1650,8 +1832,16 @@ bool MultiColumnList::setItemSelectState_impl(const MCLGridRef grid_ref, bool st
             "the specified row index is invalid."));
 	}
 
+	// selection of a data source cell is held by the list, so the source
+	// is not asked for the item.
+	ListboxItem* item =
+		d_dataSource ? 0 : getGridItem(grid_ref.row, grid_ref.column);
+	const bool selected = d_dataSource ?
+		isSourceCellSelected(grid_ref.row, grid_ref.column) :
+		((item != 0) && item->isSelected());
+
 	// only do this if the setting is changing
-	if (d_grid[grid_ref.row][grid_ref.column]->isSelected() != state)
+	if ((d_dataSource || (item != 0)) && (selected != state))
 	{
 		// if using nominated selection row and/ or column, check that they match.
 		if ((!d_useNominatedCol || (d_nominatedSelectCol == grid_ref.column)) &&
@@ -1677,9 +1867,13 @@ bool MultiColumnList::setItemSelectState_impl(const MCLGridRef grid_ref, bool st
 
 			}
 			// single item to be affected
+			else if (d_dataSource)
+			{
+				setSourceCellSelectState(grid_ref.row, grid_ref.column, state);
+			}
 			else
 			{
-				d_grid[grid_ref.row][grid_ref.column]->setSelected(state);
+				item->setSelected(state);
 			}
 
 			return true;
@@ -1698,7 +1892,13 @@ void MultiColumnList::setSelectForItemsInRow(uint row_idx, bool state)
 {
 	for (uint i = 0; i < getColumnCount(); ++i)
 	{
-		ListboxItem* item = d_grid[row_idx][i];
+		if (d_dataSource)
+		{
+			setSourceCellSelectState(row_idx, i, state);
+			continue;
+		}
+
+		ListboxItem* item = getGridItem(row_idx, i);
 
 		if (item)
 		{
@@ -1717,7 +1917,13 @@ void MultiColumnList::setSelectForItemsInColumn(uint col_idx, bool state)
 {
 	for (uint i = 0; i < getRowCount(); ++i)
 	{
-		ListboxItem* item = d_grid[i][col_idx];
+		if (d_dataSource)
+		{
+			setSourceCellSelectState(i, col_idx, state);
+			continue;
+		}
+
+		ListboxItem* item = getGridItem(i, col_idx);
 
 		if (item)
 		{
@@ -1765,7 +1971,7 @@ void MultiColumnList::moveColumn_impl(uint col_idx, uint position)
 		}
 
 		// move column entry in each row.
-		for (uint i = 0; i < getRowCount(); ++i)
+		for (uint i = 0; i < d_grid.size(); ++i)
 		{
 			// store entry.
 			ListboxItem* item = d_grid[i][col_idx];
@@ -1943,18 +2149,20 @@ void MultiColumnList::onMouseButtonDown(MouseEventArgs& e)
 
 			modified = true;
 
+			const MCLGridRef item_ref(getItemGridReference(item));
+
 			// select range or item, depending upon keys and last selected item
 			if (((e.sysKeys & Shift) && (d_lastSelected != 0)) && d_multiSelect)
 			{
-				modified |= selectRange(getItemGridReference(item), getItemGridReference(d_lastSelected));
+				modified |= selectRange(item_ref, getItemGridReference(d_lastSelected));
 			}
 			else
 			{
-				modified |= setItemSelectState_impl(getItemGridReference(item), item->isSelected() ^ true);
+				modified |= setItemSelectState_impl(item_ref, isItemSelected(item_ref) ^ true);
 			}
 
 			// update last selected item
-			d_lastSelected = item->isSelected() ? item : 0;
+			d_lastSelected = isItemSelected(item_ref) ? item : 0;
 		}
 
 		// fire event if needed
@@ -2066,7 +2274,7 @@ bool MultiColumnList::handleSortColumnChange(const EventArgs&)
 	uint col = getSortColumn();
 
 	// set new sort column on all rows
-	for (uint i = 0; i < getRowCount(); ++i)
+	for (uint i = 0; i < d_grid.size(); ++i)
 	{
 		d_grid[i].d_sortColumn = col;
 	}
@@ -2157,6 +2365,10 @@ uint MultiColumnList::getRowID(uint row_idx) const
 		CEGUI_THROW(InvalidRequestException(
             "the row index given is out of range."));
 	}
+	else if (d_dataSource)
+	{
+		return d_sourceRows[row_idx];
+	}
 	else
 	{
 		return d_grid[row_idx].d_rowID;
@@ -2171,7 +2383,7 @@ uint MultiColumnList::getRowWithID(uint row_id) const
 {
 	for (uint i = 0; i < getRowCount(); ++i)
 	{
-		if (d_grid[i].d_rowID == row_id)
+		if (getRowID(i) == row_id)
 		{
 			return i;
 		}
@@ -2291,14 +2503,14 @@ void MultiColumnList::addMultiColumnListProperties(void)
 bool MultiColumnList::resetList_impl(void)
 {
 	// just return false if the list is already empty (no rows == empty)
-	if (getRowCount() == 0)
+	if (d_grid.empty())
 	{
 		return false;
 	}
 	// we have items to be removed and possible deleted
 	else
 	{
-		for (uint i = 0; i < getRowCount(); ++i)
+		for (uint i = 0; i < d_grid.size(); ++i)
 		{
 			for (uint j = 0; j < getColumnCount(); ++j)
 			{
@@ -2316,6 +2528,7 @@ bool MultiColumnList::resetList_impl(void)
 
 		// clear all items from the grid.
 		d_grid.clear();
+		d_itemRows.clear();
 
 		// reset other affected fields
 		d_nominatedSelectRow = 0;
@@ -2356,6 +2569,8 @@ void MultiColumnList::autoSizeColumnHeader(uint col_idx)
 *************************************************************************/
 void MultiColumnList::setRowID(uint row_idx, uint row_id)
 {
+	checkNoDataSource();
+
 	// check for invalid index
 	if (row_idx >= getRowCount())
 	{
@@ -2529,12 +2744,14 @@ void MultiColumnList::ensureRowIsVisible(uint row_idx)
         float listHeight = getListRenderArea().getHeight();
 
         // get distance to top of item
-        uint row;
-        for (row = 0; row < row_idx; ++row)
-            top += getHighestRowItemHeight(row);
+        if (d_dataSource)
+            top = row_idx * getDataSourceRowHeight();
+        else
+            for (uint row = 0; row < row_idx; ++row)
+                top += getHighestRowItemHeight(row);
 
         // calculate distance to bottom of item
-        bottom = top + getHighestRowItemHeight(row);
+        bottom = top + getHighestRowItemHeight(row_idx);
 
         // account for current scrollbar value
         float currPos = vertScrollbar->getScrollPosition();
@@ -2682,15 +2899,498 @@ void MultiColumnList::resortList()
     // re-sort list according to direction
     ListHeaderSegment::SortDirection dir = getSortDirection();
 
+    if (d_dataSource)
+    {
+        // unsorted rows from a data source are shown in source order.
+        if ((dir == ListHeaderSegment::None) || (getColumnCount() == 0))
+            std::sort(d_sourceRows.begin(), d_sourceRows.end());
+        else
+            std::stable_sort(d_sourceRows.begin(), d_sourceRows.end(),
+                             SourceRowLess(*d_dataSource, getSortColumnID(),
+                                 dir == ListHeaderSegment::Descending));
+
+        return;
+    }
+
+    // NB: a stable sort is used so that a batch of rows sorted once in
+    // endUpdate ends up in the same order as had each row been inserted at
+    // its sorted position individually.
     if (dir == ListHeaderSegment::Descending)
     {
-        std::sort(d_grid.begin(), d_grid.end(), pred_descend);
+        std::stable_sort(d_grid.begin(), d_grid.end(), pred_descend);
     }
     else if (dir == ListHeaderSegment::Ascending)
     {
-        std::sort(d_grid.begin(), d_grid.end());
+        std::stable_sort(d_grid.begin(), d_grid.end());
+    }
+    // no (or invalid) direction, so do not sort.
+    else
+    {
+        return;
+    }
+
+    // re-key the items on their new rows.
+    for (uint i = 0; i < d_grid.size(); ++i)
+        addItemRows(i);
+}
+
+//----------------------------------------------------------------------------//
+uint MultiColumnList::handleUpdatedRowData(uint row_idx)
+{
+    checkNoDataSource();
+
+    if (row_idx >= getRowCount())
+        CEGUI_THROW(InvalidRequestException(
+            "the row index given is out of range."));
+
+    uint pos = row_idx;
+    const ListHeaderSegment::SortDirection dir = getSortDirection();
+
+    if ((dir != ListHeaderSegment::None) && d_updateDepth)
+    {
+        d_updateNeedsSort = true;
+    }
+    else if (dir != ListHeaderSegment::None)
+    {
+        // take the row out and re-insert it at its sorted position.
+        const ListRow row(d_grid[row_idx]);
+        d_grid.erase(d_grid.begin() + row_idx);
+
+        ListItemGrid::iterator ins_pos = dir == ListHeaderSegment::Descending ?
+            std::upper_bound(d_grid.begin(), d_grid.end(), row, pred_descend) :
+            std::upper_bound(d_grid.begin(), d_grid.end(), row);
+
+        pos = static_cast<uint>(d_grid.insert(ins_pos, row) - d_grid.begin());
+
+        // only the rows between the old and new positions have moved.
+        for (uint i = ceguimin(row_idx, pos); i <= ceguimax(row_idx, pos); ++i)
+            addItemRows(i);
+    }
+
+    notifyContentsChanged();
+
+    return pos;
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::beginUpdate()
+{
+    ++d_updateDepth;
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::endUpdate()
+{
+    if (d_updateDepth == 0)
+        CEGUI_THROW(InvalidRequestException(
+            "endUpdate called without a matching call to beginUpdate."));
+
+    if (--d_updateDepth != 0)
+        return;
+
+    if (d_updateNeedsSort)
+    {
+        d_updateNeedsSort = false;
+        resortList();
+    }
+
+    if (d_updateContentsChanged)
+    {
+        d_updateContentsChanged = false;
+        WindowEventArgs args(this);
+        onListContentsChanged(args);
+    }
+}
+
+//----------------------------------------------------------------------------//
+bool MultiColumnList::isUpdating() const
+{
+    return d_updateDepth != 0;
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::notifyContentsChanged()
+{
+    if (d_updateDepth)
+    {
+        d_updateContentsChanged = true;
+    }
+    else
+    {
+        WindowEventArgs args(this);
+        onListContentsChanged(args);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::setDataSource(MultiColumnListDataSource* source)
+{
+    // rows held directly by the list are discarded.
+    resetList_impl();
+
+    d_dataSource = source;
+    d_sourceRows.clear();
+    d_selectedSourceCells.clear();
+    d_sourceItemCells.clear();
+    d_nominatedSelectRow = 0;
+    d_lastSelected = 0;
+
+    if (d_dataSource)
+        notifyDataSourceReset();
+    else
+        notifyContentsChanged();
+}
+
+//----------------------------------------------------------------------------//
+MultiColumnListDataSource* MultiColumnList::getDataSource() const
+{
+    return d_dataSource;
+}
+
+//----------------------------------------------------------------------------//
+uint MultiColumnList::getDataSourceRow(uint row_idx) const
+{
+    checkDataSource();
+
+    if (row_idx >= getRowCount())
+        CEGUI_THROW(InvalidRequestException(
+            "the row index given is out of range."));
+
+    return d_sourceRows[row_idx];
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::notifyDataSourceRowInserted(uint source_row)
+{
+    checkDataSource();
+
+    // source rows at or after the insertion point have moved down one.
+    for (SourceRowList::iterator i = d_sourceRows.begin();
+         i != d_sourceRows.end(); ++i)
+    {
+        if (*i >= source_row)
+            ++*i;
+    }
+
+    shiftSourceCells(source_row, true);
+    insertSourceRow(source_row);
+    notifyContentsChanged();
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::notifyDataSourceRowRemoved(uint source_row)
+{
+    checkDataSource();
+
+    SourceRowList::iterator pos =
+        std::find(d_sourceRows.begin(), d_sourceRows.end(), source_row);
+
+    if (pos == d_sourceRows.end())
+        CEGUI_THROW(InvalidRequestException(
+            "the specified data source row is not in the list."));
+
+    const uint row_idx = static_cast<uint>(pos - d_sourceRows.begin());
+    d_sourceRows.erase(pos);
+
+    // source rows after the removed row have moved up one.
+    for (SourceRowList::iterator i = d_sourceRows.begin();
+         i != d_sourceRows.end(); ++i)
+    {
+        if (*i > source_row)
+            --*i;
+    }
+
+    shiftSourceCells(source_row, false);
+
+    if (d_nominatedSelectRow == row_idx)
+        d_nominatedSelectRow = 0;
+
+    // the item may have gone with the row.
+    d_lastSelected = 0;
+
+    notifyContentsChanged();
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::notifyDataSourceRowChanged(uint source_row)
+{
+    checkDataSource();
+
+    if ((getSortDirection() != ListHeaderSegment::None) &&
+        (getColumnCount() != 0))
+    {
+        SourceRowList::iterator pos =
+            std::find(d_sourceRows.begin(), d_sourceRows.end(), source_row);
+
+        if (pos == d_sourceRows.end())
+            CEGUI_THROW(InvalidRequestException(
+                "the specified data source row is not in the list."));
+
+        if (d_updateDepth)
+        {
+            d_updateNeedsSort = true;
+        }
+        else
+        {
+            d_sourceRows.erase(pos);
+            insertSourceRow(source_row);
+        }
+    }
+
+    notifyContentsChanged();
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::notifyDataSourceReset()
+{
+    checkDataSource();
+
+    const uint count = d_dataSource->getRowCount();
+
+    d_sourceRows.resize(count);
+    for (uint i = 0; i < count; ++i)
+        d_sourceRows[i] = i;
+
+    d_selectedSourceCells.clear();
+    d_sourceItemCells.clear();
+
+    d_nominatedSelectRow = 0;
+    d_lastSelected = 0;
+
+    if (d_updateDepth)
+        d_updateNeedsSort = true;
+    else
+        resortList();
+
+    notifyContentsChanged();
+}
+
+//----------------------------------------------------------------------------//
+uint MultiColumnList::insertSourceRow(uint source_row)
+{
+    const ListHeaderSegment::SortDirection dir = getSortDirection();
+    SourceRowList::iterator pos;
+
+    // unsorted rows are kept in source order.
+    if ((dir == ListHeaderSegment::None) || (getColumnCount() == 0))
+    {
+        pos = d_sourceRows.begin() +
+            ceguimin(static_cast<size_t>(source_row), d_sourceRows.size());
+    }
+    // batch in progress; append now and sort once in endUpdate.
+    else if (d_updateDepth)
+    {
+        pos = d_sourceRows.end();
+        d_updateNeedsSort = true;
+    }
+    else
+    {
+        pos = std::upper_bound(d_sourceRows.begin(), d_sourceRows.end(),
+                               source_row,
+                               SourceRowLess(*d_dataSource, getSortColumnID(),
+                                   dir == ListHeaderSegment::Descending));
+    }
+
+    return static_cast<uint>(d_sourceRows.insert(pos, source_row) -
+                             d_sourceRows.begin());
+}
+
+//----------------------------------------------------------------------------//
+ListboxItem* MultiColumnList::getGridItem(uint row_idx, uint col_idx) const
+{
+    if (!d_dataSource)
+        return d_grid[row_idx][col_idx];
+
+    const SourceCell cell(d_sourceRows[row_idx], getColumnID(col_idx));
+    ListboxItem* item = d_dataSource->getItem(cell.first, cell.second);
+
+    // items from a data source take their defaults (font etc) from us, and
+    // their selection state from the cell.  Remember where the item came
+    // from so that it can be found again without searching the source.
+    if (item)
+    {
+        item->setOwnerWindow(this);
+        item->setSelected(d_selectedSourceCells.count(cell) != 0);
+        d_sourceItemCells[item] = cell;
+    }
+
+    return item;
+}
+
+//----------------------------------------------------------------------------//
+float MultiColumnList::getDataSourceRowHeight() const
+{
+    float height = 0.0f;
+
+    if (getRowCount() == 0)
+        return height;
+
+    for (uint i = 0; i < getColumnCount(); ++i)
+    {
+        const ListboxItem* item = getGridItem(0, i);
+
+        if (item)
+            height = ceguimax(height, item->getPixelSize().d_height);
+    }
+
+    return height;
+}
+
+//----------------------------------------------------------------------------//
+bool MultiColumnList::findSourceItem(const ListboxItem* item,
+                                     MCLGridRef& grid_ref) const
+{
+    SourceItemMap::iterator cell = d_sourceItemCells.find(item);
+
+    if (cell == d_sourceItemCells.end())
+        return false;
+
+    const uint source_row = cell->second.first;
+    const uint col_id = cell->second.second;
+
+    // the source may since have dropped the item or reused it elsewhere.
+    if ((source_row >= d_dataSource->getRowCount()) ||
+        (d_dataSource->getItem(source_row, col_id) != item))
+    {
+        d_sourceItemCells.erase(cell);
+        return false;
+    }
+
+    grid_ref.row = getSourceRowIndex(source_row);
+    grid_ref.column = getColumnWithID(col_id);
+
+    return grid_ref.row < getRowCount();
+}
+
+//----------------------------------------------------------------------------//
+uint MultiColumnList::getSourceRowIndex(uint source_row) const
+{
+    return static_cast<uint>(
+        std::find(d_sourceRows.begin(), d_sourceRows.end(), source_row) -
+        d_sourceRows.begin());
+}
+
+//----------------------------------------------------------------------------//
+bool MultiColumnList::isSourceCellSelected(uint row_idx, uint col_idx) const
+{
+    return d_selectedSourceCells.count(
+        SourceCell(d_sourceRows[row_idx], getColumnID(col_idx))) != 0;
+}
+
+//----------------------------------------------------------------------------//
+bool MultiColumnList::setSourceCellSelectState(uint row_idx, uint col_idx,
+                                               bool state)
+{
+    const SourceCell cell(d_sourceRows[row_idx], getColumnID(col_idx));
+
+    if (state)
+        return d_selectedSourceCells.insert(cell).second;
+
+    return d_selectedSourceCells.erase(cell) != 0;
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::shiftSourceCells(uint source_row, bool inserted)
+{
+    // cells keep their relative order, so the set is rebuilt in order.
+    SourceCellSet cells;
+
+    for (SourceCellSet::const_iterator i = d_selectedSourceCells.begin();
+         i != d_selectedSourceCells.end(); ++i)
+    {
+        if (i->first < source_row)
+            cells.insert(cells.end(), *i);
+        else if (inserted)
+            cells.insert(cells.end(), SourceCell(i->first + 1, i->second));
+        else if (i->first > source_row)
+            cells.insert(cells.end(), SourceCell(i->first - 1, i->second));
     }
-    // else no (or invalid) direction, so do not sort.
+
+    d_selectedSourceCells.swap(cells);
+
+    for (SourceItemMap::iterator i = d_sourceItemCells.begin();
+         i != d_sourceItemCells.end(); )
+    {
+        uint& row = i->second.first;
+
+        if (!inserted && (row == source_row))
+        {
+            d_sourceItemCells.erase(i++);
+            continue;
+        }
+
+        if (row >= source_row)
+            row = inserted ? row + 1 : row - 1;
+
+        ++i;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::addItemRows(uint row_idx)
+{
+    for (uint i = 0; i < getColumnCount(); ++i)
+    {
+        if (d_grid[row_idx][i])
+            d_itemRows[d_grid[row_idx][i]] = row_idx;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::removeItemRows(uint row_idx)
+{
+    for (uint i = 0; i < getColumnCount(); ++i)
+    {
+        if (d_grid[row_idx][i])
+            d_itemRows.erase(d_grid[row_idx][i]);
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::shiftItemRows(uint first_row, bool inserted)
+{
+    for (ItemRowMap::iterator i = d_itemRows.begin(); i != d_itemRows.end(); ++i)
+    {
+        if (i->second < first_row)
+            continue;
+
+        if (inserted)
+            ++i->second;
+        else
+            --i->second;
+    }
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::checkNoDataSource() const
+{
+    if (d_dataSource)
+        CEGUI_THROW(InvalidRequestException(
+            "rows may not be modified directly while a data source is "
+            "attached to the MultiColumnList."));
+}
+
+//----------------------------------------------------------------------------//
+void MultiColumnList::checkDataSource() const
+{
+    if (!d_dataSource)
+        CEGUI_THROW(InvalidRequestException(
+            "no data source is attached to the MultiColumnList."));
+}
+
+//----------------------------------------------------------------------------//
+bool MultiColumnListDataSource::isRowLess(uint lhs, uint rhs, uint col_id) const
+{
+    const ListboxItem* a = getItem(lhs, col_id);
+    const ListboxItem* b = getItem(rhs, col_id);
+
+    // handle cases with empty slots
+    if (!b)
+        return false;
+    else if (!a)
+        return true;
+    else
+        return *a < *b;
 }
 
 
@@ -36,6 +36,8 @@
 #include "CEGUI/WindowManager.h"
 #include "CEGUI/Clipboard.h"
 
+#include <algorithm>
+
 // Start of CEGUI namespace section
 namespace CEGUI
 {
@@ -87,6 +89,12 @@ const String MultiLineEditbox::EventHorzScrollbarModeChanged( "HorzScrollbarMode
 // Static data initialisation
 String MultiLineEditbox::d_lineBreakChars("\n");
 
+//----------------------------------------------------------------------------//
+static bool lineStartsAfter(size_t index, const MultiLineEditbox::LineInfo& line)
+{
+    return index < line.d_startIdx;
+}
+
 /*************************************************************************
     Child Widget name constants
 *************************************************************************/
@@ -107,6 +115,8 @@ MultiLineEditbox::MultiLineEditbox(const String& type, const String& name) :
 	d_dragAnchorIdx(0),
 	d_wordWrap(true),
 	d_widestExtent(0.0f),
+	d_formattedFont(0),
+	d_formattedWrapWidth(0.0f),
 	d_forceVertScroll(false),
 	d_forceHorzScroll(false),
 	d_selectionBrush(0)
@@ -328,7 +338,7 @@ void MultiLineEditbox::ensureCaretIsVisible(void)
 		size_t caretLineIdx = d_caretPos - d_lines[caretLine].d_startIdx;
 
 		float ypos = caretLine * fnt->getLineSpacing();
-        float xpos = fnt->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, caretLineIdx));
+        float xpos = fnt->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, caretLineIdx);
 
 		// adjust position for scroll bars
 		xpos -= horzScrollbar->getScrollPosition();
@@ -445,118 +455,162 @@ void MultiLineEditbox::formatText(void)
 //----------------------------------------------------------------------------//
 void MultiLineEditbox::formatText(const bool update_scrollbars)
 {
-    // TODO: ASSAF - todo
-	// clear old formatting data
-	d_lines.clear();
-	d_widestExtent = 0.0f;
+    const Font* fnt = getFont();
+    const String& text = getText();
+    const float areaWidth = getTextRenderArea().getWidth();
+    const float wrapWidth = (d_wordWrap && (areaWidth > 0.0f)) ? areaWidth : 0.0f;
 
-	String paraText;
+    if (!fnt)
+    {
+        d_lines.clear();
+        d_formattedText.clear();
+        d_formattedFont = 0;
+    }
+    // font or available width changed, so everything must be re-wrapped.
+    else if ((fnt != d_formattedFont) || (wrapWidth != d_formattedWrapWidth))
+    {
+        d_lines.clear();
+        formatParagraphs(text, 0, text.length(), wrapWidth, d_lines);
 
-	const Font* fnt = getFont();
+        d_formattedText = text;
+        d_formattedFont = fnt;
+        d_formattedWrapWidth = wrapWidth;
+    }
+    // only the paragraphs touched since the last pass need re-wrapping.
+    else
+    {
+        const size_t oldLength = d_formattedText.length();
+        const size_t newLength = text.length();
+        const size_t minLength = ceguimin(oldLength, newLength);
 
-	if (fnt)
-	{
-		float areaWidth = getTextRenderArea().getWidth();
+        // find the span that differs between the old and new text
+        size_t prefix = 0;
+        while ((prefix < minLength) && (d_formattedText[prefix] == text[prefix]))
+            ++prefix;
 
-		String::size_type	currPos = 0;
-		String::size_type	paraLen;
-		LineInfo	line;
+        size_t suffix = 0;
+        while ((suffix < minLength - prefix) &&
+               (d_formattedText[oldLength - 1 - suffix] == text[newLength - 1 - suffix]))
+            ++suffix;
 
-        while (currPos < getText().length())
-		{
-           if ((paraLen = getText().find_first_of(d_lineBreakChars, currPos)) == String::npos)
-			{
-               paraLen = getText().length() - currPos;
-			}
-			else
-			{
-				++paraLen -= currPos;
-			}
+        if ((prefix != oldLength) || (oldLength != newLength))
+        {
+            // widen the span out to whole paragraphs
+            String::size_type paraStart = prefix ?
+                text.find_last_of(d_lineBreakChars, prefix - 1) : String::npos;
+            paraStart = (paraStart == String::npos) ? 0 : paraStart + 1;
+
+            String::size_type oldParaEnd =
+                d_formattedText.find_first_of(d_lineBreakChars, oldLength - suffix);
+            oldParaEnd = (oldParaEnd == String::npos) ? oldLength : oldParaEnd + 1;
+            const size_t newParaEnd = oldParaEnd + newLength - oldLength;
+
+            LineList::iterator first = d_lines.begin();
+            while ((first != d_lines.end()) && (first->d_startIdx < paraStart))
+                ++first;
+            LineList::iterator last = first;
+            while ((last != d_lines.end()) && (last->d_startIdx < oldParaEnd))
+                ++last;
+
+            // lines after the edit keep their layout, they just move.
+            for (LineList::iterator line = last; line != d_lines.end(); ++line)
+                line->d_startIdx = line->d_startIdx + newLength - oldLength;
+
+            LineList newLines;
+            formatParagraphs(text, paraStart, newParaEnd, wrapWidth, newLines);
+
+            const size_t firstIdx = first - d_lines.begin();
+            d_lines.erase(first, last);
+            d_lines.insert(d_lines.begin() + firstIdx, newLines.begin(), newLines.end());
+
+            d_formattedText.replace(prefix, oldLength - suffix - prefix,
+                                    text, prefix, newLength - suffix - prefix);
+        }
+    }
 
-            paraText = getText().substr(currPos, paraLen);
+    d_widestExtent = 0.0f;
+    for (LineList::const_iterator line = d_lines.begin(); line != d_lines.end(); ++line)
+        d_widestExtent = ceguimax(d_widestExtent, line->d_extent);
 
-			if (!d_wordWrap || (areaWidth <= 0.0f))
-			{
-				// no word wrapping, so we are just one long line.
-				line.d_startIdx = currPos;
-				line.d_length	= paraLen;
-				line.d_extent	= fnt->getTextExtent(paraText);
-				d_lines.push_back(line);
-
-				// update widest, if needed.
-				if (line.d_extent > d_widestExtent)
-				{
-					d_widestExtent = line.d_extent;
-				}
+    if (update_scrollbars)
+        configureScrollbars();
 
-			}
-			// must word-wrap the paragraph text
-			else
-			{
-				String::size_type lineIndex = 0;
-
-				// while there is text in the string
-				while (lineIndex < paraLen)
-				{
-					String::size_type  lineLen = 0;
-					float lineExtent = 0.0f;
-
-					// loop while we have not reached the end of the paragraph string
-					while (lineLen < (paraLen - lineIndex))
-					{
-						// get cp / char count of next token
-						size_t nextTokenSize = getNextTokenLength(paraText, lineIndex + lineLen);
-
-						// get pixel width of the token
-						float tokenExtent  = fnt->getTextExtent(paraText.substr(lineIndex + lineLen, nextTokenSize));
-
-						// would adding this token would overflow the available width
-						if ((lineExtent + tokenExtent) > areaWidth)
-						{
-							// Was this the first token?
-							if (lineLen == 0)
-							{
-								// get point at which to break the token
-								lineLen = fnt->getCharAtPixel(paraText.substr(lineIndex, nextTokenSize), areaWidth);
-							}
-
-							// text wraps, exit loop early with line info up until wrap point
-							break;
-						}
-
-						// add this token to current line
-						lineLen    += nextTokenSize;
-						lineExtent += tokenExtent;
-					}
-
-					// set up line info and add to collection
-					line.d_startIdx = currPos + lineIndex;
-					line.d_length	= lineLen;
-					line.d_extent	= lineExtent;
-					d_lines.push_back(line);
-
-					// update widest, if needed.
-					if (lineExtent > d_widestExtent)
-					{
-						d_widestExtent = lineExtent;
-					}
-
-					// update position in string
-					lineIndex += lineLen;
-				}
+    invalidate();
+}
 
-			}
+//----------------------------------------------------------------------------//
+void MultiLineEditbox::formatParagraphs(const String& text, size_t start_idx,
+                                        size_t end_idx, float wrap_width,
+                                        LineList& lines) const
+{
+    const Font* fnt = getFont();
+    LineInfo line;
 
-			// skip to next 'paragraph' in text
-			currPos += paraLen;
-		}
+    String::size_type currPos = start_idx;
 
-	}
+    while (currPos < end_idx)
+    {
+        String::size_type paraEnd = text.find_first_of(d_lineBreakChars, currPos);
+        paraEnd = (paraEnd == String::npos) ? end_idx : ceguimin(paraEnd + 1, end_idx);
 
-    if (update_scrollbars)
-        configureScrollbars();
+        if (wrap_width <= 0.0f)
+        {
+            // no word wrapping, so we are just one long line.
+            line.d_startIdx = currPos;
+            line.d_length   = paraEnd - currPos;
+            line.d_extent   = fnt->getTextExtent(text, currPos, line.d_length);
+            lines.push_back(line);
+        }
+        // must word-wrap the paragraph text
+        else
+        {
+            String::size_type lineStart = currPos;
+
+            while (lineStart < paraEnd)
+            {
+                String::size_type lineEnd = lineStart;
+                float lineExtent = 0.0f;
+
+                while (lineEnd < paraEnd)
+                {
+                    const size_t tokenLength = ceguimin(
+                        getNextTokenLength(text, lineEnd), paraEnd - lineEnd);
+                    const float tokenExtent =
+                        fnt->getTextExtent(text, lineEnd, tokenLength);
+
+                    // would adding this token overflow the available width
+                    if ((lineExtent + tokenExtent) > wrap_width)
+                    {
+                        // first token on the line, so break the token itself
+                        // (always taking at least one code point)
+                        if (lineEnd == lineStart)
+                        {
+                            const size_t breakLength = ceguimin(
+                                fnt->getCharAtPixel(text, lineStart, wrap_width) - lineStart,
+                                tokenLength);
+                            lineEnd += ceguimax(breakLength, static_cast<size_t>(1));
+                            lineExtent = fnt->getTextExtent(text, lineStart, lineEnd - lineStart);
+                        }
+
+                        break;
+                    }
+
+                    lineEnd    += tokenLength;
+                    lineExtent += tokenExtent;
+                }
+
+                line.d_startIdx = lineStart;
+                line.d_length   = lineEnd - lineStart;
+                line.d_extent   = lineExtent;
+                lines.push_back(line);
+
+                lineStart = lineEnd;
+            }
+        }
 
-	invalidate();
+        // skip to next 'paragraph' in text
+        currPos = paraEnd;
+    }
 }
 
 
@@ -613,13 +667,12 @@ size_t MultiLineEditbox::getTextIndexFromPosition(const Vector2f& pt) const
 		lineNumber = d_lines.size() - 1;
 	}
 
-    String lineText(getText().substr(d_lines[lineNumber].d_startIdx, d_lines[lineNumber].d_length));
-
-	size_t lineIdx = getFont()->getCharAtPixel(lineText, wndPt.d_x);
+    const LineInfo& line = d_lines[lineNumber];
+	size_t lineIdx = getFont()->getCharAtPixel(getText(), line.d_startIdx, wndPt.d_x) - line.d_startIdx;
 
-	if (lineIdx >= lineText.length() - 1)
+	if (lineIdx >= line.d_length - 1)
 	{
-		lineIdx = lineText.length() - 1;
+		lineIdx = line.d_length - 1;
 	}
 
 	return d_lines[lineNumber].d_startIdx + lineIdx;
@@ -644,20 +697,13 @@ size_t MultiLineEditbox::getLineNumberFromIndex(size_t index) const
 	}
 	else
 	{
-		size_t indexCount = 0;
-		size_t caretLine = 0;
-
-		for (; caretLine < lineCount; ++caretLine)
-		{
-			indexCount += d_lines[caretLine].d_length;
-
-			if (index < indexCount)
-			{
-				return caretLine;
-			}
-
-		}
+        // lines are contiguous and ordered, so find the last line starting
+        // at or before index.
+        LineList::const_iterator line = std::upper_bound(
+            d_lines.begin(), d_lines.end(), index, lineStartsAfter);
 
+        if (line != d_lines.begin())
+            return (line - d_lines.begin()) - 1;
 	}
 
 	CEGUI_THROW(InvalidRequestException(
@@ -1030,11 +1076,13 @@ void MultiLineEditbox::handleLineUp(uint sysKeys)
 
 	if (caretLine > 0)
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx);
 
 		--caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = ceguimin(
+            getFont()->getCharAtPixel(getText(), d_lines[caretLine].d_startIdx, caretPixelOffset) - d_lines[caretLine].d_startIdx,
+            d_lines[caretLine].d_length);
 
 		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
 	}
@@ -1060,11 +1108,13 @@ void MultiLineEditbox::handleLineDown(uint sysKeys)
 
 	if ((d_lines.size() > 1) && (caretLine < (d_lines.size() - 1)))
 	{
-        float caretPixelOffset = getFont()->getTextAdvance(getText().substr(d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx));
+        float caretPixelOffset = getFont()->getTextAdvance(getText(), d_lines[caretLine].d_startIdx, d_caretPos - d_lines[caretLine].d_startIdx);
 
 		++caretLine;
 
-        size_t newLineIndex = getFont()->getCharAtPixel(getText().substr(d_lines[caretLine].d_startIdx, d_lines[caretLine].d_length), caretPixelOffset);
+        size_t newLineIndex = ceguimin(
+            getFont()->getCharAtPixel(getText(), d_lines[caretLine].d_startIdx, caretPixelOffset) - d_lines[caretLine].d_startIdx,
+            d_lines[caretLine].d_length);
 
 		setCaretIndex(d_lines[caretLine].d_startIdx + newLineIndex);
 	}
@@ -1533,6 +1583,8 @@ void MultiLineEditbox::onMouseWheel(MouseEventArgs& e)
 void MultiLineEditbox::onFontChanged(WindowEventArgs& e)
 {
     Window::onFontChanged(e);
+    // the font object may be the same, but its metrics may not be.
+    d_formattedFont = 0;
     formatText(true);
 }
 
@@ -59,6 +59,15 @@ PushButton::~PushButton(void)
 }
 
 
+/*************************************************************************
+	PushButton resets all of its state in ButtonBase::resetForReuse
+*************************************************************************/
+bool PushButton::isReusable() const
+{
+	return true;
+}
+
+
 /*************************************************************************
 	handler invoked internally when the button is clicked.
 *************************************************************************/
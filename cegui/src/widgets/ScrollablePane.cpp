@@ -183,6 +183,9 @@ float ScrollablePane::getHorizontalScrollPosition(void) const
 //----------------------------------------------------------------------------//
 void ScrollablePane::setHorizontalScrollPosition(float position)
 {
+    // make sure the scrollbars know about content changed since the last update
+    getScrolledContainer()->notifyContentChangedIfNecessary();
+
     getHorzScrollbar()->setUnitIntervalScrollPosition(position);
 }
 
@@ -221,6 +224,9 @@ float ScrollablePane::getVerticalScrollPosition(void) const
 //----------------------------------------------------------------------------//
 void ScrollablePane::setVerticalScrollPosition(float position)
 {
+    // make sure the scrollbars know about content changed since the last update
+    getScrolledContainer()->notifyContentChangedIfNecessary();
+
     getVertScrollbar()->setUnitIntervalScrollPosition(position);
 }
 
@@ -72,6 +72,25 @@ Scrollbar::~Scrollbar(void)
 {
 }
 
+//----------------------------------------------------------------------------//
+void Scrollbar::resetForReuse()
+{
+    Window::resetForReuse();
+
+    d_documentSize = 1.0f;
+    d_pageSize = 0.0f;
+    d_stepSize = 1.0f;
+    d_overlapSize = 0.0f;
+    d_position = 0.0f;
+    d_endLockPosition = false;
+}
+
+//----------------------------------------------------------------------------//
+bool Scrollbar::isReusable() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void Scrollbar::initialiseComponents(void)
 {
@@ -43,6 +43,8 @@ ScrolledContainer::ScrolledContainer(const String& type, const String& name) :
     Window(type, name),
     d_contentArea(0, 0, 0, 0),
     d_autosizePane(true),
+    d_contentChangePending(false),
+    d_childAreasPixelSize(0, 0),
     
     d_clientChildContentArea(this, static_cast<Element::CachedRectf::DataGenerator>(&ScrolledContainer::getClientChildContentArea_impl))
 {
@@ -119,36 +121,113 @@ Rectf ScrolledContainer::getChildExtentsArea(void) const
 {
     Rectf extents(0, 0, 0, 0);
 
-    const size_t childCount = getChildCount();
-    if (childCount == 0)
+    // child areas with relative positions depend on our own pixel size
+    if (d_childAreasPixelSize != d_pixelSize)
+        rebuildChildExtents();
+
+    if (d_childAreas.empty())
         return extents;
 
-    for (size_t i = 0; i < childCount; ++i)
-    {
-        const Window* const wnd = getChildAtIdx(i);
-        const Rectf area(
-            CoordConverter::asAbsolute(wnd->getPosition(), d_pixelSize),
-            wnd->getPixelSize());
+    if (*d_childLefts.begin() < extents.d_min.d_x)
+        extents.d_min.d_x = *d_childLefts.begin();
 
-        if (area.d_min.d_x < extents.d_min.d_x)
-            extents.d_min.d_x = area.d_min.d_x;
+    if (*d_childTops.begin() < extents.d_min.d_y)
+        extents.d_min.d_y = *d_childTops.begin();
 
-        if (area.d_min.d_y < extents.d_min.d_y)
-            extents.d_min.d_y = area.d_min.d_y;
+    if (*d_childRights.rbegin() > extents.d_max.d_x)
+        extents.d_max.d_x = *d_childRights.rbegin();
 
-        if (area.d_max.d_x > extents.d_max.d_x)
-            extents.d_max.d_x = area.d_max.d_x;
+    if (*d_childBottoms.rbegin() > extents.d_max.d_y)
+        extents.d_max.d_y = *d_childBottoms.rbegin();
 
-        if (area.d_max.d_y > extents.d_max.d_y)
-            extents.d_max.d_y = area.d_max.d_y;
+    return extents;
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::notifyContentChangedIfNecessary()
+{
+    if (d_contentChangePending)
+    {
+        WindowEventArgs args(this);
+        onContentChanged(args);
     }
+}
 
-    return extents;
+//----------------------------------------------------------------------------//
+void ScrolledContainer::update(float elapsed)
+{
+    Window::update(elapsed);
+
+    notifyContentChangedIfNecessary();
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::markContentChanged()
+{
+    if (d_autosizePane)
+        d_contentArea = getChildExtentsArea();
+
+    d_contentChangePending = true;
+}
+
+//----------------------------------------------------------------------------//
+Rectf ScrolledContainer::getChildArea(const Window* wnd) const
+{
+    return Rectf(CoordConverter::asAbsolute(wnd->getPosition(), d_pixelSize),
+                 wnd->getPixelSize());
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::addChildExtents(const Window* wnd) const
+{
+    const Rectf area(getChildArea(wnd));
+
+    d_childAreas[wnd] = area;
+    d_childLefts.insert(area.d_min.d_x);
+    d_childTops.insert(area.d_min.d_y);
+    d_childRights.insert(area.d_max.d_x);
+    d_childBottoms.insert(area.d_max.d_y);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::removeChildExtents(const Window* wnd) const
+{
+    const ChildAreaMap::iterator i = d_childAreas.find(wnd);
+
+    if (i == d_childAreas.end())
+        return;
+
+    // erase a single entry for each edge; other children may share the value
+    const Rectf& area = i->second;
+    d_childLefts.erase(d_childLefts.find(area.d_min.d_x));
+    d_childTops.erase(d_childTops.find(area.d_min.d_y));
+    d_childRights.erase(d_childRights.find(area.d_max.d_x));
+    d_childBottoms.erase(d_childBottoms.find(area.d_max.d_y));
+
+    d_childAreas.erase(i);
+}
+
+//----------------------------------------------------------------------------//
+void ScrolledContainer::rebuildChildExtents() const
+{
+    d_childAreas.clear();
+    d_childLefts.clear();
+    d_childTops.clear();
+    d_childRights.clear();
+    d_childBottoms.clear();
+
+    d_childAreasPixelSize = d_pixelSize;
+
+    const size_t childCount = getChildCount();
+    for (size_t i = 0; i < childCount; ++i)
+        addChildExtents(getChildAtIdx(i));
 }
 
 //----------------------------------------------------------------------------//
 void ScrolledContainer::onContentChanged(WindowEventArgs& e)
 {
+    d_contentChangePending = false;
+
     if (d_autosizePane)
     {
         d_contentArea = getChildExtentsArea();
@@ -170,20 +249,28 @@ void ScrolledContainer::onAutoSizeSettingChanged(WindowEventArgs& e)
 }
 
 //----------------------------------------------------------------------------//
-bool ScrolledContainer::handleChildSized(const EventArgs&)
+bool ScrolledContainer::handleChildSized(const EventArgs& e)
 {
-    // Fire event that notifies that a child's area has changed.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    const Window* const wnd = static_cast<const Window*>(
+        static_cast<const ElementEventArgs&>(e).element);
+
+    // update the area of just this child, then note that the content changed.
+    removeChildExtents(wnd);
+    addChildExtents(wnd);
+    markContentChanged();
     return true;
 }
 
 //----------------------------------------------------------------------------//
-bool ScrolledContainer::handleChildMoved(const EventArgs&)
+bool ScrolledContainer::handleChildMoved(const EventArgs& e)
 {
-    // Fire event that notifies that a child's area has changed.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    const Window* const wnd = static_cast<const Window*>(
+        static_cast<const ElementEventArgs&>(e).element);
+
+    // update the area of just this child, then note that the content changed.
+    removeChildExtents(wnd);
+    addChildExtents(wnd);
+    markContentChanged();
     return true;
 }
 
@@ -248,9 +335,10 @@ void ScrolledContainer::onChildAdded(ElementEventArgs& e)
     // force window to update what it thinks it's screen / pixel areas are.
     static_cast<Window*>(e.element)->notifyScreenAreaChanged(false);
 
+    addChildExtents(static_cast<Window*>(e.element));
+
     // perform notification.
-    WindowEventArgs args(this);
-    onContentChanged(args);
+    markContentChanged();
 }
 
 //----------------------------------------------------------------------------//
@@ -266,12 +354,11 @@ void ScrolledContainer::onChildRemoved(ElementEventArgs& e)
         d_eventConnections.erase(conn);
     }
 
+    removeChildExtents(static_cast<Window*>(e.element));
+
     // perform notification only if we're not currently being destroyed
     if (!d_destructionStarted)
-    {
-        WindowEventArgs args(this);
-        onContentChanged(args);
-    }
+        markContentChanged();
 }
 
 //----------------------------------------------------------------------------//
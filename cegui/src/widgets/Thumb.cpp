@@ -71,6 +71,25 @@ Thumb::~Thumb(void)
 }
 
 
+/*************************************************************************
+	Prepare a destroyed thumb for being reused
+*************************************************************************/
+void Thumb::resetForReuse()
+{
+	PushButton::resetForReuse();
+
+	d_hotTrack = true;
+	d_vertFree = false;
+	d_horzFree = false;
+	d_vertMin = 0.0f;
+	d_vertMax = 1.0f;
+	d_horzMin = 0.0f;
+	d_horzMax = 1.0f;
+	d_beingDragged = false;
+	d_dragPoint = Vector2f(0, 0);
+}
+
+
 /*************************************************************************
 	set the movement range of the thumb for the vertical axis.	
 *************************************************************************/
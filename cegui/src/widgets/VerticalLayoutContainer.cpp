@@ -50,6 +50,12 @@ VerticalLayoutContainer::VerticalLayoutContainer(const String& type,
 VerticalLayoutContainer::~VerticalLayoutContainer(void)
 {}
 
+//----------------------------------------------------------------------------//
+bool VerticalLayoutContainer::isReusable() const
+{
+    return true;
+}
+
 //----------------------------------------------------------------------------//
 void VerticalLayoutContainer::layout()
 {
@@ -410,6 +410,16 @@ macro (cegui_add_test_executable _NAME)
 
     cegui_gather_files()
 
+    # tests of the software renderer are built along with the renderer only
+    if (NOT CEGUI_BUILD_RENDERER_SOFTWARE)
+        list(REMOVE_ITEM CORE_SOURCE_FILES SoftwareRenderer.cpp)
+    endif()
+
+    # tests of the minizip resource provider are built along with it only
+    if (NOT CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER)
+        list(REMOVE_ITEM CORE_SOURCE_FILES MinizipResourceProvider.cpp)
+    endif()
+
     ###########################################################################
     #                     Statically Linked Executable
     ###########################################################################
@@ -456,6 +466,17 @@ macro (cegui_add_test_executable _NAME)
         boost_unit_test_framework # FIXME: Not portable!
     )
 
+    if (CEGUI_BUILD_RENDERER_SOFTWARE)
+        cegui_target_link_libraries(${CEGUI_TARGET_NAME}
+            ${CEGUI_SOFTWARE_RENDERER_LIBNAME}
+        )
+    endif()
+
+    # the tests write their archives with minizip
+    if (CEGUI_HAS_MINIZIP_RESOURCE_PROVIDER)
+        cegui_add_dependency(${CEGUI_TARGET_NAME} MINIZIP)
+    endif()
+
     if (CEGUI_BUILD_STATIC_CONFIGURATION)
         target_link_libraries(${CEGUI_TARGET_NAME}_Static
             ${CEGUI_NULL_RENDERER_LIBNAME}_Static
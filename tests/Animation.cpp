@@ -0,0 +1,202 @@
+/***********************************************************************
+ *    filename:   Animation.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Animation.h"
+#include "CEGUI/AnimationInstance.h"
+#include "CEGUI/AnimationManager.h"
+#include "CEGUI/Affector.h"
+#include "CEGUI/KeyFrame.h"
+#include "CEGUI/TplInterpolators.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+/*
+ * Interpolator that only provides the String based path, like custom
+ * interpolators written before the native path existed.
+ */
+template<typename T>
+class StringOnlyInterpolator : public CEGUI::TplLinearInterpolator<T>
+{
+public:
+    StringOnlyInterpolator(const CEGUI::String& type):
+        CEGUI::TplLinearInterpolator<T>(type)
+    {}
+
+    virtual bool interpolateNative(CEGUI::Property&, CEGUI::AnimationInstance*,
+                                   CEGUI::Affector::ApplicationMethod,
+                                   const CEGUI::KeyFrame&, const CEGUI::KeyFrame&,
+                                   float)
+    {
+        return false;
+    }
+};
+
+struct AnimationFixture
+{
+    AnimationFixture():
+        d_stringFloat("StringOnlyFloat"),
+        d_stringURect("StringOnlyURect")
+    {
+        CEGUI::AnimationManager::getSingleton().addInterpolator(&d_stringFloat);
+        CEGUI::AnimationManager::getSingleton().addInterpolator(&d_stringURect);
+    }
+
+    ~AnimationFixture()
+    {
+        CEGUI::AnimationManager::getSingleton().removeInterpolator(&d_stringURect);
+        CEGUI::AnimationManager::getSingleton().removeInterpolator(&d_stringFloat);
+    }
+
+    // two affectors: Alpha (float) and Area (URect, relative to saved value)
+    CEGUI::Animation* createAnimation(const CEGUI::String& float_interpolator,
+                                      const CEGUI::String& urect_interpolator)
+    {
+        CEGUI::Animation* anim = CEGUI::AnimationManager::getSingleton().createAnimation();
+        anim->setDuration(1.0f);
+        anim->setReplayMode(CEGUI::Animation::RM_Loop);
+
+        CEGUI::Affector* alpha = anim->createAffector("Alpha", float_interpolator);
+        alpha->createKeyFrame(0.0f, "0.2");
+        alpha->createKeyFrame(1.0f, "0.8", CEGUI::KeyFrame::P_QuadraticAccelerating);
+
+        CEGUI::Affector* area = anim->createAffector("Area", urect_interpolator);
+        area->setApplicationMethod(CEGUI::Affector::AM_Relative);
+        area->createKeyFrame(0.0f, "{{0,0},{0,0},{0,0},{0,0}}");
+        area->createKeyFrame(1.0f, "{{0.1,10},{0,20},{0.1,10},{0,20}}");
+
+        return anim;
+    }
+
+    StringOnlyInterpolator<float> d_stringFloat;
+    StringOnlyInterpolator<CEGUI::URect> d_stringURect;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Animation, AnimationFixture)
+
+BOOST_AUTO_TEST_CASE(NativeMatchesString)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::AnimationManager& animMgr = CEGUI::AnimationManager::getSingleton();
+
+    CEGUI::Window* nativeWnd = winMgr.createWindow("DefaultWindow");
+    CEGUI::Window* stringWnd = winMgr.createWindow("DefaultWindow");
+    const CEGUI::URect area(CEGUI::UDim(0, 5), CEGUI::UDim(0, 5),
+                            CEGUI::UDim(0.5f, 0), CEGUI::UDim(0.5f, 0));
+    nativeWnd->setArea(area);
+    stringWnd->setArea(area);
+
+    CEGUI::Animation* nativeAnim = createAnimation("float", "URect");
+    CEGUI::Animation* stringAnim = createAnimation("StringOnlyFloat", "StringOnlyURect");
+
+    CEGUI::AnimationInstance* nativeInst = animMgr.instantiateAnimation(nativeAnim);
+    CEGUI::AnimationInstance* stringInst = animMgr.instantiateAnimation(stringAnim);
+    nativeInst->setTargetWindow(nativeWnd);
+    stringInst->setTargetWindow(stringWnd);
+    nativeInst->start(false);
+    stringInst->start(false);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        nativeInst->step(0.1f);
+        stringInst->step(0.1f);
+
+        // the String path rounds when formatting, so allow a small difference
+        const CEGUI::URect& nativeArea = nativeWnd->getArea();
+        const CEGUI::URect& stringArea = stringWnd->getArea();
+        BOOST_CHECK_SMALL(nativeWnd->getAlpha() - stringWnd->getAlpha(), 0.001f);
+        BOOST_CHECK_SMALL(nativeArea.d_min.d_y.d_offset - stringArea.d_min.d_y.d_offset, 0.001f);
+        BOOST_CHECK_SMALL(nativeArea.d_max.d_x.d_offset - stringArea.d_max.d_x.d_offset, 0.001f);
+        BOOST_CHECK_SMALL(nativeArea.d_max.d_x.d_scale - stringArea.d_max.d_x.d_scale, 0.001f);
+    }
+
+    // key frame values are cached natively, but must follow value changes
+    nativeAnim->getAffectorAtIdx(0)->getKeyFrameAtIdx(1)->setValue("0.4");
+    nativeInst->setPosition(1.0f);
+    nativeInst->step(0.0f);
+    BOOST_CHECK_CLOSE(nativeWnd->getAlpha(), 0.4f, 0.01f);
+
+    animMgr.destroyAnimationInstance(stringInst);
+    animMgr.destroyAnimationInstance(nativeInst);
+    animMgr.destroyAnimation(stringAnim);
+    animMgr.destroyAnimation(nativeAnim);
+    winMgr.destroyWindow(stringWnd);
+    winMgr.destroyWindow(nativeWnd);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+    CEGUI::AnimationManager& animMgr = CEGUI::AnimationManager::getSingleton();
+
+    const unsigned int windowCount = 300;
+    const unsigned int steps = 100;
+
+    const char* const interpolators[][2] = {
+        { "StringOnlyFloat", "StringOnlyURect" },
+        { "float", "URect" }
+    };
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        CEGUI::Animation* anim = createAnimation(interpolators[i][0], interpolators[i][1]);
+
+        std::vector<CEGUI::Window*> windows;
+        std::vector<CEGUI::AnimationInstance*> instances;
+        for (unsigned int w = 0; w < windowCount; ++w)
+        {
+            windows.push_back(winMgr.createWindow("DefaultWindow"));
+            instances.push_back(animMgr.instantiateAnimation(anim));
+            instances.back()->setTargetWindow(windows.back());
+            instances.back()->start(false);
+        }
+
+        boost::timer timer;
+        for (unsigned int s = 0; s < steps; ++s)
+            for (unsigned int w = 0; w < windowCount; ++w)
+                instances[w]->step(0.016f);
+
+        BOOST_CHECK(windows.back()->getAlpha() >= 0.2f && windows.back()->getAlpha() <= 0.8f);
+        BOOST_TEST_MESSAGE((i ? "Native" : "String") << " animation path, " << steps
+                           << " steps of " << windowCount << " windows: "
+                           << timer.elapsed() << "s");
+
+        for (unsigned int w = 0; w < windowCount; ++w)
+        {
+            animMgr.destroyAnimationInstance(instances[w]);
+            winMgr.destroyWindow(windows[w]);
+        }
+        animMgr.destroyAnimation(anim);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,228 @@
+/***********************************************************************
+ *    filename:   AsyncLogger.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AsyncLogger.h"
+#include "CEGUI/DefaultLogger.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+static const char* const LogFilename = "AsyncLoggerTest.log";
+
+//! logs numbered messages for one thread id.
+class LoggingTask : public CEGUI::ThreadPool::Task
+{
+public:
+    LoggingTask(int thread, int count) :
+        d_thread(thread),
+        d_count(count)
+    {}
+
+    void execute()
+    {
+        CEGUI::Logger& logger(CEGUI::Logger::getSingleton());
+
+        for (int i = 0; i < d_count; ++i)
+        {
+            char buff[32];
+            sprintf(buff, "thread %d entry %d", d_thread, i);
+            logger.logEvent(buff);
+            logger.logEvent("filtered", CEGUI::Informative);
+        }
+    }
+
+private:
+    const int d_thread;
+    const int d_count;
+};
+
+/*!
+    Replaces the system's logger with an AsyncLogger, and restores a
+    DefaultLogger afterwards so System still has a logger to delete.
+*/
+struct AsyncLoggerFixture
+{
+    AsyncLoggerFixture()
+    {
+        d_previousLevel = CEGUI::Logger::getSingleton().getLoggingLevel();
+        CEGUI_DELETE_AO CEGUI::Logger::getSingletonPtr();
+        d_logger = CEGUI_NEW_AO CEGUI::AsyncLogger(64);
+        d_logger->setLoggingLevel(CEGUI::Standard);
+    }
+
+    ~AsyncLoggerFixture()
+    {
+        CEGUI_DELETE_AO d_logger;
+        std::remove(LogFilename);
+
+        CEGUI::Logger* logger = CEGUI_NEW_AO CEGUI::DefaultLogger();
+        logger->setLoggingLevel(d_previousLevel);
+        logger->setLogFilename("CEGUI.log", true);
+    }
+
+    //! return the lines of the log file.
+    std::vector<std::string> readLog() const
+    {
+        std::vector<std::string> lines;
+        std::ifstream file(LogFilename);
+        std::string line;
+
+        while (std::getline(file, line))
+            lines.push_back(line);
+
+        return lines;
+    }
+
+    CEGUI::AsyncLogger* d_logger;
+    CEGUI::LoggingLevel d_previousLevel;
+};
+
+BOOST_FIXTURE_TEST_SUITE(AsyncLogger, AsyncLoggerFixture)
+
+BOOST_AUTO_TEST_CASE(CapacityIsPowerOfTwo)
+{
+    BOOST_CHECK_EQUAL(d_logger->getCapacity(), 64u);
+    CEGUI_DELETE_AO d_logger;
+
+    d_logger = CEGUI_NEW_AO CEGUI::AsyncLogger(100);
+    BOOST_CHECK_EQUAL(d_logger->getCapacity(), 128u);
+}
+
+BOOST_AUTO_TEST_CASE(CachesUntilFileIsSet)
+{
+    d_logger->logEvent("before file", CEGUI::Warnings);
+    d_logger->logEvent("filtered", CEGUI::Insane);
+    d_logger->setLogFilename(LogFilename);
+    d_logger->logEvent("after file", CEGUI::Errors);
+    d_logger->flush();
+
+    const std::vector<std::string> lines(readLog());
+    BOOST_REQUIRE_GE(lines.size(), 2u);
+
+    // the header, then the two entries that pass the level check.
+    BOOST_CHECK(lines[0].find("(Std) \t+-+-+") != std::string::npos);
+    BOOST_CHECK(lines[lines.size() - 2].find("(Warn)\tbefore file") != std::string::npos);
+    BOOST_CHECK(lines.back().find("(Error)\tafter file") != std::string::npos);
+
+    // dd/mm/yyyy hh:mm:ss
+    BOOST_CHECK_EQUAL(lines.back()[2], '/');
+    BOOST_CHECK_EQUAL(lines.back()[5], '/');
+    BOOST_CHECK_EQUAL(lines.back()[13], ':');
+    BOOST_CHECK_EQUAL(lines.back()[19], ' ');
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentProducers)
+{
+    const int threadCount = 4;
+    const int entryCount = 5000;
+
+    d_logger->setLogFilename(LogFilename);
+
+    {
+        CEGUI::ThreadPool pool(threadCount);
+        for (int t = 0; t < threadCount; ++t)
+            pool.submit(new LoggingTask(t, entryCount));
+        pool.waitUntilIdle();
+    }
+
+    d_logger->flush();
+
+    // every entry is written once, and each thread's entries are in order.
+    std::vector<int> next(threadCount, 0);
+    int written = 0;
+    const std::vector<std::string> lines(readLog());
+
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        BOOST_CHECK(lines[i].find("filtered") == std::string::npos);
+
+        const size_t pos = lines[i].find("thread ");
+        if (pos == std::string::npos)
+            continue;
+
+        int thread, entry;
+        BOOST_REQUIRE_EQUAL(sscanf(lines[i].c_str() + pos, "thread %d entry %d",
+                                   &thread, &entry), 2);
+        BOOST_REQUIRE(thread >= 0 && thread < threadCount);
+        BOOST_CHECK_EQUAL(entry, next[thread]);
+        next[thread] = entry + 1;
+        ++written;
+    }
+
+    BOOST_CHECK_EQUAL(written, threadCount * entryCount);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const int entryCount = 100000;
+    const CEGUI::String message("Assigning LookNFeel 'TaharezLook/Button' "
+                                "to window 'Root/Frame/Button'.");
+
+    d_logger->setLogFilename(LogFilename);
+
+    boost::timer timer;
+    for (int i = 0; i < entryCount; ++i)
+        d_logger->logEvent(message);
+    d_logger->flush();
+
+    double elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("AsyncLogger, " << entryCount << " entries: " << elapsed << "s");
+
+    // with the level checked by the caller, disabled entries build no string.
+    timer.restart();
+    for (int i = 0; i < entryCount; ++i)
+    {
+        if (d_logger->getLoggingLevel() >= CEGUI::Informative)
+            d_logger->logEvent("Renamed element at: " + message, CEGUI::Informative);
+    }
+
+    elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("AsyncLogger, " << entryCount << " disabled entries: " << elapsed << "s");
+
+    CEGUI_DELETE_AO d_logger;
+    d_logger = 0;
+
+    CEGUI::DefaultLogger* defaultLogger = CEGUI_NEW_AO CEGUI::DefaultLogger();
+    defaultLogger->setLogFilename(LogFilename);
+
+    timer.restart();
+    for (int i = 0; i < entryCount; ++i)
+        defaultLogger->logEvent(message);
+
+    elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("DefaultLogger, " << entryCount << " entries: " << elapsed << "s");
+
+    CEGUI_DELETE_AO defaultLogger;
+    d_logger = CEGUI_NEW_AO CEGUI::AsyncLogger();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+/***********************************************************************
+ *    filename:   AsyncResourceLoader.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/AsyncResourceLoader.h"
+#include "CEGUI/ThreadPool.h"
+#include "CEGUI/SchemeManager.h"
+#include "CEGUI/ImageManager.h"
+#include "CEGUI/falagard/WidgetLookManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+
+#include <boost/test/unit_test.hpp>
+
+//! adds one to a shared counter if run on a worker thread, and optionally
+//! queues more tasks.
+class CountingTask : public CEGUI::ThreadPool::Task
+{
+public:
+    CountingTask(CEGUI::ThreadPool& pool, CEGUI::Mutex& mutex, int& count,
+                 int children) :
+        d_pool(pool),
+        d_mutex(mutex),
+        d_count(count),
+        d_children(children)
+    {}
+
+    void execute()
+    {
+        for (int i = 0; i < d_children; ++i)
+            d_pool.submit(new CountingTask(d_pool, d_mutex, d_count, 0));
+
+        CEGUI::MutexLock lock(d_mutex);
+        if (CEGUI::ThreadPool::isWorkerThread())
+            ++d_count;
+    }
+
+private:
+    CEGUI::ThreadPool& d_pool;
+    CEGUI::Mutex& d_mutex;
+    int& d_count;
+    const int d_children;
+};
+
+BOOST_AUTO_TEST_SUITE(AsyncResourceLoader)
+
+BOOST_AUTO_TEST_CASE(ThreadPoolRunsAllTasks)
+{
+    CEGUI::ThreadPool pool(4);
+    BOOST_CHECK_EQUAL(pool.getThreadCount(), 4u);
+    BOOST_CHECK(!CEGUI::ThreadPool::isWorkerThread());
+
+    CEGUI::Mutex mutex;
+    int count = 0;
+
+    for (int i = 0; i < 100; ++i)
+        pool.submit(new CountingTask(pool, mutex, count, 3));
+
+    pool.waitUntilIdle();
+    BOOST_CHECK_EQUAL(count, 400);
+}
+
+BOOST_AUTO_TEST_CASE(LoadsCompleteInOrder)
+{
+    CEGUI::AsyncResourceLoader loader;
+    const CEGUI::AsyncLoadHandle imageset =
+        loader.loadImageset("AlfiskoSkin.imageset");
+    const CEGUI::AsyncLoadHandle looknfeel =
+        loader.loadLookNFeel("AlfiskoSkin.looknfeel");
+
+    loader.wait(looknfeel);
+
+    BOOST_CHECK_EQUAL(imageset->getStatus(), CEGUI::AsyncLoad::S_COMPLETE);
+    BOOST_CHECK_EQUAL(looknfeel->getStatus(), CEGUI::AsyncLoad::S_COMPLETE);
+    BOOST_CHECK_EQUAL(imageset->getUsedFileCount(), 2u);
+    BOOST_CHECK_EQUAL(looknfeel->getUsedFileCount(), 1u);
+    BOOST_CHECK(CEGUI::System::getSingleton().getRenderer()->isTextureDefined("AlfiskoSkin"));
+
+    CEGUI::ImageManager::getSingleton().destroyImageCollection("AlfiskoSkin");
+}
+
+BOOST_AUTO_TEST_CASE(LoadScheme)
+{
+    BOOST_REQUIRE(!CEGUI::SchemeManager::getSingleton().isDefined("AlfiskoSkin"));
+
+    CEGUI::AsyncResourceLoader loader(2);
+    const CEGUI::AsyncLoadHandle load = loader.loadScheme("AlfiskoSkin.scheme");
+    BOOST_CHECK_EQUAL(loader.getPendingLoadCount(), 1u);
+
+    // poll as an application would once per frame
+    while (!load->isComplete())
+        loader.update();
+
+    BOOST_CHECK_EQUAL(load->getStatus(), CEGUI::AsyncLoad::S_COMPLETE);
+    BOOST_CHECK_EQUAL(loader.getPendingLoadCount(), 0u);
+    BOOST_CHECK(CEGUI::SchemeManager::getSingleton().isDefined("AlfiskoSkin"));
+    BOOST_CHECK(CEGUI::ImageManager::getSingleton().isDefined("AlfiskoSkin/WindowB"));
+    BOOST_CHECK(CEGUI::WidgetLookManager::getSingleton().isWidgetLookAvailable("AlfiskoSkin/Button"));
+
+    // the scheme, font, imageset, texture image and looknfeel files were all
+    // prepared on the workers and then used.
+    BOOST_CHECK_EQUAL(load->getPreparedFileCount(), 5u);
+    BOOST_CHECK_EQUAL(load->getUsedFileCount(), load->getPreparedFileCount());
+}
+
+BOOST_AUTO_TEST_CASE(MissingFileFails)
+{
+    CEGUI::AsyncResourceLoader loader;
+    const CEGUI::AsyncLoadHandle load =
+        loader.loadImageset("NoSuchFile.imageset");
+
+    loader.waitAll();
+
+    BOOST_CHECK_EQUAL(load->getStatus(), CEGUI::AsyncLoad::S_FAILED);
+    BOOST_CHECK(!load->getError().empty());
+    BOOST_CHECK_EQUAL(load->getPreparedFileCount(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
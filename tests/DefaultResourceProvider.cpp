@@ -0,0 +1,83 @@
+/***********************************************************************
+ *    filename:   DefaultResourceProvider.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/DefaultResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <string.h>
+
+BOOST_AUTO_TEST_SUITE(DefaultResourceProvider)
+
+BOOST_AUTO_TEST_CASE(FileMapping)
+{
+    CEGUI::DefaultResourceProvider& provider =
+        static_cast<CEGUI::DefaultResourceProvider&>(
+            *CEGUI::System::getSingleton().getResourceProvider());
+
+    BOOST_CHECK(!provider.isFileMappingEnabled());
+
+    CEGUI::RawDataContainer read;
+    provider.loadRawDataContainer("DejaVuSans.ttf", read, "fonts");
+    BOOST_CHECK(!read.isMapped());
+
+    provider.setFileMappingEnabled(true);
+
+    CEGUI::RawDataContainer mapped;
+    provider.loadRawDataContainer("DejaVuSans.ttf", mapped, "fonts");
+    BOOST_CHECK(mapped.isMapped());
+    BOOST_REQUIRE_EQUAL(mapped.getSize(), read.getSize());
+    BOOST_CHECK(memcmp(mapped.getDataPtr(), read.getDataPtr(),
+                       read.getSize()) == 0);
+
+    // the mapping is private, so writing to it does not change the file
+    mapped.getDataPtr()[0] ^= 0xFF;
+    CEGUI::RawDataContainer mapped_again;
+    provider.loadRawDataContainer("DejaVuSans.ttf", mapped_again, "fonts");
+    BOOST_CHECK_EQUAL(mapped_again.getDataPtr()[0], read.getDataPtr()[0]);
+
+    provider.unloadRawDataContainer(mapped);
+    BOOST_CHECK(!mapped.isMapped());
+    BOOST_CHECK(mapped.getDataPtr() == 0);
+
+    // small files are still read
+    CEGUI::RawDataContainer small;
+    provider.loadRawDataContainer("TaharezLook.scheme", small, "schemes");
+    BOOST_CHECK(small.getSize() < provider.getFileMappingMinimumSize());
+    BOOST_CHECK(!small.isMapped());
+
+    BOOST_CHECK_THROW(provider.loadRawDataContainer("NoSuchFile.ttf", mapped,
+                                                    "fonts"),
+                      CEGUI::FileIOException);
+
+    provider.setFileMappingEnabled(false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
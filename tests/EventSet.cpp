@@ -34,6 +34,9 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/timer.hpp>
 
+#include <sstream>
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(EventSet)
 
 BOOST_AUTO_TEST_CASE(AddingAndRemovingEvents)
@@ -135,63 +138,118 @@ BOOST_AUTO_TEST_CASE(Subscribing)
         connection->disconnect();
     }
 }
-/*
-BOOST_AUTO_TEST_CASE(Performance)
+BOOST_AUTO_TEST_CASE(UnsubscribedEventsAreSkipped)
 {
     CEGUI::EventSet set;
-    
-    const CEGUI::String eventName("ExplicitlyAddedTestEvent");
-    set.addEvent(eventName);
-    // at this point, the EventSet should contain just one event with eventName as it's name
-    
     TestEventArgs args;
-    // we measure event firing lookup overhead with one event first
-    
-    {
-        boost::timer timer;
-        for (unsigned int i = 0; i < 1000000; ++i)
-        {
-            set.fireEvent(eventName, args);
-        }
-        
-        BOOST_TEST_MESSAGE("Time taken, 1000000x event lookup (1 event): " << timer.elapsed());
-    }
-    
-    // now lets add events to a total of 100 and try again (realistic scenario test)
-    for (unsigned int i = 1; i < 100; ++i)
+
+    // 100 names, so some of them share a bit of the subscriber mask.
+    std::vector<CEGUI::Event::Connection> connections;
+    for (unsigned int i = 0; i < 100; ++i)
     {
         std::stringstream s;
-        s << "Event" << i;
-        set.addEvent(s.str());
+        s << "MaskTestEvent" << i;
+        connections.push_back(
+            set.subscribeEvent(s.str(), &freeFunctionSubscriber));
     }
-    
+
+    // disconnect every other one; the rest must still be fired.
+    for (unsigned int i = 0; i < 100; i += 2)
+        connections[i]->disconnect();
+
+    for (unsigned int i = 0; i < 100; ++i)
     {
-        boost::timer timer;
-        for (unsigned int i = 0; i < 1000000; ++i)
-        {
-            set.fireEvent(eventName, args);
-        }
-        
-        BOOST_TEST_MESSAGE("Time taken, 1000000x event lookup (100 events): " << timer.elapsed());
+        std::stringstream s;
+        s << "MaskTestEvent" << i;
+
+        g_GlobalEventValue = 0;
+        args.d_targetValue = 1;
+        set.fireEvent(s.str(), args);
+        BOOST_CHECK_EQUAL(g_GlobalEventValue, i % 2 ? 1 : 0);
     }
+
+    // an Event subscribed to directly is fired too.
+    const CEGUI::String eventName("DirectlySubscribedTestEvent");
+    set.addEvent(eventName);
+    CEGUI::Event::Connection connection = set.getEventObject(eventName)->
+        subscribe(CEGUI::Event::Subscriber(&freeFunctionSubscriber));
+
+    args.d_targetValue = 2;
+    set.fireEvent(eventName, args);
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 2);
+    connection->disconnect();
+
+    // names never used for an Event are not interned.
+    CEGUI::Event::ID id;
+    BOOST_CHECK(!CEGUI::Event::findInternedName("NeverUsedTestEvent", id));
+    BOOST_CHECK(CEGUI::Event::findInternedName(eventName, id));
+    BOOST_CHECK_EQUAL(id, set.getEventObject(eventName)->getID());
+}
+
+BOOST_AUTO_TEST_CASE(GlobalEvents)
+{
+    CEGUI::EventSet set;
+    TestEventArgs args;
+
+    CEGUI::Event::Connection connection =
+        CEGUI::GlobalEventSet::getSingleton().subscribeEvent(
+            "TestNamespace/GlobalTestEvent", &freeFunctionSubscriber);
+
+    g_GlobalEventValue = 0;
+    args.d_targetValue = 4;
+    set.fireEvent("GlobalTestEvent", args, "OtherNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 0);
+    set.fireEvent("GlobalTestEvent", args, "TestNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 4);
+
+    connection->disconnect();
+    args.d_targetValue = 5;
+    set.fireEvent("GlobalTestEvent", args, "TestNamespace");
+    BOOST_CHECK_EQUAL(g_GlobalEventValue, 4);
+}
+
+//! fire \a name on \a set a million times, and report the rate.
+static void measureEventRate(CEGUI::EventSet& set, const CEGUI::String& name,
+                             const char* description)
+{
+    TestEventArgs args;
+    const unsigned int count = 1000000;
+
+    boost::timer timer;
+    for (unsigned int i = 0; i < count; ++i)
+        set.fireEvent(name, args, "TestNamespace");
+
+    const double elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("Events fired per second, " << description << ": " <<
+                       (elapsed > 0 ? count / elapsed : 0));
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    CEGUI::EventSet set;
     
-    // now lets add events to a total of 10000 and try again (synthetic test)
-    for (unsigned int i = 100; i < 10000; ++i)
+    const CEGUI::String eventName("ExplicitlyAddedTestEvent");
+    set.addEvent(eventName);
+
+    measureEventRate(set, eventName, "no subscribers");
+
+    // the subscribed events are not the one fired.
+    std::vector<CEGUI::Event::Connection> connections;
+    for (unsigned int i = 0; i < 10; ++i)
     {
         std::stringstream s;
         s << "Event" << i;
-        set.addEvent(s.str());
-    }
-    
-    {
-        boost::timer timer;
-        for (unsigned int i = 0; i < 1000000; ++i)
-        {
-            set.fireEvent(eventName, args);
-        }
-        
-        BOOST_TEST_MESSAGE("Time taken, 1000000x event lookup (10000 events): " << timer.elapsed());
+        connections.push_back(
+            set.subscribeEvent(s.str(), FunctorSubscriber()));
     }
+
+    measureEventRate(set, eventName, "other events subscribed");
+
+    connections.push_back(set.subscribeEvent(eventName, FunctorSubscriber()));
+    measureEventRate(set, eventName, "one subscriber");
+
+    for (size_t i = 0; i < connections.size(); ++i)
+        connections[i]->disconnect();
 }
-*/
+
 BOOST_AUTO_TEST_SUITE_END()
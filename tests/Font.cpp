@@ -0,0 +1,182 @@
+/***********************************************************************
+ *    filename:   Font.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Font.h"
+#include "CEGUI/FontGlyphTable.h"
+#include "CEGUI/FontManager.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <map>
+#include <vector>
+
+typedef std::map<CEGUI::utf32, CEGUI::FontGlyph> GlyphMap;
+
+// fill the map with glyphs for a range of codepoints and mirror it in table
+static void addGlyphRange(GlyphMap& map, CEGUI::FontGlyphTable& table,
+                          CEGUI::utf32 first, CEGUI::utf32 last)
+{
+    for (CEGUI::utf32 cp = first; cp <= last; ++cp)
+    {
+        CEGUI::FontGlyph& glyph = map[cp];
+        glyph.setAdvance(static_cast<float>(cp % 17));
+        table.insert(cp, &glyph);
+    }
+}
+
+// build a text of given length cycling through the given codepoint ranges
+static void makeText(std::vector<CEGUI::utf32>& text, size_t length,
+                     const CEGUI::utf32* ranges, size_t range_count)
+{
+    text.resize(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        const size_t r = (i / 7) % range_count;
+        const CEGUI::utf32 span = ranges[r * 2 + 1] - ranges[r * 2] + 1;
+        text[i] = ranges[r * 2] + static_cast<CEGUI::utf32>((i * 31) % span);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(Font)
+
+BOOST_AUTO_TEST_CASE(GlyphTable)
+{
+    GlyphMap map;
+    CEGUI::FontGlyphTable table;
+
+    BOOST_CHECK_EQUAL(table.find('A'), static_cast<CEGUI::FontGlyph*>(0));
+    BOOST_CHECK_EQUAL(table.find(0x1F600), static_cast<CEGUI::FontGlyph*>(0));
+
+    addGlyphRange(map, table, 0x20, 0x7E);
+    addGlyphRange(map, table, 0x4E00, 0x4FFF);
+    // enough codepoints outside the BMP to force the hash to grow
+    addGlyphRange(map, table, 0x1F300, 0x1F6FF);
+    addGlyphRange(map, table, 0x10FFF0, 0x10FFFF);
+
+    BOOST_CHECK_EQUAL(table.size(), map.size());
+
+    for (GlyphMap::iterator i = map.begin(); i != map.end(); ++i)
+        BOOST_CHECK_EQUAL(table.find(i->first), &i->second);
+
+    BOOST_CHECK_EQUAL(table.find(0x1F), static_cast<CEGUI::FontGlyph*>(0));
+    BOOST_CHECK_EQUAL(table.find(0x5000), static_cast<CEGUI::FontGlyph*>(0));
+    BOOST_CHECK_EQUAL(table.find(0x1F2FF), static_cast<CEGUI::FontGlyph*>(0));
+    BOOST_CHECK_EQUAL(table.find(0x110000), static_cast<CEGUI::FontGlyph*>(0));
+
+    // replacing an existing entry must not change the count
+    CEGUI::FontGlyph other;
+    table.insert('A', &other);
+    table.insert(0x1F600, &other);
+    BOOST_CHECK_EQUAL(table.size(), map.size());
+    BOOST_CHECK_EQUAL(table.find('A'), &other);
+    BOOST_CHECK_EQUAL(table.find(0x1F600), &other);
+
+    table.clear();
+    BOOST_CHECK_EQUAL(table.size(), 0u);
+    BOOST_CHECK_EQUAL(table.find('B'), static_cast<CEGUI::FontGlyph*>(0));
+    BOOST_CHECK_EQUAL(table.find(0x1F601), static_cast<CEGUI::FontGlyph*>(0));
+}
+
+BOOST_AUTO_TEST_CASE(GlyphLookup)
+{
+    CEGUI::Font& font = CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+
+    BOOST_CHECK(font.isCodepointAvailable('A'));
+    BOOST_CHECK(!font.isCodepointAvailable(0x10FFFF));
+    BOOST_CHECK(font.getGlyphData('A') != 0);
+    BOOST_CHECK(font.getGlyphData('A')->getImage() != 0);
+    BOOST_CHECK_EQUAL(font.getGlyphData(0x10FFFF), static_cast<const CEGUI::FontGlyph*>(0));
+
+    const float extent = font.getTextExtent("Hello");
+    BOOST_CHECK(extent > 0);
+    BOOST_CHECK_CLOSE(font.getTextExtent("HelloHello"),
+                      font.getTextAdvance("Hello") + extent, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(GlyphTablePerformance)
+{
+    GlyphMap map;
+    CEGUI::FontGlyphTable table;
+
+    // roughly the coverage of a font with Latin, CJK and emoji support
+    addGlyphRange(map, table, 0x20, 0x24F);
+    addGlyphRange(map, table, 0x3000, 0x30FF);
+    addGlyphRange(map, table, 0x4E00, 0x9FFF);
+    addGlyphRange(map, table, 0x1F300, 0x1F64F);
+
+    const CEGUI::utf32 latin[] = { 0x20, 0x7E, 0xC0, 0x17F };
+    const CEGUI::utf32 cjk[] = { 0x3040, 0x30FF, 0x4E00, 0x9FFF };
+    const CEGUI::utf32 mixed[] = { 0x20, 0x7E, 0x4E00, 0x9FFF, 0x1F300, 0x1F64F };
+
+    struct Case { const char* name; const CEGUI::utf32* ranges; size_t count; };
+    const Case cases[] = {
+        { "Latin", latin, 2 },
+        { "CJK", cjk, 2 },
+        { "Mixed", mixed, 3 }
+    };
+
+    const size_t textLength = 10000;
+    const unsigned int iterations = 200;
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); ++c)
+    {
+        std::vector<CEGUI::utf32> text;
+        makeText(text, textLength, cases[c].ranges, cases[c].count);
+
+        float map_sum = 0;
+        boost::timer map_timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+            for (size_t t = 0; t < textLength; ++t)
+            {
+                GlyphMap::const_iterator pos = map.find(text[t]);
+                if (pos != map.end())
+                    map_sum += pos->second.getAdvance();
+            }
+        const double map_elapsed = map_timer.elapsed();
+
+        float table_sum = 0;
+        boost::timer table_timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+            for (size_t t = 0; t < textLength; ++t)
+            {
+                const CEGUI::FontGlyph* glyph = table.find(text[t]);
+                if (glyph)
+                    table_sum += glyph->getAdvance();
+            }
+        const double table_elapsed = table_timer.elapsed();
+
+        BOOST_CHECK_EQUAL(map_sum, table_sum);
+        BOOST_TEST_MESSAGE(cases[c].name << " text, " << iterations << "x "
+                           << textLength << " lookups: std::map "
+                           << map_elapsed << "s, FontGlyphTable "
+                           << table_elapsed << "s");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,377 @@
+/***********************************************************************
+ *    filename:   GeometryBuffer.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/BasicImage.h"
+#include "CEGUI/ColourRect.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/VertexConverter.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <vector>
+
+static void makeVertices(std::vector<CEGUI::Vertex>& vertices, unsigned int count)
+{
+    vertices.resize(count);
+
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const float f = static_cast<float>(i);
+        vertices[i].position = CEGUI::Vector3f(f, f + 0.25f, f + 0.5f);
+        vertices[i].tex_coords = CEGUI::Vector2f(f * 0.5f, f * 0.25f);
+        vertices[i].colour_val = CEGUI::Colour(0.1f, 0.2f, 0.3f, 0.4f);
+    }
+}
+
+/*
+    GeometryBuffer storing vertices the way the OpenGL3 renderer does: Vertex
+    data is expanded to nine floats per vertex, while PackedVertex data, when
+    native, is stored as is.  Lets the packed path be exercised and timed
+    without a GL context.
+*/
+class StoringGeometryBuffer : public CEGUI::GeometryBuffer
+{
+public:
+    StoringGeometryBuffer(bool packed_native) :
+        d_packedNative(packed_native),
+        d_activeTexture(0),
+        d_batchCount(0)
+    {}
+
+    void draw() const {}
+    void setTranslation(const CEGUI::Vector3f&) {}
+    void setRotation(const CEGUI::Quaternion&) {}
+    void setPivot(const CEGUI::Vector3f&) {}
+    void setClippingRegion(const CEGUI::Rectf&) {}
+
+    void appendVertex(const CEGUI::Vertex& vertex)
+    {
+        appendGeometry(&vertex, 1);
+    }
+
+    void appendGeometry(const CEGUI::Vertex* const vbuff, CEGUI::uint vertex_count)
+    {
+        const size_t size = d_floats.size();
+        d_floats.resize(size + vertex_count * CEGUI::VertexConverter::PositionTexColourFloatCount);
+        CEGUI::VertexConverter::toPositionTexColourFloats(vbuff, vertex_count, &d_floats[size]);
+    }
+
+    void appendPackedGeometry(const CEGUI::PackedVertex* const vbuff, CEGUI::uint vertex_count)
+    {
+        if (!d_packedNative)
+        {
+            CEGUI::GeometryBuffer::appendPackedGeometry(vbuff, vertex_count);
+            return;
+        }
+
+        d_packed.insert(d_packed.end(), vbuff, vbuff + vertex_count);
+    }
+
+    bool isPackedGeometryNative() const { return d_packedNative; }
+
+    void reserveVertices(CEGUI::uint vertex_count)
+    {
+        if (d_packedNative)
+            d_packed.reserve(d_packed.size() + vertex_count);
+        else
+            d_floats.reserve(d_floats.size() + vertex_count * CEGUI::VertexConverter::PositionTexColourFloatCount);
+    }
+
+    void setActiveTexture(CEGUI::Texture* texture)
+    {
+        if (texture != d_activeTexture || !d_batchCount)
+            ++d_batchCount;
+        d_activeTexture = texture;
+    }
+
+    void reset()
+    {
+        d_floats.clear();
+        d_packed.clear();
+        d_activeTexture = 0;
+        d_batchCount = 0;
+    }
+
+    CEGUI::Texture* getActiveTexture() const { return d_activeTexture; }
+
+    CEGUI::uint getVertexCount() const
+    {
+        return static_cast<CEGUI::uint>(d_floats.size() / CEGUI::VertexConverter::PositionTexColourFloatCount +
+                                        d_packed.size());
+    }
+
+    CEGUI::uint getBatchCount() const { return d_batchCount; }
+    void setRenderEffect(CEGUI::RenderEffect*) {}
+    CEGUI::RenderEffect* getRenderEffect() { return 0; }
+    void setClippingActive(const bool) {}
+    bool isClippingActive() const { return false; }
+
+    //! all stored vertices as nine floats each, packed ones expanded.
+    std::vector<float> getFloats() const
+    {
+        std::vector<float> out(d_floats);
+
+        if (!d_packed.empty())
+        {
+            std::vector<CEGUI::Vertex> vertices(d_packed.size());
+            CEGUI::VertexConverter::fromPackedVertices(&d_packed[0], d_packed.size(), &vertices[0]);
+
+            const size_t size = out.size();
+            out.resize(size + vertices.size() * CEGUI::VertexConverter::PositionTexColourFloatCount);
+            CEGUI::VertexConverter::toPositionTexColourFloats(&vertices[0], vertices.size(), &out[size]);
+        }
+
+        return out;
+    }
+
+    //! bytes of vertex data that would be uploaded to the GPU.
+    size_t getVertexBytes() const
+    {
+        return d_floats.size() * sizeof(float) + d_packed.size() * sizeof(CEGUI::PackedVertex);
+    }
+
+private:
+    bool d_packedNative;
+    CEGUI::Texture* d_activeTexture;
+    CEGUI::uint d_batchCount;
+    std::vector<float> d_floats;
+    std::vector<CEGUI::PackedVertex> d_packed;
+};
+
+static const char* const PackedTestText =
+    "The quick brown fox jumps over the lazy dog. 0123456789 !?";
+
+BOOST_AUTO_TEST_SUITE(GeometryBuffer)
+
+BOOST_AUTO_TEST_CASE(VertexConversion)
+{
+    std::vector<CEGUI::Vertex> vertices;
+    makeVertices(vertices, 7);
+
+    std::vector<float> out(vertices.size() * CEGUI::VertexConverter::PositionTexColourFloatCount);
+    CEGUI::VertexConverter::toPositionTexColourFloats(&vertices[0], vertices.size(), &out[0]);
+
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        const float* v = &out[i * CEGUI::VertexConverter::PositionTexColourFloatCount];
+
+        BOOST_CHECK_EQUAL(v[0], vertices[i].position.d_x);
+        BOOST_CHECK_EQUAL(v[1], vertices[i].position.d_y);
+        BOOST_CHECK_EQUAL(v[2], vertices[i].position.d_z);
+        BOOST_CHECK_EQUAL(v[3], vertices[i].tex_coords.d_x);
+        BOOST_CHECK_EQUAL(v[4], vertices[i].tex_coords.d_y);
+        BOOST_CHECK_EQUAL(v[5], vertices[i].colour_val.getRed());
+        BOOST_CHECK_EQUAL(v[6], vertices[i].colour_val.getGreen());
+        BOOST_CHECK_EQUAL(v[7], vertices[i].colour_val.getBlue());
+        BOOST_CHECK_EQUAL(v[8], vertices[i].colour_val.getAlpha());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AppendGeometry)
+{
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBuffer();
+
+    std::vector<CEGUI::Vertex> vertices;
+    makeVertices(vertices, 60);
+
+    buffer.reserveVertices(vertices.size());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 0u);
+
+    buffer.appendGeometry(&vertices[0], vertices.size());
+    buffer.appendVertex(vertices[0]);
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 61u);
+
+    buffer.reset();
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 0u);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(PackedConversion)
+{
+    std::vector<CEGUI::Vertex> vertices;
+    makeVertices(vertices, 7);
+
+    std::vector<CEGUI::PackedVertex> packed(vertices.size());
+    CEGUI::VertexConverter::toPackedVertices(&vertices[0], vertices.size(), &packed[0]);
+
+    std::vector<CEGUI::Vertex> unpacked(vertices.size());
+    CEGUI::VertexConverter::fromPackedVertices(&packed[0], packed.size(), &unpacked[0]);
+
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(packed[i].x, vertices[i].position.d_x);
+        BOOST_CHECK_EQUAL(packed[i].y, vertices[i].position.d_y);
+        BOOST_CHECK_EQUAL(packed[i].u, vertices[i].tex_coords.d_x);
+        BOOST_CHECK_EQUAL(packed[i].v, vertices[i].tex_coords.d_y);
+        BOOST_CHECK_EQUAL(packed[i].colour, vertices[i].colour_val.getARGB());
+
+        BOOST_CHECK_EQUAL(unpacked[i].position.d_x, vertices[i].position.d_x);
+        BOOST_CHECK_EQUAL(unpacked[i].position.d_y, vertices[i].position.d_y);
+        BOOST_CHECK_EQUAL(unpacked[i].position.d_z, 0.0f);
+        BOOST_CHECK_EQUAL(unpacked[i].tex_coords.d_x, vertices[i].tex_coords.d_x);
+        BOOST_CHECK_EQUAL(unpacked[i].tex_coords.d_y, vertices[i].tex_coords.d_y);
+        BOOST_CHECK_EQUAL(unpacked[i].colour_val.getARGB(), vertices[i].colour_val.getARGB());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AppendPackedGeometry)
+{
+    // renderers without native support expand packed vertices on append
+    CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBuffer();
+    BOOST_CHECK(!buffer.isPackedGeometryNative());
+
+    std::vector<CEGUI::Vertex> vertices;
+    makeVertices(vertices, 150);
+    std::vector<CEGUI::PackedVertex> packed(vertices.size());
+    CEGUI::VertexConverter::toPackedVertices(&vertices[0], vertices.size(), &packed[0]);
+
+    buffer.appendPackedGeometry(&packed[0], packed.size());
+    BOOST_CHECK_EQUAL(buffer.getVertexCount(), 150u);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(PackedImageAndText)
+{
+    CEGUI::Font& font = CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+    const CEGUI::Image* image = font.getGlyphData('W')->getImage();
+    BOOST_REQUIRE(dynamic_cast<const CEGUI::BasicImage*>(image));
+
+    const CEGUI::ColourRect colours(CEGUI::Colour(0xFF336699), CEGUI::Colour(0x80FF0000),
+                                    CEGUI::Colour(0x4000FF00), CEGUI::Colour(0xFF0000FF));
+    const CEGUI::Rectf dest(10.0f, 20.0f, 42.0f, 60.0f);
+    const CEGUI::Rectf clip(15.0f, 0.0f, 100.0f, 50.0f);
+    const CEGUI::Rectf outside(200.0f, 200.0f, 300.0f, 300.0f);
+
+    StoringGeometryBuffer vertex_buffer(false);
+    StoringGeometryBuffer packed_buffer(true);
+
+    for (int native = 0; native < 2; ++native)
+    {
+        StoringGeometryBuffer& buffer = native ? packed_buffer : vertex_buffer;
+        image->render(buffer, dest, 0, colours);
+        image->render(buffer, dest, &clip, colours);
+        image->render(buffer, dest, &outside, colours);
+        font.drawText(buffer, PackedTestText, CEGUI::Vector2f(3.0f, 7.0f), &clip, colours);
+    }
+
+    // packed vertices must describe the same geometry, in the same order
+    BOOST_CHECK_EQUAL(packed_buffer.getVertexCount(), vertex_buffer.getVertexCount());
+    BOOST_CHECK(packed_buffer.getVertexBytes() < vertex_buffer.getVertexBytes());
+
+    const std::vector<float> expected(vertex_buffer.getFloats());
+    const std::vector<float> actual(packed_buffer.getFloats());
+    BOOST_CHECK_EQUAL_COLLECTIONS(actual.begin(), actual.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const unsigned int vertexCount = 6 * 1000;
+    const unsigned int iterations = 200;
+
+    std::vector<CEGUI::Vertex> vertices;
+    makeVertices(vertices, vertexCount);
+
+    {
+        std::vector<float> out(vertexCount * CEGUI::VertexConverter::PositionTexColourFloatCount);
+
+        boost::timer timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+            CEGUI::VertexConverter::toPositionTexColourFloats(&vertices[0], vertexCount, &out[0]);
+
+        const double elapsed = timer.elapsed();
+        BOOST_TEST_MESSAGE("VertexConverter (" << CEGUI::VertexConverter::getImplementationName() << "), "
+                           << iterations << "x " << vertexCount << " vertices: " << elapsed << "s, "
+                           << (elapsed > 0 ? iterations * vertexCount / elapsed : 0) << " vertices/s");
+    }
+
+    {
+        CEGUI::Renderer* renderer = CEGUI::System::getSingleton().getRenderer();
+        CEGUI::GeometryBuffer& buffer = renderer->createGeometryBuffer();
+
+        boost::timer timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            buffer.reset();
+            // append one quad at a time, as Image::render does
+            for (unsigned int v = 0; v < vertexCount; v += 6)
+                buffer.appendGeometry(&vertices[v], 6);
+        }
+
+        const double elapsed = timer.elapsed();
+        BOOST_TEST_MESSAGE("GeometryBuffer::appendGeometry, " << iterations << "x " << vertexCount
+                           << " vertices: " << elapsed << "s, "
+                           << (elapsed > 0 ? iterations * vertexCount / elapsed : 0) << " vertices/s");
+
+        renderer->destroyGeometryBuffer(buffer);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PackedPerformance)
+{
+    const unsigned int iterations = 2000;
+
+    CEGUI::Font& font = CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+    const CEGUI::Image* image = font.getGlyphData('W')->getImage();
+    const CEGUI::ColourRect colours(CEGUI::Colour(0xFF336699));
+    const CEGUI::Rectf dest(10.0f, 20.0f, 42.0f, 60.0f);
+
+    for (int native = 0; native < 2; ++native)
+    {
+        StoringGeometryBuffer buffer(native != 0);
+
+        boost::timer timer;
+        for (unsigned int i = 0; i < iterations; ++i)
+        {
+            buffer.reset();
+            for (unsigned int q = 0; q < 50; ++q)
+                image->render(buffer, dest, 0, colours);
+            font.drawText(buffer, PackedTestText, CEGUI::Vector2f(3.0f, 7.0f), 0, colours);
+        }
+
+        const double elapsed = timer.elapsed();
+        BOOST_TEST_MESSAGE("BasicImage::render + Font::drawText ("
+                           << (native ? "PackedVertex" : "Vertex") << "), "
+                           << iterations << "x " << buffer.getVertexCount() << " vertices: "
+                           << elapsed << "s, "
+                           << (elapsed > 0 ? iterations * buffer.getVertexCount() / elapsed : 0)
+                           << " vertices/s, "
+                           << buffer.getVertexBytes() / buffer.getVertexCount() << " bytes/vertex");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,151 @@
+/***********************************************************************
+ *    filename:   GlyphAtlas.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/GlyphAtlas.h"
+#include "CEGUI/BasicImage.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Texture.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+struct Allocation
+{
+    const CEGUI::Texture* texture;
+    CEGUI::Rectf area;
+};
+
+static bool areasTooClose(const CEGUI::Rectf& a, const CEGUI::Rectf& b,
+                          float padding)
+{
+    return a.left() < b.right() + padding && b.left() < a.right() + padding &&
+           a.top() < b.bottom() + padding && b.top() < a.bottom() + padding;
+}
+
+BOOST_AUTO_TEST_SUITE(GlyphAtlas)
+
+BOOST_AUTO_TEST_CASE(AllocationsDoNotOverlap)
+{
+    CEGUI::GlyphAtlas atlas("GlyphAtlasTest", 128, 2);
+    std::vector<Allocation> allocations;
+
+    // deterministic spread of glyph-like sizes
+    unsigned int seed = 12345;
+    for (int i = 0; i < 400; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const CEGUI::uint w = 3 + (seed >> 16) % 22;
+        const CEGUI::uint h = 5 + (seed >> 8) % 20;
+
+        Allocation alloc;
+        alloc.texture = &atlas.allocate(w, h, alloc.area);
+        BOOST_CHECK_EQUAL(alloc.area.getWidth(), static_cast<float>(w));
+        BOOST_CHECK_EQUAL(alloc.area.getHeight(), static_cast<float>(h));
+        allocations.push_back(alloc);
+    }
+
+    // the first page could not hold everything, later pages are larger.
+    BOOST_REQUIRE(atlas.getPageCount() > 1);
+    BOOST_CHECK_EQUAL(atlas.getPageTexture(0).getSize().d_width, 128.0f);
+    BOOST_CHECK_EQUAL(atlas.getPageTexture(1).getSize().d_width, 256.0f);
+
+    for (size_t i = 0; i < allocations.size(); ++i)
+    {
+        const Allocation& a = allocations[i];
+        const CEGUI::Sizef& size = a.texture->getSize();
+        BOOST_CHECK(a.area.left() >= 2 && a.area.top() >= 2);
+        BOOST_CHECK(a.area.right() <= size.d_width - 2);
+        BOOST_CHECK(a.area.bottom() <= size.d_height - 2);
+
+        for (size_t j = i + 1; j < allocations.size(); ++j)
+            if (allocations[j].texture == a.texture)
+                BOOST_CHECK(!areasTooClose(a.area, allocations[j].area, 2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PackingDensity)
+{
+    CEGUI::GlyphAtlas atlas("GlyphAtlasTest", 256, 2);
+
+    // fill the first page with uniformly sized glyphs
+    CEGUI::Rectf area;
+    while (atlas.getPageCount() < 2)
+        atlas.allocate(9, 13, area);
+
+    BOOST_CHECK(atlas.getPageOccupancy(0) > 0.9f);
+}
+
+BOOST_AUTO_TEST_CASE(ReleaseDestroysPages)
+{
+    CEGUI::Renderer& renderer = *CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GlyphAtlas atlas("GlyphAtlasTest", 64, 1);
+
+    std::vector<const CEGUI::Texture*> textures;
+    CEGUI::Rectf area;
+    for (int i = 0; i < 100; ++i)
+        textures.push_back(&atlas.allocate(12, 12, area));
+    // empty areas still reference a page
+    textures.push_back(&atlas.allocate(0, 0, area));
+    BOOST_CHECK_EQUAL(area.getWidth(), 0.0f);
+
+    const size_t page_count = atlas.getPageCount();
+    BOOST_REQUIRE(page_count > 1);
+    const CEGUI::String first_name(atlas.getPageTexture(0).getName());
+    BOOST_CHECK(renderer.isTextureDefined(first_name));
+
+    for (size_t i = 0; i < textures.size(); ++i)
+        atlas.release(*textures[i]);
+
+    BOOST_CHECK_EQUAL(atlas.getPageCount(), 0u);
+    BOOST_CHECK(!renderer.isTextureDefined(first_name));
+}
+
+#ifdef CEGUI_HAS_FREETYPE
+BOOST_AUTO_TEST_CASE(FontsShareAtlas)
+{
+    CEGUI::FontManager& fm = CEGUI::FontManager::getSingleton();
+    const CEGUI::Font& font = fm.get("DejaVuSans-12");
+    const CEGUI::Font& other =
+        fm.createFreeTypeFont("GlyphAtlasTest-10", 10, true, "DejaVuSans.ttf");
+
+    const CEGUI::BasicImage* a = static_cast<const CEGUI::BasicImage*>(
+        font.getGlyphData('A')->getImage());
+    const CEGUI::BasicImage* b = static_cast<const CEGUI::BasicImage*>(
+        other.getGlyphData('A')->getImage());
+
+    BOOST_CHECK(a->getTexture() != 0);
+    BOOST_CHECK_EQUAL(a->getTexture(), b->getTexture());
+
+    fm.destroy("GlyphAtlasTest-10");
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
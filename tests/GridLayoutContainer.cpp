@@ -0,0 +1,212 @@
+/***********************************************************************
+ *    filename:   GridLayoutContainer.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/GridLayoutContainer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Exceptions.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+struct GridLayoutContainerFixture
+{
+    GridLayoutContainerFixture()
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_grid = static_cast<CEGUI::GridLayoutContainer*>(
+            CEGUI::WindowManager::getSingleton().createWindow("GridLayoutContainer"));
+        d_root->addChild(d_grid);
+    }
+
+    ~GridLayoutContainerFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::Window* createCell(float width, float height)
+    {
+        CEGUI::Window* wnd = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        wnd->setSize(CEGUI::USize(CEGUI::UDim(0, width), CEGUI::UDim(0, height)));
+
+        return wnd;
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::GridLayoutContainer* d_grid;
+};
+
+BOOST_FIXTURE_TEST_SUITE(GridLayoutContainer, GridLayoutContainerFixture)
+
+BOOST_AUTO_TEST_CASE(EmptyCellsHaveNoWindows)
+{
+    d_grid->setGridDimensions(64, 64);
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 0u);
+    BOOST_CHECK(d_grid->getChildAtPosition(10, 20) == 0);
+
+    CEGUI::Window* wnd = createCell(10, 10);
+    d_grid->addChildToPosition(wnd, 10, 20);
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 1u);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(10, 20), wnd);
+
+    d_grid->removeChildFromPosition(10, 20);
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 0u);
+    BOOST_CHECK(d_grid->getChildAtPosition(10, 20) == 0);
+
+    // removing from an empty cell does nothing
+    d_grid->removeChildFromPosition(10, 20);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(wnd);
+}
+
+BOOST_AUTO_TEST_CASE(Layout)
+{
+    d_grid->setGridDimensions(3, 3);
+
+    CEGUI::Window* first = createCell(10, 20);
+    CEGUI::Window* second = createCell(30, 5);
+    d_grid->addChildToPosition(first, 0, 0);
+    d_grid->addChildToPosition(second, 2, 1);
+    d_grid->layout();
+
+    BOOST_CHECK_EQUAL(first->getPosition(), CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0)));
+    // the empty middle column takes no space
+    BOOST_CHECK_EQUAL(second->getPosition(), CEGUI::UVector2(CEGUI::UDim(0, 10), CEGUI::UDim(0, 20)));
+    BOOST_CHECK_EQUAL(d_grid->getSize(), CEGUI::USize(CEGUI::UDim(0, 40), CEGUI::UDim(0, 25)));
+
+    // resizing a child updates the cached row and column sizes
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 15), CEGUI::UDim(0, 20)));
+    BOOST_CHECK(d_grid->needsLayouting());
+    d_grid->layout();
+    BOOST_CHECK_EQUAL(second->getPosition(), CEGUI::UVector2(CEGUI::UDim(0, 15), CEGUI::UDim(0, 20)));
+    BOOST_CHECK_EQUAL(d_grid->getSize(), CEGUI::USize(CEGUI::UDim(0, 45), CEGUI::UDim(0, 25)));
+
+    // and so does removing one
+    d_grid->removeChild(first);
+    d_grid->layout();
+    BOOST_CHECK_EQUAL(second->getPosition(), CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0)));
+    BOOST_CHECK_EQUAL(d_grid->getSize(), CEGUI::USize(CEGUI::UDim(0, 30), CEGUI::UDim(0, 5)));
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(first);
+}
+
+BOOST_AUTO_TEST_CASE(ResizeKeepsChildren)
+{
+    d_grid->setGridDimensions(4, 4);
+
+    CEGUI::Window* kept = createCell(10, 10);
+    CEGUI::Window* dropped = createCell(10, 10);
+    dropped->setDestroyedByParent(false);
+    d_grid->addChildToPosition(kept, 1, 1);
+    d_grid->addChildToPosition(dropped, 3, 0);
+
+    d_grid->setGridDimensions(2, 8);
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 1u);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(1, 1), kept);
+    BOOST_CHECK(dropped->getParent() == 0);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(dropped);
+}
+
+BOOST_AUTO_TEST_CASE(SwapAndMove)
+{
+    d_grid->setGridDimensions(3, 2);
+
+    CEGUI::Window* first = createCell(10, 10);
+    CEGUI::Window* second = createCell(10, 10);
+    d_grid->addChildToPosition(first, 0, 0);
+    d_grid->addChildToPosition(second, 1, 1);
+
+    d_grid->swapChildren(first, second);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(1, 1), first);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(0, 0), second);
+
+    // swapping with an empty cell moves the child there
+    d_grid->swapChildPositions(1, 1, 2, 0);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(2, 0), first);
+    BOOST_CHECK(d_grid->getChildAtPosition(1, 1) == 0);
+
+    d_grid->moveChildToPosition(second, 2, 1);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(2, 1), second);
+    BOOST_CHECK(d_grid->getChildAtPosition(0, 0) == 0);
+    BOOST_CHECK_EQUAL(d_grid->getChildCount(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(AutoPositioning)
+{
+    d_grid->setGridDimensions(2, 2);
+    d_grid->setAutoPositioning(CEGUI::GridLayoutContainer::AP_TopToBottom);
+
+    CEGUI::Window* cells[4];
+    for (size_t i = 0; i < 4; ++i)
+    {
+        cells[i] = createCell(10, 10);
+        d_grid->addChild(cells[i]);
+    }
+
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(0, 0), cells[0]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(0, 1), cells[1]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(1, 0), cells[2]);
+    BOOST_CHECK_EQUAL(d_grid->getChildAtPosition(1, 1), cells[3]);
+
+    // the sequence has run out of cells
+    CEGUI::Window* extra = createCell(10, 10);
+    BOOST_CHECK_THROW(d_grid->addChild(extra), CEGUI::InvalidRequestException);
+    BOOST_CHECK(extra->getParent() == 0);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(extra);
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const size_t gridSize = 64;
+    const size_t iterations = 100;
+
+    d_grid->setGridDimensions(gridSize, gridSize);
+
+    // a sparsely filled inventory: one item per row
+    for (size_t y = 0; y < gridSize; ++y)
+        d_grid->addChildToPosition(createCell(32, 32), y, y);
+
+    boost::timer timer;
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        d_grid->setGridDimensions(gridSize + i % 2, gridSize);
+        d_grid->layout();
+    }
+
+    const double elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("GridLayoutContainer " << gridSize << "x" << gridSize << " with " << d_grid->getChildCount()
+                       << " children, " << iterations << " resizes and layouts: " << elapsed << "s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,160 @@
+/***********************************************************************
+ *    filename:   Listbox.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/Listbox.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+struct ListboxFixture
+{
+    ListboxFixture()
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_listbox = static_cast<CEGUI::Listbox*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Listbox"));
+        d_listbox->setArea(CEGUI::URect(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0),
+                                        CEGUI::UDim(0, 300), CEGUI::UDim(0, 400)));
+        d_root->addChild(d_listbox);
+    }
+
+    ~ListboxFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    // compare the cached metrics against measuring every item
+    void checkMetrics()
+    {
+        float top = 0.0f;
+        float widest = 0.0f;
+
+        for (size_t i = 0; i < d_listbox->getItemCount(); ++i)
+        {
+            const CEGUI::Sizef size(d_listbox->getListboxItemFromIndex(i)->getPixelSize());
+
+            BOOST_CHECK_CLOSE(d_listbox->getItemOffset(i) + 1.0f, top + 1.0f, 0.001f);
+            BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(top + size.d_height * 0.5f), i);
+
+            top += size.d_height;
+            widest = ceguimax(widest, size.d_width);
+        }
+
+        BOOST_CHECK_CLOSE(d_listbox->getTotalItemsHeight() + 1.0f, top + 1.0f, 0.001f);
+        BOOST_CHECK_EQUAL(d_listbox->getWidestItemWidth(), widest);
+        BOOST_CHECK_EQUAL(d_listbox->getItemIndexAtOffset(top + 1.0f), d_listbox->getItemCount());
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::Listbox* d_listbox;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Listbox, ListboxFixture)
+
+BOOST_AUTO_TEST_CASE(ItemMetrics)
+{
+    checkMetrics();
+
+    for (int i = 0; i < 20; ++i)
+        d_listbox->addItem(new CEGUI::ListboxTextItem(
+            CEGUI::PropertyHelper<int>::toString(i * 37 % 20)));
+    checkMetrics();
+
+    // multi-line items have different heights
+    CEGUI::ListboxTextItem* tall = new CEGUI::ListboxTextItem("A much wider item\nover\nthree lines");
+    d_listbox->insertItem(tall, d_listbox->getListboxItemFromIndex(4));
+    checkMetrics();
+
+    // per item update, including the widest item getting narrower
+    tall->setText("narrow");
+    d_listbox->handleUpdatedItemData(d_listbox->getItemIndex(tall));
+    checkMetrics();
+
+    CEGUI::ListboxItem* wide = new CEGUI::ListboxTextItem("Another rather wide item");
+    d_listbox->insertItem(wide, 0);
+    checkMetrics();
+    d_listbox->removeItem(wide);
+    checkMetrics();
+
+    d_listbox->setSortingEnabled(true);
+    checkMetrics();
+    d_listbox->addItem(new CEGUI::ListboxTextItem("10 and\nsome"));
+    checkMetrics();
+
+    d_listbox->resetList();
+    checkMetrics();
+}
+
+BOOST_AUTO_TEST_CASE(ItemAtPoint)
+{
+    for (int i = 0; i < 100; ++i)
+        d_listbox->addItem(new CEGUI::ListboxTextItem(
+            CEGUI::PropertyHelper<int>::toString(i)));
+
+    d_listbox->getVertScrollbar()->setScrollPosition(d_listbox->getItemOffset(30) + 1.0f);
+
+    const CEGUI::Rectf area(d_listbox->getListRenderArea());
+    // the listbox is at the screen origin, so window and screen co-ords match
+    const CEGUI::Vector2f pt(area.left() + 5.0f, area.top() + 1.0f);
+
+    BOOST_CHECK_EQUAL(d_listbox->getItemAtPoint(pt), d_listbox->getListboxItemFromIndex(30));
+}
+
+BOOST_AUTO_TEST_CASE(ScrollPerformance)
+{
+    const size_t itemCount = 50000;
+    for (size_t i = 0; i < itemCount; ++i)
+        d_listbox->addItem(new CEGUI::ListboxTextItem(
+            CEGUI::PropertyHelper<int>::toString(static_cast<int>(i))));
+
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+    CEGUI::Scrollbar* scrollbar = d_listbox->getVertScrollbar();
+    const CEGUI::Vector2f pt(d_listbox->getListRenderArea().getPosition() +
+                             CEGUI::Vector2f(5.0f, 5.0f));
+
+    const unsigned int frames = 200;
+    boost::timer timer;
+    for (unsigned int i = 0; i < frames; ++i)
+    {
+        scrollbar->setScrollPosition(scrollbar->getDocumentSize() * i / frames);
+        BOOST_REQUIRE(d_listbox->getItemAtPoint(pt) != 0);
+        context.draw();
+    }
+    BOOST_TEST_MESSAGE("Scroll, hit-test and redraw of " << itemCount << " items, "
+                       << frames << " frames: " << timer.elapsed() << "s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
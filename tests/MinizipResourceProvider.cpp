@@ -0,0 +1,271 @@
+/***********************************************************************
+ *    filename:   MinizipResourceProvider.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/MinizipResourceProvider.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/Exceptions.h"
+
+#include "minizip/zip.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static const char* const ArchiveFilename = "MinizipResourceProviderTest.zip";
+
+struct ArchiveEntry
+{
+    const char* name;
+    size_t size;
+};
+
+static const ArchiveEntry ARCHIVE_ENTRIES[] =
+{
+    { "layouts/a.layout", 100 },
+    { "layouts/b.layout", 200 },
+    { "layouts/readme.txt", 50 },
+    { "layouts/sub/c.layout", 150 },
+    { "looknfeel/d.looknfeel", 300 },
+    { "layouts.layout", 10 }
+};
+
+static const size_t ARCHIVE_ENTRY_COUNT =
+    sizeof(ARCHIVE_ENTRIES) / sizeof(ARCHIVE_ENTRIES[0]);
+
+//! return the content written for the archive entry at \a index.
+static std::string entryContent(size_t index)
+{
+    std::string content;
+    for (size_t i = 0; i < ARCHIVE_ENTRIES[index].size; ++i)
+        content += static_cast<char>('a' + (i * 7 + index) % 26);
+
+    return content;
+}
+
+/*!
+    Writes a zip archive holding ARCHIVE_ENTRIES and opens a
+    MinizipResourceProvider on it, with the "layouts" and "looknfeels"
+    resource groups set to the directories in the archive.
+*/
+struct MinizipResourceProviderFixture
+{
+    MinizipResourceProviderFixture()
+    {
+        zipFile zip = zipOpen(ArchiveFilename, APPEND_STATUS_CREATE);
+        BOOST_REQUIRE(zip);
+
+        for (size_t i = 0; i < ARCHIVE_ENTRY_COUNT; ++i)
+        {
+            const std::string content(entryContent(i));
+
+            BOOST_REQUIRE_EQUAL(zipOpenNewFileInZip(
+                zip, ARCHIVE_ENTRIES[i].name, 0, 0, 0, 0, 0, 0,
+                Z_DEFLATED, Z_DEFAULT_COMPRESSION), ZIP_OK);
+            BOOST_REQUIRE_EQUAL(zipWriteInFileInZip(
+                zip, content.data(),
+                static_cast<unsigned int>(content.size())), ZIP_OK);
+            BOOST_REQUIRE_EQUAL(zipCloseFileInZip(zip), ZIP_OK);
+        }
+
+        BOOST_REQUIRE_EQUAL(zipClose(zip, 0), ZIP_OK);
+
+        d_provider = CEGUI_NEW_AO CEGUI::MinizipResourceProvider(
+            ArchiveFilename, false);
+        d_provider->setResourceGroupDirectory("layouts", "layouts/");
+        d_provider->setResourceGroupDirectory("looknfeels", "looknfeel/");
+    }
+
+    ~MinizipResourceProviderFixture()
+    {
+        CEGUI_DELETE_AO d_provider;
+        std::remove(ArchiveFilename);
+    }
+
+    //! load \a filename from \a group and return its content.
+    std::string load(const CEGUI::String& filename, const CEGUI::String& group)
+    {
+        CEGUI::RawDataContainer data;
+        d_provider->loadRawDataContainer(filename, data, group);
+
+        const std::string content(
+            reinterpret_cast<const char*>(data.getDataPtr()), data.getSize());
+
+        // later loads must not be affected by changes to the returned data.
+        if (data.getSize())
+            data.getDataPtr()[0] ^= 0xFF;
+
+        return content;
+    }
+
+    CEGUI::MinizipResourceProvider* d_provider;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MinizipResourceProvider,
+                         MinizipResourceProviderFixture)
+
+BOOST_AUTO_TEST_CASE(IndexedLookup)
+{
+    BOOST_CHECK(load("a.layout", "layouts") == entryContent(0));
+    BOOST_CHECK(load("b.layout", "layouts") == entryContent(1));
+    BOOST_CHECK(load("sub/c.layout", "layouts") == entryContent(3));
+    BOOST_CHECK(load("d.looknfeel", "looknfeels") == entryContent(4));
+    BOOST_CHECK(load("layouts.layout", "") == entryContent(5));
+
+    // every entry can be loaded again, in any order.
+    for (size_t i = ARCHIVE_ENTRY_COUNT; i-- > 0; )
+        BOOST_CHECK(load(ARCHIVE_ENTRIES[i].name, "") == entryContent(i));
+
+    BOOST_CHECK_THROW(load("missing.layout", "layouts"),
+                      CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(load("a.layout", "looknfeels"),
+                      CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(WildcardQueries)
+{
+    std::vector<CEGUI::String> names;
+
+    // names in subdirectories and outside the group's directory do not match.
+    BOOST_CHECK_EQUAL(d_provider->getResourceGroupFileNames(
+        names, "*.layout", "layouts"), 2u);
+    std::sort(names.begin(), names.end());
+    BOOST_REQUIRE_EQUAL(names.size(), 2u);
+    BOOST_CHECK_EQUAL(names[0], "a.layout");
+    BOOST_CHECK_EQUAL(names[1], "b.layout");
+
+    names.clear();
+    BOOST_CHECK_EQUAL(d_provider->getResourceGroupFileNames(
+        names, "*", "layouts"), 3u);
+
+    names.clear();
+    BOOST_CHECK_EQUAL(d_provider->getResourceGroupFileNames(
+        names, "sub/*.layout", "layouts"), 1u);
+    BOOST_REQUIRE_EQUAL(names.size(), 1u);
+    BOOST_CHECK_EQUAL(names[0], "sub/c.layout");
+
+    names.clear();
+    BOOST_CHECK_EQUAL(d_provider->getResourceGroupFileNames(
+        names, "*.looknfeel", "looknfeels"), 1u);
+    BOOST_REQUIRE_EQUAL(names.size(), 1u);
+    BOOST_CHECK_EQUAL(names[0], "d.looknfeel");
+
+    names.clear();
+    BOOST_CHECK_EQUAL(d_provider->getResourceGroupFileNames(
+        names, "*.scheme", "layouts"), 0u);
+    BOOST_CHECK(names.empty());
+}
+
+BOOST_AUTO_TEST_CASE(CacheEviction)
+{
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 0u);
+
+    // nothing is kept while the cache is disabled.
+    load("a.layout", "layouts");
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 0u);
+
+    d_provider->setCacheSize(450);
+    BOOST_CHECK_EQUAL(d_provider->getCacheSize(), 450u);
+
+    load("a.layout", "layouts");
+    load("b.layout", "layouts");
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 300u);
+
+    // a hit makes a.layout the most recently used, and returns a copy.
+    BOOST_CHECK(load("a.layout", "layouts") == entryContent(0));
+    BOOST_CHECK(load("a.layout", "layouts") == entryContent(0));
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 300u);
+
+    // d.looknfeel only fits once b.layout, the least recently used, is gone.
+    load("d.looknfeel", "looknfeels");
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 400u);
+    BOOST_CHECK(load("a.layout", "layouts") == entryContent(0));
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 400u);
+
+    // now d.looknfeel is the least recently used, and makes room for b.layout.
+    BOOST_CHECK(load("b.layout", "layouts") == entryContent(1));
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 300u);
+
+    // shrinking the cache discards the least recently used files to fit.
+    d_provider->setCacheSize(250);
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 200u);
+
+    // files bigger than the cache are loaded without being kept.
+    BOOST_CHECK(load("d.looknfeel", "looknfeels") == entryContent(4));
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 200u);
+
+    d_provider->setCacheSize(150);
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 0u);
+
+    load("a.layout", "layouts");
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 100u);
+    d_provider->clearCache();
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(Preload)
+{
+    std::vector<CEGUI::String> names;
+    names.push_back("a.layout");
+    names.push_back("b.layout");
+    names.push_back("sub/c.layout");
+    names.push_back("missing.layout");
+
+    // nothing is preloaded while the cache is disabled.
+    BOOST_CHECK_EQUAL(d_provider->preloadFiles(names, "layouts", 2), 0u);
+
+    d_provider->setCacheSize(1000);
+    BOOST_CHECK_EQUAL(d_provider->preloadFiles(names, "layouts", 2), 3u);
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 450u);
+
+    // files already in the cache are not decompressed again.
+    BOOST_CHECK_EQUAL(d_provider->preloadFiles(names, "layouts", 2), 0u);
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 450u);
+
+    // loads are served from the cache.
+    BOOST_CHECK(load("a.layout", "layouts") == entryContent(0));
+    BOOST_CHECK(load("b.layout", "layouts") == entryContent(1));
+    BOOST_CHECK(load("sub/c.layout", "layouts") == entryContent(3));
+    BOOST_CHECK_EQUAL(d_provider->getCachedBytes(), 450u);
+
+    // files that do not fit are skipped.
+    d_provider->clearCache();
+    d_provider->setCacheSize(250);
+    std::vector<CEGUI::String> all;
+    for (size_t i = 0; i < ARCHIVE_ENTRY_COUNT; ++i)
+        all.push_back(ARCHIVE_ENTRIES[i].name);
+
+    const size_t added = d_provider->preloadFiles(all, "", 0);
+    BOOST_CHECK(added > 0);
+    BOOST_CHECK(added < ARCHIVE_ENTRY_COUNT);
+    BOOST_CHECK(d_provider->getCachedBytes() <= 250u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,391 @@
+/***********************************************************************
+ *    filename:   MultiColumnList.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/MultiColumnList.h"
+#include "CEGUI/widgets/ListboxTextItem.h"
+#include "CEGUI/widgets/Scrollbar.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <cstdio>
+#include <vector>
+
+// Zero padded so that text order and numeric order agree.
+static CEGUI::String makeKey(unsigned int value)
+{
+    char buff[16];
+    std::sprintf(buff, "%06u", value);
+    return buff;
+}
+
+// Data source holding two columns of text items, counting item requests.
+class TestDataSource : public CEGUI::MultiColumnListDataSource
+{
+public:
+    TestDataSource() : d_requests(0) {}
+
+    ~TestDataSource()
+    {
+        for (size_t i = 0; i < d_items.size(); ++i)
+            delete d_items[i];
+    }
+
+    void insertRow(CEGUI::uint row, unsigned int key)
+    {
+        d_items.insert(d_items.begin() + row * 2,
+                       new CEGUI::ListboxTextItem(makeKey(key)));
+        d_items.insert(d_items.begin() + row * 2 + 1,
+                       new CEGUI::ListboxTextItem("row " + makeKey(key)));
+    }
+
+    void removeRow(CEGUI::uint row)
+    {
+        delete d_items[row * 2];
+        delete d_items[row * 2 + 1];
+        d_items.erase(d_items.begin() + row * 2, d_items.begin() + row * 2 + 2);
+    }
+
+    CEGUI::ListboxTextItem* getKeyItem(CEGUI::uint row)
+    {
+        return d_items[row * 2];
+    }
+
+    CEGUI::uint getRowCount() const
+    {
+        return static_cast<CEGUI::uint>(d_items.size() / 2);
+    }
+
+    CEGUI::ListboxItem* getItem(CEGUI::uint source_row, CEGUI::uint col_id) const
+    {
+        ++d_requests;
+        return d_items[source_row * 2 + col_id];
+    }
+
+    mutable size_t d_requests;
+
+private:
+    std::vector<CEGUI::ListboxTextItem*> d_items;
+};
+
+struct MultiColumnListFixture
+{
+    MultiColumnListFixture() :
+        d_contentsChangedCount(0)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_list = createList();
+        d_list->subscribeEvent(CEGUI::MultiColumnList::EventListContentsChanged,
+            CEGUI::Event::Subscriber(&MultiColumnListFixture::onContentsChanged, this));
+    }
+
+    ~MultiColumnListFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::MultiColumnList* createList()
+    {
+        CEGUI::MultiColumnList* list = static_cast<CEGUI::MultiColumnList*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiColumnList"));
+        list->setArea(CEGUI::URect(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0),
+                                   CEGUI::UDim(0, 400), CEGUI::UDim(0, 300)));
+        list->addColumn("Key", 0, CEGUI::UDim(0.5f, 0));
+        list->addColumn("Text", 1, CEGUI::UDim(0.5f, 0));
+        list->setSortColumn(0);
+        list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+        d_root->addChild(list);
+
+        return list;
+    }
+
+    bool onContentsChanged(const CEGUI::EventArgs&)
+    {
+        ++d_contentsChangedCount;
+        return true;
+    }
+
+    void addRow(CEGUI::MultiColumnList* list, unsigned int key)
+    {
+        const CEGUI::uint row = list->addRow(new CEGUI::ListboxTextItem(makeKey(key)), 0);
+        list->setItem(new CEGUI::ListboxTextItem("row " + makeKey(key)), 1, row);
+    }
+
+    // check rows are in ascending order of the key column
+    void checkSorted(CEGUI::MultiColumnList* list)
+    {
+        for (CEGUI::uint i = 1; i < list->getRowCount(); ++i)
+            BOOST_CHECK(!(list->getItemAtGridReference(CEGUI::MCLGridRef(i, 0))->getText() <
+                          list->getItemAtGridReference(CEGUI::MCLGridRef(i - 1, 0))->getText()));
+    }
+
+    // check every item is found at the position it is shown at
+    void checkGridReferences(CEGUI::MultiColumnList* list)
+    {
+        for (CEGUI::uint i = 0; i < list->getRowCount(); ++i)
+        {
+            for (CEGUI::uint j = 0; j < list->getColumnCount(); ++j)
+            {
+                const CEGUI::ListboxItem* item = list->getItemAtGridReference(CEGUI::MCLGridRef(i, j));
+                if (!item)
+                    continue;
+
+                BOOST_CHECK(list->getItemGridReference(item) == CEGUI::MCLGridRef(i, j));
+                BOOST_CHECK(list->isListboxItemInList(item));
+            }
+        }
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::MultiColumnList* d_list;
+    unsigned int d_contentsChangedCount;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiColumnList, MultiColumnListFixture)
+
+BOOST_AUTO_TEST_CASE(BatchedInsert)
+{
+    CEGUI::MultiColumnList* reference = createList();
+
+    d_list->beginUpdate();
+    d_list->beginUpdate();
+    for (unsigned int i = 0; i < 200; ++i)
+    {
+        addRow(d_list, i * 37 % 101);
+        addRow(reference, i * 37 % 101);
+    }
+    d_list->endUpdate();
+    BOOST_CHECK(d_list->isUpdating());
+    BOOST_CHECK_EQUAL(d_contentsChangedCount, 0u);
+    d_list->endUpdate();
+
+    BOOST_CHECK(!d_list->isUpdating());
+    BOOST_CHECK_EQUAL(d_contentsChangedCount, 1u);
+    BOOST_REQUIRE_EQUAL(d_list->getRowCount(), reference->getRowCount());
+    checkSorted(d_list);
+
+    // a batch sorts to the same order as inserting each row individually
+    for (CEGUI::uint i = 0; i < d_list->getRowCount(); ++i)
+        BOOST_CHECK_EQUAL(d_list->getItemAtGridReference(CEGUI::MCLGridRef(i, 1))->getText(),
+                          reference->getItemAtGridReference(CEGUI::MCLGridRef(i, 1))->getText());
+
+    BOOST_CHECK_THROW(d_list->endUpdate(), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(ItemGridReference)
+{
+    for (unsigned int i = 0; i < 50; ++i)
+        addRow(d_list, i * 7 % 50);
+    d_list->removeRow(10);
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Descending);
+    checkGridReferences(d_list);
+
+    CEGUI::ListboxTextItem detached("detached");
+    BOOST_CHECK(!d_list->isListboxItemInList(&detached));
+    BOOST_CHECK_THROW(d_list->getItemRowIndex(&detached), CEGUI::InvalidRequestException);
+}
+
+BOOST_AUTO_TEST_CASE(ItemRowsAfterEdits)
+{
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::None);
+    for (unsigned int i = 0; i < 20; ++i)
+        addRow(d_list, i * 3);
+
+    d_list->insertRow(new CEGUI::ListboxTextItem(makeKey(100)), 0, 5);
+    d_list->insertRow(new CEGUI::ListboxTextItem(makeKey(101)), 0, 0);
+    checkGridReferences(d_list);
+
+    d_list->removeRow(12);
+    d_list->setItem(new CEGUI::ListboxTextItem("replaced"), 1, 3);
+    checkGridReferences(d_list);
+
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::Ascending);
+    checkGridReferences(d_list);
+
+    d_list->getItemAtGridReference(CEGUI::MCLGridRef(2, 0))->setText(makeKey(40));
+    d_list->handleUpdatedRowData(2);
+    checkSorted(d_list);
+    checkGridReferences(d_list);
+}
+
+BOOST_AUTO_TEST_CASE(UpdatedRowData)
+{
+    for (unsigned int i = 0; i < 50; ++i)
+        addRow(d_list, i * 2);
+
+    CEGUI::ListboxItem* item = d_list->getItemAtGridReference(CEGUI::MCLGridRef(5, 0));
+    item->setText(makeKey(71));
+
+    const CEGUI::uint row = d_list->handleUpdatedRowData(5);
+    BOOST_CHECK_EQUAL(row, 35u);
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), row);
+    checkSorted(d_list);
+}
+
+BOOST_AUTO_TEST_CASE(DataSource)
+{
+    TestDataSource source;
+    for (unsigned int i = 0; i < 100; ++i)
+        source.insertRow(i, (i * 37) % 100);
+
+    addRow(d_list, 1);
+    d_list->setDataSource(&source);
+    BOOST_CHECK_EQUAL(d_list->getRowCount(), 100u);
+    BOOST_CHECK_THROW(d_list->addRow(), CEGUI::InvalidRequestException);
+    checkSorted(d_list);
+
+    // insert, change and remove rows in the source
+    source.insertRow(0, 1000);
+    d_list->notifyDataSourceRowInserted(0);
+    BOOST_CHECK_EQUAL(d_list->getDataSourceRow(100), 0u);
+
+    source.getKeyItem(1)->setText(makeKey(50) + "a");
+    d_list->notifyDataSourceRowChanged(1);
+    BOOST_CHECK_EQUAL(d_list->getDataSourceRow(50), 1u);
+
+    source.removeRow(0);
+    d_list->notifyDataSourceRowRemoved(0);
+    BOOST_CHECK_EQUAL(d_list->getRowCount(), 100u);
+    BOOST_CHECK_EQUAL(d_list->getDataSourceRow(50), 0u);
+    checkSorted(d_list);
+
+    CEGUI::ListboxItem* item = source.getKeyItem(0);
+    BOOST_CHECK_EQUAL(d_list->getItemRowIndex(item), 50u);
+
+    // unsorted rows are shown in source order
+    d_list->setSortDirection(CEGUI::ListHeaderSegment::None);
+    for (CEGUI::uint i = 0; i < d_list->getRowCount(); ++i)
+        BOOST_CHECK_EQUAL(d_list->getDataSourceRow(i), i);
+
+    d_list->setDataSource(0);
+    BOOST_CHECK_EQUAL(d_list->getRowCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(DataSourceVisibleRows)
+{
+    TestDataSource source;
+    const CEGUI::uint rowCount = 20000;
+    for (CEGUI::uint i = 0; i < rowCount; ++i)
+        source.insertRow(i, rowCount - i);
+
+    d_list->setDataSource(&source);
+
+    CEGUI::Scrollbar* scrollbar = d_list->getVertScrollbar();
+    scrollbar->setScrollPosition(scrollbar->getDocumentSize() / 2);
+
+    // rows from a data source all share the height of the first row
+    const float rowHeight = d_list->getHighestRowItemHeight(0);
+    BOOST_CHECK_CLOSE(d_list->getTotalRowsHeight(), rowHeight * rowCount, 0.001f);
+
+    d_list->ensureRowIsVisible(1000);
+    BOOST_CHECK_CLOSE(scrollbar->getScrollPosition(), rowHeight * 1000, 0.001f);
+
+    // drawing asks the source only for the rows that are visible
+    source.d_requests = 0;
+    d_list->invalidate();
+    CEGUI::System::getSingleton().getDefaultGUIContext().draw();
+    BOOST_CHECK(source.d_requests > 0);
+    BOOST_CHECK(source.d_requests < 200);
+}
+
+BOOST_AUTO_TEST_CASE(DataSourceSelection)
+{
+    TestDataSource source;
+    const CEGUI::uint rowCount = 20000;
+    for (CEGUI::uint i = 0; i < rowCount; ++i)
+        source.insertRow(i, (i + 1) * 2);
+
+    d_list->setDataSource(&source);
+    d_list->setSelectionMode(CEGUI::MultiColumnList::RowMultiple);
+
+    // selection is held per source row, so the source is not enumerated
+    source.d_requests = 0;
+    d_list->setItemSelectState(CEGUI::MCLGridRef(10, 0), true);
+    d_list->setItemSelectState(CEGUI::MCLGridRef(15000, 1), true);
+    BOOST_CHECK_EQUAL(d_list->getSelectedCount(), 4u);
+
+    CEGUI::ListboxItem* first = d_list->getFirstSelectedItem();
+    BOOST_REQUIRE(first);
+    BOOST_CHECK(d_list->getItemGridReference(first) == CEGUI::MCLGridRef(10, 0));
+    BOOST_CHECK(first->isSelected());
+    BOOST_CHECK(d_list->getNextSelected(first) ==
+                d_list->getItemAtGridReference(CEGUI::MCLGridRef(10, 1)));
+    BOOST_CHECK(!d_list->isItemSelected(CEGUI::MCLGridRef(11, 0)));
+    BOOST_CHECK(source.d_requests < 100);
+
+    // selection follows its rows as source rows are inserted and removed
+    source.insertRow(0, 1);
+    d_list->notifyDataSourceRowInserted(0);
+    BOOST_CHECK(d_list->getItemGridReference(first) == CEGUI::MCLGridRef(11, 0));
+    BOOST_CHECK(d_list->isItemSelected(CEGUI::MCLGridRef(11, 0)));
+    BOOST_CHECK(d_list->isItemSelected(CEGUI::MCLGridRef(15001, 1)));
+    BOOST_CHECK(!d_list->isItemSelected(CEGUI::MCLGridRef(10, 0)));
+
+    const CEGUI::uint removed = d_list->getDataSourceRow(11);
+    source.removeRow(removed);
+    d_list->notifyDataSourceRowRemoved(removed);
+    BOOST_CHECK_EQUAL(d_list->getSelectedCount(), 2u);
+    BOOST_CHECK(d_list->isItemSelected(CEGUI::MCLGridRef(15000, 0)));
+
+    source.d_requests = 0;
+    d_list->clearAllSelections();
+    BOOST_CHECK_EQUAL(d_list->getSelectedCount(), 0u);
+    BOOST_CHECK(d_list->getFirstSelectedItem() == 0);
+    BOOST_CHECK_EQUAL(source.d_requests, 0u);
+    BOOST_CHECK(!d_list->getItemAtGridReference(CEGUI::MCLGridRef(15000, 0))->isSelected());
+}
+
+BOOST_AUTO_TEST_CASE(InsertPerformance)
+{
+    const unsigned int rowCount = 2000;
+
+    boost::timer timer;
+    d_list->beginUpdate();
+    for (unsigned int i = 0; i < rowCount; ++i)
+        addRow(d_list, (i * 7919) % rowCount);
+    d_list->endUpdate();
+    const double batched = timer.elapsed();
+
+    CEGUI::MultiColumnList* unbatched = createList();
+    timer.restart();
+    for (unsigned int i = 0; i < rowCount; ++i)
+        addRow(unbatched, (i * 7919) % rowCount);
+    const double individual = timer.elapsed();
+
+    checkSorted(d_list);
+    BOOST_TEST_MESSAGE("Sorted insert of " << rowCount << " rows: batched "
+                       << batched << "s, individually " << individual << "s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,165 @@
+/***********************************************************************
+ *    filename:   MultiLineEditbox.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/MultiLineEditbox.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+struct MultiLineEditboxFixture
+{
+    MultiLineEditboxFixture()
+    {
+        CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+
+        d_root = winMgr.createWindow("DefaultWindow");
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+
+        d_edited = createEditbox();
+        d_reference = createEditbox();
+    }
+
+    ~MultiLineEditboxFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    CEGUI::MultiLineEditbox* createEditbox()
+    {
+        CEGUI::MultiLineEditbox* editbox = static_cast<CEGUI::MultiLineEditbox*>(
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/MultiLineEditbox"));
+        editbox->setArea(CEGUI::URect(CEGUI::UDim(0, 0), CEGUI::UDim(0, 0),
+                                      CEGUI::UDim(0, 300), CEGUI::UDim(0, 400)));
+        d_root->addChild(editbox);
+
+        return editbox;
+    }
+
+    // compare the incrementally maintained lines with a fresh formatting
+    void checkAgainstReference(const CEGUI::String& text)
+    {
+        d_edited->setText(text);
+        d_reference->setText(text);
+        // force a complete re-format of the reference
+        d_reference->setFont(d_reference->getFont());
+
+        const CEGUI::MultiLineEditbox::LineList& edited = d_edited->getFormattedLines();
+        const CEGUI::MultiLineEditbox::LineList& reference = d_reference->getFormattedLines();
+
+        BOOST_REQUIRE_EQUAL(edited.size(), reference.size());
+        for (size_t i = 0; i < edited.size(); ++i)
+        {
+            BOOST_CHECK_EQUAL(edited[i].d_startIdx, reference[i].d_startIdx);
+            BOOST_CHECK_EQUAL(edited[i].d_length, reference[i].d_length);
+            BOOST_CHECK_EQUAL(edited[i].d_extent, reference[i].d_extent);
+        }
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::MultiLineEditbox* d_edited;
+    CEGUI::MultiLineEditbox* d_reference;
+};
+
+BOOST_FIXTURE_TEST_SUITE(MultiLineEditbox, MultiLineEditboxFixture)
+
+BOOST_AUTO_TEST_CASE(IncrementalFormatting)
+{
+    CEGUI::String text;
+    for (int i = 0; i < 20; ++i)
+        text += "The quick brown fox jumps over the lazy dog, again and again and again.\n";
+    checkAgainstReference(text);
+
+    // type into the middle of a paragraph
+    text.insert(150, "xyz ");
+    checkAgainstReference(text);
+
+    // split a paragraph
+    text.insert(300, "\n");
+    checkAgainstReference(text);
+
+    // join two paragraphs
+    text.erase(text.find('\n', 500), 1);
+    checkAgainstReference(text);
+
+    // replace a span covering several paragraphs
+    text.replace(100, 400, "short\n\nlines\n");
+    checkAgainstReference(text);
+
+    // edits at the very start and the very end
+    text.insert(0, "Start ");
+    checkAgainstReference(text);
+    text.insert(text.length() - 1, " end");
+    checkAgainstReference(text);
+
+    // a token too long to fit on one line
+    text.insert(40, CEGUI::String(200, 'w'));
+    checkAgainstReference(text);
+
+    // no word wrapping
+    d_edited->setWordWrapping(false);
+    d_reference->setWordWrapping(false);
+    text.erase(10, 20);
+    checkAgainstReference(text);
+
+    // everything removed
+    checkAgainstReference("");
+}
+
+BOOST_AUTO_TEST_CASE(TypingPerformance)
+{
+    // a log / console sized document
+    CEGUI::String text;
+    while (text.length() < 200000)
+        text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt.\n";
+    d_edited->setText(text);
+
+    const unsigned int keystrokes = 100;
+    size_t caret = text.length() / 2;
+
+    boost::timer timer;
+    for (unsigned int i = 0; i < keystrokes; ++i)
+    {
+        text.insert(caret++, 1, 'a');
+        d_edited->setText(text);
+    }
+    BOOST_TEST_MESSAGE("Incremental formatting, " << keystrokes << " keystrokes into "
+                       << text.length() << " code points: " << timer.elapsed() << "s");
+
+    timer.restart();
+    for (unsigned int i = 0; i < keystrokes; ++i)
+        d_edited->setFont(d_edited->getFont());
+    BOOST_TEST_MESSAGE("Full formatting, " << keystrokes << " passes: "
+                       << timer.elapsed() << "s");
+
+    BOOST_CHECK(!d_edited->getFormattedLines().empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,181 @@
+/***********************************************************************
+ *    filename:   Profiler.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/Profiler.h"
+#include "CEGUI/ThreadPool.h"
+#include "CEGUI/PropertyHelper.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+
+//! enables the Profiler for a test, and clears it afterwards.
+struct ProfilerFixture
+{
+    ProfilerFixture() :
+        profiler(CEGUI::Profiler::getSingleton())
+    {
+        profiler.clear();
+        profiler.setEnabled(true);
+    }
+
+    ~ProfilerFixture()
+    {
+        profiler.setEnabled(false);
+        profiler.clear();
+    }
+
+    std::string getTrace() const
+    {
+        std::ostringstream out;
+        profiler.writeChromeTrace(out);
+        return out.str();
+    }
+
+    CEGUI::Profiler& profiler;
+};
+
+static size_t countOccurrences(const std::string& str, const std::string& what)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(what); pos != std::string::npos;
+         pos = str.find(what, pos + what.size()))
+        ++count;
+
+    return count;
+}
+
+//! records zones from a ThreadPool thread.
+class ZoneTask : public CEGUI::ThreadPool::Task
+{
+public:
+    void execute()
+    {
+        for (int i = 0; i < 1000; ++i)
+            CEGUI::ProfileZone zone("TestTaskZone");
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(Profiler, ProfilerFixture)
+
+BOOST_AUTO_TEST_CASE(ZonesAreRecorded)
+{
+    {
+        CEGUI::ProfileZone zone("TestZone");
+        BOOST_CHECK(zone.isRecording());
+        zone.setDetail("Root/\"Frame\"");
+    }
+
+    BOOST_CHECK_EQUAL(profiler.getRecordCount(), 1u);
+
+    const std::string trace(getTrace());
+    BOOST_CHECK_EQUAL(trace.compare(0, 15, "{\"traceEvents\":"), 0);
+    BOOST_CHECK(trace.find("\"name\":\"TestZone\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"detail\":\"Root/\\\"Frame\\\"\"") !=
+                std::string::npos);
+
+    // nothing is recorded while disabled.
+    profiler.setEnabled(false);
+    {
+        CEGUI::ProfileZone zone("TestZone");
+        BOOST_CHECK(!zone.isRecording());
+    }
+    BOOST_CHECK_EQUAL(profiler.getRecordCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(CountersAreKeptPerFrame)
+{
+    profiler.count(CEGUI::Profiler::C_BATCHES, 3);
+    profiler.count(CEGUI::Profiler::C_BATCHES);
+    BOOST_CHECK_EQUAL(profiler.getCount(CEGUI::Profiler::C_BATCHES), 4u);
+
+    profiler.endFrame();
+    BOOST_CHECK_EQUAL(profiler.getFrameNumber(), 1u);
+    BOOST_CHECK_EQUAL(profiler.getCount(CEGUI::Profiler::C_BATCHES), 0u);
+    BOOST_CHECK_EQUAL(profiler.getLastFrameCount(CEGUI::Profiler::C_BATCHES),
+                      4u);
+
+    const std::string trace(getTrace());
+    BOOST_CHECK(trace.find("\"name\":\"Frame\"") != std::string::npos);
+    BOOST_CHECK_EQUAL(countOccurrences(trace, "\"Batches\":4"), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(OldestRecordsAreOverwritten)
+{
+    const size_t capacity = CEGUI::Profiler::DEFAULT_CAPACITY;
+
+    for (size_t i = 0; i < capacity + 10; ++i)
+    {
+        CEGUI::ProfileZone zone("TestZone");
+        zone.setDetail(CEGUI::PropertyHelper<CEGUI::uint>::toString(
+            static_cast<CEGUI::uint>(i)));
+    }
+
+    BOOST_CHECK_EQUAL(profiler.getRecordCount(), capacity);
+
+    const std::string trace(getTrace());
+    BOOST_CHECK(trace.find("\"detail\":\"9\"") == std::string::npos);
+    BOOST_CHECK(trace.find("\"detail\":\"10\"") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ZonesAreRecordedFromThreads)
+{
+    CEGUI::ThreadPool pool(4);
+    for (int i = 0; i < 8; ++i)
+        pool.submit(new ZoneTask);
+    pool.waitUntilIdle();
+
+    BOOST_CHECK_EQUAL(profiler.getRecordCount(), 8000u);
+    BOOST_CHECK_EQUAL(countOccurrences(getTrace(), "\"TestTaskZone\""), 8000u);
+}
+
+#ifdef CEGUI_HAS_PROFILER
+BOOST_AUTO_TEST_CASE(RenderingIsCounted)
+{
+    CEGUI::GUIContext& context =
+        CEGUI::System::getSingleton().getDefaultGUIContext();
+    CEGUI::Window* root =
+        CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    context.setRootWindow(root);
+
+    CEGUI::System::getSingleton().renderAllGUIContexts();
+    BOOST_CHECK(profiler.getLastFrameCount(
+        CEGUI::Profiler::C_WINDOWS_REDRAWN) >= 1);
+    BOOST_CHECK(getTrace().find("\"GUIContext::draw\"") != std::string::npos);
+
+    context.setRootWindow(0);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -27,8 +27,14 @@
  ***************************************************************************/
 
 #include "CEGUI/PropertySet.h"
+#include "CEGUI/System.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/widgets/FrameWindow.h"
+#include "CEGUI/falagard/Dimensions.h"
 
 #include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
 
 BOOST_AUTO_TEST_SUITE(PropertySet)
 
@@ -94,4 +100,104 @@ BOOST_AUTO_TEST_CASE(SettingGetting)
     BOOST_CHECK_EQUAL(set.getProperty<int>("MemberValue"), 10);
 }
 
+BOOST_AUTO_TEST_CASE(InternedIDs)
+{
+    TestPropertySet set;
+
+    const CEGUI::PropertySet::PropertyID id =
+        CEGUI::PropertySet::internPropertyName("MemberValue");
+    const CEGUI::PropertySet::PropertyID bogusId =
+        CEGUI::PropertySet::internPropertyName("BogusValue");
+
+    // interning is stable and reversible
+    BOOST_CHECK_EQUAL(CEGUI::PropertySet::internPropertyName("MemberValue"), id);
+    BOOST_CHECK(id != bogusId);
+    BOOST_CHECK_EQUAL(CEGUI::PropertySet::getInternedPropertyName(id), "MemberValue");
+
+    // access by ID matches access by name
+    set.setProperty<int>("MemberValue", 42);
+    BOOST_CHECK_EQUAL(set.getPropertyInstance(id), set.getPropertyInstance("MemberValue"));
+    BOOST_CHECK_EQUAL(set.getProperty<int>(id), 42);
+    BOOST_CHECK_EQUAL(set.getProperty<float>(id), 42); // string fallback
+    BOOST_CHECK_EQUAL(set.getProperty(id), "42");
+
+    BOOST_CHECK_THROW(set.getProperty(bogusId), CEGUI::UnknownObjectException);
+
+    // cached lookups must not outlive the property
+    set.removeProperty("MemberValue");
+    BOOST_CHECK_THROW(set.getPropertyInstance(id), CEGUI::UnknownObjectException);
+    set.defineProperty();
+    BOOST_CHECK_EQUAL(set.getProperty<int>(id), 42);
+}
+
+BOOST_AUTO_TEST_CASE(ImagePropertyDimLookup)
+{
+    CEGUI::Window* wnd =
+        CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+
+    // "Text" is not an Image* property, so the value is looked up by name
+    const CEGUI::ImagePropertyDim dim("Text", CEGUI::DT_WIDTH);
+
+    wnd->setText("");
+    BOOST_CHECK_EQUAL(dim.getValue(*wnd), 0.0f);
+
+    wnd->setText("NoSuchImage");
+    BOOST_CHECK_THROW(dim.getValue(*wnd), CEGUI::UnknownObjectException);
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(wnd);
+}
+
+BOOST_AUTO_TEST_CASE(FalagardRedrawPerformance)
+{
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+    CEGUI::WindowManager& winMgr = CEGUI::WindowManager::getSingleton();
+
+    CEGUI::Window* root = winMgr.createWindow("DefaultWindow");
+    context.setRootWindow(root);
+
+    const unsigned int windowCount = 20;
+    for (unsigned int i = 0; i < windowCount; ++i)
+    {
+        CEGUI::Window* frame = winMgr.createWindow("TaharezLook/FrameWindow");
+        frame->setArea(CEGUI::URect(CEGUI::UDim(0, 10.0f * i), CEGUI::UDim(0, 5.0f * i),
+                                    CEGUI::UDim(0, 10.0f * i + 300), CEGUI::UDim(0, 5.0f * i + 200)));
+        frame->setText("Frame");
+        root->addChild(frame);
+    }
+
+    // the lookup Falagard used to do for every property sourced value
+    const unsigned int lookups = 100000;
+    CEGUI::Window* frame = root->getChildAtIdx(0);
+    const CEGUI::PropertySet::PropertyID id =
+        CEGUI::PropertySet::internPropertyName("ClientAreaColour");
+    {
+        boost::timer timer;
+        for (unsigned int i = 0; i < lookups; ++i)
+            CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(frame->getProperty("ClientAreaColour"));
+        BOOST_TEST_MESSAGE("By name + fromString, " << lookups << " lookups: " << timer.elapsed() << "s");
+    }
+    {
+        boost::timer timer;
+        for (unsigned int i = 0; i < lookups; ++i)
+            frame->getProperty<CEGUI::ColourRect>(id);
+        BOOST_TEST_MESSAGE("By interned ID, " << lookups << " lookups: " << timer.elapsed() << "s");
+    }
+    BOOST_CHECK(frame->getProperty<CEGUI::ColourRect>(id).d_top_left ==
+                CEGUI::PropertyHelper<CEGUI::ColourRect>::fromString(frame->getProperty("ClientAreaColour")).d_top_left);
+
+    // full redraw of the skinned windows
+    const unsigned int redraws = 200;
+    boost::timer timer;
+    for (unsigned int i = 0; i < redraws; ++i)
+    {
+        root->invalidate(true);
+        context.draw();
+    }
+    BOOST_TEST_MESSAGE("Redraw of " << windowCount << " skinned FrameWindows, " << redraws
+                       << " times: " << timer.elapsed() << "s");
+
+    context.setRootWindow(0);
+    winMgr.destroyWindow(root);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,178 @@
+/***********************************************************************
+ *    filename:   RenderQueue.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RenderQueue.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/RendererModules/Null/Renderer.h"
+#include "CEGUI/Vertex.h"
+#include "CEGUI/Quaternion.h"
+#include "CEGUI/Window.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+struct RenderQueueFixture
+{
+    RenderQueueFixture() :
+        d_renderer(*static_cast<CEGUI::NullRenderer*>(
+            CEGUI::System::getSingleton().getRenderer())),
+        d_textureA(d_renderer.createTexture("RenderQueueTestA")),
+        d_textureB(d_renderer.createTexture("RenderQueueTestB"))
+    {
+        d_queue.setBatchingEnabled(true);
+    }
+
+    ~RenderQueueFixture()
+    {
+        for (size_t i = 0; i < d_buffers.size(); ++i)
+            d_renderer.destroyGeometryBuffer(*d_buffers[i]);
+
+        d_renderer.destroyTexture(d_textureA);
+        d_renderer.destroyTexture(d_textureB);
+    }
+
+    // add a buffer holding a 10x10 quad at \a x to the queue.
+    CEGUI::GeometryBuffer& addQuadBuffer(float x, CEGUI::Texture& texture)
+    {
+        CEGUI::GeometryBuffer& buffer = d_renderer.createGeometryBuffer();
+        d_buffers.push_back(&buffer);
+
+        CEGUI::Vertex vertices[6];
+        const float xs[6] = {0, 10, 10, 0, 10, 0};
+        const float ys[6] = {0, 0, 10, 0, 10, 10};
+        for (int i = 0; i < 6; ++i)
+            vertices[i].position = CEGUI::Vector3f(xs[i], ys[i], 0);
+
+        buffer.setActiveTexture(&texture);
+        buffer.appendGeometry(vertices, 6);
+        buffer.setTranslation(CEGUI::Vector3f(x, 0, 0));
+        buffer.setClippingRegion(CEGUI::Rectf(x, 0, x + 10, 10));
+
+        d_queue.addGeometryBuffer(buffer);
+        return buffer;
+    }
+
+    // draw the queue and return the number of draw calls issued.
+    CEGUI::uint drawCalls()
+    {
+        d_renderer.resetDrawStatistics();
+        d_queue.draw();
+        return d_renderer.getDrawCallCount();
+    }
+
+    CEGUI::NullRenderer& d_renderer;
+    CEGUI::Texture& d_textureA;
+    CEGUI::Texture& d_textureB;
+    CEGUI::RenderQueue d_queue;
+    std::vector<CEGUI::GeometryBuffer*> d_buffers;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderQueue, RenderQueueFixture)
+
+BOOST_AUTO_TEST_CASE(MergeCompatibleBuffers)
+{
+    for (int i = 0; i < 10; ++i)
+        addQuadBuffer(i * 10.0f, d_textureA);
+
+    BOOST_CHECK_EQUAL(drawCalls(), 1u);
+    BOOST_CHECK_EQUAL(d_renderer.getDrawnVertexCount(), 60u);
+
+    d_queue.setBatchingEnabled(false);
+    BOOST_CHECK_EQUAL(drawCalls(), 10u);
+    BOOST_CHECK_EQUAL(d_renderer.getDrawnVertexCount(), 60u);
+}
+
+BOOST_AUTO_TEST_CASE(StateChangesSplitBatches)
+{
+    addQuadBuffer(0, d_textureA);
+    addQuadBuffer(10, d_textureA);
+    // texture change
+    addQuadBuffer(20, d_textureB);
+    // geometry extending beyond its clip region must keep its own scissor
+    addQuadBuffer(30, d_textureB).setClippingRegion(CEGUI::Rectf(30, 0, 35, 10));
+    addQuadBuffer(40, d_textureB);
+    BOOST_CHECK_EQUAL(drawCalls(), 4u);
+
+    // ... but not when clipping is disabled for that geometry
+    d_buffers[3]->reset();
+    d_buffers[3]->setClippingActive(false);
+    CEGUI::Vertex vertex;
+    d_buffers[3]->setActiveTexture(&d_textureB);
+    d_buffers[3]->appendGeometry(&vertex, 1);
+    BOOST_CHECK_EQUAL(drawCalls(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(IncompatibleBuffers)
+{
+    addQuadBuffer(0, d_textureA);
+    addQuadBuffer(10, d_textureA).setRotation(
+        CEGUI::Quaternion::eulerAnglesDegrees(0, 0, 45));
+    addQuadBuffer(20, d_textureA).setBlendMode(CEGUI::BM_RTT_PREMULTIPLIED);
+    addQuadBuffer(30, d_textureA);
+    BOOST_CHECK_EQUAL(drawCalls(), 4u);
+}
+
+BOOST_AUTO_TEST_CASE(GUIContextDrawCalls)
+{
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+    context.setRootWindow(root);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CEGUI::Window* button =
+            CEGUI::WindowManager::getSingleton().createWindow("TaharezLook/Button");
+        button->setArea(CEGUI::URect(CEGUI::UDim(0, (i % 10) * 60.0f), CEGUI::UDim(0, (i / 10) * 40.0f),
+                                     CEGUI::UDim(0, (i % 10) * 60.0f + 50.0f), CEGUI::UDim(0, (i / 10) * 40.0f + 30.0f)));
+        root->addChild(button);
+    }
+
+    d_renderer.resetDrawStatistics();
+    context.draw();
+    const CEGUI::uint unbatched = d_renderer.getDrawCallCount();
+    const CEGUI::uint vertices = d_renderer.getDrawnVertexCount();
+
+    context.setBatchingEnabled(true);
+    d_renderer.resetDrawStatistics();
+    context.draw();
+    const CEGUI::uint batched = d_renderer.getDrawCallCount();
+
+    BOOST_CHECK_EQUAL(d_renderer.getDrawnVertexCount(), vertices);
+    BOOST_CHECK(batched < unbatched);
+    BOOST_TEST_MESSAGE("Draw calls for 100 buttons: " << unbatched
+                       << " unbatched, " << batched << " batched");
+
+    context.setBatchingEnabled(false);
+    context.setRootWindow(0);
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,281 @@
+/***********************************************************************
+ *    filename:   RenderedStringWordWrapper.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/RenderedStringWordWrapper.h"
+#include "CEGUI/LeftAlignedRenderedString.h"
+#include "CEGUI/RenderedStringTextComponent.h"
+#include "CEGUI/RenderedStringImageComponent.h"
+#include "CEGUI/Font.h"
+#include "CEGUI/FontManager.h"
+#include "CEGUI/System.h"
+#include "CEGUI/Renderer.h"
+#include "CEGUI/GeometryBuffer.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+typedef CEGUI::RenderedStringWordWrapper<CEGUI::LeftAlignedRenderedString>
+    LeftWrapper;
+
+//! exposes the width the current lines were wrapped at.
+class TestWrapper : public LeftWrapper
+{
+public:
+    TestWrapper(const CEGUI::RenderedString& string) : LeftWrapper(string) {}
+    float getWrappedWidth() const { return d_wrappedWidth; }
+};
+
+/*
+ * Reference wrapping using RenderedString::split, as the wrapper used to do,
+ * returning the number of lines and the widest line.
+ */
+static size_t referenceWrap(const CEGUI::RenderedString& string, float width,
+                            float& max_width, float& height)
+{
+    CEGUI::RenderedString rstring(string), lstring;
+    size_t lines = 0;
+    max_width = 0;
+    height = 0;
+
+    for (size_t line = 0; line < rstring.getLineCount(); ++line)
+    {
+        float rs_width;
+        while ((rs_width = rstring.getPixelSize(0, line).d_width) > 0)
+        {
+            if (rs_width <= width)
+                break;
+
+            rstring.split(0, line, width, lstring);
+            lines += lstring.getLineCount();
+            max_width = std::max(max_width, lstring.getHorizontalExtent(0));
+            height += lstring.getVerticalExtent(0);
+            line = 0;
+        }
+    }
+
+    lines += rstring.getLineCount();
+    max_width = std::max(max_width, rstring.getHorizontalExtent(0));
+    height += rstring.getVerticalExtent(0);
+    return lines;
+}
+
+static void appendWords(CEGUI::RenderedString& string, const CEGUI::Font* font,
+                        size_t count)
+{
+    static const char* words[] = { "lorem", "ipsum", "dolor", "sit", "amet",
+        "consectetur", "adipiscing", "elit", "sed", "do", "eiusmod" };
+
+    CEGUI::String text;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (i)
+            text += ' ';
+        text += words[(i * 7) % (sizeof(words) / sizeof(words[0]))];
+    }
+
+    string.appendComponent(CEGUI::RenderedStringTextComponent(text, font));
+}
+
+struct WordWrapperFixture
+{
+    WordWrapperFixture()
+    {
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+        d_font = &CEGUI::FontManager::getSingleton().get("DejaVuSans-12");
+
+        // a paragraph made of several components, an empty line and a
+        // paragraph that is a single long component.
+        appendWords(d_string, d_font, 12);
+        appendWords(d_string, d_font, 5);
+        d_string.appendLineBreak();
+        d_string.appendLineBreak();
+        appendWords(d_string, d_font, 60);
+    }
+
+    const CEGUI::Font* d_font;
+    CEGUI::RenderedString d_string;
+};
+
+BOOST_FIXTURE_TEST_SUITE(RenderedStringWordWrapper, WordWrapperFixture)
+
+BOOST_AUTO_TEST_CASE(MatchesSplitWrapping)
+{
+    const float widths[] = { 60.0f, 150.0f, 333.0f, 1000.0f, 5000.0f };
+
+    for (size_t i = 0; i < sizeof(widths) / sizeof(widths[0]); ++i)
+    {
+        LeftWrapper wrapper(d_string);
+        wrapper.format(0, CEGUI::Sizef(widths[i], 100.0f));
+
+        float ref_width, ref_height;
+        const size_t ref_lines =
+            referenceWrap(d_string, widths[i], ref_width, ref_height);
+
+        BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(), ref_lines);
+        BOOST_CHECK_CLOSE(wrapper.getHorizontalExtent(0), ref_width, 0.01f);
+        BOOST_CHECK_CLOSE(wrapper.getVerticalExtent(0), ref_height, 0.01f);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(UnsplittableComponents)
+{
+    // a wide, unsplittable item.
+    CEGUI::RenderedStringImageComponent image("TaharezLook/ClientBrush");
+    image.setSize(CEGUI::Sizef(120.0f, 10.0f));
+
+    CEGUI::RenderedString string;
+    appendWords(string, d_font, 3);
+    string.appendComponent(image);
+    appendWords(string, d_font, 3);
+
+    const float widths[] = { 80.0f, 130.0f, 400.0f };
+    for (size_t i = 0; i < sizeof(widths) / sizeof(widths[0]); ++i)
+    {
+        LeftWrapper wrapper(string);
+        wrapper.format(0, CEGUI::Sizef(widths[i], 100.0f));
+
+        float ref_width, ref_height;
+        BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(),
+                          referenceWrap(string, widths[i], ref_width, ref_height));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CachedLines)
+{
+    TestWrapper wrapper(d_string);
+    wrapper.format(0, CEGUI::Sizef(300.0f, 100.0f));
+    BOOST_CHECK_EQUAL(wrapper.getWrappedWidth(), 300.0f);
+
+    // formatting again at the same width keeps the wrapped lines
+    wrapper.format(0, CEGUI::Sizef(300.0f, 200.0f));
+    BOOST_CHECK_EQUAL(wrapper.getWrappedWidth(), 300.0f);
+
+    // any other width wraps wrapped text again
+    wrapper.format(0, CEGUI::Sizef(150.0f, 100.0f));
+    BOOST_CHECK_EQUAL(wrapper.getWrappedWidth(), 150.0f);
+
+    float ref_width, ref_height;
+    BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(),
+                      referenceWrap(d_string, 150.0f, ref_width, ref_height));
+    BOOST_CHECK_CLOSE(wrapper.getHorizontalExtent(0), ref_width, 0.01f);
+
+    // modifying the string invalidates the wrapped lines
+    const size_t old_lines = wrapper.getFormattedLineCount();
+    appendWords(d_string, d_font, 20);
+    wrapper.format(0, CEGUI::Sizef(150.0f, 100.0f));
+    BOOST_CHECK(wrapper.getFormattedLineCount() > old_lines);
+
+    // unwrapped text stays valid for any larger width
+    CEGUI::RenderedString short_string;
+    appendWords(short_string, d_font, 2);
+    TestWrapper short_wrapper(short_string);
+    short_wrapper.format(0, CEGUI::Sizef(500.0f, 100.0f));
+    short_wrapper.format(0, CEGUI::Sizef(800.0f, 100.0f));
+    BOOST_CHECK_EQUAL(short_wrapper.getWrappedWidth(), 500.0f);
+    BOOST_CHECK_EQUAL(short_wrapper.getFormattedLineCount(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(DrawAfterSourceChange)
+{
+    CEGUI::Renderer* const renderer =
+        CEGUI::System::getSingleton().getRenderer();
+    CEGUI::GeometryBuffer& buffer = renderer->createGeometryBuffer();
+
+    LeftWrapper wrapper(d_string);
+    wrapper.format(0, CEGUI::Sizef(150.0f, 100.0f));
+    const size_t old_lines = wrapper.getFormattedLineCount();
+
+    // drawing a changed string wraps it again at the last formatted size
+    appendWords(d_string, d_font, 20);
+    wrapper.draw(0, buffer, CEGUI::Vector2f(0, 0), 0, 0);
+
+    float ref_width, ref_height;
+    BOOST_CHECK(wrapper.getFormattedLineCount() > old_lines);
+    BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(),
+                      referenceWrap(d_string, 150.0f, ref_width, ref_height));
+    BOOST_CHECK(buffer.getVertexCount() > 0);
+
+    renderer->destroyGeometryBuffer(buffer);
+}
+
+BOOST_AUTO_TEST_CASE(JustifiedParagraphs)
+{
+    CEGUI::RenderedStringWordWrapper<CEGUI::JustifiedRenderedString>
+        wrapper(d_string);
+    wrapper.format(0, CEGUI::Sizef(200.0f, 100.0f));
+
+    float ref_width, ref_height;
+    BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(),
+                      referenceWrap(d_string, 200.0f, ref_width, ref_height));
+    // justified lines are stretched to the full width
+    BOOST_CHECK_CLOSE(wrapper.getHorizontalExtent(0), 200.0f, 0.01f);
+}
+
+BOOST_AUTO_TEST_CASE(WrapPerformance)
+{
+    // a long chat log like paragraph in a single component
+    CEGUI::RenderedString string;
+    appendWords(string, d_font, 4000);
+
+    const float width = 250.0f;
+
+    boost::timer ref_timer;
+    float ref_width, ref_height;
+    const size_t ref_lines = referenceWrap(string, width, ref_width, ref_height);
+    const double ref_elapsed = ref_timer.elapsed();
+
+    boost::timer wrap_timer;
+    LeftWrapper wrapper(string);
+    wrapper.format(0, CEGUI::Sizef(width, 100.0f));
+    const double wrap_elapsed = wrap_timer.elapsed();
+
+    BOOST_CHECK_EQUAL(wrapper.getFormattedLineCount(), ref_lines);
+
+    boost::timer same_timer;
+    for (int i = 0; i < 1000; ++i)
+        wrapper.format(0, CEGUI::Sizef(width, 100.0f));
+    const double same_elapsed = same_timer.elapsed();
+
+    boost::timer resize_timer;
+    for (int i = 0; i < 20; ++i)
+        wrapper.format(0, CEGUI::Sizef(width + (i % 2) * 0.25f, 100.0f));
+    const double resize_elapsed = resize_timer.elapsed();
+
+    boost::timer rewrap_timer;
+    for (int i = 0; i < 20; ++i)
+        referenceWrap(string, width + (i % 2) * 0.25f, ref_width, ref_height);
+    const double rewrap_elapsed = rewrap_timer.elapsed();
+
+    BOOST_TEST_MESSAGE("Wrapping 4000 words into " << ref_lines
+                       << " lines: split based " << ref_elapsed
+                       << "s, single pass " << wrap_elapsed
+                       << "s; 1000 formats at the same size " << same_elapsed
+                       << "s; 20 resizes: single pass " << resize_elapsed
+                       << "s, split based " << rewrap_elapsed << "s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
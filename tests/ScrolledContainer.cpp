@@ -0,0 +1,194 @@
+/***********************************************************************
+ *    filename:   ScrolledContainer.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/widgets/ScrolledContainer.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/CoordConverter.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+struct ScrolledContainerFixture
+{
+    ScrolledContainerFixture() :
+        d_contentChangedCount(0)
+    {
+        d_root = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(d_root);
+        CEGUI::System::getSingleton().notifyDisplaySizeChanged(CEGUI::Sizef(800, 600));
+
+        d_container = static_cast<CEGUI::ScrolledContainer*>(
+            CEGUI::WindowManager::getSingleton().createWindow("ScrolledContainer"));
+        d_container->setSize(CEGUI::USize(CEGUI::UDim(0, 200), CEGUI::UDim(0, 100)));
+        d_root->addChild(d_container);
+
+        d_container->subscribeEvent(CEGUI::ScrolledContainer::EventContentChanged,
+            CEGUI::Event::Subscriber(&ScrolledContainerFixture::handleContentChanged, this));
+    }
+
+    ~ScrolledContainerFixture()
+    {
+        CEGUI::System::getSingleton().getDefaultGUIContext().setRootWindow(0);
+        CEGUI::WindowManager::getSingleton().destroyWindow(d_root);
+    }
+
+    bool handleContentChanged(const CEGUI::EventArgs&)
+    {
+        ++d_contentChangedCount;
+        return true;
+    }
+
+    CEGUI::Window* addChild(float x, float y, float width, float height)
+    {
+        CEGUI::Window* wnd = CEGUI::WindowManager::getSingleton().createWindow("DefaultWindow");
+        wnd->setArea(CEGUI::UDim(0, x), CEGUI::UDim(0, y), CEGUI::UDim(0, width), CEGUI::UDim(0, height));
+        d_container->addChild(wnd);
+
+        return wnd;
+    }
+
+    // compare the maintained extents against measuring every child
+    void checkExtents()
+    {
+        CEGUI::Rectf expected(0, 0, 0, 0);
+
+        for (size_t i = 0; i < d_container->getChildCount(); ++i)
+        {
+            const CEGUI::Window* wnd = d_container->getChildAtIdx(i);
+            const CEGUI::Rectf area(
+                CEGUI::CoordConverter::asAbsolute(wnd->getPosition(), d_container->getPixelSize()),
+                wnd->getPixelSize());
+
+            expected.d_min.d_x = ceguimin(expected.d_min.d_x, area.d_min.d_x);
+            expected.d_min.d_y = ceguimin(expected.d_min.d_y, area.d_min.d_y);
+            expected.d_max.d_x = ceguimax(expected.d_max.d_x, area.d_max.d_x);
+            expected.d_max.d_y = ceguimax(expected.d_max.d_y, area.d_max.d_y);
+        }
+
+        BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), expected);
+        BOOST_CHECK_EQUAL(d_container->getContentArea(), expected);
+    }
+
+    CEGUI::Window* d_root;
+    CEGUI::ScrolledContainer* d_container;
+    int d_contentChangedCount;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ScrolledContainer, ScrolledContainerFixture)
+
+BOOST_AUTO_TEST_CASE(ChildExtents)
+{
+    checkExtents();
+
+    CEGUI::Window* first = addChild(10, 20, 100, 50);
+    CEGUI::Window* second = addChild(-30, 5, 20, 400);
+    CEGUI::Window* third = addChild(10, 20, 100, 50);
+    checkExtents();
+
+    // moving and sizing update only the affected child
+    second->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 5), CEGUI::UDim(0, -10)));
+    checkExtents();
+    first->setSize(CEGUI::USize(CEGUI::UDim(0, 300), CEGUI::UDim(0, 10)));
+    checkExtents();
+
+    // two children with identical areas; removing one leaves the other
+    d_container->removeChild(first);
+    checkExtents();
+    d_container->removeChild(second);
+    checkExtents();
+    d_container->removeChild(third);
+    checkExtents();
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(first);
+    CEGUI::WindowManager::getSingleton().destroyWindow(second);
+    CEGUI::WindowManager::getSingleton().destroyWindow(third);
+}
+
+BOOST_AUTO_TEST_CASE(RelativePositions)
+{
+    CEGUI::Window* wnd = addChild(0, 0, 10, 10);
+    wnd->setPosition(CEGUI::UVector2(CEGUI::UDim(0.5f, 0), CEGUI::UDim(1.0f, 0)));
+    checkExtents();
+
+    // our own size changing moves children with relative positions
+    d_container->setSize(CEGUI::USize(CEGUI::UDim(0, 400), CEGUI::UDim(0, 300)));
+    BOOST_CHECK_EQUAL(d_container->getChildExtentsArea(), CEGUI::Rectf(0, 0, 210, 310));
+}
+
+BOOST_AUTO_TEST_CASE(ContentChangesAreCoalesced)
+{
+    d_contentChangedCount = 0;
+
+    for (int i = 0; i < 50; ++i)
+        addChild(0, i * 20.0f, 100, 20);
+
+    // the content area is current straight away, the event is deferred
+    checkExtents();
+    BOOST_CHECK_EQUAL(d_contentChangedCount, 0);
+
+    d_container->update(0.0f);
+    BOOST_CHECK_EQUAL(d_contentChangedCount, 1);
+
+    d_container->update(0.0f);
+    BOOST_CHECK_EQUAL(d_contentChangedCount, 1);
+
+    d_container->getChildAtIdx(0)->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 0), CEGUI::UDim(0, 2000)));
+    d_container->notifyContentChangedIfNecessary();
+    BOOST_CHECK_EQUAL(d_contentChangedCount, 2);
+    checkExtents();
+}
+
+BOOST_AUTO_TEST_CASE(Performance)
+{
+    const int childCount = 3000;
+
+    boost::timer timer;
+    for (int i = 0; i < childCount; ++i)
+    {
+        addChild(0, i * 20.0f, 100, 20);
+        d_container->notifyContentChangedIfNecessary();
+    }
+
+    double elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("ScrolledContainer, " << childCount << " children appended: " << elapsed << "s");
+
+    // live updates: move every child once
+    timer.restart();
+    for (int i = 0; i < childCount; ++i)
+    {
+        d_container->getChildAtIdx(i)->setYPosition(CEGUI::UDim(0, (childCount - i) * 20.0f));
+        d_container->notifyContentChangedIfNecessary();
+    }
+
+    elapsed = timer.elapsed();
+    BOOST_TEST_MESSAGE("ScrolledContainer, " << childCount << " children moved: " << elapsed << "s");
+    checkExtents();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
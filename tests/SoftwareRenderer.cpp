@@ -0,0 +1,361 @@
+/***********************************************************************
+ *    filename:   SoftwareRenderer.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+
+#include "CEGUI/RendererModules/Software/Renderer.h"
+#include "CEGUI/RendererModules/Software/Texture.h"
+#include "CEGUI/GeometryBuffer.h"
+#include "CEGUI/Quaternion.h"
+#include "CEGUI/RenderTarget.h"
+#include "CEGUI/RenderingSurface.h"
+#include "CEGUI/RenderingWindow.h"
+#include "CEGUI/TextureTarget.h"
+#include "CEGUI/Vertex.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+//! create a GeometryBuffer drawing to the whole of the render target.
+static CEGUI::GeometryBuffer& createBuffer(CEGUI::Renderer& renderer)
+{
+    CEGUI::GeometryBuffer& buffer = renderer.createGeometryBuffer();
+    buffer.setClippingActive(false);
+    return buffer;
+}
+
+//! append two triangles covering \a rect, with texture co-ordinates 0 to 1.
+static void appendQuad(CEGUI::GeometryBuffer& buffer, const CEGUI::Rectf& rect,
+                       const CEGUI::Colour& colour)
+{
+    CEGUI::Vertex v[6];
+    v[0].position = CEGUI::Vector3f(rect.left(), rect.top(), 0);
+    v[0].tex_coords = CEGUI::Vector2f(0, 0);
+    v[1].position = CEGUI::Vector3f(rect.left(), rect.bottom(), 0);
+    v[1].tex_coords = CEGUI::Vector2f(0, 1);
+    v[2].position = CEGUI::Vector3f(rect.right(), rect.bottom(), 0);
+    v[2].tex_coords = CEGUI::Vector2f(1, 1);
+    v[3] = v[2];
+    v[4].position = CEGUI::Vector3f(rect.right(), rect.top(), 0);
+    v[4].tex_coords = CEGUI::Vector2f(1, 0);
+    v[5] = v[0];
+
+    for (int i = 0; i < 6; ++i)
+        v[i].colour_val = colour;
+
+    buffer.appendGeometry(v, 6);
+}
+
+//! draw \a buffer to the display of \a renderer.
+static void drawToDisplay(CEGUI::SoftwareRenderer& renderer,
+                          const CEGUI::GeometryBuffer& buffer)
+{
+    CEGUI::RenderTarget& target = renderer.getDefaultRenderTarget();
+
+    renderer.beginRendering();
+    target.activate();
+    target.draw(buffer);
+    target.deactivate();
+    renderer.endRendering();
+}
+
+static const CEGUI::uint8* pixelAt(const CEGUI::SoftwareTexture& texture,
+                                   unsigned int x, unsigned int y)
+{
+    return texture.getPixels() + (y * texture.getPixelWidth() + x) * 4;
+}
+
+BOOST_AUTO_TEST_SUITE(SoftwareRenderer)
+
+BOOST_AUTO_TEST_CASE(SharedEdgesAreCoveredOnce)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(16, 16), 1);
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+
+    // half transparent white, so a pixel blended twice differs.
+    appendQuad(buffer, CEGUI::Rectf(2, 2, 10, 10),
+               CEGUI::Colour(1, 1, 1, 0.5f));
+    drawToDisplay(renderer, buffer);
+
+    const CEGUI::SoftwareTexture& display = renderer.getDisplaySurface();
+    for (unsigned int y = 0; y < 16; ++y)
+    {
+        for (unsigned int x = 0; x < 16; ++x)
+        {
+            const bool inside = x >= 2 && x < 10 && y >= 2 && y < 10;
+            const CEGUI::uint8* p = pixelAt(display, x, y);
+
+            BOOST_CHECK_EQUAL(p[0], inside ? 128 : 0);
+            BOOST_CHECK_EQUAL(p[3], inside ? 128 : 0);
+        }
+    }
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(ClippingRegion)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(16, 16), 1);
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+
+    buffer.setClippingRegion(CEGUI::Rectf(4, 5, 6, 8));
+    buffer.setClippingActive(true);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 16, 16), CEGUI::Colour(1, 0, 0, 1));
+    drawToDisplay(renderer, buffer);
+
+    const CEGUI::SoftwareTexture& display = renderer.getDisplaySurface();
+    for (unsigned int y = 0; y < 16; ++y)
+    {
+        for (unsigned int x = 0; x < 16; ++x)
+        {
+            const bool inside = x >= 4 && x < 6 && y >= 5 && y < 8;
+            BOOST_CHECK_EQUAL(pixelAt(display, x, y)[0], inside ? 255 : 0);
+        }
+    }
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(BlendModes)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(4, 4), 1);
+    renderer.setClearColour(CEGUI::Colour(0, 0, 1, 1));
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 4, 4),
+               CEGUI::Colour(0.5f, 0, 0, 0.5f));
+
+    const CEGUI::SoftwareTexture& display = renderer.getDisplaySurface();
+
+    // the source colour is scaled by its alpha.
+    drawToDisplay(renderer, buffer);
+    BOOST_CHECK_EQUAL(display.getPixels()[0], 64);
+    BOOST_CHECK_EQUAL(display.getPixels()[2], 128);
+    BOOST_CHECK_EQUAL(display.getPixels()[3], 255);
+
+    // the source colour is used as is.
+    buffer.setBlendMode(CEGUI::BM_RTT_PREMULTIPLIED);
+    drawToDisplay(renderer, buffer);
+    BOOST_CHECK_EQUAL(display.getPixels()[0], 128);
+    BOOST_CHECK_EQUAL(display.getPixels()[2], 128);
+    BOOST_CHECK_EQUAL(display.getPixels()[3], 255);
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(TextureSampling)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(8, 8), 1);
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+
+    // a black and a white texel.
+    const CEGUI::uint8 texels[] = { 0, 0, 0, 255, 255, 255, 255, 255 };
+    CEGUI::Texture& texture = renderer.createTexture("texels");
+    texture.loadFromMemory(texels, CEGUI::Sizef(2, 1), CEGUI::Texture::PF_RGBA);
+    buffer.setActiveTexture(&texture);
+
+    // drawn at its size, the texture is copied.
+    appendQuad(buffer, CEGUI::Rectf(3, 3, 5, 4), CEGUI::Colour(1, 1, 1, 1));
+    drawToDisplay(renderer, buffer);
+
+    const CEGUI::SoftwareTexture& display = renderer.getDisplaySurface();
+    BOOST_CHECK_EQUAL(pixelAt(display, 3, 3)[0], 0);
+    BOOST_CHECK_EQUAL(pixelAt(display, 4, 3)[0], 255);
+
+    // stretched, the texels are filtered and the edges are clamped.
+    buffer.reset();
+    buffer.setActiveTexture(&texture);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 8, 1), CEGUI::Colour(1, 1, 1, 1));
+    drawToDisplay(renderer, buffer);
+
+    const int expected[] = { 0, 0, 32, 96, 159, 223, 255, 255 };
+    for (unsigned int x = 0; x < 8; ++x)
+    {
+        BOOST_CHECK_EQUAL(pixelAt(display, x, 0)[0], expected[x]);
+        BOOST_CHECK_EQUAL(pixelAt(display, x, 0)[3], 255);
+    }
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(TextureTarget)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(8, 8), 1);
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 2, 2), CEGUI::Colour(0, 1, 0, 1));
+
+    CEGUI::TextureTarget* target = renderer.createTextureTarget();
+    target->declareRenderSize(CEGUI::Sizef(200, 100));
+    target->setArea(CEGUI::Rectf(0, 0, 200, 100));
+    target->clear();
+
+    target->activate();
+    target->draw(buffer);
+    target->deactivate();
+
+    const CEGUI::SoftwareTexture& texture =
+        static_cast<CEGUI::SoftwareTexture&>(target->getTexture());
+    BOOST_CHECK_EQUAL(pixelAt(texture, 1, 1)[1], 255);
+    BOOST_CHECK_EQUAL(pixelAt(texture, 2, 1)[1], 0);
+
+    // the display is left alone.
+    BOOST_CHECK_EQUAL(pixelAt(renderer.getDisplaySurface(), 1, 1)[1], 0);
+
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(PartialRedraw)
+{
+    CEGUI::SoftwareRenderer& renderer =
+        CEGUI::SoftwareRenderer::create(CEGUI::Sizef(16, 16), 1);
+    CEGUI::GeometryBuffer& buffer = createBuffer(renderer);
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 16, 16),
+               CEGUI::Colour(1, 0, 0, 0.5f));
+
+    CEGUI::TextureTarget* target = renderer.createTextureTarget();
+    CEGUI::RenderingSurface* owner = new CEGUI::RenderingSurface(
+        renderer.getDefaultRenderTarget());
+    CEGUI::RenderingWindow& window = owner->createRenderingWindow(*target);
+    window.setSize(CEGUI::Sizef(16, 16));
+
+    window.addGeometryBuffer(CEGUI::RQ_BASE, buffer);
+    window.draw();
+    BOOST_CHECK(!window.isInvalidated());
+
+    buffer.reset();
+    appendQuad(buffer, CEGUI::Rectf(0, 0, 16, 16),
+               CEGUI::Colour(0, 0, 1, 0.5f));
+
+    // areas are merged, and rounded outwards to whole pixels.
+    window.invalidateArea(CEGUI::Rectf(4.5f, 4.5f, 6, 7.2f));
+    window.invalidateArea(CEGUI::Rectf(5, 6, 8, 8));
+    BOOST_CHECK(window.isPartiallyInvalidated());
+    BOOST_CHECK(window.getInvalidatedArea() == CEGUI::Rectf(4, 4, 8, 8));
+
+    window.clearGeometry();
+    window.addGeometryBuffer(CEGUI::RQ_BASE, buffer);
+    window.draw();
+    BOOST_CHECK(!window.isPartiallyInvalidated());
+
+    // the redrawn area is cleared first, so it is blended once only.
+    const CEGUI::SoftwareTexture& texture =
+        static_cast<CEGUI::SoftwareTexture&>(target->getTexture());
+    for (unsigned int y = 0; y < 16; ++y)
+    {
+        for (unsigned int x = 0; x < 16; ++x)
+        {
+            const bool inside = x >= 4 && x < 8 && y >= 4 && y < 8;
+            const CEGUI::uint8* p = pixelAt(texture, x, y);
+
+            BOOST_CHECK_EQUAL(p[0], inside ? 0 : 128);
+            BOOST_CHECK_EQUAL(p[2], inside ? 128 : 0);
+            BOOST_CHECK_EQUAL(p[3], 128);
+        }
+    }
+
+    // areas outside of the window change nothing.
+    window.invalidateArea(CEGUI::Rectf(16, 0, 20, 4));
+    BOOST_CHECK(!window.isInvalidated());
+
+    // invalidating everything redraws everything.
+    window.invalidateArea(CEGUI::Rectf(0, 0, 1, 1));
+    window.invalidate();
+    BOOST_CHECK(!window.isPartiallyInvalidated());
+    window.draw();
+    BOOST_CHECK_EQUAL(pixelAt(texture, 0, 0)[2], 128);
+
+    delete owner;
+    CEGUI::SoftwareRenderer::destroy(renderer);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadCountDoesNotChangeOutput)
+{
+    const CEGUI::Sizef size(301, 197);
+    CEGUI::SoftwareRenderer& single = CEGUI::SoftwareRenderer::create(size, 1);
+    CEGUI::SoftwareRenderer& multi = CEGUI::SoftwareRenderer::create(size, 4);
+
+    std::vector<CEGUI::uint8> texels(16 * 16 * 4);
+    for (size_t i = 0; i < texels.size(); ++i)
+        texels[i] = static_cast<CEGUI::uint8>(i * 37);
+
+    std::srand(1);
+    CEGUI::SoftwareRenderer* renderers[] = { &single, &multi };
+    std::vector<CEGUI::Vertex> vertices(600);
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        CEGUI::Vertex& v = vertices[i];
+        v.position = CEGUI::Vector3f(std::rand() % 4000 / 10.0f - 50,
+                                     std::rand() % 3000 / 10.0f - 50, 0);
+        v.tex_coords = CEGUI::Vector2f(std::rand() % 100 / 50.0f,
+                                       std::rand() % 100 / 50.0f);
+        v.colour_val = CEGUI::Colour(std::rand() % 256 / 255.0f,
+                                     std::rand() % 256 / 255.0f,
+                                     std::rand() % 256 / 255.0f,
+                                     std::rand() % 256 / 255.0f);
+    }
+
+    for (int r = 0; r < 2; ++r)
+    {
+        CEGUI::Texture& texture = renderers[r]->createTexture("texels");
+        texture.loadFromMemory(&texels[0], CEGUI::Sizef(16, 16),
+                               CEGUI::Texture::PF_RGBA);
+
+        CEGUI::GeometryBuffer& plain = createBuffer(*renderers[r]);
+        plain.appendGeometry(&vertices[0], 300);
+
+        CEGUI::GeometryBuffer& textured = createBuffer(*renderers[r]);
+        textured.setActiveTexture(&texture);
+        textured.setRotation(CEGUI::Quaternion::eulerAnglesDegrees(10, 20, 30));
+        textured.setPivot(CEGUI::Vector3f(150, 100, 0));
+        textured.appendGeometry(&vertices[300], 300);
+
+        CEGUI::RenderTarget& target = renderers[r]->getDefaultRenderTarget();
+        renderers[r]->beginRendering();
+        target.activate();
+        target.draw(plain);
+        target.draw(textured);
+        target.deactivate();
+        renderers[r]->endRendering();
+    }
+
+    const CEGUI::SoftwareTexture& a = single.getDisplaySurface();
+    const CEGUI::SoftwareTexture& b = multi.getDisplaySurface();
+    const size_t bytes = a.getPixelWidth() * a.getPixelHeight() * 4;
+    BOOST_CHECK(std::equal(a.getPixels(), a.getPixels() + bytes,
+                           b.getPixels()));
+
+    CEGUI::SoftwareRenderer::destroy(single);
+    CEGUI::SoftwareRenderer::destroy(multi);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
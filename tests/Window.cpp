@@ -28,6 +28,8 @@
 
 #include "CEGUI/Window.h"
 #include "CEGUI/WindowManager.h"
+#include "CEGUI/GUIContext.h"
+#include "CEGUI/HitTestIndex.h"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/timer.hpp>
@@ -179,6 +181,70 @@ BOOST_AUTO_TEST_CASE(RecursiveSearch)
     d_insideInsideRoot->setID(previousID[2]);
 }
 
+BOOST_AUTO_TEST_CASE(HitTestIndex)
+{
+    /*
+     * The GUIContext hit-test index must give exactly the same answers as the
+     * recursive walk, so we build a messy hierarchy and compare the two.
+     */
+    CEGUI::GUIContext& context = CEGUI::System::getSingleton().getDefaultGUIContext();
+
+    std::vector<CEGUI::Window*> windows;
+    for (unsigned int i = 0; i < 40; ++i)
+    {
+        CEGUI::Window* parent = (i % 3 == 0 || windows.empty()) ? d_insideRoot : windows[i / 2];
+        CEGUI::Window* wnd = parent->createChild("DefaultWindow");
+        wnd->setPosition(CEGUI::UVector2(CEGUI::UDim(0, static_cast<float>((i * 37) % 150)),
+                                         CEGUI::UDim(0, static_cast<float>((i * 53) % 120))));
+        wnd->setSize(CEGUI::USize(CEGUI::UDim(0, 40.0f + (i % 5) * 20.0f),
+                                  CEGUI::UDim(0, 30.0f + (i % 4) * 25.0f)));
+        wnd->setClippedByParent(i % 7 != 0);
+        wnd->setMousePassThroughEnabled(i % 5 == 0);
+        wnd->setAlwaysOnTop(i % 11 == 0);
+        wnd->setVisible(i % 13 != 0);
+        wnd->setDisabled(i % 17 == 0);
+        windows.push_back(wnd);
+    }
+
+    std::vector<CEGUI::Window*> expected_target;
+    std::vector<CEGUI::Window*> expected_child;
+    for (float y = 0; y < 600; y += 7)
+    {
+        for (float x = 0; x < 800; x += 7)
+        {
+            expected_target.push_back(d_root->getTargetChildAtPosition(CEGUI::Vector2f(x, y)));
+            expected_child.push_back(d_root->getChildAtPosition(CEGUI::Vector2f(x, y)));
+        }
+    }
+
+    context.setHitTestIndexEnabled(true);
+    BOOST_CHECK(context.getHitTestIndex()->getWindowCount() > windows.size());
+
+    size_t i = 0;
+    for (float y = 0; y < 600; y += 7)
+    {
+        for (float x = 0; x < 800; x += 7, ++i)
+        {
+            BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(CEGUI::Vector2f(x, y)), expected_target[i]);
+            BOOST_CHECK_EQUAL(d_root->getChildAtPosition(CEGUI::Vector2f(x, y)), expected_child[i]);
+        }
+    }
+
+    // moving, re-ordering and removing windows must be reflected by the index
+    windows[3]->setPosition(CEGUI::UVector2(CEGUI::UDim(0, 350), CEGUI::UDim(0, 250)));
+    windows[3]->moveToFront();
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(CEGUI::Vector2f(455, 305)), windows[3]);
+    windows[3]->setVisible(false);
+    BOOST_CHECK(d_root->getTargetChildAtPosition(CEGUI::Vector2f(455, 305)) != windows[3]);
+
+    for (std::vector<CEGUI::Window*>::reverse_iterator w = windows.rbegin(); w != windows.rend(); ++w)
+        CEGUI::WindowManager::getSingleton().destroyWindow(*w);
+
+    BOOST_CHECK_EQUAL(d_root->getTargetChildAtPosition(CEGUI::Vector2f(300, 150)), d_insideInsideRoot);
+
+    context.setHitTestIndexEnabled(false);
+}
+
 struct DrawListPerformanceFixture
 {
     DrawListPerformanceFixture()
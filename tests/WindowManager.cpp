@@ -0,0 +1,285 @@
+/***********************************************************************
+ *    filename:   WindowManager.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <map>
+#include <vector>
+
+//! return the values of every property of \a window, except its name.
+static std::map<CEGUI::String, CEGUI::String> getPropertyValues(
+    const CEGUI::Window& window)
+{
+    std::map<CEGUI::String, CEGUI::String> values;
+
+    CEGUI::PropertySet::PropertyIterator i = window.getPropertyIterator();
+    for (; !i.isAtEnd(); ++i)
+    {
+        const CEGUI::String name(i.getCurrentKey());
+        if (name != "Name" && name != "NamePath" &&
+            i.getCurrentValue()->isReadable())
+            values[name] = window.getProperty(name);
+    }
+
+    return values;
+}
+
+static size_t countWindows()
+{
+    size_t count = 0;
+    CEGUI::WindowManager::WindowIterator i =
+        CEGUI::WindowManager::getSingleton().getIterator();
+    for (; !i.isAtEnd(); ++i)
+        ++count;
+
+    return count;
+}
+
+//! counts the events it is subscribed to.
+struct EventCounter
+{
+    EventCounter() : d_count(0) {}
+
+    bool handleEvent(const CEGUI::EventArgs&)
+    {
+        ++d_count;
+        return true;
+    }
+
+    int d_count;
+};
+
+BOOST_AUTO_TEST_SUITE(WindowManager)
+
+BOOST_AUTO_TEST_CASE(Registry)
+{
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+    const size_t initial_count = countWindows();
+
+    std::vector<CEGUI::Window*> windows;
+    for (int i = 0; i < 10; ++i)
+        windows.push_back(wm.createWindow("DefaultWindow"));
+
+    // remove from the middle, the end and the start
+    wm.destroyWindow(windows[4]);
+    wm.destroyWindow(windows[9]);
+    wm.destroyWindow(windows[0]);
+    BOOST_CHECK(!wm.isAlive(windows[4]));
+    BOOST_CHECK(!wm.isAlive(windows[9]));
+    BOOST_CHECK(!wm.isAlive(windows[0]));
+    BOOST_CHECK_EQUAL(countWindows(), initial_count + 7);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i == 0 || i == 4 || i == 9)
+            continue;
+
+        BOOST_CHECK(wm.isAlive(windows[i]));
+        wm.destroyWindow(windows[i]);
+        BOOST_CHECK(!wm.isAlive(windows[i]));
+    }
+
+    BOOST_CHECK_EQUAL(countWindows(), initial_count);
+    wm.cleanDeadPool();
+}
+
+BOOST_AUTO_TEST_CASE(PooledWindowsAreReset)
+{
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+    const char* const types[] =
+        { "TaharezLook/Button", "TaharezLook/StaticText", "DefaultWindow",
+          "VerticalLayoutContainer", "LayoutCell",
+          "TaharezLook/VerticalScrollbar" };
+
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t)
+    {
+        const CEGUI::String type(types[t]);
+        BOOST_TEST_MESSAGE("Pooling " << type);
+
+        wm.setWindowPoolSize(type, 4);
+        BOOST_CHECK_EQUAL(wm.getWindowPoolSize(type), 4u);
+
+        CEGUI::Window* fresh = wm.createWindow(type);
+        const std::map<CEGUI::String, CEGUI::String> fresh_values(
+            getPropertyValues(*fresh));
+        const size_t fresh_children = fresh->getChildCount();
+
+        CEGUI::Window* used = wm.createWindow(type, "Used");
+        used->setText("Some text");
+        used->setAlpha(0.5f);
+        used->setPosition(CEGUI::UVector2(CEGUI::UDim(0.5f, 10), CEGUI::UDim(0, 20)));
+        used->setDisabled(true);
+        used->setID(42);
+        used->setUserString("key", "value");
+        used->setProperty("AlwaysOnTop", "true");
+        used->setSize(CEGUI::USize(CEGUI::UDim(0, 100), CEGUI::UDim(0.25f, 0)));
+        used->setMinSize(CEGUI::USize(CEGUI::UDim(0, 5), CEGUI::UDim(0, 5)));
+        used->setHorizontalAlignment(CEGUI::HA_CENTRE);
+        used->setRotation(CEGUI::Quaternion::eulerAnglesDegrees(0, 0, 30));
+        used->setMargin(CEGUI::UBox(CEGUI::UDim(0, 3)));
+        used->setTooltipText("tip");
+        used->setFont("DejaVuSans-12");
+        used->setMouseCursor("TaharezLook/MouseArrow");
+        used->setUpdateMode(CEGUI::WUM_ALWAYS);
+        used->setRiseOnClickEnabled(false);
+        used->setTextParsingEnabled(false);
+        used->setWritingXMLAllowed(false);
+        used->banPropertyFromXML("Alpha");
+        EventCounter text_changes;
+        used->subscribeEvent(CEGUI::Window::EventTextChanged,
+            CEGUI::Event::Subscriber(&EventCounter::handleEvent, &text_changes));
+
+        wm.destroyWindow(used);
+        wm.cleanDeadPool();
+        BOOST_CHECK_EQUAL(wm.getPooledWindowCount(type), 1u);
+
+        CEGUI::Window* reused = wm.createWindow(type, "Reused");
+        BOOST_CHECK(reused == used);
+        BOOST_CHECK_EQUAL(wm.getPooledWindowCount(type), 0u);
+        BOOST_CHECK_EQUAL(reused->getName(), "Reused");
+        BOOST_CHECK_EQUAL(reused->getType(), type);
+        BOOST_CHECK_EQUAL(reused->getChildCount(), fresh_children);
+        BOOST_CHECK(!reused->isUserStringDefined("key"));
+
+        const std::map<CEGUI::String, CEGUI::String> reused_values(
+            getPropertyValues(*reused));
+        BOOST_CHECK_EQUAL(reused_values.size(), fresh_values.size());
+        for (std::map<CEGUI::String, CEGUI::String>::const_iterator i =
+                fresh_values.begin(); i != fresh_values.end(); ++i)
+        {
+            std::map<CEGUI::String, CEGUI::String>::const_iterator reused_value =
+                reused_values.find(i->first);
+            BOOST_CHECK_MESSAGE(reused_value != reused_values.end() &&
+                                reused_value->second == i->second,
+                                "property " << i->first);
+        }
+
+        // the previous user's subscription is gone
+        reused->setText("Other text");
+        BOOST_CHECK_EQUAL(text_changes.d_count, 0);
+
+        wm.destroyWindow(fresh);
+        wm.destroyWindow(reused);
+        wm.setWindowPoolSize(type, 0);
+        wm.cleanDeadPool();
+        BOOST_CHECK_EQUAL(wm.getPooledWindowCount(type), 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(OnlyReusableClassesArePooled)
+{
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+    const char* const types[] =
+        { "TaharezLook/FrameWindow", "TaharezLook/Listbox",
+          "TaharezLook/Checkbox", "GridLayoutContainer" };
+
+    for (size_t t = 0; t < sizeof(types) / sizeof(types[0]); ++t)
+    {
+        const CEGUI::String type(types[t]);
+        BOOST_TEST_MESSAGE("Not pooling " << type);
+
+        wm.setWindowPoolSize(type, 4);
+        CEGUI::Window* window = wm.createWindow(type);
+        BOOST_CHECK(!window->isReusable());
+
+        wm.destroyWindow(window);
+        wm.cleanDeadPool();
+        BOOST_CHECK_EQUAL(wm.getPooledWindowCount(type), 0u);
+
+        wm.setWindowPoolSize(type, 0);
+    }
+}
+
+//! set the pool size of a type and of the types of the children its look creates.
+static void setTreePoolSize(const char* const* types, size_t size)
+{
+    for (; *types; ++types)
+        CEGUI::WindowManager::getSingleton().setWindowPoolSize(*types, size);
+}
+
+BOOST_AUTO_TEST_CASE(PoolingPerformance)
+{
+    CEGUI::WindowManager& wm = CEGUI::WindowManager::getSingleton();
+    const char* const static_text[] =
+        { "TaharezLook/StaticText", "TaharezLook/HorizontalScrollbar",
+          "TaharezLook/VerticalScrollbar", "TaharezLook/HorizontalScrollbarThumb",
+          "TaharezLook/VerticalScrollbarThumb", "TaharezLook/ImageButton", 0 };
+    const char* const button[] = { "TaharezLook/Button", 0 };
+    const char* const default_window[] = { "DefaultWindow", 0 };
+    const char* const* const trees[] = { static_text, button, default_window };
+
+    const int rows = 2000;
+    const int rebuilds = 3;
+
+    for (size_t t = 0; t < sizeof(trees) / sizeof(trees[0]); ++t)
+    {
+        const CEGUI::String type(trees[t][0]);
+
+        double elapsed[2];
+        for (int pooled = 0; pooled < 2; ++pooled)
+        {
+            setTreePoolSize(trees[t], pooled ? rows * 4 : 0);
+
+            // fill the pools first, so that only reuse is timed
+            if (pooled)
+            {
+                std::vector<CEGUI::Window*> windows;
+                for (int i = 0; i < rows; ++i)
+                    windows.push_back(wm.createWindow(type));
+                for (int i = 0; i < rows; ++i)
+                    wm.destroyWindow(windows[i]);
+                wm.cleanDeadPool();
+            }
+
+            boost::timer timer;
+            for (int rebuild = 0; rebuild < rebuilds; ++rebuild)
+            {
+                std::vector<CEGUI::Window*> windows;
+                for (int i = 0; i < rows; ++i)
+                    windows.push_back(wm.createWindow(type));
+
+                for (int i = 0; i < rows; ++i)
+                    wm.destroyWindow(windows[i]);
+                wm.cleanDeadPool();
+            }
+            elapsed[pooled] = timer.elapsed() / rebuilds;
+        }
+
+        BOOST_CHECK_EQUAL(wm.getPooledWindowCount(type), static_cast<size_t>(rows));
+        setTreePoolSize(trees[t], 0);
+
+        BOOST_TEST_MESSAGE("Rebuilding " << rows << " " << type << " windows: "
+                           << elapsed[0] << "s, pooled " << elapsed[1] << "s");
+        BOOST_WARN_LT(elapsed[1], elapsed[0]);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
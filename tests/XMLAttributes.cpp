@@ -0,0 +1,187 @@
+/***********************************************************************
+ *    filename:   XMLAttributes.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/Exceptions.h"
+#include "CEGUI/System.h"
+#include "CEGUI/WindowManager.h"
+#include "CEGUI/Window.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <cstring>
+#include <vector>
+
+//! records the attributes of every element it is given.
+class AttributeRecorder : public CEGUI::XMLHandler
+{
+public:
+    const CEGUI::String& getDefaultResourceGroup() const
+    {
+        static const CEGUI::String group;
+        return group;
+    }
+
+    void elementStart(const CEGUI::String& /*element*/,
+                      const CEGUI::XMLAttributes& attributes)
+    {
+        d_attributes.push_back(attributes);
+    }
+
+    std::vector<CEGUI::XMLAttributes> d_attributes;
+};
+
+BOOST_AUTO_TEST_SUITE(XMLAttributes)
+
+BOOST_AUTO_TEST_CASE(Views)
+{
+    char name[] = "Colour";
+    char value[] = "FF00FF00";
+
+    CEGUI::XMLAttributes attrs;
+    attrs.addView(name, value);
+    attrs.addView("Width", "42");
+    attrs.addView("Scale", "0.5");
+    attrs.addView("Visible", "True");
+
+    // the value is not copied
+    BOOST_CHECK(attrs.getValueAsUTF8("Colour") == value);
+    BOOST_CHECK_EQUAL(attrs.getValueAsString("Colour"), "FF00FF00");
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Width"), 42);
+    BOOST_CHECK_EQUAL(attrs.getValueAsFloat("Scale"), 0.5f);
+    BOOST_CHECK_EQUAL(attrs.getValueAsBool("Visible"), true);
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Missing", 7), 7);
+    BOOST_CHECK_EQUAL(std::strcmp(attrs.getValueAsUTF8("Missing", "def"), "def"), 0);
+
+    // attributes are kept in the order they were added
+    BOOST_REQUIRE_EQUAL(attrs.getCount(), 4u);
+    BOOST_CHECK_EQUAL(attrs.getName(1), "Width");
+    BOOST_CHECK_EQUAL(attrs.getValue(3), "True");
+
+    // adding an existing attribute replaces it
+    attrs.add("Width", "17");
+    BOOST_CHECK_EQUAL(attrs.getCount(), 4u);
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Width"), 17);
+
+    // names of other lengths never match
+    BOOST_CHECK(!attrs.exists("Widt"));
+    BOOST_CHECK(!attrs.exists("Widths"));
+
+    attrs.remove("Colour");
+    BOOST_CHECK(!attrs.exists("Colour"));
+    BOOST_CHECK_EQUAL(attrs.getCount(), 3u);
+
+    attrs.clear();
+    BOOST_CHECK_EQUAL(attrs.getCount(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(NonASCIIText)
+{
+    // "Größe" and "Ünïcode" in UTF-8
+    const char name[] = "Gr\xc3\xb6\xc3\x9f" "e";
+    const char value[] = "\xc3\x9cn\xc3\xaf" "code";
+
+    CEGUI::XMLAttributes attrs;
+    attrs.addView(name, value);
+
+    const CEGUI::String str_name(reinterpret_cast<const CEGUI::encoded_char*>(name));
+    BOOST_CHECK(attrs.exists(str_name));
+    BOOST_CHECK(!attrs.exists("Grosse"));
+    BOOST_CHECK(!attrs.exists("Gr"));
+    BOOST_CHECK(!attrs.exists(str_name + "n"));
+    BOOST_CHECK_EQUAL(attrs.getValue(str_name),
+        CEGUI::String(reinterpret_cast<const CEGUI::encoded_char*>(value)));
+}
+
+BOOST_AUTO_TEST_CASE(CopiesOwnTheirText)
+{
+    char value[] = "100";
+
+    CEGUI::XMLAttributes attrs;
+    attrs.addView("Height", value);
+    const CEGUI::XMLAttributes copy(attrs);
+
+    value[0] = '2';
+    BOOST_CHECK_EQUAL(attrs.getValueAsInteger("Height"), 200);
+    BOOST_CHECK_EQUAL(copy.getValueAsInteger("Height"), 100);
+    BOOST_CHECK(copy.getValueAsUTF8("Height") != value);
+}
+
+BOOST_AUTO_TEST_CASE(ConversionErrors)
+{
+    CEGUI::XMLAttributes attrs;
+    attrs.addView("Bool", "yes");
+    attrs.addView("Int", "abc");
+    attrs.addView("Float", "");
+    attrs.addView("Big", "99999999999999999999");
+
+    BOOST_CHECK_THROW(attrs.getValueAsBool("Bool"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("Int"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsFloat("Float"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValueAsInteger("Big"), CEGUI::InvalidRequestException);
+    BOOST_CHECK_THROW(attrs.getValue("Missing"), CEGUI::UnknownObjectException);
+}
+
+BOOST_AUTO_TEST_CASE(ParserAttributes)
+{
+    AttributeRecorder recorder;
+    CEGUI::System::getSingleton().getXMLParser()->parseXMLString(recorder,
+        "<Root a=\"1\" b=\"two\"><Child c=\"3.5\" d=\"x &amp; y\"/></Root>", "");
+
+    BOOST_REQUIRE_EQUAL(recorder.d_attributes.size(), 2u);
+
+    const CEGUI::XMLAttributes& root = recorder.d_attributes[0];
+    BOOST_CHECK_EQUAL(root.getCount(), 2u);
+    BOOST_CHECK_EQUAL(root.getValueAsInteger("a"), 1);
+    BOOST_CHECK_EQUAL(root.getValueAsString("b"), "two");
+
+    const CEGUI::XMLAttributes& child = recorder.d_attributes[1];
+    BOOST_CHECK_EQUAL(child.getValueAsFloat("c"), 3.5f);
+    BOOST_CHECK_EQUAL(child.getValueAsString("d"), "x & y");
+    BOOST_CHECK(!child.exists("a"));
+}
+
+BOOST_AUTO_TEST_CASE(LayoutOptionalAttributes)
+{
+    // an unnamed window and a user string without a Value attribute
+    CEGUI::Window* root = CEGUI::WindowManager::getSingleton().loadLayoutFromString(
+        "<GUILayout version=\"4\"><Window type=\"DefaultWindow\">"
+        "<UserString name=\"Empty\"/>"
+        "<UserString name=\"Full\" value=\"text\"/>"
+        "</Window></GUILayout>");
+
+    BOOST_CHECK_EQUAL(root->getName().substr(0, 2), "__");
+    BOOST_CHECK(root->isUserStringDefined("Empty"));
+    BOOST_CHECK_EQUAL(root->getUserString("Empty"), "");
+    BOOST_CHECK_EQUAL(root->getUserString("Full"), "text");
+
+    CEGUI::WindowManager::getSingleton().destroyWindow(root);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
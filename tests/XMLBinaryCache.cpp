@@ -0,0 +1,322 @@
+/***********************************************************************
+ *    filename:   XMLBinaryCache.cpp
+ *    created:    17/10/2026
+ *    author:     The CEGUI Development Team
+ *************************************************************************/
+/***************************************************************************
+ *   Copyright (C) 2004 - 2026 Paul D Turner & The CEGUI Development Team
+ *
+ *   Permission is hereby granted, free of charge, to any person obtaining
+ *   a copy of this software and associated documentation files (the
+ *   "Software"), to deal in the Software without restriction, including
+ *   without limitation the rights to use, copy, modify, merge, publish,
+ *   distribute, sublicense, and/or sell copies of the Software, and to
+ *   permit persons to whom the Software is furnished to do so, subject to
+ *   the following conditions:
+ *
+ *   The above copyright notice and this permission notice shall be
+ *   included in all copies or substantial portions of the Software.
+ *
+ *   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ *   EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ *   MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ *   IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ *   OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ *   ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ *   OTHER DEALINGS IN THE SOFTWARE.
+ ***************************************************************************/
+#include "CEGUI/XMLBinaryCache.h"
+#include "CEGUI/XMLAttributes.h"
+#include "CEGUI/XMLHandler.h"
+#include "CEGUI/XMLParser.h"
+#include "CEGUI/DataContainer.h"
+#include "CEGUI/ResourceProvider.h"
+#include "CEGUI/System.h"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/timer.hpp>
+
+#include <stdio.h>
+#include <vector>
+
+//! records every event it receives as a string.
+class EventLog : public CEGUI::XMLHandler
+{
+public:
+    const CEGUI::String& getDefaultResourceGroup() const
+    {
+        static const CEGUI::String group;
+        return group;
+    }
+
+    void elementStart(const CEGUI::String& element,
+                      const CEGUI::XMLAttributes& attributes)
+    {
+        d_events.push_back("<" + element);
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+            d_events.push_back(attributes.getName(i) + "=" +
+                               attributes.getValue(i));
+    }
+
+    void elementEnd(const CEGUI::String& element)
+    {
+        d_events.push_back(">" + element);
+    }
+
+    void text(const CEGUI::String& text)
+    {
+        d_events.push_back("#" + text);
+    }
+
+    std::vector<CEGUI::String> d_events;
+};
+
+//! touches every attribute value, as a typical handler would.
+class NullHandler : public CEGUI::XMLHandler
+{
+public:
+    NullHandler() : d_elements(0) {}
+
+    const CEGUI::String& getDefaultResourceGroup() const
+    {
+        static const CEGUI::String group;
+        return group;
+    }
+
+    void elementStart(const CEGUI::String& /*element*/,
+                      const CEGUI::XMLAttributes& attributes)
+    {
+        ++d_elements;
+        for (size_t i = 0; i < attributes.getCount(); ++i)
+            attributes.getValue(i);
+    }
+
+    size_t d_elements;
+};
+
+struct DataFile
+{
+    const char* pattern;
+    const char* group;
+};
+
+static const DataFile DATA_FILES[] =
+{
+    { "*.looknfeel", "looknfeels" },
+    { "*.imageset", "imagesets" },
+    { "*.scheme", "schemes" },
+    { "*.font", "fonts" }
+};
+
+struct XMLBinaryCacheFixture
+{
+    XMLBinaryCacheFixture() :
+        d_parser(CEGUI::System::getSingleton().getXMLParser()),
+        d_provider(CEGUI::System::getSingleton().getResourceProvider())
+    {}
+
+    void load(const CEGUI::String& filename, const CEGUI::String& group,
+              CEGUI::RawDataContainer& data)
+    {
+        d_provider->loadRawDataContainer(filename, data, group);
+    }
+
+    void removeCache(const CEGUI::RawDataContainer& data)
+    {
+        remove(CEGUI::XMLBinaryCache::getCacheFilename(".", data).c_str());
+    }
+
+    CEGUI::XMLParser* d_parser;
+    CEGUI::ResourceProvider* d_provider;
+};
+
+BOOST_FIXTURE_TEST_SUITE(XMLBinaryCache, XMLBinaryCacheFixture)
+
+BOOST_AUTO_TEST_CASE(ReplayMatchesParse)
+{
+    for (size_t f = 0; f < sizeof(DATA_FILES) / sizeof(DATA_FILES[0]); ++f)
+    {
+        std::vector<CEGUI::String> names;
+        d_provider->getResourceGroupFileNames(names, DATA_FILES[f].pattern,
+                                              DATA_FILES[f].group);
+        BOOST_REQUIRE(!names.empty());
+
+        CEGUI::RawDataContainer data;
+        load(names[0], DATA_FILES[f].group, data);
+        removeCache(data);
+
+        EventLog parsed;
+        d_parser->parseXML(parsed, data, "");
+
+        // no cache file yet
+        EventLog replayed;
+        BOOST_CHECK(!CEGUI::XMLBinaryCache::replay(replayed, ".", data));
+        BOOST_CHECK(replayed.d_events.empty());
+
+        EventLog stored;
+        CEGUI::XMLBinaryCache::parseAndStore(*d_parser, stored, ".", data, "");
+        BOOST_CHECK(stored.d_events == parsed.d_events);
+
+        BOOST_REQUIRE(CEGUI::XMLBinaryCache::replay(replayed, ".", data));
+        BOOST_CHECK_EQUAL(replayed.d_events.size(), parsed.d_events.size());
+        BOOST_CHECK(replayed.d_events == parsed.d_events);
+
+        removeCache(data);
+        d_provider->unloadRawDataContainer(data);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(StaleAndDamagedCaches)
+{
+    CEGUI::RawDataContainer data;
+    load("TaharezLook.imageset", "imagesets", data);
+
+    NullHandler handler;
+    CEGUI::XMLBinaryCache::parseAndStore(*d_parser, handler, ".", data, "");
+    BOOST_REQUIRE(CEGUI::XMLBinaryCache::replay(handler, ".", data));
+
+    // changed content misses the cache
+    std::vector<CEGUI::uint8> changed(data.getDataPtr(),
+                                      data.getDataPtr() + data.getSize());
+    changed.push_back('\n');
+    CEGUI::RawDataContainer changed_data;
+    changed_data.setData(&changed[0]);
+    changed_data.setSize(changed.size());
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replay(handler, ".", changed_data));
+    changed_data.setData(0);
+    changed_data.setSize(0);
+
+    // a truncated file is rejected without calling the handler
+    const CEGUI::String filename(
+        CEGUI::XMLBinaryCache::getCacheFilename(".", data));
+    FILE* file = fopen(filename.c_str(), "r+b");
+    BOOST_REQUIRE(file);
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::vector<char> contents(size);
+    BOOST_REQUIRE_EQUAL(fread(&contents[0], 1, size, file), size_t(size));
+    fclose(file);
+
+    file = fopen(filename.c_str(), "wb");
+    fwrite(&contents[0], 1, size / 2, file);
+    fclose(file);
+
+    NullHandler damaged;
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replay(damaged, ".", data));
+    BOOST_CHECK_EQUAL(damaged.d_elements, 0u);
+
+    removeCache(data);
+    d_provider->unloadRawDataContainer(data);
+}
+
+BOOST_AUTO_TEST_CASE(ParseXMLFileUsesCache)
+{
+    CEGUI::RawDataContainer data;
+    load("TaharezLook.scheme", "schemes", data);
+    removeCache(data);
+
+    // the default provider reports the file status, so the cache is keyed on it
+    CEGUI::uint64 size;
+    CEGUI::uint64 modified_time;
+    BOOST_REQUIRE(d_provider->getFileStatus("TaharezLook.scheme", "schemes",
+                                            size, modified_time));
+    BOOST_CHECK_EQUAL(size, data.getSize());
+    const CEGUI::uint64 key = CEGUI::XMLBinaryCache::computeFileKey(
+        "TaharezLook.scheme", "schemes", size, modified_time);
+    const CEGUI::String filename(
+        CEGUI::XMLBinaryCache::getCacheFilename(".", key));
+    remove(filename.c_str());
+
+    d_parser->setBinaryCacheDirectory(".");
+
+    EventLog first;
+    d_parser->parseXMLFile(first, "TaharezLook.scheme", "", "schemes");
+    FILE* file = fopen(filename.c_str(), "rb");
+    BOOST_CHECK(file);
+    if (file)
+        fclose(file);
+
+    // no content hashed cache file is written
+    file = fopen(
+        CEGUI::XMLBinaryCache::getCacheFilename(".", data).c_str(), "rb");
+    BOOST_CHECK(!file);
+    if (file)
+        fclose(file);
+
+    EventLog second;
+    d_parser->parseXMLFile(second, "TaharezLook.scheme", "", "schemes");
+    BOOST_CHECK(first.d_events == second.d_events);
+
+    EventLog replayed;
+    BOOST_CHECK(CEGUI::XMLBinaryCache::replay(replayed, ".", key, size));
+    BOOST_CHECK(replayed.d_events == first.d_events);
+
+    // a changed modification time or size misses the cache
+    NullHandler handler;
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replay(handler, ".",
+        CEGUI::XMLBinaryCache::computeFileKey("TaharezLook.scheme", "schemes",
+                                              size, modified_time + 1), size));
+    BOOST_CHECK(!CEGUI::XMLBinaryCache::replay(handler, ".", key, size + 1));
+    BOOST_CHECK_EQUAL(handler.d_elements, 0u);
+
+    d_parser->setBinaryCacheDirectory("");
+    remove(filename.c_str());
+    d_provider->unloadRawDataContainer(data);
+}
+
+BOOST_AUTO_TEST_CASE(ColdStartBenchmark)
+{
+    // all bundled looknfeel, imageset, scheme and font files
+    std::vector<CEGUI::RawDataContainer*> files;
+    size_t total_size = 0;
+    for (size_t f = 0; f < sizeof(DATA_FILES) / sizeof(DATA_FILES[0]); ++f)
+    {
+        std::vector<CEGUI::String> names;
+        d_provider->getResourceGroupFileNames(names, DATA_FILES[f].pattern,
+                                              DATA_FILES[f].group);
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            files.push_back(new CEGUI::RawDataContainer);
+            load(names[i], DATA_FILES[f].group, *files.back());
+            total_size += files.back()->getSize();
+
+            NullHandler handler;
+            CEGUI::XMLBinaryCache::parseAndStore(*d_parser, handler, ".",
+                                                 *files.back(), "");
+        }
+    }
+
+    const int runs = 5;
+
+    NullHandler xml_handler;
+    boost::timer xml_timer;
+    for (int run = 0; run < runs; ++run)
+        for (size_t i = 0; i < files.size(); ++i)
+            d_parser->parseXML(xml_handler, *files[i], "");
+    const double xml_elapsed = xml_timer.elapsed() / runs;
+
+    NullHandler cache_handler;
+    boost::timer cache_timer;
+    for (int run = 0; run < runs; ++run)
+        for (size_t i = 0; i < files.size(); ++i)
+            BOOST_REQUIRE(CEGUI::XMLBinaryCache::replay(cache_handler, ".",
+                                                        *files[i]));
+    const double cache_elapsed = cache_timer.elapsed() / runs;
+
+    BOOST_CHECK_EQUAL(xml_handler.d_elements, cache_handler.d_elements);
+
+    BOOST_TEST_MESSAGE("Loading " << files.size() << " files (" << total_size
+                       << " bytes, " << xml_handler.d_elements / runs
+                       << " elements): XML " << xml_elapsed << "s, binary cache "
+                       << cache_elapsed << "s");
+
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        removeCache(*files[i]);
+        d_provider->unloadRawDataContainer(*files[i]);
+        delete files[i];
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()